@@ -7,6 +7,7 @@
 
 import stl;
 import hnsw_alg;
+import hnsw_common;
 import local_file_system;
 import file_system_type;
 import file_system;
@@ -32,6 +33,7 @@ int main() {
     size_t embedding_count = 1000000;
     size_t test_top = 100;
     const int thread_n = 1;
+    const int build_thread_n = std::thread::hardware_concurrency();
 
     using LabelT = uint64_t;
 
@@ -67,6 +69,7 @@ int main() {
 
         infinity::BaseProfiler profiler;
         std::cout << "Begin memory cost: " << get_current_rss() << "B" << std::endl;
+        std::cout << "build thread number: " << build_thread_n << std::endl;
         profiler.Begin();
 
         if (false) {
@@ -81,7 +84,7 @@ int main() {
         } else {
             auto labels = std::make_unique<LabelT[]>(embedding_count);
             std::iota(labels.get(), labels.get() + embedding_count, 0);
-            knn_hnsw->Insert(input_embeddings, labels.get(), embedding_count);
+            knn_hnsw->Insert(input_embeddings, labels.get(), embedding_count, build_thread_n);
         }
 
         profiler.End();
@@ -135,7 +138,7 @@ int main() {
     results.reserve(number_of_queries);
     std::cout << "thread number: " << thread_n << std::endl;
     for (int ef = 100; ef <= 300; ef += 25) {
-        knn_hnsw->SetEf(ef);
+        HnswSearchParams search_params{.ef_ = SizeT(ef)};
         int correct = 0;
         int sum_time = 0;
         for (int i = 0; i < round; ++i) {
@@ -150,7 +153,7 @@ int main() {
                             break;
                         }
                         const float *query = queries + cur_idx * dimension;
-                        MaxHeap<Pair<float, LabelT>> result = knn_hnsw->KnnSearch(query, test_top);
+                        MaxHeap<Pair<float, LabelT>> result = knn_hnsw->KnnSearch(query, test_top, search_params);
                         results[cur_idx] = std::move(result);
                     }
                 });
@@ -51,7 +51,7 @@ class InfinityThriftQueryBuilder(ABC):
         self._offset = None
 
     def knn(self, vector_column_name: str, embedding_data: VEC, embedding_data_type: str, distance_type: str,
-            topn: int) -> InfinityThriftQueryBuilder:
+            topn: int, knn_params: dict = None) -> InfinityThriftQueryBuilder:
         if self._search is None:
             self._search = SearchExpr()
         if self._search.knn_exprs is None:
@@ -98,8 +98,13 @@ class InfinityThriftQueryBuilder(ABC):
             dist_type = KnnDistanceType.InnerProduct
         elif distance_type == 'hamming':
             dist_type = KnnDistanceType.Hamming
+        # e.g. {"ef": "100"}, or {"radius": "0.5"} for all the rows within the distance instead of the top n
+        opt_params = []
+        if knn_params is not None:
+            for k, v in knn_params.items():
+                opt_params.append(ttypes.InitParameter(param_name=k, param_value=str(v)))
         knn_expr = KnnExpr(column_expr=column_expr, embedding_data=data, embedding_data_type=elem_type,
-                           distance_type=dist_type, topn=topn)
+                           distance_type=dist_type, topn=topn, opt_params=opt_params)
         # print(knn_expr)
         self._search.knn_exprs.append(knn_expr)
         return self
@@ -198,8 +198,8 @@ class RemoteTable(Table, ABC):
                                  update_expr_array=update_expr_array)
 
     def knn(self, vector_column_name: str, embedding_data: VEC, embedding_data_type: str, distance_type: str,
-            topn: int):
-        self.query_builder.knn(vector_column_name, embedding_data, embedding_data_type, distance_type, topn)
+            topn: int, knn_params: dict = None):
+        self.query_builder.knn(vector_column_name, embedding_data, embedding_data_type, distance_type, topn, knn_params)
 
         return self
 
@@ -100,6 +100,32 @@ export {
     constexpr SizeT HNSW_M = 16;
     constexpr SizeT HNSW_EF_CONSTRUCTION = 200;
     constexpr SizeT HNSW_EF = 200;
+    // a batch search of hnsw uses one more thread for every this number of queries
+    constexpr SizeT HNSW_BATCH_SEARCH_QUERY_PER_THREAD = 64;
+
+    // default ivf parameter
+    constexpr SizeT IVF_NPROBE = 1;
+    // the centroids of a segment are trained on at most this many sampled rows per centroid
+    constexpr u32 IVF_TRAIN_POINTS_PER_CENTROID = 256;
+    // the centroids of an appended segment are trained once it has at least this many rows per centroid
+    constexpr SizeT IVF_MIN_POINTS_PER_CENTROID = 39;
+
+    // default diskann parameter
+    constexpr SizeT DISKANN_R = 64;
+    constexpr SizeT DISKANN_L = 100;
+    constexpr SizeT DISKANN_BEAM_WIDTH = 4;
+    // the vectors and the neighbors of diskann are read from the disk in sectors of this size
+    constexpr SizeT DISKANN_SECTOR_SIZE = 4096;
+    // the graph of a segment is built again once the rows appended since the last build exceed this ratio of the rows in it
+    constexpr double DISKANN_REBUILD_APPENDED_RATIO = 0.2;
+
+    // repair the vector index of a segment when the rows deleted since the last repair exceed this ratio of the segment rows
+    constexpr double VECTOR_INDEX_REPAIR_DELETED_RATIO = 0.2;
+
+    // a segment with a vector index is searched exactly if fewer than this ratio of its rows pass the filter
+    constexpr double KNN_FILTER_BRUTE_FORCE_RATIO = 0.02;
+    // hnsw passes through the filtered out vertices to their neighbors if fewer than this ratio of the rows pass the filter
+    constexpr double KNN_FILTER_EXPAND_RATIO = 0.5;
 
     // default distance compute blas parameter
     constexpr SizeT DISTANCE_COMPUTE_BLAS_QUERY_BS = 4096;
@@ -4,23 +4,26 @@ module;
 
 import stl;
 import buffer_obj;
+import hnsw_mem_pool;
 
 module specific_concurrent_queue;
 
 namespace infinity {
 
+using FloatLinearPool = LinearPool<float, i32>;
+
 template <>
-void SpecificConcurrentQueue<FloatDistHeap>::Enqueue(const FloatDistHeap &item) {
+void SpecificConcurrentQueue<FloatLinearPool>::Enqueue(const FloatLinearPool &item) {
     queue_.enqueue(item);
 }
 
 template <>
-void SpecificConcurrentQueue<FloatDistHeap>::Enqueue(FloatDistHeap &&item) {
+void SpecificConcurrentQueue<FloatLinearPool>::Enqueue(FloatLinearPool &&item) {
     queue_.enqueue(Move(item));
 }
 
 template <>
-bool SpecificConcurrentQueue<FloatDistHeap>::TryDequeue(FloatDistHeap &item) {
+bool SpecificConcurrentQueue<FloatLinearPool>::TryDequeue(FloatLinearPool &item) {
     return queue_.try_dequeue(item);
 }
 
@@ -40,17 +43,17 @@ bool SpecificConcurrentQueue<BufferObj *>::TryDequeue(BufferObj *&item) {
 }
 
 template <>
-void SpecificConcurrentQueue<Vector<bool>>::Enqueue(const Vector<bool> &item) {
+void SpecificConcurrentQueue<VisitedTable>::Enqueue(const VisitedTable &item) {
     queue_.enqueue(item);
 }
 
 template <>
-void SpecificConcurrentQueue<Vector<bool>>::Enqueue(Vector<bool> &&item) {
+void SpecificConcurrentQueue<VisitedTable>::Enqueue(VisitedTable &&item) {
     queue_.enqueue(Move(item));
 }
 
 template <>
-bool SpecificConcurrentQueue<Vector<bool>>::TryDequeue(Vector<bool> &item) {
+bool SpecificConcurrentQueue<VisitedTable>::TryDequeue(VisitedTable &item) {
     return queue_.try_dequeue(item);
 }
 } // namespace infinitye
\ No newline at end of file
@@ -20,11 +20,6 @@ public:
     bool TryDequeue(T &item);
 };
 
-using PFV = Pair<float, i32>;
-using CMP = CompareByFirst<float, i32>;
-using FloatDistHeap = Heap<PFV, CMP>;
-template class SpecificConcurrentQueue<FloatDistHeap>;
-
 template class SpecificConcurrentQueue<BufferObj *>;
 
 template class SpecificConcurrentQueue<Vector<bool>>;
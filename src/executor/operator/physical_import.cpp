@@ -53,6 +53,7 @@ import infinity_exception;
 import table_collection_entry;
 import segment_entry;
 import zsv;
+import hnsw_simd_func;
 
 module physical_import;
 
@@ -101,7 +102,8 @@ void PhysicalImport::ImportFVECS(QueryContext *query_context, ImportOperatorStat
         Error<ExecutorException>("FVECS file must have only one embedding column.");
     }
     auto embedding_info = static_cast<EmbeddingInfo *>(column_type->type_info().get());
-    if (embedding_info->Type() != kElemFloat) {
+    EmbeddingDataType elem_type = embedding_info->Type();
+    if (elem_type != kElemFloat && elem_type != kElemFloat16 && elem_type != kElemBFloat16) {
         Error<ExecutorException>("FVECS file must have only one embedding column with float element.");
     }
 
@@ -125,6 +127,26 @@ void PhysicalImport::ImportFVECS(QueryContext *query_context, ImportOperatorStat
         Error<ExecutorException>("Weird file size.");
     }
     SizeT vector_n = file_size / row_size;
+    // the float vectors are narrowed when the column is of half precision
+    SizeT elem_width = EmbeddingT::EmbeddingDataWidth(elem_type);
+    auto float_buffer = MakeUniqueForOverwrite<FloatT[]>(dimension);
+    auto ReadVector = [&](ptr_t dst_ptr) {
+        switch (elem_type) {
+            case kElemFloat16: {
+                fs.Read(*file_handler, float_buffer.get(), sizeof(FloatT) * dimension);
+                F32ToHalf(float_buffer.get(), reinterpret_cast<float16_t *>(dst_ptr), dimension);
+                break;
+            }
+            case kElemBFloat16: {
+                fs.Read(*file_handler, float_buffer.get(), sizeof(FloatT) * dimension);
+                F32ToHalf(float_buffer.get(), reinterpret_cast<bfloat16_t *>(dst_ptr), dimension);
+                break;
+            }
+            default: {
+                fs.Read(*file_handler, dst_ptr, sizeof(FloatT) * dimension);
+            }
+        }
+    };
 
     Txn *txn = query_context->GetTxn();
     TxnTableStore *txn_store = txn->GetTxnTableStore(table_collection_entry_);
@@ -142,8 +164,8 @@ void PhysicalImport::ImportFVECS(QueryContext *query_context, ImportOperatorStat
         if (dim != dimension or nbytes != sizeof(dimension)) {
             Error<ExecutorException>(Format("Dimension in file ({}) doesn't match with table definition ({}).", dim, dimension));
         }
-        ptr_t dst_ptr = buf_ptr + last_block_entry->row_count_ * sizeof(FloatT) * dimension;
-        fs.Read(*file_handler, dst_ptr, sizeof(FloatT) * dimension);
+        ptr_t dst_ptr = buf_ptr + last_block_entry->row_count_ * elem_width * dimension;
+        ReadVector(dst_ptr);
         ++segment_entry->row_count_;
         ++last_block_entry->row_count_;
 
@@ -358,12 +380,29 @@ void AppendEmbeddingData(BlockColumnEntry *column_data_entry, const Vector<Strin
     SizeT arr_len = ele_str_views.size();
     auto tmp_buffer = MakeUnique<T[]>(arr_len);
     for (SizeT ele_idx = 0; auto &ele_str_view : ele_str_views) {
-        T ele = DataType::StringToValue<T>(ele_str_view);
-        tmp_buffer[ele_idx++] = ele;
+        if constexpr (IsSame<T, float16_t>() || IsSame<T, bfloat16_t>()) {
+            // half precision values are parsed as float
+            tmp_buffer[ele_idx++] = T(DataType::StringToValue<FloatT>(ele_str_view));
+        } else {
+            T ele = DataType::StringToValue<T>(ele_str_view);
+            tmp_buffer[ele_idx++] = ele;
+        }
     }
     BlockColumnEntry::AppendRaw(column_data_entry, dst_offset, reinterpret_cast<ptr_t>(tmp_buffer.get()), sizeof(T) * arr_len, nullptr);
 }
 
+// the elements of a bit embedding are 0 or 1, packed 8 in a byte with the first one in the most significant bit
+void AppendBitEmbeddingData(BlockColumnEntry *column_data_entry, const Vector<i8> &bits, SizeT dst_offset, SizeT dim) {
+    Vector<u8> packed(EmbeddingT::EmbeddingSize(kElemBit, dim));
+    for (SizeT i = 0; i < bits.size(); ++i) {
+        if (bits[i] != 0 && bits[i] != 1) {
+            Error<ExecutorException>("Bit embedding element should be 0 or 1.");
+        }
+        packed[i / 8] |= u8(bits[i]) << (7 - i % 8);
+    }
+    BlockColumnEntry::AppendRaw(column_data_entry, dst_offset, reinterpret_cast<ptr_t>(packed.data()), packed.size(), nullptr);
+}
+
 void AppendVarcharData(BlockColumnEntry *column_data_entry, const StringView &str_view, SizeT dst_offset) {
     auto varchar_ptr = MakeUnique<VarcharT>();
     varchar_ptr->InitAsValue(str_view.data(), str_view.size());
@@ -428,7 +467,13 @@ void PhysicalImport::CSVRowHandler(void *context) {
 
             switch (embedding_info->Type()) {
                 case kElemBit: {
-                    Error<ExecutorException>("Embedding bit type is not implemented.");
+                    Vector<i8> bits;
+                    bits.reserve(ele_str_views.size());
+                    for (const auto &ele_str_view : ele_str_views) {
+                        bits.push_back(DataType::StringToValue<TinyIntT>(ele_str_view));
+                    }
+                    AppendBitEmbeddingData(block_column_entry, bits, dst_offset, embedding_info->Dimension());
+                    break;
                 }
                 case kElemInt8: {
                     AppendEmbeddingData<TinyIntT>(block_column_entry, ele_str_views, dst_offset);
@@ -454,6 +499,14 @@ void PhysicalImport::CSVRowHandler(void *context) {
                     AppendEmbeddingData<DoubleT>(block_column_entry, ele_str_views, dst_offset);
                     break;
                 }
+                case kElemFloat16: {
+                    AppendEmbeddingData<float16_t>(block_column_entry, ele_str_views, dst_offset);
+                    break;
+                }
+                case kElemBFloat16: {
+                    AppendEmbeddingData<bfloat16_t>(block_column_entry, ele_str_views, dst_offset);
+                    break;
+                }
                 case kElemInvalid: {
                     Error<ExecutorException>("Embedding element type is invalid.");
                 }
@@ -515,6 +568,12 @@ void AppendEmbeddingJsonl(BlockColumnEntry *block_column_entry, const Vector<T>
                                 nullptr);
 }
 
+template <typename T>
+void AppendHalfEmbeddingJsonl(BlockColumnEntry *block_column_entry, const Vector<f32> &embedding, SizeT dst_offset, SizeT dim) {
+    Vector<T> half_embedding(embedding.begin(), embedding.end());
+    AppendEmbeddingJsonl<T>(block_column_entry, half_embedding, dst_offset, dim);
+}
+
 void PhysicalImport::JSONLRowHandler(const Json &line_json, BlockEntry *block_entry) {
     SizeT column_n = table_collection_entry_->columns_.size();
     SizeT row_cnt = block_entry->row_count_;
@@ -533,6 +592,14 @@ void PhysicalImport::JSONLRowHandler(const Json &line_json, BlockEntry *block_en
                 auto embedding_info = static_cast<EmbeddingInfo *>(column_type->type_info().get());
                 SizeT dim = embedding_info->Dimension();
                 switch (embedding_info->Type()) {
+                    case kElemBit: {
+                        Vector<i8> bits = line_json[column_def->name_];
+                        if (bits.size() != dim) {
+                            Error<ExecutorException>("Embedding data size neq dimension.");
+                        }
+                        AppendBitEmbeddingData(block_column_entry, bits, dst_offset, dim);
+                        break;
+                    }
                     case kElemInt8: {
                         AppendEmbeddingJsonl<i8>(block_column_entry, line_json[column_def->name_], dst_offset, dim);
                         break;
@@ -557,6 +624,14 @@ void PhysicalImport::JSONLRowHandler(const Json &line_json, BlockEntry *block_en
                         AppendEmbeddingJsonl<double>(block_column_entry, line_json[column_def->name_], dst_offset, dim);
                         break;
                     }
+                    case kElemFloat16: {
+                        AppendHalfEmbeddingJsonl<float16_t>(block_column_entry, line_json[column_def->name_], dst_offset, dim);
+                        break;
+                    }
+                    case kElemBFloat16: {
+                        AppendHalfEmbeddingJsonl<bfloat16_t>(block_column_entry, line_json[column_def->name_], dst_offset, dim);
+                        break;
+                    }
                     default: {
                         Error<NotImplementException>("Embedding type not implemented.");
                     }
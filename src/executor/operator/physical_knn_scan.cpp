@@ -15,6 +15,8 @@
 module;
 
 #include <algorithm>
+#include <charconv>
+#include <numeric>
 #include <string>
 import stl;
 import query_context;
@@ -48,6 +50,11 @@ import knn_result_handler;
 import index_def;
 import ann_ivf_flat;
 import annivfflat_index_data;
+import ann_ivf_pq;
+import annivfpq_index_data;
+import ann_ivf_sq8;
+import annivfsq8_index_data;
+import diskann_index;
 import buffer_handle;
 import table_index_meta;
 import segment_column_index_entry;
@@ -62,31 +69,50 @@ import expression_state;
 import index_hnsw;
 
 import hnsw_alg;
-import plain_store;
-import lvq_store;
-import dist_func_l2;
-import dist_func_ip;
+import hnsw_dispatch;
 import knn_expression;
 import value;
+import hnsw_common;
+import infinity_context;
+import config;
+import resource_manager;
 
 module physical_knn_scan;
 
 namespace infinity {
 
+// the value of a search option, which must be an integer in [min_value, max_value]
+u64 ParseSearchOption(const InitParameter &opt_param, u64 min_value, u64 max_value) {
+    const String &str = opt_param.param_value_;
+    u64 value = 0;
+    auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), value);
+    if (ec != std::errc() || ptr != str.data() + str.size() || value < min_value || value > max_value) {
+        Error<ExecutorException>(
+            Format("Invalid knn search option {}={}, expect an integer in [{}, {}]", opt_param.param_name_, str, min_value, max_value));
+    }
+    return value;
+}
+
+// read the columns `output_column_idx` of the block into `output`, where the output column i is the table column `column_ids[i]`.
+// the other columns of `output` are left untouched.
 void ReadDataBlock(DataBlock *output,
                    BufferManager *buffer_mgr,
                    const auto row_count,
                    const BlockEntry *current_block_entry,
-                   const Vector<SizeT> &column_ids) {
+                   const Vector<SizeT> &column_ids,
+                   const Vector<SizeT> &output_column_idx) {
     auto block_id = current_block_entry->block_id_;
     auto segment_id = current_block_entry->segment_entry_->segment_id_;
-    for (SizeT output_column_id = 0; auto column_id : column_ids) {
-        if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+    for (SizeT output_column_id : output_column_idx) {
+        auto &column_vector = output->column_vectors[output_column_id];
+        column_vector->Reset();
+        column_vector->Initialize(ColumnVectorType::kFlat, row_count);
+        if (SizeT column_id = column_ids[output_column_id]; column_id == COLUMN_IDENTIFIER_ROW_ID) {
             u32 segment_offset = block_id * DEFAULT_BLOCK_CAPACITY;
-            output->column_vectors[output_column_id++]->AppendWith(RowID(segment_id, segment_offset), row_count);
+            column_vector->AppendWith(RowID(segment_id, segment_offset), row_count);
         } else {
             ColumnBuffer column_buffer = BlockColumnEntry::GetColumnData(current_block_entry->columns_[column_id].get(), buffer_mgr);
-            output->column_vectors[output_column_id++]->AppendWith(column_buffer, 0, row_count);
+            column_vector->AppendWith(column_buffer, 0, row_count);
         }
     }
     output->Finalize();
@@ -152,8 +178,7 @@ bool PhysicalKnnScan::Execute(QueryContext *query_context, OperatorState *operat
     switch (elem_type) {
         case kElemFloat: {
             switch (dist_type) {
-                case KnnDistanceType::kL2:
-                case KnnDistanceType::kHamming: {
+                case KnnDistanceType::kL2: {
                     ExecuteInternal<f32, CompareMax>(query_context, knn_scan_operator_state);
                     break;
                 }
@@ -168,6 +193,31 @@ bool PhysicalKnnScan::Execute(QueryContext *query_context, OperatorState *operat
             }
             break;
         }
+        case kElemInt8: {
+            // the query is int8, the distance is accumulated in i32 and compared in f32
+            switch (dist_type) {
+                case KnnDistanceType::kL2: {
+                    ExecuteInternal<f32, CompareMax>(query_context, knn_scan_operator_state);
+                    break;
+                }
+                case KnnDistanceType::kInnerProduct: {
+                    ExecuteInternal<f32, CompareMin>(query_context, knn_scan_operator_state);
+                    break;
+                }
+                default: {
+                    Error<ExecutorException>("Int8 embedding query only supports l2 and inner product distance");
+                }
+            }
+            break;
+        }
+        case kElemBit: {
+            // the query is packed bits, the distance is the f32 number of different bits
+            if (dist_type != KnnDistanceType::kHamming) {
+                Error<ExecutorException>("Bit embedding query only supports hamming distance");
+            }
+            ExecuteInternal<f32, CompareMax>(query_context, knn_scan_operator_state);
+            break;
+        }
         default: {
             Error<ExecutorException>("Not implemented");
         }
@@ -213,6 +263,8 @@ void PhysicalKnnScan::PlanWithIndex(QueryContext *query_context) { // TODO: retu
 
         // Fill the segment with index
         ColumnIndexEntry *column_index_entry = table_index_entry->column_index_map_[knn_column_id].get();
+        // indexes of new segments are added when rows are committed
+        SharedLock<RWMutex> r_locker(column_index_entry->rw_locker_);
         index_entry_map.reserve(column_index_entry->index_by_segment.size());
         for (auto &[segment_id, segment_column_index] : column_index_entry->index_by_segment) {
             index_entry_map[segment_id].emplace_back(segment_column_index.get());
@@ -245,8 +297,59 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
     auto merge_heap = static_cast<MergeKnn<DataType, C> *>(knn_scan_function_data->merge_knn_base_.get());
     auto query = static_cast<const DataType *>(knn_scan_shared_data->query_embedding_);
 
+    TxnTimeStamp begin_ts = query_context->GetTxn()->BeginTS();
     SizeT index_task_n = knn_scan_shared_data->index_entries_->size();
     SizeT brute_task_n = knn_scan_shared_data->block_column_entries_->size();
+    // int8 and bit columns are searched with queries of the same element type, the others with f32 queries
+    auto column_type = knn_expression_->arguments()[0]->Type();
+    auto column_elem_type = static_cast<EmbeddingInfo *>(column_type.type_info().get())->Type();
+    auto IsExact = [](EmbeddingDataType elem_type) { return elem_type == kElemInt8 || elem_type == kElemBit; };
+    if ((IsExact(column_elem_type) || IsExact(knn_scan_shared_data->elem_type_)) && column_elem_type != knn_scan_shared_data->elem_type_) {
+        Error<ExecutorException>(Format("Query of {} embedding doesn't match column of {} embedding",
+                                        EmbeddingT::EmbeddingDataType2String(knn_scan_shared_data->elem_type_),
+                                        EmbeddingT::EmbeddingDataType2String(column_elem_type)));
+    }
+    // call `search` with the queries, the vectors of a block column, the dimension and the distance of the column element type.
+    // the query is f32 for a column of half precision.
+    auto SearchColumn = [&](const ColumnBuffer &column_buffer, auto &&search) {
+        switch (column_elem_type) {
+            case kElemFloat16: {
+                search(query,
+                       reinterpret_cast<const float16_t *>(column_buffer.GetAll()),
+                       knn_scan_shared_data->dimension_,
+                       dist_func->f16_dist_func_);
+                break;
+            }
+            case kElemBFloat16: {
+                search(query,
+                       reinterpret_cast<const bfloat16_t *>(column_buffer.GetAll()),
+                       knn_scan_shared_data->dimension_,
+                       dist_func->bf16_dist_func_);
+                break;
+            }
+            case kElemInt8: {
+                search(static_cast<const i8 *>(knn_scan_shared_data->query_embedding_),
+                       reinterpret_cast<const i8 *>(column_buffer.GetAll()),
+                       knn_scan_shared_data->dimension_,
+                       dist_func->i8_dist_func_);
+                break;
+            }
+            case kElemBit: {
+                // the query and the vectors are compared byte by byte
+                search(static_cast<const u8 *>(knn_scan_shared_data->query_embedding_),
+                       reinterpret_cast<const u8 *>(column_buffer.GetAll()),
+                       EmbeddingT::EmbeddingSize(kElemBit, knn_scan_shared_data->dimension_),
+                       dist_func->bit_dist_func_);
+                break;
+            }
+            default: {
+                search(query,
+                       reinterpret_cast<const DataType *>(column_buffer.GetAll()),
+                       knn_scan_shared_data->dimension_,
+                       dist_func->dist_func_);
+            }
+        }
+    };
 
     if (u64 block_column_idx = knn_scan_shared_data->current_block_idx_++; block_column_idx < brute_task_n) {
         LOG_TRACE(Format("KnnScan: {} brute force {}/{}", knn_scan_function_data->task_id_, block_column_idx + 1, brute_task_n));
@@ -263,8 +366,12 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
             auto &filter_state_ = knn_scan_function_data->filter_state_;
             auto &bool_column = knn_scan_function_data->bool_column_;
             // filter and build bitmask, if filter_expression_ != nullptr
-            db_for_filter->Reset(row_count);
-            ReadDataBlock(db_for_filter, buffer_mgr, row_count, block_entry, base_table_ref_->column_ids_);
+            ReadDataBlock(db_for_filter,
+                          buffer_mgr,
+                          row_count,
+                          block_entry,
+                          base_table_ref_->column_ids_,
+                          knn_scan_function_data->filter_column_idx_);
             bool_column->Initialize(ColumnVectorType::kFlat, row_count);
             ExpressionEvaluator expr_evaluator;
             expr_evaluator.Init(db_for_filter);
@@ -274,23 +381,40 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
             MergeIntoBitmask(bool_column_ptr, null_mask, row_count, bitmask, true);
             bool_column->Reset();
         }
+        SegmentEntry *segment_entry = base_table_ref_->block_index_->segment_index_.at(block_entry->segment_entry_->segment_id_);
+        SegmentEntry::MaskDeletedRows(segment_entry, block_entry->block_id_ * DEFAULT_BLOCK_CAPACITY, row_count, begin_ts, bitmask);
 
         ColumnBuffer column_buffer = BlockColumnEntry::GetColumnData(block_column_entry, buffer_mgr);
-
-        auto data = reinterpret_cast<const DataType *>(column_buffer.GetAll());
-        merge_heap->Search(query,
-                           data,
-                           knn_scan_shared_data->dimension_,
-                           dist_func->dist_func_,
-                           row_count,
-                           block_entry->segment_entry_->segment_id_,
-                           block_entry->block_id_,
-                           bitmask);
+        if (column_elem_type == kElemFloat) {
+            // the f32 rows are compared without the distance function, by the blocked products for several queries
+            merge_heap->Search(query,
+                               reinterpret_cast<const DataType *>(column_buffer.GetAll()),
+                               knn_scan_shared_data->dimension_,
+                               knn_scan_shared_data->knn_distance_type_,
+                               row_count,
+                               block_entry->segment_entry_->segment_id_,
+                               block_entry->block_id_,
+                               bitmask);
+        } else {
+            SearchColumn(column_buffer, [&](const auto *queries, const auto *data, u32 dim, auto column_dist_func) {
+                merge_heap->Search(queries,
+                                   data,
+                                   dim,
+                                   column_dist_func,
+                                   row_count,
+                                   block_entry->segment_entry_->segment_id_,
+                                   block_entry->block_id_,
+                                   bitmask);
+            });
+        }
     } else if (u64 index_idx = knn_scan_shared_data->current_index_idx_++; index_idx < index_task_n) {
         LOG_TRACE(Format("KnnScan: {} index {}/{}", knn_scan_function_data->task_id_, index_idx + 1, index_task_n));
         // with index
         SegmentColumnIndexEntry *segment_column_index_entry = knn_scan_shared_data->index_entries_->at(index_idx);
         BufferManager *buffer_mgr = query_context->storage()->buffer_manager();
+        // committed rows are inserted into the index concurrently. lock it before reading the segment row count,
+        // so that every vertex of the index is covered by the bitmask.
+        SharedLock<RWMutex> index_r_locker(segment_column_index_entry->rw_locker_);
 
         auto segment_id = segment_column_index_entry->segment_id_;
         SegmentEntry *segment_entry = nullptr;
@@ -312,8 +436,12 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
             ExpressionEvaluator expr_evaluator;
             for (auto &block_entry : segment_entry->block_entries_) {
                 auto row_count = block_entry->row_count_;
-                db_for_filter->Reset(row_count);
-                ReadDataBlock(db_for_filter, buffer_mgr, row_count, block_entry.get(), base_table_ref_->column_ids_);
+                ReadDataBlock(db_for_filter,
+                              buffer_mgr,
+                              row_count,
+                              block_entry.get(),
+                              base_table_ref_->column_ids_,
+                              knn_scan_function_data->filter_column_idx_);
                 bool_column->Initialize(ColumnVectorType::kFlat, row_count);
                 expr_evaluator.Init(db_for_filter);
                 expr_evaluator.Execute(filter_expression_, filter_state_, bool_column);
@@ -330,200 +458,311 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
                                                 segment_row_count));
             }
         }
-        // bool use_bitmask = !bitmask.IsAllTrue();
-
-        switch (segment_column_index_entry->column_index_entry_->index_base_->index_type_) {
-            case IndexType::kIVFFlat: {
-                BufferHandle index_handle = SegmentColumnIndexEntry::GetIndex(segment_column_index_entry, buffer_mgr);
-                auto index = static_cast<const AnnIVFFlatIndexData<DataType> *>(index_handle.GetData());
-                i32 n_probes = 1;
-                auto IVFFlatScan = [&]<typename AnnIVFFlatType>() {
-                    AnnIVFFlatType ann_ivfflat_query(query,
-                                                     knn_scan_shared_data->query_count_,
-                                                     knn_scan_shared_data->topk_,
-                                                     knn_scan_shared_data->dimension_,
-                                                     knn_scan_shared_data->elem_type_);
-                    ann_ivfflat_query.Begin();
-                    ann_ivfflat_query.Search(index, segment_id, n_probes, bitmask);
-                    ann_ivfflat_query.EndWithoutSort();
-                    auto dists = ann_ivfflat_query.GetDistances();
-                    auto row_ids = ann_ivfflat_query.GetIDs();
-                    // TODO: now only work for one query
-                    // FIXME: cant work for multiple queries
-                    auto result_count =
-                        std::lower_bound(dists, dists + knn_scan_shared_data->topk_, AnnIVFFlatType::InvalidValue(), AnnIVFFlatType::CompareDist) -
-                        dists;
-                    merge_heap->Search(dists, row_ids, result_count);
-                };
-                switch (knn_scan_shared_data->knn_distance_type_) {
-                    case KnnDistanceType::kL2: {
-                        IVFFlatScan.template operator()<AnnIVFFlatL2<DataType>>();
-                        break;
+        // the vertices of the deleted rows are still traversed by hnsw, but not returned
+        SegmentEntry::MaskDeletedRows(segment_entry, 0, segment_row_count, begin_ts, bitmask);
+
+        // the search of the segment depends on the ratio of the rows passing the filter and not deleted. the few rows are
+        // compared exactly, the index would wander through the filtered out vectors. hnsw passes through the filtered out
+        // vertices to their neighbors if many are filtered out.
+        bool brute_force = false;
+        bool expand_filtered = false;
+        if (!bitmask.IsAllTrue() && segment_row_count > 0) {
+            // the bits beyond the segment rows are true
+            SizeT passed_n = bitmask.CountTrue() - (bitmask.count() - segment_row_count);
+            f64 passed_ratio = f64(passed_n) / segment_row_count;
+            brute_force = passed_ratio < KNN_FILTER_BRUTE_FORCE_RATIO;
+            expand_filtered = passed_ratio < KNN_FILTER_EXPAND_RATIO;
+        }
+
+        // compare the rows from `begin_row` of the segment passing the bitmask exactly
+        auto SearchRowsExactly = [&](SizeT begin_row) {
+            SizeT knn_column_id = static_cast<ColumnExpression *>(knn_expression_->arguments()[0].get())->binding().column_idx;
+            Vector<u16> offsets;
+            offsets.reserve(DEFAULT_BLOCK_CAPACITY);
+            for (auto &block_entry : segment_entry->block_entries_) {
+                offsets.clear();
+                SizeT block_begin = block_entry->block_id_ * DEFAULT_BLOCK_CAPACITY;
+                for (SizeT i = begin_row > block_begin ? begin_row - block_begin : 0; i < block_entry->row_count_; ++i) {
+                    if (bitmask.IsTrue(block_begin + i)) {
+                        offsets.push_back(i);
                     }
-                    case KnnDistanceType::kInnerProduct: {
-                        IVFFlatScan.template operator()<AnnIVFFlatIP<DataType>>();
-                        break;
+                }
+                if (offsets.empty()) {
+                    continue;
+                }
+                ColumnBuffer column_buffer = BlockColumnEntry::GetColumnData(block_entry->columns_[knn_column_id].get(), buffer_mgr);
+                SearchColumn(column_buffer, [&](const auto *queries, const auto *data, u32 dim, auto column_dist_func) {
+                    merge_heap->Search(queries, data, dim, column_dist_func, offsets.data(), u16(offsets.size()), segment_id, block_entry->block_id_);
+                });
+            }
+        };
+        if (brute_force) {
+            LOG_TRACE(Format("KnnScan: {} brute force segment {} of filtered index", knn_scan_function_data->task_id_, segment_id));
+            SearchRowsExactly(0);
+        } else {
+            // the committed rows are inserted into the index in background, the rows not in the index yet are compared exactly
+            SizeT indexed_row_n = 0;
+            switch (segment_column_index_entry->column_index_entry_->index_base_->index_type_) {
+                case IndexType::kIVFFlat:
+                case IndexType::kIVFPQ:
+                case IndexType::kIVFSQ8: {
+                    BufferHandle index_handle = SegmentColumnIndexEntry::GetIndex(segment_column_index_entry, buffer_mgr);
+                    IndexType index_type = segment_column_index_entry->column_index_entry_->index_base_->index_type_;
+                    // "nprobe" is the number of the partitions searched for every query.
+                    // "rerank_factor" makes sq8 keep this times top k candidates, which are compared again with the column vectors.
+                    u32 n_probes = IVF_NPROBE;
+                    u32 rerank_factor = 0;
+                    for (const auto &opt_param : knn_scan_shared_data->opt_params_) {
+                        if (opt_param.param_name_ == "nprobe") {
+                            n_probes = ParseSearchOption(opt_param, 1, LimitMax<u32>());
+                        } else if (opt_param.param_name_ == "rerank_factor") {
+                            // the candidates of a query are counted in u32
+                            rerank_factor = ParseSearchOption(opt_param, 0, LimitMax<u32>() / Max<u64>(knn_scan_shared_data->topk_, 1));
+                        }
                     }
-                    default: {
-                        Error<ExecutorException>("Not implemented");
+                    const bool rerank = index_type == IndexType::kIVFSQ8 && rerank_factor > 1 && !knn_scan_shared_data->radius_.has_value();
+                    // replace the distances of the candidates of a query with the exact ones. the candidates are visited in the
+                    // order of their rows, so that the column of a block is loaded once.
+                    auto Rerank = [&](u64 query_idx, DataType *dists, const RowID *row_ids, SizeT candidate_n) {
+                        SizeT knn_column_id = static_cast<ColumnExpression *>(knn_expression_->arguments()[0].get())->binding().column_idx;
+                        Vector<SizeT> order(candidate_n);
+                        std::iota(order.begin(), order.end(), 0);
+                        std::sort(order.begin(), order.end(), [&](SizeT x, SizeT y) {
+                            return row_ids[x].segment_offset_ < row_ids[y].segment_offset_;
+                        });
+                        for (SizeT i = 0; i < candidate_n;) {
+                            u32 block_id = row_ids[order[i]].segment_offset_ / DEFAULT_BLOCK_CAPACITY;
+                            BlockEntry *block_entry = segment_entry->block_entries_[block_id].get();
+                            ColumnBuffer column_buffer = BlockColumnEntry::GetColumnData(block_entry->columns_[knn_column_id].get(), buffer_mgr);
+                            SizeT block_end = i;
+                            while (block_end < candidate_n && row_ids[order[block_end]].segment_offset_ / DEFAULT_BLOCK_CAPACITY == block_id) {
+                                ++block_end;
+                            }
+                            SearchColumn(column_buffer, [&](const auto *queries, const auto *data, u32 dim, auto column_dist_func) {
+                                for (SizeT k = i; k < block_end; ++k) {
+                                    SizeT block_offset = row_ids[order[k]].segment_offset_ % DEFAULT_BLOCK_CAPACITY;
+                                    dists[order[k]] = column_dist_func(queries + query_idx * dim, data + block_offset * dim, dim);
+                                }
+                            });
+                            i = block_end;
+                        }
+                    };
+                    auto IVFScan = [&]<typename AnnIVFType>(const auto *index) {
+                        indexed_row_n = index->data_num_;
+                        // the partitions of all the queries are probed together, then the results of every query are merged
+                        auto SearchAndMerge = [&](AnnIVFType &ann_ivf_query) {
+                            ann_ivf_query.Begin();
+                            ann_ivf_query.Search(index, segment_id, n_probes, bitmask);
+                            ann_ivf_query.EndWithoutSort();
+                            for (u64 query_idx = 0; query_idx < knn_scan_shared_data->query_count_; ++query_idx) {
+                                if (rerank) {
+                                    Rerank(query_idx,
+                                           ann_ivf_query.GetDistanceByIdx(query_idx),
+                                           ann_ivf_query.GetIDByIdx(query_idx),
+                                           ann_ivf_query.GetResultCount(query_idx));
+                                }
+                                merge_heap->Search(query_idx,
+                                                   ann_ivf_query.GetDistanceByIdx(query_idx),
+                                                   ann_ivf_query.GetIDByIdx(query_idx),
+                                                   ann_ivf_query.GetResultCount(query_idx));
+                            }
+                        };
+                        if (knn_scan_shared_data->radius_.has_value()) {
+                            AnnIVFType ann_ivf_query(query,
+                                                     knn_scan_shared_data->query_count_,
+                                                     knn_scan_shared_data->dimension_,
+                                                     knn_scan_shared_data->elem_type_,
+                                                     *knn_scan_shared_data->radius_);
+                            SearchAndMerge(ann_ivf_query);
+                            return;
+                        }
+                        AnnIVFType ann_ivf_query(query,
+                                                 knn_scan_shared_data->query_count_,
+                                                 knn_scan_shared_data->topk_ * (rerank ? rerank_factor : 1),
+                                                 knn_scan_shared_data->dimension_,
+                                                 knn_scan_shared_data->elem_type_);
+                        SearchAndMerge(ann_ivf_query);
+                    };
+                    auto IVFScanByMetric = [&]<template <typename> typename AnnIVFL2, template <typename> typename AnnIVFIP, typename IndexData>() {
+                        const auto *index = static_cast<const IndexData *>(index_handle.GetData());
+                        switch (knn_scan_shared_data->knn_distance_type_) {
+                            case KnnDistanceType::kL2: {
+                                IVFScan.template operator()<AnnIVFL2<DataType>>(index);
+                                break;
+                            }
+                            case KnnDistanceType::kInnerProduct: {
+                                IVFScan.template operator()<AnnIVFIP<DataType>>(index);
+                                break;
+                            }
+                            default: {
+                                Error<ExecutorException>("Not implemented");
+                            }
+                        }
+                    };
+                    if (index_type == IndexType::kIVFFlat) {
+                        IVFScanByMetric.template operator()<AnnIVFFlatL2, AnnIVFFlatIP, AnnIVFFlatIndexData<DataType>>();
+                    } else if (index_type == IndexType::kIVFPQ) {
+                        IVFScanByMetric.template operator()<AnnIVFPQL2, AnnIVFPQIP, AnnIVFPQIndexData<DataType>>();
+                    } else {
+                        IVFScanByMetric.template operator()<AnnIVFSQ8L2, AnnIVFSQ8IP, AnnIVFSQ8IndexData<DataType>>();
                     }
+                    break;
                 }
-                break;
-            }
-            case IndexType::kHnsw: {
-                BufferHandle index_handle = SegmentColumnIndexEntry::GetIndex(segment_column_index_entry, buffer_mgr);
-                auto index_hnsw = static_cast<IndexHnsw *>(segment_column_index_entry->column_index_entry_->index_base_.get());
-                auto KnnScanOld = [&](auto *index) {
-                    Vector<DataType> dists(knn_scan_shared_data->topk_ * knn_scan_shared_data->query_count_);
-                    Vector<RowID> row_ids(knn_scan_shared_data->topk_ * knn_scan_shared_data->query_count_);
-
+                case IndexType::kHnsw: {
+                    BufferHandle index_handle = SegmentColumnIndexEntry::GetIndex(segment_column_index_entry, buffer_mgr);
+                    auto index_hnsw = static_cast<IndexHnsw *>(segment_column_index_entry->column_index_entry_->index_base_.get());
+                    // search parameters are passed to every query, the shared index is read only.
+                    HnswSearchParams search_params;
                     for (const auto &opt_param : knn_scan_shared_data->opt_params_) {
                         if (opt_param.param_name_ == "ef") {
-                            u64 ef = std::stoull(opt_param.param_value_);
-                            index->SetEf(ef);
+                            search_params.ef_ = ParseSearchOption(opt_param, 0, LimitMax<u32>());
                         }
                     }
-
-                    i64 result_n = -1;
-                    for (u64 query_idx = 0; query_idx < knn_scan_shared_data->query_count_; ++query_idx) {
-                        const DataType *query =
-                            static_cast<const DataType *>(knn_scan_shared_data->query_embedding_) + query_idx * knn_scan_shared_data->dimension_;
-                        MaxHeap<Pair<DataType, u64>> heap = index->KnnSearch(query, knn_scan_shared_data->topk_, bitmask);
-                        if (result_n < 0) {
-                            result_n = heap.size();
-                        } else if (result_n != (i64)heap.size()) {
-                            throw ExecutorException("Bug");
+                    search_params.expand_filtered_ = expand_filtered;
+                    auto KnnScanUseHeap = [&]<typename LabelType>(const auto *index) {
+                        if constexpr (!std::is_same_v<LabelType, u64>) {
+                            Error<ExecutorException>("Bug: Hnsw LabelType must be u64");
+                        }
+                        SizeT query_n = knn_scan_shared_data->query_count_;
+                        SizeT topk = knn_scan_shared_data->topk_;
+                        auto d_ptr = MakeUniqueForOverwrite<DataType[]>(query_n * topk);
+                        auto l_ptr = MakeUniqueForOverwrite<LabelType[]>(query_n * topk);
+                        auto result_ns = MakeUniqueForOverwrite<SizeT[]>(query_n);
+                        // a large batch of queries is searched by more threads
+                        SizeT thread_n = query_n / HNSW_BATCH_SEARCH_QUERY_PER_THREAD + 1;
+                        if (Config *config = InfinityContext::instance().config(); config != nullptr) {
+                            thread_n = Min(thread_n, (SizeT)config->worker_cpu_limit());
+                        }
+                        ThreadPool *pool = nullptr;
+                        if (ResourceManager *resource_manager = InfinityContext::instance().resource_manager(); resource_manager != nullptr) {
+                            pool = &resource_manager->worker_pool();
                         }
-                        u64 id = 0;
-                        while (!heap.empty()) {
-                            const auto &[dist, row_id] = heap.top();
-                            row_ids[query_idx * knn_scan_shared_data->topk_ + id] = RowID::FromUint64(row_id);
+                        // the queries of an int8 or bit index are of its element type
+                        using QueryType = typename std::remove_pointer_t<decltype(index)>::HnswDataType;
+                        const auto *queries = static_cast<const QueryType *>(knn_scan_shared_data->query_embedding_);
+                        index->KnnSearchBatch(queries,
+                                              query_n,
+                                              topk,
+                                              bitmask,
+                                              d_ptr.get(),
+                                              l_ptr.get(),
+                                              result_ns.get(),
+                                              search_params,
+                                              pool,
+                                              thread_n);
+
+                        // the queries may find different numbers of rows under a filter, they are merged one by one
+                        for (u64 query_idx = 0; query_idx < query_n; ++query_idx) {
+                            SizeT result_size = result_ns[query_idx];
+                            if (result_size <= 0) {
+                                continue;
+                            }
+                            DataType *dists = d_ptr.get() + query_idx * topk;
+                            LabelType *labels = l_ptr.get() + query_idx * topk;
+                            UniquePtr<RowID[]> row_ids_ptr;
+                            RowID *row_ids = nullptr;
+                            if constexpr (sizeof(RowID) == sizeof(LabelType)) {
+                                row_ids = reinterpret_cast<RowID *>(labels);
+                            } else {
+                                row_ids_ptr = MakeUniqueForOverwrite<RowID[]>(result_size);
+                                row_ids = row_ids_ptr.get();
+                            }
+                            for (SizeT i = 0; i < result_size; ++i) {
+                                row_ids[i] = RowID::FromUint64(labels[i]);
+                            }
                             switch (knn_scan_shared_data->knn_distance_type_) {
                                 case KnnDistanceType::kInvalid: {
                                     throw ExecutorException("Bug");
                                 }
                                 case KnnDistanceType::kL2:
                                 case KnnDistanceType::kHamming: {
-                                    dists[query_idx * knn_scan_shared_data->topk_ + id] = +dist;
                                     break;
                                 }
                                 case KnnDistanceType::kCosine:
                                 case KnnDistanceType::kInnerProduct: {
-                                    dists[query_idx * knn_scan_shared_data->topk_ + id] = -dist;
+                                    for (SizeT i = 0; i < result_size; ++i) {
+                                        dists[i] = -dists[i];
+                                    }
                                     break;
                                 }
                             }
-                            ++id;
-                            heap.pop();
+                            merge_heap->Search(query_idx, dists, row_ids, result_size);
                         }
-                    }
-                    merge_heap->Search(dists.data(), row_ids.data(), result_n);
-                };
-                auto KnnScanUseHeap = [&]<typename LabelType>(auto *index) {
-                    if constexpr (!std::is_same_v<LabelType, u64>) {
-                        Error<ExecutorException>("Bug: Hnsw LabelType must be u64");
-                    }
+                    };
+                    // all the rows within the radius. hnsw searches by the negated similarity of inner product and cosine.
+                    auto KnnScanRange = [&](const auto *index) {
+                        using QueryType = typename std::remove_pointer_t<decltype(index)>::HnswDataType;
+                        const auto *queries = static_cast<const QueryType *>(knn_scan_shared_data->query_embedding_);
+                        SizeT query_size = EmbeddingT::EmbeddingSize(knn_scan_shared_data->elem_type_, knn_scan_shared_data->dimension_);
+                        bool negated = knn_scan_shared_data->knn_distance_type_ == KnnDistanceType::kCosine ||
+                                       knn_scan_shared_data->knn_distance_type_ == KnnDistanceType::kInnerProduct;
+                        DataType radius = negated ? -*knn_scan_shared_data->radius_ : *knn_scan_shared_data->radius_;
+                        Vector<DataType> dists;
+                        Vector<RowID> row_ids;
+                        for (u64 query_idx = 0; query_idx < knn_scan_shared_data->query_count_; ++query_idx) {
+                            const QueryType *query = queries + query_idx * query_size / sizeof(QueryType);
+                            auto result = index->KnnRangeSearch(query, radius, bitmask, search_params);
+                            dists.clear();
+                            row_ids.clear();
+                            for (const auto &[dist, label] : result) {
+                                dists.push_back(negated ? -dist : dist);
+                                row_ids.push_back(RowID::FromUint64(label));
+                            }
+                            merge_heap->Search(query_idx, dists.data(), row_ids.data(), result.size());
+                        }
+                    };
+                    auto KnnScan = [&](const auto *index) {
+                        indexed_row_n = index->GetVertexNum();
+                        if (knn_scan_shared_data->radius_.has_value()) {
+                            KnnScanRange(index);
+                            return;
+                        }
+                        using LabelType = typename std::remove_pointer_t<decltype(index)>::HnswLabelType;
+                        KnnScanUseHeap.template operator()<LabelType>(index);
+                    };
+                    DispatchHnsw(index_hnsw, column_elem_type, [&]<typename Hnsw>() { KnnScan(static_cast<const Hnsw *>(index_handle.GetData())); });
+                    break;
+                }
+                case IndexType::kDiskAnn: {
+                    BufferHandle index_handle = SegmentColumnIndexEntry::GetIndex(segment_column_index_entry, buffer_mgr);
+                    const auto *diskann_index = static_cast<const DiskAnnIndex *>(index_handle.GetData());
+                    indexed_row_n = diskann_index->data_num();
+                    // "ef" is the size of the candidate list as hnsw, "beam_width" is the number of nodes read from the disk at once
+                    u32 L = HNSW_EF;
+                    u32 beam_width = DISKANN_BEAM_WIDTH;
                     for (const auto &opt_param : knn_scan_shared_data->opt_params_) {
                         if (opt_param.param_name_ == "ef") {
-                            u64 ef = std::stoull(opt_param.param_value_);
-                            index->SetEf(ef);
+                            L = ParseSearchOption(opt_param, 1, LimitMax<u32>());
+                        } else if (opt_param.param_name_ == "beam_width") {
+                            beam_width = ParseSearchOption(opt_param, 1, LimitMax<u32>());
                         }
                     }
-                    i64 result_n = -1;
+                    // diskann searches by the negated inner product, so is the radius of a range search
+                    bool negated = knn_scan_shared_data->knn_distance_type_ == KnnDistanceType::kInnerProduct;
+                    const auto &radius = knn_scan_shared_data->radius_;
+                    Vector<DataType> dists;
+                    Vector<RowID> row_ids;
                     for (u64 query_idx = 0; query_idx < knn_scan_shared_data->query_count_; ++query_idx) {
-                        const DataType *query =
-                            static_cast<const DataType *>(knn_scan_shared_data->query_embedding_) + query_idx * knn_scan_shared_data->dimension_;
-                        auto search_result = index->KnnSearchReturnPair(query, knn_scan_shared_data->topk_, bitmask);
-                        auto &[result_size, unique_ptr_pair] = search_result;
-                        auto &[d_ptr, l_ptr] = unique_ptr_pair;
-                        if (result_n < 0) {
-                            result_n = result_size;
-                        } else if (result_n != (i64)result_size) {
-                            throw ExecutorException("Bug");
-                        }
-                        if (result_size <= 0) {
-                            continue;
-                        }
-                        UniquePtr<RowID[]> row_ids_ptr;
-                        RowID *row_ids = nullptr;
-                        if constexpr (sizeof(RowID) == sizeof(LabelType)) {
-                            row_ids = reinterpret_cast<RowID *>(l_ptr.get());
-                        } else {
-                            row_ids_ptr = MakeUniqueForOverwrite<RowID[]>(result_size);
-                            row_ids = row_ids_ptr.get();
+                        const DataType *query = static_cast<const DataType *>(knn_scan_shared_data->query_embedding_) +
+                                                query_idx * knn_scan_shared_data->dimension_;
+                        auto result = radius.has_value() ? diskann_index->KnnRangeSearch(query, negated ? -*radius : *radius, L, beam_width, bitmask)
+                                                         : diskann_index->KnnSearch(query, knn_scan_shared_data->topk_, L, beam_width, bitmask);
+                        dists.clear();
+                        row_ids.clear();
+                        for (const auto &[dist, id] : result) {
+                            dists.push_back(negated ? -dist : dist);
+                            row_ids.emplace_back(segment_id, id);
                         }
-                        for (SizeT i = 0; i < result_size; ++i) {
-                            row_ids[i] = RowID::FromUint64(l_ptr[i]);
-                        }
-                        switch (knn_scan_shared_data->knn_distance_type_) {
-                            case KnnDistanceType::kInvalid: {
-                                throw ExecutorException("Bug");
-                            }
-                            case KnnDistanceType::kL2:
-                            case KnnDistanceType::kHamming: {
-                                break;
-                            }
-                            case KnnDistanceType::kCosine:
-                            case KnnDistanceType::kInnerProduct: {
-                                for (SizeT i = 0; i < result_size; ++i) {
-                                    d_ptr[i] = -d_ptr[i];
-                                }
-                                break;
-                            }
-                        }
-                        merge_heap->Search(0, d_ptr.get(), row_ids, result_size);
-                    }
-                };
-                auto KnnScan = [&](auto *index) {
-                    using LabelType = typename std::remove_pointer_t<decltype(index)>::HnswLabelType;
-                    KnnScanUseHeap.template operator()<LabelType>(index);
-                };
-                switch (index_hnsw->encode_type_) {
-                    case HnswEncodeType::kPlain: {
-                        switch (index_hnsw->metric_type_) {
-                            case MetricType::kMerticInnerProduct: {
-                                using Hnsw = KnnHnsw<f32, u64, PlainStore<f32>, PlainIPDist<f32>>;
-                                // Fixme: const_cast here. may have bug.
-                                KnnScan(const_cast<Hnsw *>(static_cast<const Hnsw *>(index_handle.GetData())));
-                                break;
-                            }
-                            case MetricType::kMerticL2: {
-                                using Hnsw = KnnHnsw<f32, u64, PlainStore<f32>, PlainL2Dist<f32>>;
-                                KnnScan(const_cast<Hnsw *>(static_cast<const Hnsw *>(index_handle.GetData())));
-                                break;
-                            }
-                            default: {
-                                Error<ExecutorException>("Not implemented");
-                            }
-                        }
-                        break;
-                    }
-                    case HnswEncodeType::kLVQ: {
-                        switch (index_hnsw->metric_type_) {
-                            case MetricType::kMerticInnerProduct: {
-                                using Hnsw = KnnHnsw<f32, u64, LVQStore<f32, i8, LVQIPCache<f32, i8>>, LVQIPDist<f32, i8>>;
-                                KnnScan(const_cast<Hnsw *>(static_cast<const Hnsw *>(index_handle.GetData())));
-                                break;
-                            }
-                            case MetricType::kMerticL2: {
-                                using Hnsw = KnnHnsw<f32, u64, LVQStore<f32, i8, LVQL2Cache<f32, i8>>, LVQL2Dist<f32, i8>>;
-                                KnnScan(const_cast<Hnsw *>(static_cast<const Hnsw *>(index_handle.GetData())));
-                                break;
-                            }
-                            default: {
-                                Error<ExecutorException>("Not implemented");
-                            }
-                        }
-                        break;
-                    }
-                    default: {
-                        Error<ExecutorException>("Not implemented");
+                        merge_heap->Search(query_idx, dists.data(), row_ids.data(), dists.size());
                     }
+                    break;
+                }
+                default: {
+                    Error<ExecutorException>("Not implemented");
                 }
-                break;
             }
-            default: {
-                Error<ExecutorException>("Not implemented");
+            if (indexed_row_n < segment_row_count) {
+                SearchRowsExactly(indexed_row_n);
             }
         }
     }
@@ -533,13 +772,15 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
         BlockIndex *block_index = knn_scan_shared_data->table_ref_->block_index_.get();
 
         merge_heap->End();
-        i64 result_n = Min(knn_scan_shared_data->topk_, merge_heap->total_count());
 
         if (!operator_state->data_block_array_.empty()) {
             Error<ExecutorException>("In physical_knn_scan : operator_state->data_block_array_ is not empty.");
         }
         {
-            SizeT total_data_row_count = knn_scan_shared_data->query_count_ * result_n;
+            SizeT total_data_row_count = 0;
+            for (u64 query_idx = 0; query_idx < knn_scan_shared_data->query_count_; ++query_idx) {
+                total_data_row_count += merge_heap->ResultCount(query_idx);
+            }
             SizeT row_idx = 0;
             do {
                 auto data_block = DataBlock::MakeUniquePtr();
@@ -555,10 +796,9 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
         for (u64 query_idx = 0; query_idx < knn_scan_shared_data->query_count_; ++query_idx) {
             DataType *result_dists = merge_heap->GetDistancesByIdx(query_idx);
             RowID *row_ids = merge_heap->GetIDsByIdx(query_idx);
+            i64 result_n = merge_heap->ResultCount(query_idx);
 
             for (i64 top_idx = 0; top_idx < result_n; ++top_idx) {
-                SizeT id = query_idx * knn_scan_shared_data->query_count_ + top_idx;
-
                 u32 segment_id = row_ids[top_idx].segment_id_;
                 u32 segment_offset = row_ids[top_idx].segment_offset_;
                 u16 block_id = segment_offset / DEFAULT_BLOCK_CAPACITY;
@@ -594,8 +834,8 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
                         output_block_ptr->AppendValue(column_id, value);
                     }
                 }
-                output_block_ptr->AppendValueByPtr(column_n, (ptr_t)&result_dists[id]);
-                output_block_ptr->AppendValueByPtr(column_n + 1, (ptr_t)&row_ids[id]);
+                output_block_ptr->AppendValueByPtr(column_n, (ptr_t)&result_dists[top_idx]);
+                output_block_ptr->AppendValueByPtr(column_n + 1, (ptr_t)&row_ids[top_idx]);
 
                 ++output_block_row_id;
             }
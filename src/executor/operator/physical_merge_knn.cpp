@@ -59,7 +59,10 @@ bool PhysicalMergeKnn::Execute(QueryContext *query_context, OperatorState *opera
         case kElemInvalid: {
             Error<ExecutorException>("Invalid elem type");
         }
-        case kElemFloat: {
+        case kElemFloat:
+        case kElemInt8:
+        case kElemBit: {
+            // the distances of int8 and bit queries are f32 as well
             switch (merge_knn_data.heap_type_) {
                 case MergeKnnHeapType::kInvalid: {
                     Error<ExecutorException>("Invalid heap type");
@@ -112,10 +115,10 @@ void PhysicalMergeKnn::ExecuteInner(QueryContext *query_context, MergeKnnOperato
         BlockIndex *block_index = merge_knn_data.table_ref_->block_index_.get();
 
         u64 output_row_count{0};
-        i64 result_n = Min(merge_knn_data.topk_, merge_knn->total_count());
         for (i64 query_idx = 0; query_idx < merge_knn_data.query_count_; ++query_idx) {
             DataType *result_dists = merge_knn->GetDistancesByIdx(query_idx);
             RowID *result_row_ids = merge_knn->GetIDsByIdx(query_idx);
+            i64 result_n = merge_knn->ResultCount(query_idx);
             for (i64 top_idx = 0; top_idx < result_n; ++top_idx) {
                 u32 segment_id = result_row_ids[top_idx].segment_id_;
                 u32 segment_offset = result_row_ids[top_idx].segment_offset_;
@@ -41,6 +41,9 @@ import data_table;
 import third_party;
 import index_def;
 import index_ivfflat;
+import index_ivfpq;
+import index_diskann;
+import index_ivfsq8;
 import table_index_meta;
 import table_index_entry;
 import index_base;
@@ -1387,9 +1390,36 @@ void PhysicalShow::ExecuteShowIndexes(QueryContext *query_context, ShowOperatorS
                 switch (index_base->index_type_) {
                     case IndexType::kIVFFlat: {
                         const IndexIVFFlat *index_ivfflat = static_cast<const IndexIVFFlat *>(index_base);
-                        other_parameters = Format("metric = {}, centroids_count = {}",
+                        other_parameters = Format("metric = {}, centroids_count = {}, mini_batch_size = {}",
                                                   MetricTypeToString(index_ivfflat->metric_type_),
-                                                  index_ivfflat->centroids_count_);
+                                                  index_ivfflat->centroids_count_,
+                                                  index_ivfflat->mini_batch_size_);
+                        break;
+                    }
+                    case IndexType::kIVFPQ: {
+                        const IndexIVFPQ *index_ivfpq = static_cast<const IndexIVFPQ *>(index_base);
+                        other_parameters = Format("metric = {}, centroids_count = {}, subspace_num = {}, mini_batch_size = {}",
+                                                  MetricTypeToString(index_ivfpq->metric_type_),
+                                                  index_ivfpq->centroids_count_,
+                                                  index_ivfpq->subspace_num_,
+                                                  index_ivfpq->mini_batch_size_);
+                        break;
+                    }
+                    case IndexType::kIVFSQ8: {
+                        const IndexIVFSQ8 *index_ivfsq8 = static_cast<const IndexIVFSQ8 *>(index_base);
+                        other_parameters = Format("metric = {}, centroids_count = {}, mini_batch_size = {}",
+                                                  MetricTypeToString(index_ivfsq8->metric_type_),
+                                                  index_ivfsq8->centroids_count_,
+                                                  index_ivfsq8->mini_batch_size_);
+                        break;
+                    }
+                    case IndexType::kDiskAnn: {
+                        const IndexDiskAnn *index_diskann = static_cast<const IndexDiskAnn *>(index_base);
+                        other_parameters = Format("metric = {}, R = {}, L = {}, subspace_num = {}",
+                                                  MetricTypeToString(index_diskann->metric_type_),
+                                                  index_diskann->R_,
+                                                  index_diskann->L_,
+                                                  index_diskann->subspace_num_);
                         break;
                     }
                     case IndexType::kHnsw: {
@@ -15,6 +15,7 @@
 module;
 
 #include <sstream>
+#include <string>
 import stl;
 import expression_type;
 import parser;
@@ -61,6 +62,9 @@ KnnExpression::KnnExpression(EmbeddingDataType embedding_data_type,
     if (opt_params) {
         for (auto &param : *opt_params) {
             opt_params_.emplace_back(*param);
+            if (param->param_name_ == "radius") {
+                radius_ = std::stof(param->param_value_);
+            }
         }
     }
 }
@@ -46,6 +46,9 @@ public:
     const EmbeddingT query_embedding_;
     const i64 topn_;
     Vector<InitParameter> opt_params_;
+    // search the rows within the distance `radius` of the query instead of the nearest `topn_`, with the option "radius".
+    // it is the largest distance of l2 and hamming, and the smallest similarity of inner product and cosine.
+    Optional<f32> radius_;
 };
 
 } // namespace infinity
\ No newline at end of file
@@ -14,6 +14,8 @@
 
 module;
 
+#include "storage/knnindex/knn_hnsw/header.h"
+
 import stl;
 import function;
 import function_data;
@@ -22,6 +24,7 @@ import column_vector;
 import infinity_exception;
 import base_expression;
 import parser;
+import hnsw_simd_func;
 
 export module aggregate_function;
 
@@ -32,6 +35,23 @@ using AggregateUpdateFuncType = StdFunction<void(ptr_t, const SharedPtr<ColumnVe
 using AggregateFinalizeFuncType = StdFunction<ptr_t(ptr_t)>;
 
 class AggregateOperation {
+    // the loop over a flat column is compiled for avx2 as well, and the variant is chosen at run time
+    template <typename AggregateState, typename InputType>
+    static void UpdateFlat(AggregateState *state, const InputType *input_ptr, SizeT row_count) {
+        for (SizeT idx = 0; idx < row_count; ++idx) {
+            state->Update(input_ptr, idx);
+        }
+    }
+
+#if defined(USE_AVX)
+    template <typename AggregateState, typename InputType>
+    AVX2_TARGET static void UpdateFlatAVX2(AggregateState *state, const InputType *input_ptr, SizeT row_count) {
+        for (SizeT idx = 0; idx < row_count; ++idx) {
+            state->Update(input_ptr, idx);
+        }
+    }
+#endif
+
 public:
     template <typename AggregateState>
     static inline void StateInitialize(const ptr_t state) {
@@ -46,9 +66,13 @@ public:
             case ColumnVectorType::kFlat: {
                 SizeT row_count = input_column_vector->Size();
                 auto *input_ptr = (InputType *)(input_column_vector->data());
-                for (SizeT idx = 0; idx < row_count; ++idx) {
-                    ((AggregateState *)state)->Update(input_ptr, idx);
+#if defined(USE_AVX)
+                if (SupportAVX2()) {
+                    UpdateFlatAVX2((AggregateState *)state, input_ptr, row_count);
+                    break;
                 }
+#endif
+                UpdateFlat((AggregateState *)state, input_ptr, row_count);
                 break;
             }
             case ColumnVectorType::kConstant: {
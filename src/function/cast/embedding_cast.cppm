@@ -64,6 +64,12 @@ export inline BoundCastFunc BindEmbeddingCast(const DataType &source, const Data
         case EmbeddingDataType::kElemDouble: {
             return BindEmbeddingCast<DoubleT>(target_info);
         }
+        case EmbeddingDataType::kElemFloat16: {
+            return BindEmbeddingCast<float16_t>(target_info);
+        }
+        case EmbeddingDataType::kElemBFloat16: {
+            return BindEmbeddingCast<bfloat16_t>(target_info);
+        }
         default: {
             Error<TypeException>(Format("Can't cast from {} to Embedding type", target.ToString()));
         }
@@ -92,6 +98,12 @@ inline BoundCastFunc BindEmbeddingCast(const EmbeddingInfo *target) {
         case EmbeddingDataType::kElemDouble: {
             return BoundCastFunc(&ColumnVectorCast::TryCastColumnVectorEmbedding<SourceElemType, DoubleT, EmbeddingTryCastToFixlen>);
         }
+        case EmbeddingDataType::kElemFloat16: {
+            return BoundCastFunc(&ColumnVectorCast::TryCastColumnVectorEmbedding<SourceElemType, float16_t, EmbeddingTryCastToFixlen>);
+        }
+        case EmbeddingDataType::kElemBFloat16: {
+            return BoundCastFunc(&ColumnVectorCast::TryCastColumnVectorEmbedding<SourceElemType, bfloat16_t, EmbeddingTryCastToFixlen>);
+        }
         default: {
             Error<TypeException>(Format("Can't cast from Embedding type to {}", target->ToString()));
         }
@@ -102,7 +114,22 @@ inline BoundCastFunc BindEmbeddingCast(const EmbeddingInfo *target) {
 struct EmbeddingTryCastToFixlen {
     template <typename SourceElemType, typename TargetElemType>
     static inline bool Run(const SourceElemType *source, TargetElemType *target, SizeT len) {
-        if constexpr (IsSame<SourceElemType, TinyIntT>() || IsSame<SourceElemType, SmallIntT>() || IsSame<SourceElemType, IntegerT>() ||
+        // half precision values are converted through float, out of range values become inf
+        if constexpr (IsSame<TargetElemType, float16_t>() || IsSame<TargetElemType, bfloat16_t>()) {
+            for (SizeT i = 0; i < len; ++i) {
+                target[i] = static_cast<FloatT>(source[i]);
+            }
+            return true;
+        } else if constexpr (IsSame<SourceElemType, float16_t>() || IsSame<SourceElemType, bfloat16_t>()) {
+            for (SizeT i = 0; i < len; ++i) {
+                if constexpr (IsSame<TargetElemType, FloatT>()) {
+                    target[i] = static_cast<FloatT>(source[i]);
+                } else if (!FloatTryCastToFixlen::Run(static_cast<FloatT>(source[i]), target[i])) {
+                    return false;
+                }
+            }
+            return true;
+        } else if constexpr (IsSame<SourceElemType, TinyIntT>() || IsSame<SourceElemType, SmallIntT>() || IsSame<SourceElemType, IntegerT>() ||
                       IsSame<SourceElemType, BigIntT>()) {
             for (SizeT i = 0; i < len; ++i) {
                 if (!IntegerTryCastToFixlen::Run(source[i], target[i])) {
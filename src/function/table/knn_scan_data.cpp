@@ -37,6 +37,8 @@ import data_block;
 import column_vector;
 import base_expression;
 import expression_state;
+import expression_type;
+import reference_expression;
 
 
 module knn_scan_data;
@@ -48,10 +50,27 @@ KnnDistance1<f32>::KnnDistance1(KnnDistanceType dist_type) {
     switch (dist_type) {
         case KnnDistanceType::kL2: {
             dist_func_ = L2Distance<f32, f32, f32, SizeT>;
+            f16_dist_func_ = L2Distance<f32, f32, float16_t, SizeT>;
+            bf16_dist_func_ = L2Distance<f32, f32, bfloat16_t, SizeT>;
+            i8_dist_func_ = L2Distance<f32, i8, i8, SizeT>;
             break;
         }
         case KnnDistanceType::kInnerProduct: {
             dist_func_ = IPDistance<f32, f32, f32, SizeT>;
+            f16_dist_func_ = IPDistance<f32, f32, float16_t, SizeT>;
+            bf16_dist_func_ = IPDistance<f32, f32, bfloat16_t, SizeT>;
+            i8_dist_func_ = IPDistance<f32, i8, i8, SizeT>;
+            break;
+        }
+        case KnnDistanceType::kCosine: {
+            // the query is normalized in `KnnScanSharedData`
+            dist_func_ = CosineDistance<f32, f32, f32, SizeT>;
+            f16_dist_func_ = CosineDistance<f32, f32, float16_t, SizeT>;
+            bf16_dist_func_ = CosineDistance<f32, f32, bfloat16_t, SizeT>;
+            break;
+        }
+        case KnnDistanceType::kHamming: {
+            bit_dist_func_ = HammingDistance<f32, SizeT>;
             break;
         }
         default: {
@@ -60,12 +79,50 @@ KnnDistance1<f32>::KnnDistance1(KnnDistanceType dist_type) {
     }
 }
 
+UniquePtr<f32[]> NormalizeCosineQuery(const void *query, i64 dimension, u64 query_count, EmbeddingDataType elem_type, KnnDistanceType dist_type) {
+    if (dist_type != KnnDistanceType::kCosine || elem_type != EmbeddingDataType::kElemFloat) {
+        return nullptr;
+    }
+    SizeT element_n = dimension * query_count;
+    auto normalized = MakeUniqueForOverwrite<f32[]>(element_n);
+    Copy(static_cast<const f32 *>(query), static_cast<const f32 *>(query) + element_n, normalized.get());
+    for (u64 i = 0; i < query_count; ++i) {
+        L2Normalize(normalized.get() + i * dimension, dimension);
+    }
+    return normalized;
+}
+
+// mark the columns referenced by `expr`. return false if the columns can't be told, e.g. in a case expression.
+bool CollectReferencedColumns(const SharedPtr<BaseExpression> &expr, Vector<bool> &referenced) {
+    switch (expr->type()) {
+        case ExpressionType::kReference: {
+            referenced[static_cast<const ReferenceExpression *>(expr.get())->column_index()] = true;
+            return true;
+        }
+        case ExpressionType::kCase:
+        case ExpressionType::kIn: {
+            return false;
+        }
+        default: {
+            for (const auto &argument : expr->arguments()) {
+                if (!CollectReferencedColumns(argument, referenced)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+}
+
 // --------------------------------------------
 
 KnnScanFunctionData::KnnScanFunctionData(KnnScanSharedData* shared_data, u32 current_parallel_idx)
     : shared_data_(shared_data), task_id_(current_parallel_idx) {
     switch (shared_data_->elem_type_) {
-        case EmbeddingDataType::kElemFloat: {
+        case EmbeddingDataType::kElemFloat:
+        case EmbeddingDataType::kElemInt8:
+        case EmbeddingDataType::kElemBit: {
+            // the distances of int8 and bit queries are also f32
             Init<f32>();
             break;
         }
@@ -83,14 +140,14 @@ void KnnScanFunctionData::Init() {
         }
         case KnnDistanceType::kL2:
         case KnnDistanceType::kHamming: {
-            auto merge_knn_max = MakeUnique<MergeKnn<DataType, CompareMax>>(shared_data_->query_count_, shared_data_->topk_);
+            auto merge_knn_max = MakeUnique<MergeKnn<DataType, CompareMax>>(shared_data_->query_count_, shared_data_->topk_, shared_data_->radius_);
             merge_knn_max->Begin();
             merge_knn_base_ = Move(merge_knn_max);
             break;
         }
         case KnnDistanceType::kCosine:
         case KnnDistanceType::kInnerProduct: {
-            auto merge_knn_min = MakeUnique<MergeKnn<DataType, CompareMin>>(shared_data_->query_count_, shared_data_->topk_);
+            auto merge_knn_min = MakeUnique<MergeKnn<DataType, CompareMin>>(shared_data_->query_count_, shared_data_->topk_, shared_data_->radius_);
             merge_knn_min->Begin();
             merge_knn_base_ = Move(merge_knn_min);
             break;
@@ -101,8 +158,26 @@ void KnnScanFunctionData::Init() {
 
     if (shared_data_->filter_expression_) {
         filter_state_ = ExpressionState::CreateState(shared_data_->filter_expression_);
+        // only the columns referenced by the filter are read into `db_for_filter_`, the others are constant vectors of one row,
+        // so that the embedding column is neither allocated nor copied
+        const auto &column_types = *(shared_data_->table_ref_->column_types_);
+        Vector<bool> referenced(column_types.size(), false);
+        if (!CollectReferencedColumns(shared_data_->filter_expression_, referenced)) {
+            Fill(referenced.begin(), referenced.end(), true);
+        }
+        Vector<SharedPtr<ColumnVector>> column_vectors;
+        column_vectors.reserve(column_types.size());
+        for (SizeT i = 0; i < column_types.size(); ++i) {
+            auto &column_vector = column_vectors.emplace_back(ColumnVector::Make(column_types[i]));
+            if (referenced[i]) {
+                column_vector->Initialize(); // default capacity
+                filter_column_idx_.push_back(i);
+            } else {
+                column_vector->Initialize(ColumnVectorType::kConstant, 1);
+            }
+        }
         db_for_filter_ = MakeUnique<DataBlock>();
-        db_for_filter_->Init(*(shared_data_->table_ref_->column_types_));                         // default capacity
+        db_for_filter_->Init(column_vectors);
         bool_column_ = ColumnVector::Make(MakeShared<infinity::DataType>(LogicalType::kBoolean)); // default capacity
     }
 }
@@ -36,6 +36,10 @@ export module knn_scan_data;
 
 namespace infinity {
 
+// a copy of the queries normalized for cosine distance, or null if they are used as they are
+export UniquePtr<f32[]>
+NormalizeCosineQuery(const void *query, i64 dimension, u64 query_count, EmbeddingDataType elem_type, KnnDistanceType dist_type);
+
 export class KnnScanSharedData {
 public:
     KnnScanSharedData(SharedPtr<BaseTableRef> table_ref,
@@ -48,10 +52,14 @@ public:
                       i64 query_embedding_count,
                       void *query_embedding,
                       EmbeddingDataType elem_type,
-                      KnnDistanceType knn_distance_type)
+                      KnnDistanceType knn_distance_type,
+                      Optional<f32> radius = {})
         : table_ref_(table_ref), filter_expression_(filter_expression), block_column_entries_(Move(block_column_entries)),
           index_entries_(Move(index_entries)), opt_params_(Move(opt_params)), topk_(topk), dimension_(dimension),
-          query_count_(query_embedding_count), query_embedding_(query_embedding), elem_type_(elem_type), knn_distance_type_(knn_distance_type) {}
+          query_count_(query_embedding_count),
+          normalized_query_(NormalizeCosineQuery(query_embedding, dimension, query_embedding_count, elem_type, knn_distance_type)),
+          query_embedding_(normalized_query_ ? normalized_query_.get() : query_embedding), elem_type_(elem_type),
+          knn_distance_type_(knn_distance_type), radius_(radius) {}
 
 public:
     const SharedPtr<BaseTableRef> table_ref_{};
@@ -65,9 +73,12 @@ public:
     const i64 topk_;
     const i64 dimension_;
     const u64 query_count_;
+    const UniquePtr<f32[]> normalized_query_;
     void *const query_embedding_;
     const EmbeddingDataType elem_type_{EmbeddingDataType::kElemInvalid};
     const KnnDistanceType knn_distance_type_{KnnDistanceType::kInvalid};
+    // all the rows within the radius are searched instead of the top k if it is given
+    const Optional<f32> radius_;
 
     atomic_u64 current_block_idx_{0};
     atomic_u64 current_index_idx_{0};
@@ -103,8 +114,19 @@ public:
 
 public:
     using DistFunc = DataType (*)(const DataType *, const DataType *, SizeT);
+    template <typename ElemType>
+    using HalfDistFunc = DataType (*)(const DataType *, const ElemType *, SizeT);
 
     DistFunc dist_func_{};
+    // for the columns of half precision embeddings
+    HalfDistFunc<float16_t> f16_dist_func_{};
+    HalfDistFunc<bfloat16_t> bf16_dist_func_{};
+    // for the columns of int8 embeddings, searched with int8 queries
+    using I8DistFunc = DataType (*)(const i8 *, const i8 *, SizeT);
+    I8DistFunc i8_dist_func_{};
+    // for the columns of bit embeddings, the query and the vectors are packed bits
+    using BitDistFunc = DataType (*)(const u8 *, const u8 *, SizeT);
+    BitDistFunc bit_dist_func_{};
 };
 
 template <>
@@ -131,6 +153,8 @@ public:
 
     SharedPtr<ExpressionState> filter_state_{};
     UniquePtr<DataBlock> db_for_filter_{};
+    // the columns of `db_for_filter_` referenced by the filter, which are the only ones read from the blocks
+    Vector<SizeT> filter_column_idx_{};
     SharedPtr<ColumnVector> bool_column_{};
 };
 
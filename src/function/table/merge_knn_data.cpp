@@ -30,13 +30,16 @@ MergeKnnFunctionData::MergeKnnFunctionData(i64 query_count,
                                            i64 topk,
                                            EmbeddingDataType elem_type,
                                            KnnDistanceType knn_distance_type,
-                                           SharedPtr<BaseTableRef> table_ref)
-    : query_count_(query_count), topk_(topk), elem_type_(elem_type), table_ref_(table_ref) {
+                                           SharedPtr<BaseTableRef> table_ref,
+                                           Optional<f32> radius)
+    : query_count_(query_count), topk_(topk), radius_(radius), elem_type_(elem_type), table_ref_(table_ref) {
     switch (elem_type) {
         case kElemInvalid: {
             Error<ExecutorException>("Invalid element type");
         }
-        case kElemFloat: {
+        case kElemFloat:
+        case kElemInt8:
+        case kElemBit: {
             MergeKnnFunctionData::InitMergeKnn<f32>(knn_distance_type);
             break;
         }
@@ -54,7 +57,7 @@ void MergeKnnFunctionData::InitMergeKnn(KnnDistanceType knn_distance_type) {
         }
         case KnnDistanceType::kL2:
         case KnnDistanceType::kHamming: {
-            auto merge_knn_max = MakeShared<MergeKnn<DataType, CompareMax>>(query_count_, topk_);
+            auto merge_knn_max = MakeShared<MergeKnn<DataType, CompareMax>>(query_count_, topk_, radius_);
             merge_knn_max->Begin();
             merge_knn_base_ = Move(merge_knn_max);
             heap_type_ = MergeKnnHeapType::kMaxHeap;
@@ -62,7 +65,7 @@ void MergeKnnFunctionData::InitMergeKnn(KnnDistanceType knn_distance_type) {
         }
         case KnnDistanceType::kCosine:
         case KnnDistanceType::kInnerProduct: {
-            auto merge_knn_min = MakeShared<MergeKnn<DataType, CompareMin>>(query_count_, topk_);
+            auto merge_knn_min = MakeShared<MergeKnn<DataType, CompareMin>>(query_count_, topk_, radius_);
             merge_knn_min->Begin();
             merge_knn_base_ = Move(merge_knn_min);
             heap_type_ = MergeKnnHeapType::kMinHeap;
@@ -37,7 +37,8 @@ public:
                                   i64 topk,
                                   EmbeddingDataType elem_type,
                                   KnnDistanceType knn_distance_type,
-                                  SharedPtr<BaseTableRef> table_ref);
+                                  SharedPtr<BaseTableRef> table_ref,
+                                  Optional<f32> radius = {});
 
 private:
     template <typename DistType>
@@ -46,6 +47,7 @@ private:
 public:
     i64 query_count_{};
     i64 topk_{};
+    Optional<f32> radius_{};
     EmbeddingDataType elem_type_{EmbeddingDataType::kElemInvalid};
     MergeKnnHeapType heap_type_{MergeKnnHeapType::kInvalid};
     SharedPtr<BaseTableRef> table_ref_{};
@@ -23,7 +23,8 @@ namespace infinity {
 
 export class ResourceManager : public Singleton<ResourceManager> {
 public:
-    explicit ResourceManager(u64 total_cpu_count, u64 total_memory) : total_cpu_count_(total_cpu_count), total_memory_(total_memory) {}
+    explicit ResourceManager(u64 total_cpu_count, u64 total_memory)
+        : total_cpu_count_(total_cpu_count), total_memory_(total_memory), worker_pool_(int(Max<u64>(total_cpu_count, 1))) {}
 
     inline u64 GetCpuResource(u64 cpu_count) {
         total_cpu_count_ -= cpu_count;
@@ -42,9 +43,13 @@ public:
         return GetMemoryResource(16 * 1024 * 1024);
     }
 
+    // the workers shared by the parallel index searches and builds, as many as the worker cpu limit
+    inline ThreadPool &worker_pool() { return worker_pool_; }
+
 private:
     atomic_u64 total_cpu_count_;
     atomic_u64 total_memory_;
+    ThreadPool worker_pool_;
 };
 
 } // namespace infinity
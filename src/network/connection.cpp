@@ -274,6 +274,13 @@ void Connection::SendTableDescription(const SharedPtr<DataTable> &result_table)
                         object_width = 8;
                         break;
                     }
+                    case kElemFloat16:
+                    case kElemBFloat16: {
+                        // no half precision type in postgres, the values are sent as text of float4
+                        object_id = 1021;
+                        object_width = 2;
+                        break;
+                    }
                     case kElemInvalid: {
                         Error<TypeException>("Invalid embedding data type");
                     }
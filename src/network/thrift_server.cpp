@@ -1046,6 +1046,10 @@ private:
                 return infinity_thrift_rpc::ElementType::ElementFloat32;
             case EmbeddingDataType::kElemDouble:
                 return infinity_thrift_rpc::ElementType::ElementFloat64;
+            case EmbeddingDataType::kElemFloat16:
+            case EmbeddingDataType::kElemBFloat16: {
+                Error<TypeException>("Half precision embedding isn't supported by the rpc protocol yet");
+            }
             case EmbeddingDataType::kElemInvalid: {
                 Error<TypeException>("Invalid embedding element data type");
             }
@@ -710,16 +710,16 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  80
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   842
+#define YYLAST   847
 
 /* YYNTOKENS -- Number of terminals.  */
 #define YYNTOKENS  175
 /* YYNNTS -- Number of nonterminals.  */
 #define YYNNTS  94
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  341
+#define YYNRULES  343
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  665
+#define YYNSTATES  673
 
 /* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   414
@@ -791,34 +791,34 @@ static const yytype_int16 yyrline[] =
      720,   721,   722,   723,   724,   725,   726,   727,   728,   729,
      730,   731,   732,   733,   734,   735,   736,   737,   738,   741,
      743,   744,   745,   746,   749,   750,   751,   752,   753,   754,
-     755,   756,   757,   758,   759,   760,   761,   762,   763,   764,
-     783,   787,   797,   800,   803,   806,   810,   815,   822,   828,
-     838,   854,   888,   901,   904,   911,   917,   920,   923,   926,
-     929,   932,   935,   938,   945,   958,   962,   967,   980,   993,
-    1008,  1023,  1038,  1061,  1102,  1147,  1150,  1153,  1162,  1172,
-    1175,  1179,  1184,  1206,  1209,  1214,  1230,  1233,  1237,  1241,
-    1246,  1252,  1255,  1258,  1262,  1266,  1268,  1272,  1274,  1277,
-    1281,  1284,  1288,  1293,  1297,  1300,  1304,  1307,  1311,  1314,
-    1318,  1321,  1324,  1327,  1335,  1338,  1353,  1353,  1355,  1369,
-    1378,  1383,  1392,  1397,  1402,  1408,  1415,  1418,  1422,  1425,
-    1430,  1442,  1449,  1463,  1466,  1469,  1472,  1475,  1478,  1481,
-    1487,  1491,  1495,  1499,  1503,  1507,  1511,  1515,  1526,  1537,
-    1549,  1562,  1577,  1581,  1585,  1593,  1608,  1614,  1619,  1625,
-    1631,  1639,  1645,  1651,  1657,  1663,  1671,  1677,  1688,  1692,
-    1697,  1701,  1728,  1734,  1738,  1739,  1740,  1741,  1742,  1744,
-    1747,  1753,  1756,  1757,  1758,  1759,  1760,  1761,  1762,  1763,
-    1765,  1932,  1940,  1951,  1957,  1966,  1972,  1982,  1986,  1990,
-    1994,  1998,  2002,  2006,  2010,  2015,  2023,  2031,  2040,  2047,
-    2054,  2061,  2068,  2075,  2083,  2091,  2099,  2107,  2115,  2123,
-    2131,  2139,  2147,  2155,  2163,  2171,  2201,  2209,  2218,  2226,
-    2235,  2243,  2249,  2256,  2262,  2269,  2274,  2281,  2288,  2296,
-    2320,  2326,  2332,  2339,  2347,  2354,  2361,  2366,  2376,  2381,
-    2386,  2391,  2396,  2401,  2406,  2409,  2412,  2415,  2419,  2422,
-    2426,  2430,  2435,  2440,  2444,  2449,  2454,  2460,  2466,  2472,
-    2478,  2484,  2490,  2496,  2502,  2508,  2514,  2520,  2531,  2535,
-    2540,  2562,  2572,  2578,  2582,  2583,  2585,  2586,  2588,  2589,
-    2601,  2609,  2613,  2616,  2620,  2624,  2629,  2634,  2642,  2649,
-    2660,  2708
+     755,   756,   757,   773,   774,   775,   776,   777,   778,   779,
+     780,   781,   815,   819,   829,   832,   835,   838,   842,   847,
+     854,   860,   870,   886,   920,   933,   936,   943,   949,   952,
+     955,   958,   961,   964,   967,   970,   977,   990,   994,   999,
+    1012,  1025,  1040,  1055,  1070,  1093,  1134,  1179,  1182,  1185,
+    1194,  1204,  1207,  1211,  1216,  1238,  1241,  1246,  1262,  1265,
+    1269,  1273,  1278,  1284,  1287,  1290,  1294,  1298,  1300,  1304,
+    1306,  1309,  1313,  1316,  1320,  1325,  1329,  1332,  1336,  1339,
+    1343,  1346,  1350,  1353,  1356,  1359,  1367,  1370,  1385,  1385,
+    1387,  1401,  1410,  1415,  1424,  1429,  1434,  1440,  1447,  1450,
+    1454,  1457,  1462,  1474,  1481,  1495,  1498,  1501,  1504,  1507,
+    1510,  1513,  1519,  1523,  1527,  1531,  1535,  1539,  1543,  1547,
+    1558,  1569,  1581,  1594,  1609,  1613,  1617,  1625,  1640,  1646,
+    1651,  1657,  1663,  1671,  1677,  1683,  1689,  1695,  1703,  1709,
+    1720,  1724,  1729,  1733,  1760,  1766,  1770,  1771,  1772,  1773,
+    1774,  1776,  1779,  1785,  1788,  1789,  1790,  1791,  1792,  1793,
+    1794,  1795,  1797,  1963,  1971,  1982,  1988,  1997,  2003,  2013,
+    2017,  2021,  2025,  2029,  2033,  2037,  2041,  2046,  2054,  2062,
+    2071,  2078,  2085,  2092,  2099,  2106,  2114,  2122,  2130,  2138,
+    2146,  2154,  2162,  2170,  2178,  2186,  2194,  2202,  2232,  2240,
+    2249,  2257,  2266,  2274,  2280,  2287,  2293,  2300,  2305,  2312,
+    2319,  2327,  2351,  2357,  2363,  2370,  2378,  2385,  2392,  2397,
+    2407,  2412,  2417,  2422,  2427,  2432,  2437,  2440,  2443,  2446,
+    2450,  2453,  2457,  2461,  2466,  2471,  2475,  2480,  2485,  2491,
+    2497,  2503,  2509,  2515,  2521,  2527,  2533,  2539,  2545,  2551,
+    2562,  2566,  2571,  2593,  2603,  2609,  2613,  2614,  2616,  2617,
+    2619,  2620,  2632,  2640,  2644,  2647,  2651,  2655,  2660,  2665,
+    2673,  2680,  2691,  2741
 };
 #endif
 
@@ -893,12 +893,12 @@ yysymbol_name (yysymbol_kind_t yysymbol)
 }
 #endif
 
-#define YYPACT_NINF (-564)
+#define YYPACT_NINF (-585)
 
 #define yypact_value_is_default(Yyn) \
   ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF (-332)
+#define YYTABLE_NINF (-334)
 
 #define yytable_value_is_error(Yyn) \
   ((Yyn) == YYTABLE_NINF)
@@ -907,73 +907,74 @@ yysymbol_name (yysymbol_kind_t yysymbol)
    STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-     556,   234,    36,   249,    85,    18,    85,   221,   395,    30,
-      61,   243,    96,    85,   120,   -95,   -54,   162,   -18,  -564,
-    -564,  -564,  -564,  -564,  -564,  -564,  -564,   172,  -564,  -564,
-     156,  -564,  -564,  -564,  -564,   108,   108,   108,   108,    47,
-      85,   118,   118,   118,   118,   118,    32,   208,    85,   309,
-     186,   232,  -564,  -564,  -564,  -564,  -564,  -564,  -564,   584,
-    -564,  -564,  -564,    89,    91,  -564,  -564,    85,   343,  -564,
-    -564,  -564,  -564,  -564,   206,   117,  -564,   259,   128,   130,
-    -564,    24,  -564,   293,  -564,  -564,    -2,   269,  -564,   280,
-     285,   329,    85,    85,    85,   368,   336,   226,   340,   411,
-      85,    85,    85,   418,   419,   421,   364,   431,   431,    12,
-      54,  -564,  -564,  -564,  -564,  -564,  -564,  -564,   172,  -564,
-    -564,  -564,  -564,  -564,  -564,  -564,   433,  -564,   270,   120,
-     431,  -564,  -564,  -564,  -564,    -2,  -564,  -564,  -564,   358,
-     392,   378,   374,  -564,   -40,  -564,   226,  -564,    85,   443,
-      15,  -564,  -564,  -564,  -564,  -564,   389,  -564,   288,   -49,
-    -564,   358,  -564,  -564,   375,   376,  -564,  -564,  -564,  -564,
-    -564,  -564,  -564,  -564,  -564,  -564,   404,   156,  -564,  -564,
-     281,   282,   289,  -564,  -564,   634,   387,   296,   298,   255,
-     451,  -564,  -564,   452,   300,   305,   310,   311,   312,   468,
-     468,  -564,   393,   202,   -53,  -564,    -6,   506,  -564,  -564,
-    -564,  -564,  -564,  -564,  -564,  -564,  -564,  -564,  -564,   307,
-    -564,  -564,   -98,  -564,   -43,  -564,   358,   358,   420,  -564,
-     -54,     9,   435,   314,  -564,  -102,   317,  -564,    85,   358,
-     421,  -564,   263,   326,   327,   494,   330,  -564,  -564,   148,
-    -564,  -564,  -564,  -564,  -564,  -564,  -564,  -564,  -564,  -564,
-    -564,  -564,   468,   334,   558,   428,   358,   358,   -61,   142,
-    -564,   634,  -564,   504,   358,   505,   507,   508,   239,   239,
-    -564,  -564,   339,   -58,     5,   358,   362,   510,   358,   358,
-     -46,   348,   -23,   468,   468,   468,   468,   468,   468,   468,
-     468,   468,   468,   468,   468,   468,   468,     4,  -564,   513,
-    -564,   515,   350,  -564,    20,   263,   358,  -564,   172,   694,
-     415,   355,   -14,  -564,  -564,  -564,   -54,   443,   360,  -564,
-     528,   358,   359,  -564,   263,  -564,   332,   332,  -564,  -564,
-     358,  -564,    10,   428,   394,   363,    11,   -56,   167,  -564,
-     358,   358,   464,    59,   365,    53,    80,  -564,  -564,   -54,
-     366,   676,  -564,    50,  -564,  -564,    43,   364,  -564,  -564,
-     400,   371,   468,   202,   426,  -564,   610,   610,    75,    75,
-     547,   610,   610,    75,    75,   239,   239,  -564,  -564,  -564,
-    -564,  -564,  -564,  -564,   358,  -564,  -564,  -564,   263,  -564,
-    -564,  -564,  -564,  -564,  -564,  -564,  -564,  -564,  -564,  -564,
-     377,  -564,  -564,  -564,  -564,  -564,  -564,  -564,  -564,  -564,
-    -564,   379,   383,   116,   384,   443,  -564,     9,   172,    82,
-     443,  -564,    99,   386,   554,   557,  -564,   110,  -564,   112,
-     129,  -564,   388,  -564,   694,   358,  -564,   358,   -47,    81,
-     468,   405,   570,  -564,   574,  -564,   575,    31,     5,   509,
-    -564,  -564,  -564,  -564,  -564,  -564,   527,  -564,   581,  -564,
-    -564,  -564,  -564,  -564,   416,   537,   202,   610,   390,   143,
-    -564,   468,  -564,   583,   291,   564,   476,   485,  -564,  -564,
-     116,  -564,   443,   155,  -564,   455,   160,  -564,   358,  -564,
-    -564,  -564,   332,  -564,  -564,  -564,   432,   263,    41,  -564,
-     358,   328,   438,  -564,  -564,   165,   434,   436,    50,   676,
-       5,     5,   444,    43,   553,   565,   446,   166,  -564,  -564,
-     558,   170,   445,   447,   448,   454,   460,   461,   463,   470,
-     471,   472,   474,   480,   481,   486,   487,   488,  -564,  -564,
-    -564,   174,  -564,   603,   483,   175,  -564,  -564,  -564,   263,
-    -564,   614,  -564,   616,  -564,  -564,  -564,  -564,   601,   443,
-    -564,  -564,  -564,  -564,   358,   358,  -564,  -564,  -564,  -564,
-     657,   659,   668,   671,   672,   673,   678,   680,   681,   683,
-     684,   689,   690,   691,   692,   695,   696,  -564,   626,   700,
-    -564,   530,   534,   358,   181,   541,   263,   545,   546,   566,
-     567,   568,   569,   571,   576,   577,   578,   579,   582,   596,
-     597,   598,   628,   629,   632,  -564,   626,   737,  -564,   263,
-    -564,  -564,  -564,  -564,  -564,  -564,  -564,  -564,  -564,  -564,
-    -564,  -564,  -564,  -564,  -564,  -564,  -564,  -564,   749,  -564,
-     633,   643,   182,  -564,   800,   210,  -564,   749,   637,  -564,
-    -564,  -564,  -564,   626,  -564
+     206,    41,    22,   248,    59,    -4,    59,   199,   499,    55,
+      42,   332,    69,    59,    75,   -51,   -48,   105,   -52,  -585,
+    -585,  -585,  -585,  -585,  -585,  -585,  -585,   237,  -585,  -585,
+     117,  -585,  -585,  -585,  -585,    63,    63,    63,    63,    -3,
+      59,    84,    84,    84,    84,    84,    32,   156,    59,   282,
+     183,   220,  -585,  -585,  -585,  -585,  -585,  -585,  -585,   505,
+    -585,  -585,  -585,    39,    74,  -585,  -585,    59,   354,  -585,
+    -585,  -585,  -585,  -585,   179,    72,  -585,   242,    92,   101,
+    -585,   151,  -585,   230,  -585,  -585,    -2,   218,  -585,   223,
+     212,   287,    59,    59,    59,   299,   254,   162,   250,   323,
+      59,    59,    59,   331,   359,   364,   311,   378,   378,    30,
+      34,  -585,  -585,  -585,  -585,  -585,  -585,  -585,   237,  -585,
+    -585,  -585,  -585,  -585,  -585,  -585,   398,  -585,   240,    75,
+     378,  -585,  -585,  -585,  -585,    -2,  -585,  -585,  -585,   430,
+     365,   352,   348,  -585,   -43,  -585,   162,  -585,    59,   419,
+       0,  -585,  -585,  -585,  -585,  -585,   374,  -585,   278,   -41,
+    -585,   430,  -585,  -585,   370,   380,  -585,  -585,  -585,  -585,
+    -585,  -585,  -585,  -585,  -585,  -585,   421,   117,  -585,  -585,
+     306,   317,   302,  -585,  -585,   264,   489,   334,   335,   301,
+     498,  -585,  -585,   503,   343,   350,   353,   357,   358,   548,
+     548,  -585,   444,   333,   -58,  -585,   -21,   600,  -585,  -585,
+    -585,  -585,  -585,  -585,  -585,  -585,  -585,  -585,  -585,   339,
+    -585,  -585,  -118,  -585,  -111,  -585,   430,   430,   457,  -585,
+     -48,    17,   473,   369,  -585,  -124,   372,  -585,    59,   430,
+     364,  -585,   341,   373,   375,   523,   376,  -585,  -585,   195,
+    -585,  -585,  -585,  -585,  -585,  -585,  -585,  -585,  -585,  -585,
+    -585,  -585,   548,   385,   651,   466,   430,   430,   106,    -6,
+    -585,   264,  -585,   540,   430,   542,   552,   553,    44,    44,
+    -585,  -585,   389,   -86,     2,   430,   406,   559,   430,   430,
+     -44,   393,   -25,   548,   548,   548,   548,   548,   548,   548,
+     548,   548,   548,   548,   548,   548,   548,     4,  -585,   558,
+    -585,   560,   392,  -585,   -49,   341,   430,  -585,   237,   735,
+     454,   401,   -59,  -585,  -585,  -585,   -48,   419,   402,  -585,
+     570,   430,   400,  -585,   341,  -585,   386,   386,  -585,  -585,
+     430,  -585,    14,   466,   435,   407,   -19,    67,   174,  -585,
+     430,   430,   508,   -78,   403,    21,    53,  -585,  -585,   -48,
+     408,   371,  -585,    43,  -585,  -585,   126,   311,  -585,  -585,
+     443,   413,   548,   333,   468,  -585,   133,   133,   320,   320,
+     612,   133,   133,   320,   320,    44,    44,  -585,  -585,  -585,
+    -585,  -585,  -585,  -585,   430,  -585,  -585,  -585,   341,  -585,
+    -585,  -585,  -585,  -585,  -585,  -585,  -585,  -585,  -585,  -585,
+     420,  -585,  -585,  -585,  -585,  -585,  -585,  -585,  -585,  -585,
+    -585,   422,   426,    81,   427,   419,  -585,    17,   237,   157,
+     419,  -585,   159,   429,   585,   588,  -585,   190,  -585,   198,
+     203,  -585,   431,  -585,   735,   430,  -585,   430,   -15,   102,
+     548,   433,   599,  -585,   601,  -585,   602,   -12,     2,   551,
+    -585,  -585,  -585,  -585,  -585,  -585,   557,  -585,   608,  -585,
+    -585,  -585,  -585,  -585,   438,   565,   333,   133,   445,   204,
+    -585,   548,  -585,   609,   150,   256,   502,   500,  -585,  -585,
+      81,  -585,   419,   209,  -585,   474,   227,  -585,   430,  -585,
+    -585,  -585,   386,  -585,  -585,  -585,   448,   341,    16,  -585,
+     430,   561,   447,  -585,  -585,   234,   451,   452,    43,   371,
+       2,     2,   455,   126,   575,   577,   460,   235,  -585,  -585,
+     651,   241,   458,   459,   461,   462,   463,   464,   465,   467,
+     469,   475,   476,   477,   482,   484,   486,   487,   488,   490,
+    -585,  -585,  -585,   268,  -585,   637,   496,   269,  -585,  -585,
+    -585,   341,  -585,   644,  -585,   659,  -585,  -585,  -585,  -585,
+     607,   419,  -585,  -585,  -585,  -585,   430,   430,  -585,  -585,
+    -585,  -585,   664,   666,   667,   668,   670,   671,   673,   674,
+     676,   677,   678,   679,   680,   681,   683,   684,   685,   686,
+     692,  -585,   625,   697,  -585,   527,   532,   430,   274,   533,
+     341,   537,   538,   539,   543,   544,   567,   568,   569,   571,
+     572,   573,   578,   580,   581,   583,   584,   586,   587,   598,
+     549,  -585,   625,   726,  -585,   341,  -585,  -585,  -585,  -585,
+    -585,  -585,  -585,  -585,  -585,  -585,  -585,  -585,  -585,  -585,
+    -585,  -585,  -585,  -585,  -585,  -585,   728,  -585,   582,   610,
+     296,  -585,   753,   319,  -585,   728,   611,  -585,  -585,  -585,
+    -585,   625,  -585
 };
 
 /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
@@ -981,88 +982,89 @@ static const yytype_int16 yypact[] =
    means the default is an error.  */
 static const yytype_int16 yydefact[] =
 {
-     167,     0,     0,     0,     0,     0,     0,     0,   103,     0,
-       0,     0,     0,     0,     0,     0,   167,     0,   329,     3,
-       5,    10,    12,    13,    11,     6,     7,     9,   116,   115,
-       0,     8,    14,    15,    16,   327,   327,   327,   327,   327,
-       0,   325,   325,   325,   325,   325,   160,     0,     0,     0,
-       0,     0,    97,   101,    98,    99,   100,   102,    96,   167,
-     181,   182,   180,     0,     0,   183,   184,     0,   187,   192,
-     193,   194,   196,   195,     0,   166,   168,     0,     0,     0,
-       1,   167,     2,   150,   152,   153,     0,   139,   121,   127,
-       0,     0,     0,     0,     0,     0,     0,    94,     0,     0,
-       0,     0,     0,     0,     0,     0,   145,     0,     0,     0,
-       0,    95,    17,    22,    24,    23,    18,    19,    21,    20,
-      25,    26,    27,   185,   186,   191,     0,   188,     0,     0,
-       0,   120,   119,     4,   151,     0,   117,   118,   138,     0,
-       0,   135,     0,    28,     0,    29,    94,   330,     0,     0,
-     167,   324,   108,   110,   109,   111,     0,   161,     0,   145,
-     105,     0,    90,   323,     0,     0,   200,   202,   201,   198,
-     199,   205,   207,   206,   203,   204,   189,     0,   169,   197,
-       0,     0,   284,   288,   291,   292,     0,     0,     0,     0,
-       0,   289,   290,     0,     0,     0,     0,     0,     0,     0,
-       0,   286,     0,   167,   141,   208,   213,   214,   226,   227,
-     228,   229,   223,   218,   217,   216,   224,   225,   215,   222,
-     221,   296,     0,   297,     0,   295,     0,     0,   137,   326,
-     167,     0,     0,     0,    88,     0,     0,    92,     0,     0,
-       0,   104,   144,     0,     0,     0,     0,   124,   123,     0,
-     307,   306,   309,   308,   311,   310,   313,   312,   315,   314,
-     317,   316,     0,     0,   250,   167,     0,     0,     0,     0,
-     293,     0,   294,     0,     0,     0,     0,     0,   252,   251,
-     304,   301,     0,     0,     0,     0,   143,     0,     0,     0,
+     169,     0,     0,     0,     0,     0,     0,     0,   105,     0,
+       0,     0,     0,     0,     0,     0,   169,     0,   331,     3,
+       5,    10,    12,    13,    11,     6,     7,     9,   118,   117,
+       0,     8,    14,    15,    16,   329,   329,   329,   329,   329,
+       0,   327,   327,   327,   327,   327,   162,     0,     0,     0,
+       0,     0,    99,   103,   100,   101,   102,   104,    98,   169,
+     183,   184,   182,     0,     0,   185,   186,     0,   189,   194,
+     195,   196,   198,   197,     0,   168,   170,     0,     0,     0,
+       1,   169,     2,   152,   154,   155,     0,   141,   123,   129,
+       0,     0,     0,     0,     0,     0,     0,    96,     0,     0,
+       0,     0,     0,     0,     0,     0,   147,     0,     0,     0,
+       0,    97,    17,    22,    24,    23,    18,    19,    21,    20,
+      25,    26,    27,   187,   188,   193,     0,   190,     0,     0,
+       0,   122,   121,     4,   153,     0,   119,   120,   140,     0,
+       0,   137,     0,    28,     0,    29,    96,   332,     0,     0,
+     169,   326,   110,   112,   111,   113,     0,   163,     0,   147,
+     107,     0,    92,   325,     0,     0,   202,   204,   203,   200,
+     201,   207,   209,   208,   205,   206,   191,     0,   171,   199,
+       0,     0,   286,   290,   293,   294,     0,     0,     0,     0,
+       0,   291,   292,     0,     0,     0,     0,     0,     0,     0,
+       0,   288,     0,   169,   143,   210,   215,   216,   228,   229,
+     230,   231,   225,   220,   219,   218,   226,   227,   217,   224,
+     223,   298,     0,   299,     0,   297,     0,     0,   139,   328,
+     169,     0,     0,     0,    90,     0,     0,    94,     0,     0,
+       0,   106,   146,     0,     0,     0,     0,   126,   125,     0,
+     309,   308,   311,   310,   313,   312,   315,   314,   317,   316,
+     319,   318,     0,     0,   252,   169,     0,     0,     0,     0,
+     295,     0,   296,     0,     0,     0,     0,     0,   254,   253,
+     306,   303,     0,     0,     0,     0,   145,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   300,     0,
-     303,     0,   126,   128,   133,   134,     0,   122,    31,     0,
-       0,     0,     0,    34,    36,    37,   167,     0,    33,    93,
-       0,     0,    91,   112,   107,   106,     0,     0,   190,   170,
-       0,   245,     0,   167,     0,     0,     0,     0,     0,   275,
-       0,     0,     0,     0,     0,     0,     0,   220,   219,   167,
-     140,   154,   156,   165,   157,   209,     0,   145,   212,   268,
-     269,     0,     0,   167,     0,   249,   259,   260,   263,   264,
-       0,   266,   258,   261,   262,   254,   253,   255,   256,   257,
-     285,   287,   302,   305,     0,   131,   132,   130,   136,    40,
+       0,     0,     0,     0,     0,     0,     0,     0,   302,     0,
+     305,     0,   128,   130,   135,   136,     0,   124,    31,     0,
+       0,     0,     0,    34,    36,    37,   169,     0,    33,    95,
+       0,     0,    93,   114,   109,   108,     0,     0,   192,   172,
+       0,   247,     0,   169,     0,     0,     0,     0,     0,   277,
+       0,     0,     0,     0,     0,     0,     0,   222,   221,   169,
+     142,   156,   158,   167,   159,   211,     0,   147,   214,   270,
+     271,     0,     0,   169,     0,   251,   261,   262,   265,   266,
+       0,   268,   260,   263,   264,   256,   255,   257,   258,   259,
+     287,   289,   304,   307,     0,   133,   134,   132,   138,    40,
       43,    44,    41,    42,    45,    46,    60,    47,    49,    48,
       63,    50,    51,    52,    53,    54,    55,    56,    57,    58,
       59,     0,     0,    38,     0,     0,    30,     0,    32,     0,
-       0,    89,     0,     0,     0,     0,   322,     0,   318,     0,
-       0,   246,     0,   280,     0,     0,   273,     0,     0,     0,
-       0,     0,     0,   233,     0,   235,     0,     0,     0,     0,
-     174,   175,   176,   177,   173,   178,     0,   163,     0,   158,
-     237,   238,   239,   240,   142,   149,   167,   267,     0,     0,
-     248,     0,   129,     0,     0,     0,     0,     0,    83,    84,
-      39,    80,     0,     0,    35,     0,     0,   210,     0,   321,
-     320,   114,     0,   113,   247,   281,     0,   277,     0,   276,
-       0,     0,     0,   298,   299,     0,     0,     0,   165,   155,
-       0,     0,   162,     0,     0,   147,     0,     0,   282,   271,
-     270,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    85,    82,
-      81,     0,    87,     0,     0,     0,   319,   279,   274,   278,
-     265,     0,   231,     0,   234,   236,   159,   171,     0,     0,
-     241,   242,   243,   244,     0,     0,   125,   283,   272,    62,
+       0,    91,     0,     0,     0,     0,   324,     0,   320,     0,
+       0,   248,     0,   282,     0,     0,   275,     0,     0,     0,
+       0,     0,     0,   235,     0,   237,     0,     0,     0,     0,
+     176,   177,   178,   179,   175,   180,     0,   165,     0,   160,
+     239,   240,   241,   242,   144,   151,   169,   269,     0,     0,
+     250,     0,   131,     0,     0,     0,     0,     0,    85,    86,
+      39,    82,     0,     0,    35,     0,     0,   212,     0,   323,
+     322,   116,     0,   115,   249,   283,     0,   279,     0,   278,
+       0,     0,     0,   300,   301,     0,     0,     0,   167,   157,
+       0,     0,   164,     0,     0,   149,     0,     0,   284,   273,
+     272,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    86,   333,     0,
-     211,     0,     0,     0,     0,   148,   146,     0,     0,     0,
+      87,    84,    83,     0,    89,     0,     0,     0,   321,   281,
+     276,   280,   267,     0,   233,     0,   236,   238,   161,   173,
+       0,     0,   243,   244,   245,   246,     0,     0,   127,   285,
+     274,    62,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   340,   333,     0,   232,   172,
-     164,    61,    67,    68,    65,    66,    69,    70,    71,    64,
-      75,    76,    73,    74,    77,    78,    79,    72,     0,   341,
-       0,   336,     0,   334,     0,     0,   332,     0,     0,   337,
-     339,   338,   335,   333,   230
+       0,    88,   335,     0,   213,     0,     0,     0,     0,   150,
+     148,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   342,   335,     0,   234,   174,   166,    61,    72,    67,
+      68,    65,    66,    69,    70,    71,    64,    81,    76,    77,
+      74,    75,    78,    79,    80,    73,     0,   343,     0,   338,
+       0,   336,     0,     0,   334,     0,     0,   339,   341,   340,
+     337,   335,   232
 };
 
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -564,  -564,  -564,   728,  -564,   751,  -564,   385,  -564,   367,
-    -564,   323,  -564,  -322,   755,   756,   670,  -564,  -564,   758,
-    -564,   580,   759,   760,   -57,   805,   -16,   645,   688,   -39,
-    -564,  -564,   430,  -564,  -564,  -564,  -564,  -564,  -564,  -155,
-    -564,  -564,  -564,  -564,   369,  -104,    17,   308,  -564,  -564,
-     699,  -564,  -564,   766,   770,   771,   772,  -246,  -564,   548,
-    -160,  -158,  -357,  -356,  -352,  -351,  -564,  -564,  -564,  -564,
-    -564,  -564,   572,  -564,  -564,  -564,  -564,  -564,   381,  -564,
-     391,  -564,   641,   498,   335,   -33,   252,   271,  -564,  -564,
-    -563,  -564,   179,  -564
+    -585,  -585,  -585,   690,  -585,   721,  -585,   356,  -585,   337,
+    -585,   298,  -585,  -317,   730,   731,   645,  -585,  -585,   734,
+    -585,   554,   736,   737,   -56,   781,   -16,   621,   665,   -55,
+    -585,  -585,   405,  -585,  -585,  -585,  -585,  -585,  -585,  -155,
+    -585,  -585,  -585,  -585,   344,   -14,     9,   283,  -585,  -585,
+     675,  -585,  -585,   744,   746,   747,   748,  -247,  -585,   524,
+    -160,  -158,  -350,  -343,  -342,  -341,  -585,  -585,  -585,  -585,
+    -585,  -585,   576,  -585,  -585,  -585,  -585,  -585,   390,  -585,
+     396,  -585,   615,   506,   308,   -71,   266,   280,  -585,  -585,
+    -584,  -585,   175,  -585
 };
 
 /* YYDEFGOTO[NTERM-NUM].  */
@@ -1072,12 +1074,12 @@ static const yytype_int16 yydefgoto[] =
      490,   491,   325,   235,    21,    22,   150,    23,    59,    24,
      159,   160,    25,    26,    27,    28,    29,    88,   136,    89,
      141,   312,   313,   397,   228,   317,   139,   286,   367,   162,
-     576,   525,    86,   360,   361,   362,   363,   469,    30,    75,
+     578,   525,    86,   360,   361,   362,   363,   469,    30,    75,
       76,   364,   466,    31,    32,    33,    34,   204,   332,   205,
      206,   207,   208,   209,   210,   211,   474,   212,   213,   214,
      215,   216,   269,   217,   218,   219,   220,   512,   221,   222,
      223,   224,   225,   437,   438,   164,    99,    91,    82,    96,
-     625,   652,   653,   328
+     631,   660,   661,   328
 };
 
 /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
@@ -1085,180 +1087,180 @@ static const yytype_int16 yydefgoto[] =
    number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-      79,   242,   118,   342,   241,   429,    87,   390,    46,   470,
-     471,   230,   319,   161,   472,   473,   166,   167,   168,   284,
-      14,    47,   267,    49,  -328,   371,   445,    68,   264,   268,
-      73,     1,   509,     2,     3,     4,     5,     6,     7,     8,
-       9,   278,   279,   283,    10,   287,   374,   137,   236,    11,
-      12,    13,    83,   467,    84,    85,    77,    97,   171,   172,
-     173,    60,   444,   649,    46,   106,   314,   315,    40,   329,
-     169,   308,   330,    61,    62,   165,   309,   288,   289,   334,
-     288,   289,   288,   289,   125,   432,   395,   396,    46,    14,
-      48,   288,   289,   375,   440,   372,   181,   179,    14,    72,
-     664,   468,    67,   493,   264,  -331,   346,   347,   496,   144,
-     145,   146,   174,   358,   353,    90,    16,   153,   154,   155,
-     558,   285,   320,    74,   321,   240,   310,   479,   369,   370,
-     231,   311,   288,   289,   237,   376,   377,   378,   379,   380,
-     381,   382,   383,   384,   385,   386,   387,   388,   389,   288,
-     289,   182,   183,   184,   185,    81,   398,   426,   288,   289,
-     427,   170,    80,   510,    87,   233,   570,   571,   135,   391,
-     551,   572,   573,   318,    15,   359,    90,    63,    64,   288,
-     289,   441,    65,    66,   285,   486,    98,   282,   195,   109,
-     448,   449,   292,    83,    16,    84,    85,   288,   289,   196,
-     197,   198,   518,   175,   104,   182,   183,   184,   185,   340,
-    -332,  -332,   475,   659,   477,   660,   661,   186,   187,   288,
-     289,   349,   105,   350,   453,   351,   188,   454,   189,   487,
-     527,   488,   489,   451,   314,   110,  -332,  -332,   302,   303,
-     304,   305,   306,   123,   190,   124,   446,   604,   447,   345,
-     351,   455,   555,   495,   456,   333,   330,   128,   182,   183,
-     184,   185,    35,    36,    37,   130,   191,   192,   193,   428,
-     497,   186,   187,   285,    38,    39,    14,    41,    42,    43,
-     188,   501,   189,   503,   502,   507,   502,   508,   194,    44,
-      45,   129,   511,   195,   100,   101,   102,   103,   190,   131,
-     504,   132,   457,   285,   196,   197,   198,    92,    93,    94,
-      95,   199,   200,   201,   529,   134,   202,   285,   203,   341,
-     191,   192,   193,   530,   186,   187,   552,   442,   605,   330,
-     138,   554,   143,   188,   330,   189,   562,   578,   267,   563,
-     285,   579,   194,   140,   580,   597,   600,   195,   330,   285,
-     559,   190,   630,   656,   142,   330,   657,   478,   196,   197,
-     198,   182,   183,   184,   185,   199,   200,   201,    50,    51,
-     202,   147,   203,   191,   192,   193,   532,   533,   534,   535,
-     536,   107,   108,   537,   538,    69,    70,    71,   126,   127,
-     182,   183,   184,   185,   148,   194,   149,   344,   280,   281,
-     195,   288,   289,   539,   304,   305,   306,   434,   435,   436,
-     151,   196,   197,   198,   152,   606,   567,   568,   199,   200,
-     201,   156,   157,   202,   158,   203,   161,   186,   187,    52,
-      53,    54,    55,    56,    57,   163,   188,    58,   189,   176,
-     177,   226,   227,   629,   229,   292,   234,   238,   239,   243,
-     244,   245,   247,   248,   190,   270,   262,   263,   271,   249,
-     526,   293,   294,   295,   296,   188,   265,   189,   266,   298,
-     273,   182,   183,   184,   185,   274,   191,   192,   193,   307,
-     275,   276,   277,   190,   327,   316,   326,   331,   299,   300,
-     301,   302,   303,   304,   305,   306,   336,   337,   194,   560,
-     338,   339,    14,   195,   343,   191,   192,   193,   352,   354,
-     357,   355,   356,   368,   196,   197,   198,   366,   373,   392,
-     393,   199,   200,   201,   394,   425,   202,   194,   203,   424,
-     430,   431,   195,   433,   443,   372,   450,   262,   288,   452,
-     458,   476,   480,   196,   197,   198,   188,   483,   189,   484,
-     199,   200,   201,   485,   492,   202,   498,   203,   499,   505,
-     500,   528,   520,     1,   190,     2,     3,     4,     5,     6,
-       7,     8,     9,   202,   515,   290,    10,   291,   516,   517,
-     521,    11,    12,    13,   522,   524,   191,   192,   193,   531,
-     523,     1,   548,     2,     3,     4,     5,     6,     7,   549,
-       9,   553,   574,   557,    10,   564,   598,   565,   194,    11,
-      12,    13,   561,   195,   569,   575,   344,   577,   601,   581,
-     602,   582,   583,   292,   196,   197,   198,   344,   584,   599,
-      14,   199,   200,   201,   585,   586,   202,   587,   203,   293,
-     294,   295,   296,   297,   588,   589,   590,   298,   591,   540,
-     541,   542,   543,   544,   592,   593,   545,   546,    14,   603,
-     594,   595,   596,   607,   292,   608,   299,   300,   301,   302,
-     303,   304,   305,   306,   609,   292,   547,   610,   611,   612,
-     293,   294,   295,   296,   613,   481,   614,   615,   298,   616,
-     617,   293,   294,   295,   296,   618,   619,   620,   621,   298,
-     624,   622,   623,   626,   627,   628,    15,   299,   300,   301,
-     302,   303,   304,   305,   306,   285,   631,   632,   299,   300,
-     301,   302,   303,   304,   305,   306,    16,   292,   459,  -179,
-     460,   461,   462,   463,    15,   464,   465,   633,   634,   635,
-     636,   650,   637,  -332,  -332,   295,   296,   638,   639,   640,
-     641,  -332,   651,   642,    16,   250,   251,   252,   253,   254,
-     255,   256,   257,   258,   259,   260,   261,   643,   644,   645,
-    -332,   300,   301,   302,   303,   304,   305,   306,   399,   400,
-     401,   402,   403,   404,   405,   406,   407,   408,   409,   410,
-     411,   412,   413,   414,   415,   416,   417,   418,   419,   646,
-     647,   420,   648,   655,   421,   422,   658,   654,   663,   133,
-     112,   506,   494,   550,   113,   114,   232,   115,   116,   117,
-     335,    78,   246,   180,   482,   119,   566,   519,   178,   120,
-     121,   122,   513,   365,   272,   439,   662,   556,     0,     0,
-     348,     0,   514
+      79,   242,   342,   118,   241,    46,    87,   390,   230,    83,
+     429,    84,    85,    47,   284,    49,   470,   395,   396,    68,
+     319,   161,    73,   471,   472,   473,    14,   371,   264,   268,
+     287,   137,   444,   236,   166,   167,   168,   165,   171,   172,
+     173,   278,   279,   283,   374,    46,   467,   329,   657,    97,
+     330,   308,   288,   289,    40,  -333,   309,   106,   310,   179,
+     288,   289,    46,   311,   509,    90,   314,   315,    48,    35,
+      36,    37,    72,   349,    14,   350,   125,   351,    74,   334,
+     181,    38,    39,    67,   432,   358,    60,   672,   169,   288,
+     289,   375,   174,   440,   468,   560,   451,   372,    61,    62,
+      77,   144,   145,   146,   264,    80,   346,   347,   493,   153,
+     154,   155,   426,   496,   353,   427,   285,   288,   289,   288,
+     289,    81,    16,   288,   289,    87,   479,   231,   369,   370,
+     320,    90,   321,   240,   237,   376,   377,   378,   379,   380,
+     381,   382,   383,   384,   385,   386,   387,   388,   389,   445,
+     486,  -330,    98,   532,   288,   289,   398,   233,     1,   518,
+       2,     3,     4,     5,     6,     7,     8,     9,   135,   391,
+     105,    10,   359,   572,   318,   553,    11,    12,    13,   170,
+     573,   574,   575,   175,   510,   441,   109,   282,   285,   267,
+     448,   449,   453,   123,   487,   454,   488,   489,   182,   183,
+     184,   185,    63,    64,   104,   288,   289,    65,    66,   304,
+     305,   306,   475,     1,   477,     2,     3,     4,     5,     6,
+       7,     8,     9,   110,   455,    14,    10,   456,   124,   527,
+     128,    11,    12,    13,   314,   533,   534,   535,   536,   537,
+     288,   289,   538,   539,   288,   289,   129,   333,   130,   345,
+     292,   557,   134,   446,   608,   447,   340,   351,    83,   541,
+      84,    85,   540,   131,   186,   187,  -334,  -334,   295,   296,
+     428,   195,   132,   188,  -334,   189,    41,    42,    43,   138,
+      14,   142,   196,   197,   198,   507,   140,   508,    44,    45,
+     143,   190,   511,  -334,   300,   301,   302,   303,   304,   305,
+     306,    15,   147,   457,   182,   183,   184,   185,   100,   101,
+     102,   103,   148,   191,   192,   193,    92,    93,    94,    95,
+     151,    16,   667,   530,   668,   669,   152,   442,   495,   609,
+     497,   330,   149,   285,   156,   194,   182,   183,   184,   185,
+     195,   542,   543,   544,   545,   546,    50,    51,   547,   548,
+     561,   196,   197,   198,   107,   108,    15,   478,   199,   200,
+     201,   501,   157,   202,   502,   203,   341,   158,   549,   503,
+     186,   187,   502,   161,   504,   529,    16,   285,   285,   188,
+     554,   189,   163,   330,   267,   250,   251,   252,   253,   254,
+     255,   256,   257,   258,   259,   260,   261,   190,   556,   126,
+     127,   330,   186,   187,   176,   564,   580,    14,   565,   285,
+     177,   188,   581,   189,   226,   582,   227,   610,   229,   191,
+     192,   193,   234,   459,  -181,   460,   461,   462,   463,   190,
+     464,   465,   238,   182,   183,   184,   185,   292,   239,   601,
+     604,   194,   330,   285,   243,   636,   195,   635,   330,   280,
+     281,   191,   192,   193,   244,  -334,  -334,   196,   197,   198,
+     526,   434,   435,   436,   199,   200,   201,   664,   245,   202,
+     665,   203,   249,   194,    69,    70,    71,   247,   195,   288,
+     289,  -334,  -334,   302,   303,   304,   305,   306,   248,   196,
+     197,   198,   182,   183,   184,   185,   199,   200,   201,   186,
+     187,   202,   270,   203,   265,   266,   569,   570,   188,   271,
+     189,   307,     1,   273,     2,     3,     4,     5,     6,     7,
+     274,     9,   316,   275,   326,    10,   190,   276,   277,   338,
+      11,    12,    13,    52,    53,    54,    55,    56,    57,   327,
+      14,    58,   331,   336,   352,   337,   354,   339,   191,   192,
+     193,   182,   183,   184,   185,   343,   355,   356,   262,   263,
+     357,   366,   368,   373,   392,   393,   394,   188,   424,   189,
+     194,   425,   430,   431,   433,   195,   372,   452,   443,    14,
+     450,   288,   458,   476,   480,   190,   196,   197,   198,   499,
+     483,   500,   484,   199,   200,   201,   485,   492,   202,   498,
+     203,   202,   505,   515,   520,   516,   517,   191,   192,   193,
+     521,   522,   523,   524,   551,   531,   528,   262,   550,   559,
+     555,   563,   566,   567,   576,   571,   188,   577,   189,   194,
+     344,   579,   583,   584,   195,   585,   586,   587,   588,   589,
+     602,   590,   603,   591,   190,   196,   197,   198,   605,   592,
+     593,   594,   199,   200,   201,    15,   595,   202,   596,   203,
+     597,   598,   599,   606,   600,   607,   191,   192,   193,   290,
+     611,   291,   612,   613,   614,    16,   615,   616,   292,   617,
+     618,   344,   619,   620,   621,   622,   623,   624,   194,   625,
+     626,   627,   628,   195,   293,   294,   295,   296,   629,   630,
+     632,   633,   298,   634,   196,   197,   198,   285,   637,   638,
+     639,   199,   200,   201,   640,   641,   202,   292,   203,   656,
+     344,   299,   300,   301,   302,   303,   304,   305,   306,   292,
+     658,   659,   562,   293,   294,   295,   296,   297,   642,   643,
+     644,   298,   645,   646,   647,   293,   294,   295,   296,   648,
+     481,   649,   650,   298,   651,   652,   662,   653,   654,   666,
+     299,   300,   301,   302,   303,   304,   305,   306,   292,   655,
+     663,   133,   299,   300,   301,   302,   303,   304,   305,   306,
+     112,   506,   671,   494,   293,   294,   295,   296,   552,   113,
+     114,   232,   298,   115,   335,   116,   117,    78,   246,   482,
+     180,   568,   519,   119,   178,   120,   121,   122,   272,   365,
+     558,   299,   300,   301,   302,   303,   304,   305,   306,   399,
+     400,   401,   402,   403,   404,   405,   406,   407,   408,   409,
+     410,   411,   412,   413,   414,   415,   416,   417,   418,   419,
+     670,   513,   420,   439,   348,   421,   422,   514
 };
 
 static const yytype_int16 yycheck[] =
 {
-      16,   161,    59,   249,   159,   327,     8,     3,     3,   366,
-     366,    51,     3,    62,   366,   366,     4,     5,     6,    72,
-      74,     4,    83,     6,     0,    71,    82,    10,   186,   189,
-      13,     7,    79,     9,    10,    11,    12,    13,    14,    15,
-      16,   199,   200,   203,    20,    51,    69,    86,    33,    25,
-      26,    27,    21,     3,    23,    24,   151,    40,     4,     5,
-       6,    31,    51,   626,     3,    48,   226,   227,    32,   171,
-      58,   169,   174,    43,    44,   108,   174,   138,   139,   239,
-     138,   139,   138,   139,    67,   331,    66,    67,     3,    74,
-      72,   138,   139,   116,   340,   141,   135,   130,    74,     3,
-     663,    51,    41,   425,   262,    58,   266,   267,   430,    92,
-      93,    94,    58,   171,   274,    68,   170,   100,   101,   102,
-      79,   174,   113,     3,   115,   174,   169,   373,   288,   289,
-     170,   174,   138,   139,   150,   293,   294,   295,   296,   297,
-     298,   299,   300,   301,   302,   303,   304,   305,   306,   138,
-     139,     3,     4,     5,     6,   173,   316,   171,   138,   139,
-     174,   149,     0,    82,     8,   148,   523,   523,   170,   165,
-     492,   523,   523,   230,   150,   170,    68,   147,   148,   138,
-     139,   171,   152,   153,   174,    69,    68,   203,   145,     3,
-     350,   351,   117,    21,   170,    23,    24,   138,   139,   156,
-     157,   158,   171,   149,   172,     3,     4,     5,     6,    61,
-     135,   136,   367,     3,   372,     5,     6,    69,    70,   138,
-     139,    79,    14,    81,   171,    83,    78,   174,    80,   113,
-     476,   115,   116,   174,   394,     3,   161,   162,   163,   164,
-     165,   166,   167,   154,    96,   154,    79,   569,    81,   265,
-      83,   171,   498,   171,   174,   238,   174,    51,     3,     4,
-       5,     6,    28,    29,    30,     6,   118,   119,   120,   326,
-     171,    69,    70,   174,    40,    41,    74,    28,    29,    30,
-      78,   171,    80,   171,   174,   445,   174,   447,   140,    40,
-      41,   174,   450,   145,    42,    43,    44,    45,    96,   171,
-     171,   171,   359,   174,   156,   157,   158,    36,    37,    38,
-      39,   163,   164,   165,   171,    22,   168,   174,   170,   171,
-     118,   119,   120,   481,    69,    70,   171,   343,   574,   174,
-      61,   171,     3,    78,   174,    80,   171,   171,    83,   174,
-     174,   171,   140,    63,   174,   171,   171,   145,   174,   174,
-     510,    96,   171,   171,    69,   174,   174,   373,   156,   157,
-     158,     3,     4,     5,     6,   163,   164,   165,   147,   148,
-     168,     3,   170,   118,   119,   120,    85,    86,    87,    88,
-      89,    72,    73,    92,    93,   142,   143,   144,    45,    46,
-       3,     4,     5,     6,    58,   140,   170,    69,     5,     6,
-     145,   138,   139,   112,   165,   166,   167,    75,    76,    77,
-      70,   156,   157,   158,     3,   575,   520,   521,   163,   164,
-     165,     3,     3,   168,     3,   170,    62,    69,    70,    34,
-      35,    36,    37,    38,    39,     4,    78,    42,    80,     6,
-     170,    49,    64,   603,    70,   117,     3,    58,   160,    74,
-      74,    47,   171,   171,    96,     4,    69,    70,     6,   170,
-     476,   133,   134,   135,   136,    78,   170,    80,   170,   141,
-     170,     3,     4,     5,     6,   170,   118,   119,   120,   172,
-     170,   170,   170,    96,   170,    65,    51,   170,   160,   161,
-     162,   163,   164,   165,   166,   167,   170,   170,   140,   171,
-       6,   171,    74,   145,   170,   118,   119,   120,     4,     4,
-     171,     4,     4,     3,   156,   157,   158,   155,   170,     6,
-       5,   163,   164,   165,   174,   170,   168,   140,   170,   114,
-     170,     3,   145,   174,   171,   141,    72,    69,   138,   174,
-     174,   170,   116,   156,   157,   158,    78,   170,    80,   170,
-     163,   164,   165,   170,   170,   168,   170,   170,     4,   171,
-       3,   171,    53,     7,    96,     9,    10,    11,    12,    13,
-      14,    15,    16,   168,     4,    69,    20,    71,     4,     4,
-      53,    25,    26,    27,     3,    48,   118,   119,   120,     6,
-     174,     7,   116,     9,    10,    11,    12,    13,    14,   114,
-      16,   146,    49,   171,    20,   171,     3,   171,   140,    25,
-      26,    27,   174,   145,   170,    50,    69,   171,     4,   174,
-       4,   174,   174,   117,   156,   157,   158,    69,   174,   146,
-      74,   163,   164,   165,   174,   174,   168,   174,   170,   133,
-     134,   135,   136,   137,   174,   174,   174,   141,   174,    85,
-      86,    87,    88,    89,   174,   174,    92,    93,    74,    58,
-     174,   174,   174,     6,   117,     6,   160,   161,   162,   163,
-     164,   165,   166,   167,     6,   117,   112,     6,     6,     6,
-     133,   134,   135,   136,     6,   138,     6,     6,   141,     6,
-       6,   133,   134,   135,   136,     6,     6,     6,     6,   141,
-      74,     6,     6,     3,   174,   171,   150,   160,   161,   162,
-     163,   164,   165,   166,   167,   174,   171,   171,   160,   161,
-     162,   163,   164,   165,   166,   167,   170,   117,    52,    53,
-      54,    55,    56,    57,   150,    59,    60,   171,   171,   171,
-     171,     4,   171,   133,   134,   135,   136,   171,   171,   171,
-     171,   141,     3,   171,   170,   121,   122,   123,   124,   125,
-     126,   127,   128,   129,   130,   131,   132,   171,   171,   171,
-     160,   161,   162,   163,   164,   165,   166,   167,    84,    85,
-      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
-      96,    97,    98,    99,   100,   101,   102,   103,   104,   171,
-     171,   107,   170,   160,   110,   111,     6,   174,   171,    81,
-      59,   444,   427,   490,    59,    59,   146,    59,    59,    59,
-     240,    16,   177,   135,   394,    59,   518,   458,   129,    59,
-      59,    59,   451,   285,   193,   337,   657,   502,    -1,    -1,
-     268,    -1,   451
+      16,   161,   249,    59,   159,     3,     8,     3,    51,    21,
+     327,    23,    24,     4,    72,     6,   366,    66,    67,    10,
+       3,    62,    13,   366,   366,   366,    74,    71,   186,   189,
+      51,    86,    51,    33,     4,     5,     6,   108,     4,     5,
+       6,   199,   200,   203,    69,     3,     3,   171,   632,    40,
+     174,   169,   138,   139,    32,    58,   174,    48,   169,   130,
+     138,   139,     3,   174,    79,    68,   226,   227,    72,    28,
+      29,    30,     3,    79,    74,    81,    67,    83,     3,   239,
+     135,    40,    41,    41,   331,   171,    31,   671,    58,   138,
+     139,   116,    58,   340,    51,    79,   174,   141,    43,    44,
+     151,    92,    93,    94,   262,     0,   266,   267,   425,   100,
+     101,   102,   171,   430,   274,   174,   174,   138,   139,   138,
+     139,   173,   170,   138,   139,     8,   373,   170,   288,   289,
+     113,    68,   115,   174,   150,   293,   294,   295,   296,   297,
+     298,   299,   300,   301,   302,   303,   304,   305,   306,    82,
+      69,     0,    68,     3,   138,   139,   316,   148,     7,   171,
+       9,    10,    11,    12,    13,    14,    15,    16,   170,   165,
+      14,    20,   170,   523,   230,   492,    25,    26,    27,   149,
+     523,   523,   523,   149,    82,   171,     3,   203,   174,    83,
+     350,   351,   171,   154,   113,   174,   115,   116,     3,     4,
+       5,     6,   147,   148,   172,   138,   139,   152,   153,   165,
+     166,   167,   367,     7,   372,     9,    10,    11,    12,    13,
+      14,    15,    16,     3,   171,    74,    20,   174,   154,   476,
+      51,    25,    26,    27,   394,    85,    86,    87,    88,    89,
+     138,   139,    92,    93,   138,   139,   174,   238,     6,   265,
+     117,   498,    22,    79,   571,    81,    61,    83,    21,     3,
+      23,    24,   112,   171,    69,    70,   133,   134,   135,   136,
+     326,   145,   171,    78,   141,    80,    28,    29,    30,    61,
+      74,    69,   156,   157,   158,   445,    63,   447,    40,    41,
+       3,    96,   450,   160,   161,   162,   163,   164,   165,   166,
+     167,   150,     3,   359,     3,     4,     5,     6,    42,    43,
+      44,    45,    58,   118,   119,   120,    36,    37,    38,    39,
+      70,   170,     3,   481,     5,     6,     3,   343,   171,   576,
+     171,   174,   170,   174,     3,   140,     3,     4,     5,     6,
+     145,    85,    86,    87,    88,    89,   147,   148,    92,    93,
+     510,   156,   157,   158,    72,    73,   150,   373,   163,   164,
+     165,   171,     3,   168,   174,   170,   171,     3,   112,   171,
+      69,    70,   174,    62,   171,   171,   170,   174,   174,    78,
+     171,    80,     4,   174,    83,   121,   122,   123,   124,   125,
+     126,   127,   128,   129,   130,   131,   132,    96,   171,    45,
+      46,   174,    69,    70,     6,   171,   171,    74,   174,   174,
+     170,    78,   171,    80,    49,   174,    64,   577,    70,   118,
+     119,   120,     3,    52,    53,    54,    55,    56,    57,    96,
+      59,    60,    58,     3,     4,     5,     6,   117,   160,   171,
+     171,   140,   174,   174,    74,   171,   145,   607,   174,     5,
+       6,   118,   119,   120,    74,   135,   136,   156,   157,   158,
+     476,    75,    76,    77,   163,   164,   165,   171,    47,   168,
+     174,   170,   170,   140,   142,   143,   144,   171,   145,   138,
+     139,   161,   162,   163,   164,   165,   166,   167,   171,   156,
+     157,   158,     3,     4,     5,     6,   163,   164,   165,    69,
+      70,   168,     4,   170,   170,   170,   520,   521,    78,     6,
+      80,   172,     7,   170,     9,    10,    11,    12,    13,    14,
+     170,    16,    65,   170,    51,    20,    96,   170,   170,     6,
+      25,    26,    27,    34,    35,    36,    37,    38,    39,   170,
+      74,    42,   170,   170,     4,   170,     4,   171,   118,   119,
+     120,     3,     4,     5,     6,   170,     4,     4,    69,    70,
+     171,   155,     3,   170,     6,     5,   174,    78,   114,    80,
+     140,   170,   170,     3,   174,   145,   141,   174,   171,    74,
+      72,   138,   174,   170,   116,    96,   156,   157,   158,     4,
+     170,     3,   170,   163,   164,   165,   170,   170,   168,   170,
+     170,   168,   171,     4,    53,     4,     4,   118,   119,   120,
+      53,     3,   174,    48,   114,     6,   171,    69,   116,   171,
+     146,   174,   171,   171,    49,   170,    78,    50,    80,   140,
+      69,   171,   174,   174,   145,   174,   174,   174,   174,   174,
+       3,   174,   146,   174,    96,   156,   157,   158,     4,   174,
+     174,   174,   163,   164,   165,   150,   174,   168,   174,   170,
+     174,   174,   174,     4,   174,    58,   118,   119,   120,    69,
+       6,    71,     6,     6,     6,   170,     6,     6,   117,     6,
+       6,    69,     6,     6,     6,     6,     6,     6,   140,     6,
+       6,     6,     6,   145,   133,   134,   135,   136,     6,    74,
+       3,   174,   141,   171,   156,   157,   158,   174,   171,   171,
+     171,   163,   164,   165,   171,   171,   168,   117,   170,   170,
+      69,   160,   161,   162,   163,   164,   165,   166,   167,   117,
+       4,     3,   171,   133,   134,   135,   136,   137,   171,   171,
+     171,   141,   171,   171,   171,   133,   134,   135,   136,   171,
+     138,   171,   171,   141,   171,   171,   174,   171,   171,     6,
+     160,   161,   162,   163,   164,   165,   166,   167,   117,   171,
+     160,    81,   160,   161,   162,   163,   164,   165,   166,   167,
+      59,   444,   171,   427,   133,   134,   135,   136,   490,    59,
+      59,   146,   141,    59,   240,    59,    59,    16,   177,   394,
+     135,   518,   458,    59,   129,    59,    59,    59,   193,   285,
+     502,   160,   161,   162,   163,   164,   165,   166,   167,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     665,   451,   107,   337,   268,   110,   111,   451
 };
 
 /* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
@@ -1318,20 +1320,21 @@ static const yytype_int16 yystos[] =
        3,   171,   174,   171,   171,   171,   184,   235,   235,    79,
       82,   236,   252,   253,   255,     4,     4,     4,   171,   219,
       53,    53,     3,   174,    48,   216,   201,   232,   171,   171,
-     236,     6,    85,    86,    87,    88,    89,    92,    93,   112,
-      85,    86,    87,    88,    89,    92,    93,   112,   116,   114,
-     186,   188,   171,   146,   171,   232,   259,   171,    79,   235,
-     171,   174,   171,   174,   171,   171,   222,   220,   220,   170,
-     237,   238,   239,   240,    49,    50,   215,   171,   171,   171,
+     236,     6,     3,    85,    86,    87,    88,    89,    92,    93,
+     112,     3,    85,    86,    87,    88,    89,    92,    93,   112,
+     116,   114,   186,   188,   171,   146,   171,   232,   259,   171,
+      79,   235,   171,   174,   171,   174,   171,   171,   222,   220,
+     220,   170,   237,   238,   239,   240,    49,    50,   215,   171,
+     171,   171,   174,   174,   174,   174,   174,   174,   174,   174,
      174,   174,   174,   174,   174,   174,   174,   174,   174,   174,
-     174,   174,   174,   174,   174,   174,   174,   171,     3,   146,
-     171,     4,     4,    58,   188,   232,   235,     6,     6,     6,
+     174,   171,     3,   146,   171,     4,     4,    58,   188,   232,
+     235,     6,     6,     6,     6,     6,     6,     6,     6,     6,
        6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
-       6,     6,     6,     6,    74,   265,     3,   174,   171,   235,
+      74,   265,     3,   174,   171,   235,   171,   171,   171,   171,
      171,   171,   171,   171,   171,   171,   171,   171,   171,   171,
-     171,   171,   171,   171,   171,   171,   171,   171,   170,   265,
-       4,     3,   266,   267,   174,   160,   171,   174,     6,     3,
-       5,     6,   267,   171,   265
+     171,   171,   171,   171,   171,   171,   170,   265,     4,     3,
+     266,   267,   174,   160,   171,   174,     6,     3,     5,     6,
+     267,   171,   265
 };
 
 /* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
@@ -1345,33 +1348,33 @@ static const yytype_int16 yyr1[] =
      184,   184,   184,   184,   184,   184,   184,   184,   184,   184,
      184,   184,   184,   184,   184,   184,   184,   184,   184,   184,
      184,   184,   184,   184,   184,   184,   184,   184,   184,   184,
-     185,   185,   186,   186,   186,   186,   187,   187,   188,   188,
-     189,   190,   190,   191,   191,   192,   193,   193,   193,   193,
-     193,   193,   193,   193,   194,   195,   195,   196,   197,   197,
-     197,   197,   197,   198,   198,   199,   199,   199,   199,   200,
-     200,   201,   202,   203,   203,   204,   205,   205,   206,   206,
-     207,   208,   208,   208,   209,   209,   210,   210,   211,   211,
-     212,   212,   213,   213,   214,   214,   215,   215,   216,   216,
-     217,   217,   217,   217,   218,   218,   219,   219,   220,   220,
-     221,   221,   222,   222,   222,   222,   223,   223,   224,   224,
-     225,   226,   226,   227,   227,   227,   227,   227,   227,   227,
-     228,   228,   228,   228,   228,   228,   228,   228,   228,   228,
-     228,   228,   229,   229,   229,   230,   231,   231,   231,   231,
-     231,   231,   231,   231,   231,   231,   231,   231,   232,   232,
-     233,   233,   234,   234,   235,   235,   235,   235,   235,   236,
-     236,   236,   236,   236,   236,   236,   236,   236,   236,   236,
-     237,   238,   238,   239,   239,   240,   240,   241,   241,   241,
-     241,   241,   241,   241,   241,   242,   242,   242,   242,   242,
+     184,   184,   185,   185,   186,   186,   186,   186,   187,   187,
+     188,   188,   189,   190,   190,   191,   191,   192,   193,   193,
+     193,   193,   193,   193,   193,   193,   194,   195,   195,   196,
+     197,   197,   197,   197,   197,   198,   198,   199,   199,   199,
+     199,   200,   200,   201,   202,   203,   203,   204,   205,   205,
+     206,   206,   207,   208,   208,   208,   209,   209,   210,   210,
+     211,   211,   212,   212,   213,   213,   214,   214,   215,   215,
+     216,   216,   217,   217,   217,   217,   218,   218,   219,   219,
+     220,   220,   221,   221,   222,   222,   222,   222,   223,   223,
+     224,   224,   225,   226,   226,   227,   227,   227,   227,   227,
+     227,   227,   228,   228,   228,   228,   228,   228,   228,   228,
+     228,   228,   228,   228,   229,   229,   229,   230,   231,   231,
+     231,   231,   231,   231,   231,   231,   231,   231,   231,   231,
+     232,   232,   233,   233,   234,   234,   235,   235,   235,   235,
+     235,   236,   236,   236,   236,   236,   236,   236,   236,   236,
+     236,   236,   237,   238,   238,   239,   239,   240,   240,   241,
+     241,   241,   241,   241,   241,   241,   241,   242,   242,   242,
+     242,   242,   242,   242,   242,   242,   242,   242,   242,   242,
      242,   242,   242,   242,   242,   242,   242,   242,   242,   242,
-     242,   242,   242,   242,   242,   242,   242,   242,   243,   243,
-     244,   245,   245,   246,   246,   246,   246,   247,   247,   248,
-     249,   249,   249,   249,   250,   250,   250,   250,   251,   251,
-     251,   251,   251,   251,   251,   251,   251,   251,   252,   252,
-     253,   254,   254,   255,   256,   256,   257,   257,   257,   257,
-     257,   257,   257,   257,   257,   257,   257,   257,   258,   258,
-     259,   259,   259,   260,   261,   261,   262,   262,   263,   263,
-     264,   264,   265,   265,   266,   266,   267,   267,   267,   267,
-     268,   268
+     243,   243,   244,   245,   245,   246,   246,   246,   246,   247,
+     247,   248,   249,   249,   249,   249,   250,   250,   250,   250,
+     251,   251,   251,   251,   251,   251,   251,   251,   251,   251,
+     252,   252,   253,   254,   254,   255,   256,   256,   257,   257,
+     257,   257,   257,   257,   257,   257,   257,   257,   257,   257,
+     258,   258,   259,   259,   259,   260,   261,   261,   262,   262,
+     263,   263,   264,   264,   265,   265,   266,   266,   267,   267,
+     267,   267,   268,   268
 };
 
 /* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
@@ -1385,33 +1388,33 @@ static const yytype_int8 yyr2[] =
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     6,     4,     1,     6,     6,     6,     6,     6,     6,
        6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
-       1,     2,     2,     1,     1,     2,     5,     4,     1,     3,
-       4,     6,     5,     3,     0,     3,     1,     1,     1,     1,
-       1,     1,     1,     0,     5,     1,     3,     3,     4,     4,
-       4,     4,     6,     8,     8,     1,     1,     3,     3,     3,
-       3,     2,     4,     3,     3,     8,     3,     0,     1,     3,
-       2,     1,     1,     0,     2,     0,     2,     0,     1,     0,
-       2,     0,     2,     0,     2,     0,     2,     0,     3,     0,
-       1,     2,     1,     1,     1,     3,     1,     1,     2,     4,
-       1,     3,     2,     1,     5,     0,     2,     0,     1,     3,
-       5,     4,     6,     1,     1,     1,     1,     1,     1,     0,
-       2,     2,     2,     2,     2,     3,     3,     2,     3,     4,
-       6,     3,     2,     2,     2,     2,     2,     4,     4,     4,
-       4,     4,     4,     4,     4,     4,     4,     4,     1,     3,
-       3,     5,     3,     1,     1,     1,     1,     1,     1,     3,
-       3,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-      13,     6,     8,     4,     6,     4,     6,     1,     1,     1,
-       1,     3,     3,     3,     3,     3,     4,     5,     4,     3,
-       2,     2,     2,     3,     3,     3,     3,     3,     3,     3,
-       3,     3,     3,     3,     3,     6,     3,     4,     3,     3,
-       5,     5,     6,     4,     6,     3,     5,     4,     5,     6,
-       4,     5,     5,     6,     1,     3,     1,     3,     1,     1,
-       1,     1,     1,     2,     2,     1,     1,     1,     1,     1,
-       2,     2,     3,     2,     2,     3,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     1,     3,
-       2,     2,     1,     1,     2,     0,     3,     0,     1,     0,
-       2,     0,     4,     0,     1,     3,     1,     3,     3,     3,
-       6,     7
+       6,     6,     1,     2,     2,     1,     1,     2,     5,     4,
+       1,     3,     4,     6,     5,     3,     0,     3,     1,     1,
+       1,     1,     1,     1,     1,     0,     5,     1,     3,     3,
+       4,     4,     4,     4,     6,     8,     8,     1,     1,     3,
+       3,     3,     3,     2,     4,     3,     3,     8,     3,     0,
+       1,     3,     2,     1,     1,     0,     2,     0,     2,     0,
+       1,     0,     2,     0,     2,     0,     2,     0,     2,     0,
+       3,     0,     1,     2,     1,     1,     1,     3,     1,     1,
+       2,     4,     1,     3,     2,     1,     5,     0,     2,     0,
+       1,     3,     5,     4,     6,     1,     1,     1,     1,     1,
+       1,     0,     2,     2,     2,     2,     2,     3,     3,     2,
+       3,     4,     6,     3,     2,     2,     2,     2,     2,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
+       1,     3,     3,     5,     3,     1,     1,     1,     1,     1,
+       1,     3,     3,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,    13,     6,     8,     4,     6,     4,     6,     1,
+       1,     1,     1,     3,     3,     3,     3,     3,     4,     5,
+       4,     3,     2,     2,     2,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     6,     3,     4,
+       3,     3,     5,     5,     6,     4,     6,     3,     5,     4,
+       5,     6,     4,     5,     5,     6,     1,     3,     1,     3,
+       1,     1,     1,     1,     1,     2,     2,     1,     1,     1,
+       1,     1,     2,     2,     3,     2,     2,     3,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       1,     3,     2,     2,     1,     1,     2,     0,     3,     0,
+       1,     0,     2,     0,     4,     0,     1,     3,     1,     3,
+       3,     3,     6,     7
 };
 
 
@@ -1979,7 +1982,7 @@ yydestruct (const char *yymsg,
             {
     free(((*yyvaluep).str_value));
 }
-#line 1983 "parser.cpp"
+#line 1986 "parser.cpp"
         break;
 
     case YYSYMBOL_STRING: /* STRING  */
@@ -1987,7 +1990,7 @@ yydestruct (const char *yymsg,
             {
     free(((*yyvaluep).str_value));
 }
-#line 1991 "parser.cpp"
+#line 1994 "parser.cpp"
         break;
 
     case YYSYMBOL_statement_list: /* statement_list  */
@@ -2001,7 +2004,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).stmt_array));
     }
 }
-#line 2005 "parser.cpp"
+#line 2008 "parser.cpp"
         break;
 
     case YYSYMBOL_table_element_array: /* table_element_array  */
@@ -2015,7 +2018,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).table_element_array_t));
     }
 }
-#line 2019 "parser.cpp"
+#line 2022 "parser.cpp"
         break;
 
     case YYSYMBOL_column_constraints: /* column_constraints  */
@@ -2026,7 +2029,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).column_constraints_t));
     }
 }
-#line 2030 "parser.cpp"
+#line 2033 "parser.cpp"
         break;
 
     case YYSYMBOL_identifier_array: /* identifier_array  */
@@ -2035,7 +2038,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy identifier array\n");
     delete (((*yyvaluep).identifier_array_t));
 }
-#line 2039 "parser.cpp"
+#line 2042 "parser.cpp"
         break;
 
     case YYSYMBOL_optional_identifier_array: /* optional_identifier_array  */
@@ -2044,7 +2047,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy identifier array\n");
     delete (((*yyvaluep).identifier_array_t));
 }
-#line 2048 "parser.cpp"
+#line 2051 "parser.cpp"
         break;
 
     case YYSYMBOL_update_expr_array: /* update_expr_array  */
@@ -2058,7 +2061,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).update_expr_array_t));
     }
 }
-#line 2062 "parser.cpp"
+#line 2065 "parser.cpp"
         break;
 
     case YYSYMBOL_update_expr: /* update_expr  */
@@ -2069,7 +2072,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).update_expr_t);
     }
 }
-#line 2073 "parser.cpp"
+#line 2076 "parser.cpp"
         break;
 
     case YYSYMBOL_select_statement: /* select_statement  */
@@ -2079,7 +2082,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2083 "parser.cpp"
+#line 2086 "parser.cpp"
         break;
 
     case YYSYMBOL_select_with_paren: /* select_with_paren  */
@@ -2089,7 +2092,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2093 "parser.cpp"
+#line 2096 "parser.cpp"
         break;
 
     case YYSYMBOL_select_without_paren: /* select_without_paren  */
@@ -2099,7 +2102,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2103 "parser.cpp"
+#line 2106 "parser.cpp"
         break;
 
     case YYSYMBOL_select_clause_with_modifier: /* select_clause_with_modifier  */
@@ -2109,7 +2112,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2113 "parser.cpp"
+#line 2116 "parser.cpp"
         break;
 
     case YYSYMBOL_select_clause_without_modifier_paren: /* select_clause_without_modifier_paren  */
@@ -2119,7 +2122,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2123 "parser.cpp"
+#line 2126 "parser.cpp"
         break;
 
     case YYSYMBOL_select_clause_without_modifier: /* select_clause_without_modifier  */
@@ -2129,7 +2132,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2133 "parser.cpp"
+#line 2136 "parser.cpp"
         break;
 
     case YYSYMBOL_order_by_clause: /* order_by_clause  */
@@ -2143,7 +2146,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).order_by_expr_list_t));
     }
 }
-#line 2147 "parser.cpp"
+#line 2150 "parser.cpp"
         break;
 
     case YYSYMBOL_order_by_expr_list: /* order_by_expr_list  */
@@ -2157,7 +2160,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).order_by_expr_list_t));
     }
 }
-#line 2161 "parser.cpp"
+#line 2164 "parser.cpp"
         break;
 
     case YYSYMBOL_order_by_expr: /* order_by_expr  */
@@ -2167,7 +2170,7 @@ yydestruct (const char *yymsg,
     delete ((*yyvaluep).order_by_expr_t)->expr_;
     delete ((*yyvaluep).order_by_expr_t);
 }
-#line 2171 "parser.cpp"
+#line 2174 "parser.cpp"
         break;
 
     case YYSYMBOL_limit_expr: /* limit_expr  */
@@ -2175,7 +2178,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2179 "parser.cpp"
+#line 2182 "parser.cpp"
         break;
 
     case YYSYMBOL_offset_expr: /* offset_expr  */
@@ -2183,7 +2186,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2187 "parser.cpp"
+#line 2190 "parser.cpp"
         break;
 
     case YYSYMBOL_from_clause: /* from_clause  */
@@ -2192,7 +2195,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2196 "parser.cpp"
+#line 2199 "parser.cpp"
         break;
 
     case YYSYMBOL_search_clause: /* search_clause  */
@@ -2200,7 +2203,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2204 "parser.cpp"
+#line 2207 "parser.cpp"
         break;
 
     case YYSYMBOL_where_clause: /* where_clause  */
@@ -2208,7 +2211,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2212 "parser.cpp"
+#line 2215 "parser.cpp"
         break;
 
     case YYSYMBOL_having_clause: /* having_clause  */
@@ -2216,7 +2219,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2220 "parser.cpp"
+#line 2223 "parser.cpp"
         break;
 
     case YYSYMBOL_group_by_clause: /* group_by_clause  */
@@ -2230,7 +2233,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_t));
     }
 }
-#line 2234 "parser.cpp"
+#line 2237 "parser.cpp"
         break;
 
     case YYSYMBOL_table_reference: /* table_reference  */
@@ -2239,7 +2242,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2243 "parser.cpp"
+#line 2246 "parser.cpp"
         break;
 
     case YYSYMBOL_table_reference_unit: /* table_reference_unit  */
@@ -2248,7 +2251,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2252 "parser.cpp"
+#line 2255 "parser.cpp"
         break;
 
     case YYSYMBOL_table_reference_name: /* table_reference_name  */
@@ -2257,7 +2260,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2261 "parser.cpp"
+#line 2264 "parser.cpp"
         break;
 
     case YYSYMBOL_table_name: /* table_name  */
@@ -2270,7 +2273,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).table_name_t));
     }
 }
-#line 2274 "parser.cpp"
+#line 2277 "parser.cpp"
         break;
 
     case YYSYMBOL_table_alias: /* table_alias  */
@@ -2279,7 +2282,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table alias\n");
     delete (((*yyvaluep).table_alias_t));
 }
-#line 2283 "parser.cpp"
+#line 2286 "parser.cpp"
         break;
 
     case YYSYMBOL_with_clause: /* with_clause  */
@@ -2293,7 +2296,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_expr_list_t));
     }
 }
-#line 2297 "parser.cpp"
+#line 2300 "parser.cpp"
         break;
 
     case YYSYMBOL_with_expr_list: /* with_expr_list  */
@@ -2307,7 +2310,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_expr_list_t));
     }
 }
-#line 2311 "parser.cpp"
+#line 2314 "parser.cpp"
         break;
 
     case YYSYMBOL_with_expr: /* with_expr  */
@@ -2317,7 +2320,7 @@ yydestruct (const char *yymsg,
     delete ((*yyvaluep).with_expr_t)->select_;
     delete ((*yyvaluep).with_expr_t);
 }
-#line 2321 "parser.cpp"
+#line 2324 "parser.cpp"
         break;
 
     case YYSYMBOL_join_clause: /* join_clause  */
@@ -2326,7 +2329,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2330 "parser.cpp"
+#line 2333 "parser.cpp"
         break;
 
     case YYSYMBOL_expr_array: /* expr_array  */
@@ -2340,7 +2343,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_t));
     }
 }
-#line 2344 "parser.cpp"
+#line 2347 "parser.cpp"
         break;
 
     case YYSYMBOL_expr_array_list: /* expr_array_list  */
@@ -2357,7 +2360,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_list_t));
     }
 }
-#line 2361 "parser.cpp"
+#line 2364 "parser.cpp"
         break;
 
     case YYSYMBOL_expr_alias: /* expr_alias  */
@@ -2365,7 +2368,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2369 "parser.cpp"
+#line 2372 "parser.cpp"
         break;
 
     case YYSYMBOL_expr: /* expr  */
@@ -2373,7 +2376,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2377 "parser.cpp"
+#line 2380 "parser.cpp"
         break;
 
     case YYSYMBOL_operand: /* operand  */
@@ -2381,7 +2384,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2385 "parser.cpp"
+#line 2388 "parser.cpp"
         break;
 
     case YYSYMBOL_knn_expr: /* knn_expr  */
@@ -2389,7 +2392,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2393 "parser.cpp"
+#line 2396 "parser.cpp"
         break;
 
     case YYSYMBOL_match_expr: /* match_expr  */
@@ -2397,7 +2400,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2401 "parser.cpp"
+#line 2404 "parser.cpp"
         break;
 
     case YYSYMBOL_query_expr: /* query_expr  */
@@ -2405,7 +2408,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2409 "parser.cpp"
+#line 2412 "parser.cpp"
         break;
 
     case YYSYMBOL_fusion_expr: /* fusion_expr  */
@@ -2413,7 +2416,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2417 "parser.cpp"
+#line 2420 "parser.cpp"
         break;
 
     case YYSYMBOL_sub_search_array: /* sub_search_array  */
@@ -2427,7 +2430,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_t));
     }
 }
-#line 2431 "parser.cpp"
+#line 2434 "parser.cpp"
         break;
 
     case YYSYMBOL_function_expr: /* function_expr  */
@@ -2435,7 +2438,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2439 "parser.cpp"
+#line 2442 "parser.cpp"
         break;
 
     case YYSYMBOL_conjunction_expr: /* conjunction_expr  */
@@ -2443,7 +2446,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2447 "parser.cpp"
+#line 2450 "parser.cpp"
         break;
 
     case YYSYMBOL_between_expr: /* between_expr  */
@@ -2451,7 +2454,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2455 "parser.cpp"
+#line 2458 "parser.cpp"
         break;
 
     case YYSYMBOL_in_expr: /* in_expr  */
@@ -2459,7 +2462,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2463 "parser.cpp"
+#line 2466 "parser.cpp"
         break;
 
     case YYSYMBOL_case_expr: /* case_expr  */
@@ -2467,7 +2470,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2471 "parser.cpp"
+#line 2474 "parser.cpp"
         break;
 
     case YYSYMBOL_case_check_array: /* case_check_array  */
@@ -2480,7 +2483,7 @@ yydestruct (const char *yymsg,
         }
     }
 }
-#line 2484 "parser.cpp"
+#line 2487 "parser.cpp"
         break;
 
     case YYSYMBOL_cast_expr: /* cast_expr  */
@@ -2488,7 +2491,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2492 "parser.cpp"
+#line 2495 "parser.cpp"
         break;
 
     case YYSYMBOL_subquery_expr: /* subquery_expr  */
@@ -2496,7 +2499,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2500 "parser.cpp"
+#line 2503 "parser.cpp"
         break;
 
     case YYSYMBOL_column_expr: /* column_expr  */
@@ -2504,7 +2507,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2508 "parser.cpp"
+#line 2511 "parser.cpp"
         break;
 
     case YYSYMBOL_constant_expr: /* constant_expr  */
@@ -2512,7 +2515,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2516 "parser.cpp"
+#line 2519 "parser.cpp"
         break;
 
     case YYSYMBOL_array_expr: /* array_expr  */
@@ -2520,7 +2523,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2524 "parser.cpp"
+#line 2527 "parser.cpp"
         break;
 
     case YYSYMBOL_long_array_expr: /* long_array_expr  */
@@ -2528,7 +2531,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2532 "parser.cpp"
+#line 2535 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_long_array_expr: /* unclosed_long_array_expr  */
@@ -2536,7 +2539,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2540 "parser.cpp"
+#line 2543 "parser.cpp"
         break;
 
     case YYSYMBOL_double_array_expr: /* double_array_expr  */
@@ -2544,7 +2547,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2548 "parser.cpp"
+#line 2551 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_double_array_expr: /* unclosed_double_array_expr  */
@@ -2552,7 +2555,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2556 "parser.cpp"
+#line 2559 "parser.cpp"
         break;
 
     case YYSYMBOL_interval_expr: /* interval_expr  */
@@ -2560,7 +2563,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2564 "parser.cpp"
+#line 2567 "parser.cpp"
         break;
 
     case YYSYMBOL_file_path: /* file_path  */
@@ -2568,7 +2571,7 @@ yydestruct (const char *yymsg,
             {
     free(((*yyvaluep).str_value));
 }
-#line 2572 "parser.cpp"
+#line 2575 "parser.cpp"
         break;
 
     case YYSYMBOL_if_not_exists_info: /* if_not_exists_info  */
@@ -2579,7 +2582,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).if_not_exists_info_t));
     }
 }
-#line 2583 "parser.cpp"
+#line 2586 "parser.cpp"
         break;
 
     case YYSYMBOL_with_index_param_list: /* with_index_param_list  */
@@ -2593,7 +2596,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_index_param_list_t));
     }
 }
-#line 2597 "parser.cpp"
+#line 2600 "parser.cpp"
         break;
 
     case YYSYMBOL_index_info_list: /* index_info_list  */
@@ -2607,7 +2610,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).index_info_list_t));
     }
 }
-#line 2611 "parser.cpp"
+#line 2614 "parser.cpp"
         break;
 
       default:
@@ -2715,7 +2718,7 @@ YYLTYPE yylloc = yyloc_default;
   yylloc.string_length = 0;
 }
 
-#line 2719 "parser.cpp"
+#line 2722 "parser.cpp"
 
   yylsp[0] = yylloc;
   goto yysetstate;
@@ -2930,7 +2933,7 @@ yyreduce:
                                          {
     result->statements_ptr_ = (yyvsp[-1].stmt_array);
 }
-#line 2934 "parser.cpp"
+#line 2937 "parser.cpp"
     break;
 
   case 3: /* statement_list: statement  */
@@ -2941,7 +2944,7 @@ yyreduce:
     (yyval.stmt_array) = new std::vector<infinity::BaseStatement*>();
     (yyval.stmt_array)->push_back((yyvsp[0].base_stmt));
 }
-#line 2945 "parser.cpp"
+#line 2948 "parser.cpp"
     break;
 
   case 4: /* statement_list: statement_list ';' statement  */
@@ -2952,145 +2955,145 @@ yyreduce:
     (yyvsp[-2].stmt_array)->push_back((yyvsp[0].base_stmt));
     (yyval.stmt_array) = (yyvsp[-2].stmt_array);
 }
-#line 2956 "parser.cpp"
+#line 2959 "parser.cpp"
     break;
 
   case 5: /* statement: create_statement  */
 #line 483 "parser.y"
                              { (yyval.base_stmt) = (yyvsp[0].create_stmt); }
-#line 2962 "parser.cpp"
+#line 2965 "parser.cpp"
     break;
 
   case 6: /* statement: drop_statement  */
 #line 484 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].drop_stmt); }
-#line 2968 "parser.cpp"
+#line 2971 "parser.cpp"
     break;
 
   case 7: /* statement: copy_statement  */
 #line 485 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].copy_stmt); }
-#line 2974 "parser.cpp"
+#line 2977 "parser.cpp"
     break;
 
   case 8: /* statement: show_statement  */
 #line 486 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].show_stmt); }
-#line 2980 "parser.cpp"
+#line 2983 "parser.cpp"
     break;
 
   case 9: /* statement: select_statement  */
 #line 487 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].select_stmt); }
-#line 2986 "parser.cpp"
+#line 2989 "parser.cpp"
     break;
 
   case 10: /* statement: delete_statement  */
 #line 488 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].delete_stmt); }
-#line 2992 "parser.cpp"
+#line 2995 "parser.cpp"
     break;
 
   case 11: /* statement: update_statement  */
 #line 489 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].update_stmt); }
-#line 2998 "parser.cpp"
+#line 3001 "parser.cpp"
     break;
 
   case 12: /* statement: insert_statement  */
 #line 490 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].insert_stmt); }
-#line 3004 "parser.cpp"
+#line 3007 "parser.cpp"
     break;
 
   case 13: /* statement: explain_statement  */
 #line 491 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].explain_stmt); }
-#line 3010 "parser.cpp"
+#line 3013 "parser.cpp"
     break;
 
   case 14: /* statement: flush_statement  */
 #line 492 "parser.y"
                   { (yyval.base_stmt) = (yyvsp[0].flush_stmt); }
-#line 3016 "parser.cpp"
+#line 3019 "parser.cpp"
     break;
 
   case 15: /* statement: optimize_statement  */
 #line 493 "parser.y"
                      { (yyval.base_stmt) = (yyvsp[0].optimize_stmt); }
-#line 3022 "parser.cpp"
+#line 3025 "parser.cpp"
     break;
 
   case 16: /* statement: command_statement  */
 #line 494 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].command_stmt); }
-#line 3028 "parser.cpp"
+#line 3031 "parser.cpp"
     break;
 
   case 17: /* explainable_statement: create_statement  */
 #line 496 "parser.y"
                                          { (yyval.base_stmt) = (yyvsp[0].create_stmt); }
-#line 3034 "parser.cpp"
+#line 3037 "parser.cpp"
     break;
 
   case 18: /* explainable_statement: drop_statement  */
 #line 497 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].drop_stmt); }
-#line 3040 "parser.cpp"
+#line 3043 "parser.cpp"
     break;
 
   case 19: /* explainable_statement: copy_statement  */
 #line 498 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].copy_stmt); }
-#line 3046 "parser.cpp"
+#line 3049 "parser.cpp"
     break;
 
   case 20: /* explainable_statement: show_statement  */
 #line 499 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].show_stmt); }
-#line 3052 "parser.cpp"
+#line 3055 "parser.cpp"
     break;
 
   case 21: /* explainable_statement: select_statement  */
 #line 500 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].select_stmt); }
-#line 3058 "parser.cpp"
+#line 3061 "parser.cpp"
     break;
 
   case 22: /* explainable_statement: delete_statement  */
 #line 501 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].delete_stmt); }
-#line 3064 "parser.cpp"
+#line 3067 "parser.cpp"
     break;
 
   case 23: /* explainable_statement: update_statement  */
 #line 502 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].update_stmt); }
-#line 3070 "parser.cpp"
+#line 3073 "parser.cpp"
     break;
 
   case 24: /* explainable_statement: insert_statement  */
 #line 503 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].insert_stmt); }
-#line 3076 "parser.cpp"
+#line 3079 "parser.cpp"
     break;
 
   case 25: /* explainable_statement: flush_statement  */
 #line 504 "parser.y"
                   { (yyval.base_stmt) = (yyvsp[0].flush_stmt); }
-#line 3082 "parser.cpp"
+#line 3085 "parser.cpp"
     break;
 
   case 26: /* explainable_statement: optimize_statement  */
 #line 505 "parser.y"
                      { (yyval.base_stmt) = (yyvsp[0].optimize_stmt); }
-#line 3088 "parser.cpp"
+#line 3091 "parser.cpp"
     break;
 
   case 27: /* explainable_statement: command_statement  */
 #line 506 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].command_stmt); }
-#line 3094 "parser.cpp"
+#line 3097 "parser.cpp"
     break;
 
   case 28: /* create_statement: CREATE DATABASE if_not_exists IDENTIFIER  */
@@ -3110,7 +3113,7 @@ yyreduce:
     (yyval.create_stmt)->create_info_ = create_schema_info;
     (yyval.create_stmt)->create_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
 }
-#line 3114 "parser.cpp"
+#line 3117 "parser.cpp"
     break;
 
   case 29: /* create_statement: CREATE COLLECTION if_not_exists table_name  */
@@ -3128,7 +3131,7 @@ yyreduce:
     (yyval.create_stmt)->create_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 3132 "parser.cpp"
+#line 3135 "parser.cpp"
     break;
 
   case 30: /* create_statement: CREATE TABLE if_not_exists table_name '(' table_element_array ')'  */
@@ -3156,7 +3159,7 @@ yyreduce:
     (yyval.create_stmt)->create_info_ = create_table_info;
     (yyval.create_stmt)->create_info_->conflict_type_ = (yyvsp[-4].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
 }
-#line 3160 "parser.cpp"
+#line 3163 "parser.cpp"
     break;
 
   case 31: /* create_statement: CREATE TABLE if_not_exists table_name AS select_statement  */
@@ -3176,7 +3179,7 @@ yyreduce:
     create_table_info->select_ = (yyvsp[0].select_stmt);
     (yyval.create_stmt)->create_info_ = create_table_info;
 }
-#line 3180 "parser.cpp"
+#line 3183 "parser.cpp"
     break;
 
   case 32: /* create_statement: CREATE VIEW if_not_exists table_name optional_identifier_array AS select_statement  */
@@ -3197,7 +3200,7 @@ yyreduce:
     create_view_info->conflict_type_ = (yyvsp[-4].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     (yyval.create_stmt)->create_info_ = create_view_info;
 }
-#line 3201 "parser.cpp"
+#line 3204 "parser.cpp"
     break;
 
   case 33: /* create_statement: CREATE INDEX if_not_exists_info ON table_name index_info_list  */
@@ -3230,7 +3233,7 @@ yyreduce:
     (yyval.create_stmt) = new infinity::CreateStatement();
     (yyval.create_stmt)->create_info_ = create_index_info;
 }
-#line 3234 "parser.cpp"
+#line 3237 "parser.cpp"
     break;
 
   case 34: /* table_element_array: table_element  */
@@ -3239,7 +3242,7 @@ yyreduce:
     (yyval.table_element_array_t) = new std::vector<infinity::TableElement*>();
     (yyval.table_element_array_t)->push_back((yyvsp[0].table_element_t));
 }
-#line 3243 "parser.cpp"
+#line 3246 "parser.cpp"
     break;
 
   case 35: /* table_element_array: table_element_array ',' table_element  */
@@ -3248,7 +3251,7 @@ yyreduce:
     (yyvsp[-2].table_element_array_t)->push_back((yyvsp[0].table_element_t));
     (yyval.table_element_array_t) = (yyvsp[-2].table_element_array_t);
 }
-#line 3252 "parser.cpp"
+#line 3255 "parser.cpp"
     break;
 
   case 36: /* table_element: table_column  */
@@ -3256,7 +3259,7 @@ yyreduce:
                              {
     (yyval.table_element_t) = (yyvsp[0].table_column_t);
 }
-#line 3260 "parser.cpp"
+#line 3263 "parser.cpp"
     break;
 
   case 37: /* table_element: table_constraint  */
@@ -3264,7 +3267,7 @@ yyreduce:
                    {
     (yyval.table_element_t) = (yyvsp[0].table_constraint_t);
 }
-#line 3268 "parser.cpp"
+#line 3271 "parser.cpp"
     break;
 
   case 38: /* table_column: IDENTIFIER column_type  */
@@ -3304,7 +3307,7 @@ yyreduce:
     }
     */
 }
-#line 3308 "parser.cpp"
+#line 3311 "parser.cpp"
     break;
 
   case 39: /* table_column: IDENTIFIER column_type column_constraints  */
@@ -3341,260 +3344,302 @@ yyreduce:
     }
     */
 }
-#line 3345 "parser.cpp"
+#line 3348 "parser.cpp"
     break;
 
   case 40: /* column_type: BOOLEAN  */
 #line 720 "parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kBoolean, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3351 "parser.cpp"
+#line 3354 "parser.cpp"
     break;
 
   case 41: /* column_type: TINYINT  */
 #line 721 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTinyInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3357 "parser.cpp"
+#line 3360 "parser.cpp"
     break;
 
   case 42: /* column_type: SMALLINT  */
 #line 722 "parser.y"
            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSmallInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3363 "parser.cpp"
+#line 3366 "parser.cpp"
     break;
 
   case 43: /* column_type: INTEGER  */
 #line 723 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kInteger, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3369 "parser.cpp"
+#line 3372 "parser.cpp"
     break;
 
   case 44: /* column_type: INT  */
 #line 724 "parser.y"
       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kInteger, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3375 "parser.cpp"
+#line 3378 "parser.cpp"
     break;
 
   case 45: /* column_type: BIGINT  */
 #line 725 "parser.y"
          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kBigInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3381 "parser.cpp"
+#line 3384 "parser.cpp"
     break;
 
   case 46: /* column_type: HUGEINT  */
 #line 726 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kHugeInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3387 "parser.cpp"
+#line 3390 "parser.cpp"
     break;
 
   case 47: /* column_type: FLOAT  */
 #line 727 "parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kFloat, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3393 "parser.cpp"
+#line 3396 "parser.cpp"
     break;
 
   case 48: /* column_type: REAL  */
 #line 728 "parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kFloat, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3399 "parser.cpp"
+#line 3402 "parser.cpp"
     break;
 
   case 49: /* column_type: DOUBLE  */
 #line 729 "parser.y"
          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDouble, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3405 "parser.cpp"
+#line 3408 "parser.cpp"
     break;
 
   case 50: /* column_type: DATE  */
 #line 730 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDate, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3411 "parser.cpp"
+#line 3414 "parser.cpp"
     break;
 
   case 51: /* column_type: TIME  */
 #line 731 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTime, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3417 "parser.cpp"
+#line 3420 "parser.cpp"
     break;
 
   case 52: /* column_type: DATETIME  */
 #line 732 "parser.y"
            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDateTime, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3423 "parser.cpp"
+#line 3426 "parser.cpp"
     break;
 
   case 53: /* column_type: TIMESTAMP  */
 #line 733 "parser.y"
             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTimestamp, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3429 "parser.cpp"
+#line 3432 "parser.cpp"
     break;
 
   case 54: /* column_type: UUID  */
 #line 734 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kUuid, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3435 "parser.cpp"
+#line 3438 "parser.cpp"
     break;
 
   case 55: /* column_type: POINT  */
 #line 735 "parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kPoint, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3441 "parser.cpp"
+#line 3444 "parser.cpp"
     break;
 
   case 56: /* column_type: LINE  */
 #line 736 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kLine, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3447 "parser.cpp"
+#line 3450 "parser.cpp"
     break;
 
   case 57: /* column_type: LSEG  */
 #line 737 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kLineSeg, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3453 "parser.cpp"
+#line 3456 "parser.cpp"
     break;
 
   case 58: /* column_type: BOX  */
 #line 738 "parser.y"
       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kBox, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3459 "parser.cpp"
+#line 3462 "parser.cpp"
     break;
 
   case 59: /* column_type: CIRCLE  */
 #line 741 "parser.y"
          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kCircle, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3465 "parser.cpp"
+#line 3468 "parser.cpp"
     break;
 
   case 60: /* column_type: VARCHAR  */
 #line 743 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kVarchar, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3471 "parser.cpp"
+#line 3474 "parser.cpp"
     break;
 
   case 61: /* column_type: DECIMAL '(' LONG_VALUE ',' LONG_VALUE ')'  */
 #line 744 "parser.y"
                                             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDecimal, 0, (yyvsp[-3].long_value), (yyvsp[-1].long_value), infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3477 "parser.cpp"
+#line 3480 "parser.cpp"
     break;
 
   case 62: /* column_type: DECIMAL '(' LONG_VALUE ')'  */
 #line 745 "parser.y"
                              { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDecimal, 0, (yyvsp[-1].long_value), 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3483 "parser.cpp"
+#line 3486 "parser.cpp"
     break;
 
   case 63: /* column_type: DECIMAL  */
 #line 746 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDecimal, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3489 "parser.cpp"
+#line 3492 "parser.cpp"
     break;
 
   case 64: /* column_type: EMBEDDING '(' BIT ',' LONG_VALUE ')'  */
 #line 749 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemBit}; }
-#line 3495 "parser.cpp"
+#line 3498 "parser.cpp"
     break;
 
   case 65: /* column_type: EMBEDDING '(' TINYINT ',' LONG_VALUE ')'  */
 #line 750 "parser.y"
                                            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt8}; }
-#line 3501 "parser.cpp"
+#line 3504 "parser.cpp"
     break;
 
   case 66: /* column_type: EMBEDDING '(' SMALLINT ',' LONG_VALUE ')'  */
 #line 751 "parser.y"
                                             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt16}; }
-#line 3507 "parser.cpp"
+#line 3510 "parser.cpp"
     break;
 
   case 67: /* column_type: EMBEDDING '(' INTEGER ',' LONG_VALUE ')'  */
 #line 752 "parser.y"
                                            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 3513 "parser.cpp"
+#line 3516 "parser.cpp"
     break;
 
   case 68: /* column_type: EMBEDDING '(' INT ',' LONG_VALUE ')'  */
 #line 753 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 3519 "parser.cpp"
+#line 3522 "parser.cpp"
     break;
 
   case 69: /* column_type: EMBEDDING '(' BIGINT ',' LONG_VALUE ')'  */
 #line 754 "parser.y"
                                           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt64}; }
-#line 3525 "parser.cpp"
+#line 3528 "parser.cpp"
     break;
 
   case 70: /* column_type: EMBEDDING '(' FLOAT ',' LONG_VALUE ')'  */
 #line 755 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemFloat}; }
-#line 3531 "parser.cpp"
+#line 3534 "parser.cpp"
     break;
 
   case 71: /* column_type: EMBEDDING '(' DOUBLE ',' LONG_VALUE ')'  */
 #line 756 "parser.y"
                                           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemDouble}; }
-#line 3537 "parser.cpp"
+#line 3540 "parser.cpp"
     break;
 
-  case 72: /* column_type: VECTOR '(' BIT ',' LONG_VALUE ')'  */
+  case 72: /* column_type: EMBEDDING '(' IDENTIFIER ',' LONG_VALUE ')'  */
 #line 757 "parser.y"
+                                              {
+    // half precision element types aren't keywords
+    ParserHelper::ToLower((yyvsp[-3].str_value));
+    infinity::EmbeddingDataType elem_type = infinity::EmbeddingDataType::kElemInvalid;
+    if(strcmp((yyvsp[-3].str_value), "float16") == 0 || strcmp((yyvsp[-3].str_value), "half") == 0) {
+        elem_type = infinity::kElemFloat16;
+    } else if(strcmp((yyvsp[-3].str_value), "bfloat16") == 0) {
+        elem_type = infinity::kElemBFloat16;
+    }
+    free((yyvsp[-3].str_value));
+    if(elem_type == infinity::EmbeddingDataType::kElemInvalid) {
+        yyerror(&yyloc, scanner, result, "Invalid embedding element type");
+        YYERROR;
+    }
+    (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, elem_type};
+}
+#line 3561 "parser.cpp"
+    break;
+
+  case 73: /* column_type: VECTOR '(' BIT ',' LONG_VALUE ')'  */
+#line 773 "parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemBit}; }
-#line 3543 "parser.cpp"
+#line 3567 "parser.cpp"
     break;
 
-  case 73: /* column_type: VECTOR '(' TINYINT ',' LONG_VALUE ')'  */
-#line 758 "parser.y"
+  case 74: /* column_type: VECTOR '(' TINYINT ',' LONG_VALUE ')'  */
+#line 774 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt8}; }
-#line 3549 "parser.cpp"
+#line 3573 "parser.cpp"
     break;
 
-  case 74: /* column_type: VECTOR '(' SMALLINT ',' LONG_VALUE ')'  */
-#line 759 "parser.y"
+  case 75: /* column_type: VECTOR '(' SMALLINT ',' LONG_VALUE ')'  */
+#line 775 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt16}; }
-#line 3555 "parser.cpp"
+#line 3579 "parser.cpp"
     break;
 
-  case 75: /* column_type: VECTOR '(' INTEGER ',' LONG_VALUE ')'  */
-#line 760 "parser.y"
+  case 76: /* column_type: VECTOR '(' INTEGER ',' LONG_VALUE ')'  */
+#line 776 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 3561 "parser.cpp"
+#line 3585 "parser.cpp"
     break;
 
-  case 76: /* column_type: VECTOR '(' INT ',' LONG_VALUE ')'  */
-#line 761 "parser.y"
+  case 77: /* column_type: VECTOR '(' INT ',' LONG_VALUE ')'  */
+#line 777 "parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 3567 "parser.cpp"
+#line 3591 "parser.cpp"
     break;
 
-  case 77: /* column_type: VECTOR '(' BIGINT ',' LONG_VALUE ')'  */
-#line 762 "parser.y"
+  case 78: /* column_type: VECTOR '(' BIGINT ',' LONG_VALUE ')'  */
+#line 778 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt64}; }
-#line 3573 "parser.cpp"
+#line 3597 "parser.cpp"
     break;
 
-  case 78: /* column_type: VECTOR '(' FLOAT ',' LONG_VALUE ')'  */
-#line 763 "parser.y"
+  case 79: /* column_type: VECTOR '(' FLOAT ',' LONG_VALUE ')'  */
+#line 779 "parser.y"
                                       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemFloat}; }
-#line 3579 "parser.cpp"
+#line 3603 "parser.cpp"
     break;
 
-  case 79: /* column_type: VECTOR '(' DOUBLE ',' LONG_VALUE ')'  */
-#line 764 "parser.y"
+  case 80: /* column_type: VECTOR '(' DOUBLE ',' LONG_VALUE ')'  */
+#line 780 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemDouble}; }
-#line 3585 "parser.cpp"
+#line 3609 "parser.cpp"
+    break;
+
+  case 81: /* column_type: VECTOR '(' IDENTIFIER ',' LONG_VALUE ')'  */
+#line 781 "parser.y"
+                                           {
+    // half precision element types aren't keywords
+    ParserHelper::ToLower((yyvsp[-3].str_value));
+    infinity::EmbeddingDataType elem_type = infinity::EmbeddingDataType::kElemInvalid;
+    if(strcmp((yyvsp[-3].str_value), "float16") == 0 || strcmp((yyvsp[-3].str_value), "half") == 0) {
+        elem_type = infinity::kElemFloat16;
+    } else if(strcmp((yyvsp[-3].str_value), "bfloat16") == 0) {
+        elem_type = infinity::kElemBFloat16;
+    }
+    free((yyvsp[-3].str_value));
+    if(elem_type == infinity::EmbeddingDataType::kElemInvalid) {
+        yyerror(&yyloc, scanner, result, "Invalid embedding element type");
+        YYERROR;
+    }
+    (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, elem_type};
+}
+#line 3630 "parser.cpp"
     break;
 
-  case 80: /* column_constraints: column_constraint  */
-#line 783 "parser.y"
+  case 82: /* column_constraints: column_constraint  */
+#line 815 "parser.y"
                                        {
     (yyval.column_constraints_t) = new std::unordered_set<infinity::ConstraintType>();
     (yyval.column_constraints_t)->insert((yyvsp[0].column_constraint_t));
 }
-#line 3594 "parser.cpp"
+#line 3639 "parser.cpp"
     break;
 
-  case 81: /* column_constraints: column_constraints column_constraint  */
-#line 787 "parser.y"
+  case 83: /* column_constraints: column_constraints column_constraint  */
+#line 819 "parser.y"
                                        {
     if((yyvsp[-1].column_constraints_t)->contains((yyvsp[0].column_constraint_t))) {
         yyerror(&yyloc, scanner, result, "Duplicate column constraint.");
@@ -3604,85 +3649,85 @@ yyreduce:
     (yyvsp[-1].column_constraints_t)->insert((yyvsp[0].column_constraint_t));
     (yyval.column_constraints_t) = (yyvsp[-1].column_constraints_t);
 }
-#line 3608 "parser.cpp"
+#line 3653 "parser.cpp"
     break;
 
-  case 82: /* column_constraint: PRIMARY KEY  */
-#line 797 "parser.y"
+  case 84: /* column_constraint: PRIMARY KEY  */
+#line 829 "parser.y"
                                 {
     (yyval.column_constraint_t) = infinity::ConstraintType::kPrimaryKey;
 }
-#line 3616 "parser.cpp"
+#line 3661 "parser.cpp"
     break;
 
-  case 83: /* column_constraint: UNIQUE  */
-#line 800 "parser.y"
+  case 85: /* column_constraint: UNIQUE  */
+#line 832 "parser.y"
          {
     (yyval.column_constraint_t) = infinity::ConstraintType::kUnique;
 }
-#line 3624 "parser.cpp"
+#line 3669 "parser.cpp"
     break;
 
-  case 84: /* column_constraint: NULLABLE  */
-#line 803 "parser.y"
+  case 86: /* column_constraint: NULLABLE  */
+#line 835 "parser.y"
            {
     (yyval.column_constraint_t) = infinity::ConstraintType::kNull;
 }
-#line 3632 "parser.cpp"
+#line 3677 "parser.cpp"
     break;
 
-  case 85: /* column_constraint: NOT NULLABLE  */
-#line 806 "parser.y"
+  case 87: /* column_constraint: NOT NULLABLE  */
+#line 838 "parser.y"
                {
     (yyval.column_constraint_t) = infinity::ConstraintType::kNotNull;
 }
-#line 3640 "parser.cpp"
+#line 3685 "parser.cpp"
     break;
 
-  case 86: /* table_constraint: PRIMARY KEY '(' identifier_array ')'  */
-#line 810 "parser.y"
+  case 88: /* table_constraint: PRIMARY KEY '(' identifier_array ')'  */
+#line 842 "parser.y"
                                                         {
     (yyval.table_constraint_t) = new infinity::TableConstraint();
     (yyval.table_constraint_t)->names_ptr_ = (yyvsp[-1].identifier_array_t);
     (yyval.table_constraint_t)->constraint_ = infinity::ConstraintType::kPrimaryKey;
 }
-#line 3650 "parser.cpp"
+#line 3695 "parser.cpp"
     break;
 
-  case 87: /* table_constraint: UNIQUE '(' identifier_array ')'  */
-#line 815 "parser.y"
+  case 89: /* table_constraint: UNIQUE '(' identifier_array ')'  */
+#line 847 "parser.y"
                                   {
     (yyval.table_constraint_t) = new infinity::TableConstraint();
     (yyval.table_constraint_t)->names_ptr_ = (yyvsp[-1].identifier_array_t);
     (yyval.table_constraint_t)->constraint_ = infinity::ConstraintType::kUnique;
 }
-#line 3660 "parser.cpp"
+#line 3705 "parser.cpp"
     break;
 
-  case 88: /* identifier_array: IDENTIFIER  */
-#line 822 "parser.y"
+  case 90: /* identifier_array: IDENTIFIER  */
+#line 854 "parser.y"
                               {
     (yyval.identifier_array_t) = new std::vector<std::string>();
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.identifier_array_t)->emplace_back((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 3671 "parser.cpp"
+#line 3716 "parser.cpp"
     break;
 
-  case 89: /* identifier_array: identifier_array ',' IDENTIFIER  */
-#line 828 "parser.y"
+  case 91: /* identifier_array: identifier_array ',' IDENTIFIER  */
+#line 860 "parser.y"
                                   {
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyvsp[-2].identifier_array_t)->emplace_back((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
     (yyval.identifier_array_t) = (yyvsp[-2].identifier_array_t);
 }
-#line 3682 "parser.cpp"
+#line 3727 "parser.cpp"
     break;
 
-  case 90: /* delete_statement: DELETE FROM table_name where_clause  */
-#line 838 "parser.y"
+  case 92: /* delete_statement: DELETE FROM table_name where_clause  */
+#line 870 "parser.y"
                                                        {
     (yyval.delete_stmt) = new infinity::DeleteStatement();
 
@@ -3695,11 +3740,11 @@ yyreduce:
     delete (yyvsp[-1].table_name_t);
     (yyval.delete_stmt)->where_expr_ = (yyvsp[0].expr_t);
 }
-#line 3699 "parser.cpp"
+#line 3744 "parser.cpp"
     break;
 
-  case 91: /* insert_statement: INSERT INTO table_name optional_identifier_array VALUES expr_array_list  */
-#line 854 "parser.y"
+  case 93: /* insert_statement: INSERT INTO table_name optional_identifier_array VALUES expr_array_list  */
+#line 886 "parser.y"
                                                                                           {
     bool is_error{false};
     for (auto expr_array : *(yyvsp[0].expr_array_list_t)) {
@@ -3734,11 +3779,11 @@ yyreduce:
     (yyval.insert_stmt)->columns_ = (yyvsp[-2].identifier_array_t);
     (yyval.insert_stmt)->values_ = (yyvsp[0].expr_array_list_t);
 }
-#line 3738 "parser.cpp"
+#line 3783 "parser.cpp"
     break;
 
-  case 92: /* insert_statement: INSERT INTO table_name optional_identifier_array select_without_paren  */
-#line 888 "parser.y"
+  case 94: /* insert_statement: INSERT INTO table_name optional_identifier_array select_without_paren  */
+#line 920 "parser.y"
                                                                         {
     (yyval.insert_stmt) = new infinity::InsertStatement();
     if((yyvsp[-2].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -3751,101 +3796,101 @@ yyreduce:
     (yyval.insert_stmt)->columns_ = (yyvsp[-1].identifier_array_t);
     (yyval.insert_stmt)->select_ = (yyvsp[0].select_stmt);
 }
-#line 3755 "parser.cpp"
+#line 3800 "parser.cpp"
     break;
 
-  case 93: /* optional_identifier_array: '(' identifier_array ')'  */
-#line 901 "parser.y"
+  case 95: /* optional_identifier_array: '(' identifier_array ')'  */
+#line 933 "parser.y"
                                                     {
     (yyval.identifier_array_t) = (yyvsp[-1].identifier_array_t);
 }
-#line 3763 "parser.cpp"
+#line 3808 "parser.cpp"
     break;
 
-  case 94: /* optional_identifier_array: %empty  */
-#line 904 "parser.y"
+  case 96: /* optional_identifier_array: %empty  */
+#line 936 "parser.y"
   {
     (yyval.identifier_array_t) = nullptr;
 }
-#line 3771 "parser.cpp"
+#line 3816 "parser.cpp"
     break;
 
-  case 95: /* explain_statement: EXPLAIN explain_type explainable_statement  */
-#line 911 "parser.y"
+  case 97: /* explain_statement: EXPLAIN explain_type explainable_statement  */
+#line 943 "parser.y"
                                                                {
     (yyval.explain_stmt) = new infinity::ExplainStatement();
     (yyval.explain_stmt)->type_ = (yyvsp[-1].explain_type_t);
     (yyval.explain_stmt)->statement_ = (yyvsp[0].base_stmt);
 }
-#line 3781 "parser.cpp"
+#line 3826 "parser.cpp"
     break;
 
-  case 96: /* explain_type: ANALYZE  */
-#line 917 "parser.y"
+  case 98: /* explain_type: ANALYZE  */
+#line 949 "parser.y"
                       {
     (yyval.explain_type_t) = infinity::ExplainType::kAnalyze;
 }
-#line 3789 "parser.cpp"
+#line 3834 "parser.cpp"
     break;
 
-  case 97: /* explain_type: AST  */
-#line 920 "parser.y"
+  case 99: /* explain_type: AST  */
+#line 952 "parser.y"
       {
     (yyval.explain_type_t) = infinity::ExplainType::kAst;
 }
-#line 3797 "parser.cpp"
+#line 3842 "parser.cpp"
     break;
 
-  case 98: /* explain_type: RAW  */
-#line 923 "parser.y"
+  case 100: /* explain_type: RAW  */
+#line 955 "parser.y"
       {
     (yyval.explain_type_t) = infinity::ExplainType::kUnOpt;
 }
-#line 3805 "parser.cpp"
+#line 3850 "parser.cpp"
     break;
 
-  case 99: /* explain_type: LOGICAL  */
-#line 926 "parser.y"
+  case 101: /* explain_type: LOGICAL  */
+#line 958 "parser.y"
           {
     (yyval.explain_type_t) = infinity::ExplainType::kOpt;
 }
-#line 3813 "parser.cpp"
+#line 3858 "parser.cpp"
     break;
 
-  case 100: /* explain_type: PHYSICAL  */
-#line 929 "parser.y"
+  case 102: /* explain_type: PHYSICAL  */
+#line 961 "parser.y"
            {
     (yyval.explain_type_t) = infinity::ExplainType::kPhysical;
 }
-#line 3821 "parser.cpp"
+#line 3866 "parser.cpp"
     break;
 
-  case 101: /* explain_type: PIPELINE  */
-#line 932 "parser.y"
+  case 103: /* explain_type: PIPELINE  */
+#line 964 "parser.y"
            {
     (yyval.explain_type_t) = infinity::ExplainType::kPipeline;
 }
-#line 3829 "parser.cpp"
+#line 3874 "parser.cpp"
     break;
 
-  case 102: /* explain_type: FRAGMENT  */
-#line 935 "parser.y"
+  case 104: /* explain_type: FRAGMENT  */
+#line 967 "parser.y"
            {
     (yyval.explain_type_t) = infinity::ExplainType::kFragment;
 }
-#line 3837 "parser.cpp"
+#line 3882 "parser.cpp"
     break;
 
-  case 103: /* explain_type: %empty  */
-#line 938 "parser.y"
+  case 105: /* explain_type: %empty  */
+#line 970 "parser.y"
   {
     (yyval.explain_type_t) = infinity::ExplainType::kPhysical;
 }
-#line 3845 "parser.cpp"
+#line 3890 "parser.cpp"
     break;
 
-  case 104: /* update_statement: UPDATE table_name SET update_expr_array where_clause  */
-#line 945 "parser.y"
+  case 106: /* update_statement: UPDATE table_name SET update_expr_array where_clause  */
+#line 977 "parser.y"
                                                                        {
     (yyval.update_stmt) = new infinity::UpdateStatement();
     if((yyvsp[-3].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -3858,29 +3903,29 @@ yyreduce:
     (yyval.update_stmt)->where_expr_ = (yyvsp[0].expr_t);
     (yyval.update_stmt)->update_expr_array_ = (yyvsp[-1].update_expr_array_t);
 }
-#line 3862 "parser.cpp"
+#line 3907 "parser.cpp"
     break;
 
-  case 105: /* update_expr_array: update_expr  */
-#line 958 "parser.y"
+  case 107: /* update_expr_array: update_expr  */
+#line 990 "parser.y"
                                {
     (yyval.update_expr_array_t) = new std::vector<infinity::UpdateExpr*>();
     (yyval.update_expr_array_t)->emplace_back((yyvsp[0].update_expr_t));
 }
-#line 3871 "parser.cpp"
+#line 3916 "parser.cpp"
     break;
 
-  case 106: /* update_expr_array: update_expr_array ',' update_expr  */
-#line 962 "parser.y"
+  case 108: /* update_expr_array: update_expr_array ',' update_expr  */
+#line 994 "parser.y"
                                     {
     (yyvsp[-2].update_expr_array_t)->emplace_back((yyvsp[0].update_expr_t));
     (yyval.update_expr_array_t) = (yyvsp[-2].update_expr_array_t);
 }
-#line 3880 "parser.cpp"
+#line 3925 "parser.cpp"
     break;
 
-  case 107: /* update_expr: IDENTIFIER '=' expr  */
-#line 967 "parser.y"
+  case 109: /* update_expr: IDENTIFIER '=' expr  */
+#line 999 "parser.y"
                                   {
     (yyval.update_expr_t) = new infinity::UpdateExpr();
     ParserHelper::ToLower((yyvsp[-2].str_value));
@@ -3888,11 +3933,11 @@ yyreduce:
     free((yyvsp[-2].str_value));
     (yyval.update_expr_t)->value = (yyvsp[0].expr_t);
 }
-#line 3892 "parser.cpp"
+#line 3937 "parser.cpp"
     break;
 
-  case 108: /* drop_statement: DROP DATABASE if_exists IDENTIFIER  */
-#line 980 "parser.y"
+  case 110: /* drop_statement: DROP DATABASE if_exists IDENTIFIER  */
+#line 1012 "parser.y"
                                                    {
     (yyval.drop_stmt) = new infinity::DropStatement();
     std::shared_ptr<infinity::DropSchemaInfo> drop_schema_info = std::make_shared<infinity::DropSchemaInfo>();
@@ -3904,11 +3949,11 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_ = drop_schema_info;
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
 }
-#line 3908 "parser.cpp"
+#line 3953 "parser.cpp"
     break;
 
-  case 109: /* drop_statement: DROP COLLECTION if_exists table_name  */
-#line 993 "parser.y"
+  case 111: /* drop_statement: DROP COLLECTION if_exists table_name  */
+#line 1025 "parser.y"
                                        {
     (yyval.drop_stmt) = new infinity::DropStatement();
     std::shared_ptr<infinity::DropCollectionInfo> drop_collection_info = std::make_unique<infinity::DropCollectionInfo>();
@@ -3922,11 +3967,11 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 3926 "parser.cpp"
+#line 3971 "parser.cpp"
     break;
 
-  case 110: /* drop_statement: DROP TABLE if_exists table_name  */
-#line 1008 "parser.y"
+  case 112: /* drop_statement: DROP TABLE if_exists table_name  */
+#line 1040 "parser.y"
                                   {
     (yyval.drop_stmt) = new infinity::DropStatement();
     std::shared_ptr<infinity::DropTableInfo> drop_table_info = std::make_unique<infinity::DropTableInfo>();
@@ -3940,11 +3985,11 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 3944 "parser.cpp"
+#line 3989 "parser.cpp"
     break;
 
-  case 111: /* drop_statement: DROP VIEW if_exists table_name  */
-#line 1023 "parser.y"
+  case 113: /* drop_statement: DROP VIEW if_exists table_name  */
+#line 1055 "parser.y"
                                  {
     (yyval.drop_stmt) = new infinity::DropStatement();
     std::shared_ptr<infinity::DropViewInfo> drop_view_info = std::make_unique<infinity::DropViewInfo>();
@@ -3958,11 +4003,11 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 3962 "parser.cpp"
+#line 4007 "parser.cpp"
     break;
 
-  case 112: /* drop_statement: DROP INDEX if_exists IDENTIFIER ON table_name  */
-#line 1038 "parser.y"
+  case 114: /* drop_statement: DROP INDEX if_exists IDENTIFIER ON table_name  */
+#line 1070 "parser.y"
                                                 {
     (yyval.drop_stmt) = new infinity::DropStatement();
     std::shared_ptr<infinity::DropIndexInfo> drop_index_info = std::make_shared<infinity::DropIndexInfo>();
@@ -3981,11 +4026,11 @@ yyreduce:
     free((yyvsp[0].table_name_t)->table_name_ptr_);
     delete (yyvsp[0].table_name_t);
 }
-#line 3985 "parser.cpp"
+#line 4030 "parser.cpp"
     break;
 
-  case 113: /* copy_statement: COPY table_name TO file_path WITH '(' copy_option_list ')'  */
-#line 1061 "parser.y"
+  case 115: /* copy_statement: COPY table_name TO file_path WITH '(' copy_option_list ')'  */
+#line 1093 "parser.y"
                                                                            {
     (yyval.copy_stmt) = new infinity::CopyStatement();
 
@@ -4027,11 +4072,11 @@ yyreduce:
     }
     delete (yyvsp[-1].copy_option_array);
 }
-#line 4031 "parser.cpp"
+#line 4076 "parser.cpp"
     break;
 
-  case 114: /* copy_statement: COPY table_name FROM file_path WITH '(' copy_option_list ')'  */
-#line 1102 "parser.y"
+  case 116: /* copy_statement: COPY table_name FROM file_path WITH '(' copy_option_list ')'  */
+#line 1134 "parser.y"
                                                                {
     (yyval.copy_stmt) = new infinity::CopyStatement();
 
@@ -4073,27 +4118,27 @@ yyreduce:
     }
     delete (yyvsp[-1].copy_option_array);
 }
-#line 4077 "parser.cpp"
+#line 4122 "parser.cpp"
     break;
 
-  case 115: /* select_statement: select_without_paren  */
-#line 1147 "parser.y"
+  case 117: /* select_statement: select_without_paren  */
+#line 1179 "parser.y"
                                         {
     (yyval.select_stmt) = (yyvsp[0].select_stmt);
 }
-#line 4085 "parser.cpp"
+#line 4130 "parser.cpp"
     break;
 
-  case 116: /* select_statement: select_with_paren  */
-#line 1150 "parser.y"
+  case 118: /* select_statement: select_with_paren  */
+#line 1182 "parser.y"
                     {
     (yyval.select_stmt) = (yyvsp[0].select_stmt);
 }
-#line 4093 "parser.cpp"
+#line 4138 "parser.cpp"
     break;
 
-  case 117: /* select_statement: select_statement set_operator select_clause_without_modifier_paren  */
-#line 1153 "parser.y"
+  case 119: /* select_statement: select_statement set_operator select_clause_without_modifier_paren  */
+#line 1185 "parser.y"
                                                                      {
     infinity::SelectStatement* node = (yyvsp[-2].select_stmt);
     while(node->nested_select_ != nullptr) {
@@ -4103,11 +4148,11 @@ yyreduce:
     node->nested_select_ = (yyvsp[0].select_stmt);
     (yyval.select_stmt) = (yyvsp[-2].select_stmt);
 }
-#line 4107 "parser.cpp"
+#line 4152 "parser.cpp"
     break;
 
-  case 118: /* select_statement: select_statement set_operator select_clause_without_modifier  */
-#line 1162 "parser.y"
+  case 120: /* select_statement: select_statement set_operator select_clause_without_modifier  */
+#line 1194 "parser.y"
                                                                {
     infinity::SelectStatement* node = (yyvsp[-2].select_stmt);
     while(node->nested_select_ != nullptr) {
@@ -4117,36 +4162,36 @@ yyreduce:
     node->nested_select_ = (yyvsp[0].select_stmt);
     (yyval.select_stmt) = (yyvsp[-2].select_stmt);
 }
-#line 4121 "parser.cpp"
+#line 4166 "parser.cpp"
     break;
 
-  case 119: /* select_with_paren: '(' select_without_paren ')'  */
-#line 1172 "parser.y"
+  case 121: /* select_with_paren: '(' select_without_paren ')'  */
+#line 1204 "parser.y"
                                                  {
     (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 4129 "parser.cpp"
+#line 4174 "parser.cpp"
     break;
 
-  case 120: /* select_with_paren: '(' select_with_paren ')'  */
-#line 1175 "parser.y"
+  case 122: /* select_with_paren: '(' select_with_paren ')'  */
+#line 1207 "parser.y"
                             {
     (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 4137 "parser.cpp"
+#line 4182 "parser.cpp"
     break;
 
-  case 121: /* select_without_paren: with_clause select_clause_with_modifier  */
-#line 1179 "parser.y"
+  case 123: /* select_without_paren: with_clause select_clause_with_modifier  */
+#line 1211 "parser.y"
                                                               {
     (yyvsp[0].select_stmt)->with_exprs_ = (yyvsp[-1].with_expr_list_t);
     (yyval.select_stmt) = (yyvsp[0].select_stmt);
 }
-#line 4146 "parser.cpp"
+#line 4191 "parser.cpp"
     break;
 
-  case 122: /* select_clause_with_modifier: select_clause_without_modifier order_by_clause limit_expr offset_expr  */
-#line 1184 "parser.y"
+  case 124: /* select_clause_with_modifier: select_clause_without_modifier order_by_clause limit_expr offset_expr  */
+#line 1216 "parser.y"
                                                                                                    {
     if((yyvsp[-1].expr_t) == nullptr and (yyvsp[0].expr_t) != nullptr) {
         delete (yyvsp[-3].select_stmt);
@@ -4168,27 +4213,27 @@ yyreduce:
     (yyvsp[-3].select_stmt)->offset_expr_ = (yyvsp[0].expr_t);
     (yyval.select_stmt) = (yyvsp[-3].select_stmt);
 }
-#line 4172 "parser.cpp"
+#line 4217 "parser.cpp"
     break;
 
-  case 123: /* select_clause_without_modifier_paren: '(' select_clause_without_modifier ')'  */
-#line 1206 "parser.y"
+  case 125: /* select_clause_without_modifier_paren: '(' select_clause_without_modifier ')'  */
+#line 1238 "parser.y"
                                                                              {
   (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 4180 "parser.cpp"
+#line 4225 "parser.cpp"
     break;
 
-  case 124: /* select_clause_without_modifier_paren: '(' select_clause_without_modifier_paren ')'  */
-#line 1209 "parser.y"
+  case 126: /* select_clause_without_modifier_paren: '(' select_clause_without_modifier_paren ')'  */
+#line 1241 "parser.y"
                                                {
     (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 4188 "parser.cpp"
+#line 4233 "parser.cpp"
     break;
 
-  case 125: /* select_clause_without_modifier: SELECT distinct expr_array from_clause search_clause where_clause group_by_clause having_clause  */
-#line 1214 "parser.y"
+  case 127: /* select_clause_without_modifier: SELECT distinct expr_array from_clause search_clause where_clause group_by_clause having_clause  */
+#line 1246 "parser.y"
                                                                                                 {
     (yyval.select_stmt) = new infinity::SelectStatement();
     (yyval.select_stmt)->select_list_ = (yyvsp[-5].expr_array_t);
@@ -4204,245 +4249,245 @@ yyreduce:
         YYERROR;
     }
 }
-#line 4208 "parser.cpp"
+#line 4253 "parser.cpp"
     break;
 
-  case 126: /* order_by_clause: ORDER BY order_by_expr_list  */
-#line 1230 "parser.y"
+  case 128: /* order_by_clause: ORDER BY order_by_expr_list  */
+#line 1262 "parser.y"
                                               {
     (yyval.order_by_expr_list_t) = (yyvsp[0].order_by_expr_list_t);
 }
-#line 4216 "parser.cpp"
+#line 4261 "parser.cpp"
     break;
 
-  case 127: /* order_by_clause: %empty  */
-#line 1233 "parser.y"
+  case 129: /* order_by_clause: %empty  */
+#line 1265 "parser.y"
                        {
     (yyval.order_by_expr_list_t) = nullptr;
 }
-#line 4224 "parser.cpp"
+#line 4269 "parser.cpp"
     break;
 
-  case 128: /* order_by_expr_list: order_by_expr  */
-#line 1237 "parser.y"
+  case 130: /* order_by_expr_list: order_by_expr  */
+#line 1269 "parser.y"
                                   {
     (yyval.order_by_expr_list_t) = new std::vector<infinity::OrderByExpr*>();
     (yyval.order_by_expr_list_t)->emplace_back((yyvsp[0].order_by_expr_t));
 }
-#line 4233 "parser.cpp"
+#line 4278 "parser.cpp"
     break;
 
-  case 129: /* order_by_expr_list: order_by_expr_list ',' order_by_expr  */
-#line 1241 "parser.y"
+  case 131: /* order_by_expr_list: order_by_expr_list ',' order_by_expr  */
+#line 1273 "parser.y"
                                        {
     (yyvsp[-2].order_by_expr_list_t)->emplace_back((yyvsp[0].order_by_expr_t));
     (yyval.order_by_expr_list_t) = (yyvsp[-2].order_by_expr_list_t);
 }
-#line 4242 "parser.cpp"
+#line 4287 "parser.cpp"
     break;
 
-  case 130: /* order_by_expr: expr order_by_type  */
-#line 1246 "parser.y"
+  case 132: /* order_by_expr: expr order_by_type  */
+#line 1278 "parser.y"
                                    {
     (yyval.order_by_expr_t) = new infinity::OrderByExpr();
     (yyval.order_by_expr_t)->expr_ = (yyvsp[-1].expr_t);
     (yyval.order_by_expr_t)->type_ = (yyvsp[0].order_by_type_t);
 }
-#line 4252 "parser.cpp"
+#line 4297 "parser.cpp"
     break;
 
-  case 131: /* order_by_type: ASC  */
-#line 1252 "parser.y"
+  case 133: /* order_by_type: ASC  */
+#line 1284 "parser.y"
                    {
     (yyval.order_by_type_t) = infinity::kAsc;
 }
-#line 4260 "parser.cpp"
+#line 4305 "parser.cpp"
     break;
 
-  case 132: /* order_by_type: DESC  */
-#line 1255 "parser.y"
+  case 134: /* order_by_type: DESC  */
+#line 1287 "parser.y"
        {
     (yyval.order_by_type_t) = infinity::kDesc;
 }
-#line 4268 "parser.cpp"
+#line 4313 "parser.cpp"
     break;
 
-  case 133: /* order_by_type: %empty  */
-#line 1258 "parser.y"
+  case 135: /* order_by_type: %empty  */
+#line 1290 "parser.y"
   {
     (yyval.order_by_type_t) = infinity::kAsc;
 }
-#line 4276 "parser.cpp"
+#line 4321 "parser.cpp"
     break;
 
-  case 134: /* limit_expr: LIMIT expr  */
-#line 1262 "parser.y"
+  case 136: /* limit_expr: LIMIT expr  */
+#line 1294 "parser.y"
                        {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 4284 "parser.cpp"
+#line 4329 "parser.cpp"
     break;
 
-  case 135: /* limit_expr: %empty  */
-#line 1266 "parser.y"
+  case 137: /* limit_expr: %empty  */
+#line 1298 "parser.y"
 {   (yyval.expr_t) = nullptr; }
-#line 4290 "parser.cpp"
+#line 4335 "parser.cpp"
     break;
 
-  case 136: /* offset_expr: OFFSET expr  */
-#line 1268 "parser.y"
+  case 138: /* offset_expr: OFFSET expr  */
+#line 1300 "parser.y"
                          {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 4298 "parser.cpp"
+#line 4343 "parser.cpp"
     break;
 
-  case 137: /* offset_expr: %empty  */
-#line 1272 "parser.y"
+  case 139: /* offset_expr: %empty  */
+#line 1304 "parser.y"
 {   (yyval.expr_t) = nullptr; }
-#line 4304 "parser.cpp"
+#line 4349 "parser.cpp"
     break;
 
-  case 138: /* distinct: DISTINCT  */
-#line 1274 "parser.y"
+  case 140: /* distinct: DISTINCT  */
+#line 1306 "parser.y"
                     {
     (yyval.bool_value) = true;
 }
-#line 4312 "parser.cpp"
+#line 4357 "parser.cpp"
     break;
 
-  case 139: /* distinct: %empty  */
-#line 1277 "parser.y"
+  case 141: /* distinct: %empty  */
+#line 1309 "parser.y"
   {
     (yyval.bool_value) = false;
 }
-#line 4320 "parser.cpp"
+#line 4365 "parser.cpp"
     break;
 
-  case 140: /* from_clause: FROM table_reference  */
-#line 1281 "parser.y"
+  case 142: /* from_clause: FROM table_reference  */
+#line 1313 "parser.y"
                                   {
     (yyval.table_reference_t) = (yyvsp[0].table_reference_t);
 }
-#line 4328 "parser.cpp"
+#line 4373 "parser.cpp"
     break;
 
-  case 141: /* from_clause: %empty  */
-#line 1284 "parser.y"
+  case 143: /* from_clause: %empty  */
+#line 1316 "parser.y"
                        {
     (yyval.table_reference_t) = nullptr;
 }
-#line 4336 "parser.cpp"
+#line 4381 "parser.cpp"
     break;
 
-  case 142: /* search_clause: SEARCH sub_search_array  */
-#line 1288 "parser.y"
+  case 144: /* search_clause: SEARCH sub_search_array  */
+#line 1320 "parser.y"
                                        {
     infinity::SearchExpr* search_expr = new infinity::SearchExpr();
     search_expr->SetExprs((yyvsp[0].expr_array_t));
     (yyval.expr_t) = search_expr;
 }
-#line 4346 "parser.cpp"
+#line 4391 "parser.cpp"
     break;
 
-  case 143: /* search_clause: %empty  */
-#line 1293 "parser.y"
+  case 145: /* search_clause: %empty  */
+#line 1325 "parser.y"
                          {
     (yyval.expr_t) = nullptr;
 }
-#line 4354 "parser.cpp"
+#line 4399 "parser.cpp"
     break;
 
-  case 144: /* where_clause: WHERE expr  */
-#line 1297 "parser.y"
+  case 146: /* where_clause: WHERE expr  */
+#line 1329 "parser.y"
                          {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 4362 "parser.cpp"
+#line 4407 "parser.cpp"
     break;
 
-  case 145: /* where_clause: %empty  */
-#line 1300 "parser.y"
+  case 147: /* where_clause: %empty  */
+#line 1332 "parser.y"
                         {
     (yyval.expr_t) = nullptr;
 }
-#line 4370 "parser.cpp"
+#line 4415 "parser.cpp"
     break;
 
-  case 146: /* having_clause: HAVING expr  */
-#line 1304 "parser.y"
+  case 148: /* having_clause: HAVING expr  */
+#line 1336 "parser.y"
                            {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 4378 "parser.cpp"
+#line 4423 "parser.cpp"
     break;
 
-  case 147: /* having_clause: %empty  */
-#line 1307 "parser.y"
+  case 149: /* having_clause: %empty  */
+#line 1339 "parser.y"
                         {
     (yyval.expr_t) = nullptr;
 }
-#line 4386 "parser.cpp"
+#line 4431 "parser.cpp"
     break;
 
-  case 148: /* group_by_clause: GROUP BY expr_array  */
-#line 1311 "parser.y"
+  case 150: /* group_by_clause: GROUP BY expr_array  */
+#line 1343 "parser.y"
                                      {
     (yyval.expr_array_t) = (yyvsp[0].expr_array_t);
 }
-#line 4394 "parser.cpp"
+#line 4439 "parser.cpp"
     break;
 
-  case 149: /* group_by_clause: %empty  */
-#line 1314 "parser.y"
+  case 151: /* group_by_clause: %empty  */
+#line 1346 "parser.y"
   {
     (yyval.expr_array_t) = nullptr;
 }
-#line 4402 "parser.cpp"
+#line 4447 "parser.cpp"
     break;
 
-  case 150: /* set_operator: UNION  */
-#line 1318 "parser.y"
+  case 152: /* set_operator: UNION  */
+#line 1350 "parser.y"
                      {
     (yyval.set_operator_t) = infinity::SetOperatorType::kUnion;
 }
-#line 4410 "parser.cpp"
+#line 4455 "parser.cpp"
     break;
 
-  case 151: /* set_operator: UNION ALL  */
-#line 1321 "parser.y"
+  case 153: /* set_operator: UNION ALL  */
+#line 1353 "parser.y"
             {
     (yyval.set_operator_t) = infinity::SetOperatorType::kUnionAll;
 }
-#line 4418 "parser.cpp"
+#line 4463 "parser.cpp"
     break;
 
-  case 152: /* set_operator: INTERSECT  */
-#line 1324 "parser.y"
+  case 154: /* set_operator: INTERSECT  */
+#line 1356 "parser.y"
             {
     (yyval.set_operator_t) = infinity::SetOperatorType::kIntersect;
 }
-#line 4426 "parser.cpp"
+#line 4471 "parser.cpp"
     break;
 
-  case 153: /* set_operator: EXCEPT  */
-#line 1327 "parser.y"
+  case 155: /* set_operator: EXCEPT  */
+#line 1359 "parser.y"
          {
     (yyval.set_operator_t) = infinity::SetOperatorType::kExcept;
 }
-#line 4434 "parser.cpp"
+#line 4479 "parser.cpp"
     break;
 
-  case 154: /* table_reference: table_reference_unit  */
-#line 1335 "parser.y"
+  case 156: /* table_reference: table_reference_unit  */
+#line 1367 "parser.y"
                                        {
     (yyval.table_reference_t) = (yyvsp[0].table_reference_t);
 }
-#line 4442 "parser.cpp"
+#line 4487 "parser.cpp"
     break;
 
-  case 155: /* table_reference: table_reference ',' table_reference_unit  */
-#line 1338 "parser.y"
+  case 157: /* table_reference: table_reference ',' table_reference_unit  */
+#line 1370 "parser.y"
                                            {
     infinity::CrossProductReference* cross_product_ref = nullptr;
     if((yyvsp[-2].table_reference_t)->type_ == infinity::TableRefType::kCrossProduct) {
@@ -4456,11 +4501,11 @@ yyreduce:
 
     (yyval.table_reference_t) = cross_product_ref;
 }
-#line 4460 "parser.cpp"
+#line 4505 "parser.cpp"
     break;
 
-  case 158: /* table_reference_name: table_name table_alias  */
-#line 1355 "parser.y"
+  case 160: /* table_reference_name: table_name table_alias  */
+#line 1387 "parser.y"
                                               {
     infinity::TableReference* table_ref = new infinity::TableReference();
     if((yyvsp[-1].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -4474,32 +4519,32 @@ yyreduce:
     table_ref->alias_ = (yyvsp[0].table_alias_t);
     (yyval.table_reference_t) = table_ref;
 }
-#line 4478 "parser.cpp"
+#line 4523 "parser.cpp"
     break;
 
-  case 159: /* table_reference_name: '(' select_statement ')' table_alias  */
-#line 1369 "parser.y"
+  case 161: /* table_reference_name: '(' select_statement ')' table_alias  */
+#line 1401 "parser.y"
                                        {
     infinity::SubqueryReference* subquery_reference = new infinity::SubqueryReference();
     subquery_reference->select_statement_ = (yyvsp[-2].select_stmt);
     subquery_reference->alias_ = (yyvsp[0].table_alias_t);
     (yyval.table_reference_t) = subquery_reference;
 }
-#line 4489 "parser.cpp"
+#line 4534 "parser.cpp"
     break;
 
-  case 160: /* table_name: IDENTIFIER  */
-#line 1378 "parser.y"
+  case 162: /* table_name: IDENTIFIER  */
+#line 1410 "parser.y"
                         {
     (yyval.table_name_t) = new infinity::TableName();
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.table_name_t)->table_name_ptr_ = (yyvsp[0].str_value);
 }
-#line 4499 "parser.cpp"
+#line 4544 "parser.cpp"
     break;
 
-  case 161: /* table_name: IDENTIFIER '.' IDENTIFIER  */
-#line 1383 "parser.y"
+  case 163: /* table_name: IDENTIFIER '.' IDENTIFIER  */
+#line 1415 "parser.y"
                             {
     (yyval.table_name_t) = new infinity::TableName();
     ParserHelper::ToLower((yyvsp[-2].str_value));
@@ -4507,84 +4552,84 @@ yyreduce:
     (yyval.table_name_t)->schema_name_ptr_ = (yyvsp[-2].str_value);
     (yyval.table_name_t)->table_name_ptr_ = (yyvsp[0].str_value);
 }
-#line 4511 "parser.cpp"
+#line 4556 "parser.cpp"
     break;
 
-  case 162: /* table_alias: AS IDENTIFIER  */
-#line 1392 "parser.y"
+  case 164: /* table_alias: AS IDENTIFIER  */
+#line 1424 "parser.y"
                             {
     (yyval.table_alias_t) = new infinity::TableAlias();
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.table_alias_t)->alias_ = (yyvsp[0].str_value);
 }
-#line 4521 "parser.cpp"
+#line 4566 "parser.cpp"
     break;
 
-  case 163: /* table_alias: IDENTIFIER  */
-#line 1397 "parser.y"
+  case 165: /* table_alias: IDENTIFIER  */
+#line 1429 "parser.y"
              {
     (yyval.table_alias_t) = new infinity::TableAlias();
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.table_alias_t)->alias_ = (yyvsp[0].str_value);
 }
-#line 4531 "parser.cpp"
+#line 4576 "parser.cpp"
     break;
 
-  case 164: /* table_alias: AS IDENTIFIER '(' identifier_array ')'  */
-#line 1402 "parser.y"
+  case 166: /* table_alias: AS IDENTIFIER '(' identifier_array ')'  */
+#line 1434 "parser.y"
                                          {
     (yyval.table_alias_t) = new infinity::TableAlias();
     ParserHelper::ToLower((yyvsp[-3].str_value));
     (yyval.table_alias_t)->alias_ = (yyvsp[-3].str_value);
     (yyval.table_alias_t)->column_alias_array_ = (yyvsp[-1].identifier_array_t);
 }
-#line 4542 "parser.cpp"
+#line 4587 "parser.cpp"
     break;
 
-  case 165: /* table_alias: %empty  */
-#line 1408 "parser.y"
+  case 167: /* table_alias: %empty  */
+#line 1440 "parser.y"
   {
     (yyval.table_alias_t) = nullptr;
 }
-#line 4550 "parser.cpp"
+#line 4595 "parser.cpp"
     break;
 
-  case 166: /* with_clause: WITH with_expr_list  */
-#line 1415 "parser.y"
+  case 168: /* with_clause: WITH with_expr_list  */
+#line 1447 "parser.y"
                                   {
     (yyval.with_expr_list_t) = (yyvsp[0].with_expr_list_t);
 }
-#line 4558 "parser.cpp"
+#line 4603 "parser.cpp"
     break;
 
-  case 167: /* with_clause: %empty  */
-#line 1418 "parser.y"
+  case 169: /* with_clause: %empty  */
+#line 1450 "parser.y"
                           {
     (yyval.with_expr_list_t) = nullptr;
 }
-#line 4566 "parser.cpp"
+#line 4611 "parser.cpp"
     break;
 
-  case 168: /* with_expr_list: with_expr  */
-#line 1422 "parser.y"
+  case 170: /* with_expr_list: with_expr  */
+#line 1454 "parser.y"
                           {
     (yyval.with_expr_list_t) = new std::vector<infinity::WithExpr*>();
     (yyval.with_expr_list_t)->emplace_back((yyvsp[0].with_expr_t));
 }
-#line 4575 "parser.cpp"
+#line 4620 "parser.cpp"
     break;
 
-  case 169: /* with_expr_list: with_expr_list ',' with_expr  */
-#line 1425 "parser.y"
+  case 171: /* with_expr_list: with_expr_list ',' with_expr  */
+#line 1457 "parser.y"
                                  {
     (yyvsp[-2].with_expr_list_t)->emplace_back((yyvsp[0].with_expr_t));
     (yyval.with_expr_list_t) = (yyvsp[-2].with_expr_list_t);
 }
-#line 4584 "parser.cpp"
+#line 4629 "parser.cpp"
     break;
 
-  case 170: /* with_expr: IDENTIFIER AS '(' select_clause_with_modifier ')'  */
-#line 1430 "parser.y"
+  case 172: /* with_expr: IDENTIFIER AS '(' select_clause_with_modifier ')'  */
+#line 1462 "parser.y"
                                                              {
     (yyval.with_expr_t) = new infinity::WithExpr();
     ParserHelper::ToLower((yyvsp[-4].str_value));
@@ -4592,11 +4637,11 @@ yyreduce:
     free((yyvsp[-4].str_value));
     (yyval.with_expr_t)->select_ = (yyvsp[-1].select_stmt);
 }
-#line 4596 "parser.cpp"
+#line 4641 "parser.cpp"
     break;
 
-  case 171: /* join_clause: table_reference_unit NATURAL JOIN table_reference_name  */
-#line 1442 "parser.y"
+  case 173: /* join_clause: table_reference_unit NATURAL JOIN table_reference_name  */
+#line 1474 "parser.y"
                                                                     {
     infinity::JoinReference* join_reference = new infinity::JoinReference();
     join_reference->left_ = (yyvsp[-3].table_reference_t);
@@ -4604,11 +4649,11 @@ yyreduce:
     join_reference->join_type_ = infinity::JoinType::kNatural;
     (yyval.table_reference_t) = join_reference;
 }
-#line 4608 "parser.cpp"
+#line 4653 "parser.cpp"
     break;
 
-  case 172: /* join_clause: table_reference_unit join_type JOIN table_reference_name ON expr  */
-#line 1449 "parser.y"
+  case 174: /* join_clause: table_reference_unit join_type JOIN table_reference_name ON expr  */
+#line 1481 "parser.y"
                                                                    {
     infinity::JoinReference* join_reference = new infinity::JoinReference();
     join_reference->left_ = (yyvsp[-5].table_reference_t);
@@ -4617,129 +4662,129 @@ yyreduce:
     join_reference->condition_ = (yyvsp[0].expr_t);
     (yyval.table_reference_t) = join_reference;
 }
-#line 4621 "parser.cpp"
+#line 4666 "parser.cpp"
     break;
 
-  case 173: /* join_type: INNER  */
-#line 1463 "parser.y"
+  case 175: /* join_type: INNER  */
+#line 1495 "parser.y"
                   {
     (yyval.join_type_t) = infinity::JoinType::kInner;
 }
-#line 4629 "parser.cpp"
+#line 4674 "parser.cpp"
     break;
 
-  case 174: /* join_type: LEFT  */
-#line 1466 "parser.y"
+  case 176: /* join_type: LEFT  */
+#line 1498 "parser.y"
        {
     (yyval.join_type_t) = infinity::JoinType::kLeft;
 }
-#line 4637 "parser.cpp"
+#line 4682 "parser.cpp"
     break;
 
-  case 175: /* join_type: RIGHT  */
-#line 1469 "parser.y"
+  case 177: /* join_type: RIGHT  */
+#line 1501 "parser.y"
         {
     (yyval.join_type_t) = infinity::JoinType::kRight;
 }
-#line 4645 "parser.cpp"
+#line 4690 "parser.cpp"
     break;
 
-  case 176: /* join_type: OUTER  */
-#line 1472 "parser.y"
+  case 178: /* join_type: OUTER  */
+#line 1504 "parser.y"
         {
     (yyval.join_type_t) = infinity::JoinType::kFull;
 }
-#line 4653 "parser.cpp"
+#line 4698 "parser.cpp"
     break;
 
-  case 177: /* join_type: FULL  */
-#line 1475 "parser.y"
+  case 179: /* join_type: FULL  */
+#line 1507 "parser.y"
        {
     (yyval.join_type_t) = infinity::JoinType::kFull;
 }
-#line 4661 "parser.cpp"
+#line 4706 "parser.cpp"
     break;
 
-  case 178: /* join_type: CROSS  */
-#line 1478 "parser.y"
+  case 180: /* join_type: CROSS  */
+#line 1510 "parser.y"
         {
     (yyval.join_type_t) = infinity::JoinType::kCross;
 }
-#line 4669 "parser.cpp"
+#line 4714 "parser.cpp"
     break;
 
-  case 179: /* join_type: %empty  */
-#line 1481 "parser.y"
+  case 181: /* join_type: %empty  */
+#line 1513 "parser.y"
                 {
 }
-#line 4676 "parser.cpp"
+#line 4721 "parser.cpp"
     break;
 
-  case 180: /* show_statement: SHOW DATABASES  */
-#line 1487 "parser.y"
+  case 182: /* show_statement: SHOW DATABASES  */
+#line 1519 "parser.y"
                                {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kDatabases;
 }
-#line 4685 "parser.cpp"
+#line 4730 "parser.cpp"
     break;
 
-  case 181: /* show_statement: SHOW TABLES  */
-#line 1491 "parser.y"
+  case 183: /* show_statement: SHOW TABLES  */
+#line 1523 "parser.y"
               {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kTables;
 }
-#line 4694 "parser.cpp"
+#line 4739 "parser.cpp"
     break;
 
-  case 182: /* show_statement: SHOW VIEWS  */
-#line 1495 "parser.y"
+  case 184: /* show_statement: SHOW VIEWS  */
+#line 1527 "parser.y"
              {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kViews;
 }
-#line 4703 "parser.cpp"
+#line 4748 "parser.cpp"
     break;
 
-  case 183: /* show_statement: SHOW CONFIGS  */
-#line 1499 "parser.y"
+  case 185: /* show_statement: SHOW CONFIGS  */
+#line 1531 "parser.y"
                {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kConfigs;
 }
-#line 4712 "parser.cpp"
+#line 4757 "parser.cpp"
     break;
 
-  case 184: /* show_statement: SHOW PROFILES  */
-#line 1503 "parser.y"
+  case 186: /* show_statement: SHOW PROFILES  */
+#line 1535 "parser.y"
                 {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kProfiles;
 }
-#line 4721 "parser.cpp"
+#line 4766 "parser.cpp"
     break;
 
-  case 185: /* show_statement: SHOW SESSION STATUS  */
-#line 1507 "parser.y"
+  case 187: /* show_statement: SHOW SESSION STATUS  */
+#line 1539 "parser.y"
                       {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kSessionStatus;
 }
-#line 4730 "parser.cpp"
+#line 4775 "parser.cpp"
     break;
 
-  case 186: /* show_statement: SHOW GLOBAL STATUS  */
-#line 1511 "parser.y"
+  case 188: /* show_statement: SHOW GLOBAL STATUS  */
+#line 1543 "parser.y"
                      {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kGlobalStatus;
 }
-#line 4739 "parser.cpp"
+#line 4784 "parser.cpp"
     break;
 
-  case 187: /* show_statement: DESCRIBE table_name  */
-#line 1515 "parser.y"
+  case 189: /* show_statement: DESCRIBE table_name  */
+#line 1547 "parser.y"
                       {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kColumns;
@@ -4751,11 +4796,11 @@ yyreduce:
     free((yyvsp[0].table_name_t)->table_name_ptr_);
     delete (yyvsp[0].table_name_t);
 }
-#line 4755 "parser.cpp"
+#line 4800 "parser.cpp"
     break;
 
-  case 188: /* show_statement: DESCRIBE table_name SEGMENTS  */
-#line 1526 "parser.y"
+  case 190: /* show_statement: DESCRIBE table_name SEGMENTS  */
+#line 1558 "parser.y"
                                {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kSegments;
@@ -4767,11 +4812,11 @@ yyreduce:
     free((yyvsp[-1].table_name_t)->table_name_ptr_);
     delete (yyvsp[-1].table_name_t);
 }
-#line 4771 "parser.cpp"
+#line 4816 "parser.cpp"
     break;
 
-  case 189: /* show_statement: DESCRIBE table_name SEGMENT LONG_VALUE  */
-#line 1537 "parser.y"
+  case 191: /* show_statement: DESCRIBE table_name SEGMENT LONG_VALUE  */
+#line 1569 "parser.y"
                                          {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kSegments;
@@ -4784,11 +4829,11 @@ yyreduce:
     (yyval.show_stmt)->segment_id_ = (yyvsp[0].long_value);
     delete (yyvsp[-2].table_name_t);
 }
-#line 4788 "parser.cpp"
+#line 4833 "parser.cpp"
     break;
 
-  case 190: /* show_statement: DESCRIBE table_name SEGMENT LONG_VALUE BLOCK LONG_VALUE  */
-#line 1549 "parser.y"
+  case 192: /* show_statement: DESCRIBE table_name SEGMENT LONG_VALUE BLOCK LONG_VALUE  */
+#line 1581 "parser.y"
                                                           {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kSegments;
@@ -4802,11 +4847,11 @@ yyreduce:
     (yyval.show_stmt)->block_id_ = (yyvsp[0].long_value);
     delete (yyvsp[-4].table_name_t);
 }
-#line 4806 "parser.cpp"
+#line 4851 "parser.cpp"
     break;
 
-  case 191: /* show_statement: DESCRIBE INDEX table_name  */
-#line 1562 "parser.y"
+  case 193: /* show_statement: DESCRIBE INDEX table_name  */
+#line 1594 "parser.y"
                             {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kIndexes;
@@ -4818,38 +4863,38 @@ yyreduce:
     free((yyvsp[0].table_name_t)->table_name_ptr_);
     delete (yyvsp[0].table_name_t);
 }
-#line 4822 "parser.cpp"
+#line 4867 "parser.cpp"
     break;
 
-  case 192: /* flush_statement: FLUSH DATA  */
-#line 1577 "parser.y"
+  case 194: /* flush_statement: FLUSH DATA  */
+#line 1609 "parser.y"
                             {
     (yyval.flush_stmt) = new infinity::FlushStatement();
     (yyval.flush_stmt)->type_ = infinity::FlushType::kData;
 }
-#line 4831 "parser.cpp"
+#line 4876 "parser.cpp"
     break;
 
-  case 193: /* flush_statement: FLUSH LOG  */
-#line 1581 "parser.y"
+  case 195: /* flush_statement: FLUSH LOG  */
+#line 1613 "parser.y"
             {
     (yyval.flush_stmt) = new infinity::FlushStatement();
     (yyval.flush_stmt)->type_ = infinity::FlushType::kLog;
 }
-#line 4840 "parser.cpp"
+#line 4885 "parser.cpp"
     break;
 
-  case 194: /* flush_statement: FLUSH BUFFER  */
-#line 1585 "parser.y"
+  case 196: /* flush_statement: FLUSH BUFFER  */
+#line 1617 "parser.y"
                {
     (yyval.flush_stmt) = new infinity::FlushStatement();
     (yyval.flush_stmt)->type_ = infinity::FlushType::kBuffer;
 }
-#line 4849 "parser.cpp"
+#line 4894 "parser.cpp"
     break;
 
-  case 195: /* optimize_statement: OPTIMIZE table_name  */
-#line 1593 "parser.y"
+  case 197: /* optimize_statement: OPTIMIZE table_name  */
+#line 1625 "parser.y"
                                         {
     (yyval.optimize_stmt) = new infinity::OptimizeStatement();
     (yyval.optimize_stmt)->type_ = infinity::OptimizeType::kIRS;
@@ -4861,54 +4906,54 @@ yyreduce:
     free((yyvsp[0].table_name_t)->table_name_ptr_);
     delete (yyvsp[0].table_name_t);
 }
-#line 4865 "parser.cpp"
+#line 4910 "parser.cpp"
     break;
 
-  case 196: /* command_statement: USE IDENTIFIER  */
-#line 1608 "parser.y"
+  case 198: /* command_statement: USE IDENTIFIER  */
+#line 1640 "parser.y"
                                   {
     (yyval.command_stmt) = new infinity::CommandStatement();
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::UseCmd>((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 4876 "parser.cpp"
+#line 4921 "parser.cpp"
     break;
 
-  case 197: /* command_statement: EXPORT PROFILE LONG_VALUE file_path  */
-#line 1614 "parser.y"
+  case 199: /* command_statement: EXPORT PROFILE LONG_VALUE file_path  */
+#line 1646 "parser.y"
                                       {
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::ExportCmd>((yyvsp[0].str_value), infinity::ExportType::kProfileRecord, (yyvsp[-1].long_value));
     free((yyvsp[0].str_value));
 }
-#line 4886 "parser.cpp"
+#line 4931 "parser.cpp"
     break;
 
-  case 198: /* command_statement: SET SESSION IDENTIFIER ON  */
-#line 1619 "parser.y"
+  case 200: /* command_statement: SET SESSION IDENTIFIER ON  */
+#line 1651 "parser.y"
                             {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kBool, (yyvsp[-1].str_value), true);
     free((yyvsp[-1].str_value));
 }
-#line 4897 "parser.cpp"
+#line 4942 "parser.cpp"
     break;
 
-  case 199: /* command_statement: SET SESSION IDENTIFIER OFF  */
-#line 1625 "parser.y"
+  case 201: /* command_statement: SET SESSION IDENTIFIER OFF  */
+#line 1657 "parser.y"
                              {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kBool, (yyvsp[-1].str_value), false);
     free((yyvsp[-1].str_value));
 }
-#line 4908 "parser.cpp"
+#line 4953 "parser.cpp"
     break;
 
-  case 200: /* command_statement: SET SESSION IDENTIFIER STRING  */
-#line 1631 "parser.y"
+  case 202: /* command_statement: SET SESSION IDENTIFIER STRING  */
+#line 1663 "parser.y"
                                 {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -4917,55 +4962,55 @@ yyreduce:
     free((yyvsp[-1].str_value));
     free((yyvsp[0].str_value));
 }
-#line 4921 "parser.cpp"
+#line 4966 "parser.cpp"
     break;
 
-  case 201: /* command_statement: SET SESSION IDENTIFIER LONG_VALUE  */
-#line 1639 "parser.y"
+  case 203: /* command_statement: SET SESSION IDENTIFIER LONG_VALUE  */
+#line 1671 "parser.y"
                                     {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kInteger, (yyvsp[-1].str_value), (yyvsp[0].long_value));
     free((yyvsp[-1].str_value));
 }
-#line 4932 "parser.cpp"
+#line 4977 "parser.cpp"
     break;
 
-  case 202: /* command_statement: SET SESSION IDENTIFIER DOUBLE_VALUE  */
-#line 1645 "parser.y"
+  case 204: /* command_statement: SET SESSION IDENTIFIER DOUBLE_VALUE  */
+#line 1677 "parser.y"
                                       {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kDouble, (yyvsp[-1].str_value), (yyvsp[0].double_value));
     free((yyvsp[-1].str_value));
 }
-#line 4943 "parser.cpp"
+#line 4988 "parser.cpp"
     break;
 
-  case 203: /* command_statement: SET GLOBAL IDENTIFIER ON  */
-#line 1651 "parser.y"
+  case 205: /* command_statement: SET GLOBAL IDENTIFIER ON  */
+#line 1683 "parser.y"
                            {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kBool, (yyvsp[-1].str_value), true);
     free((yyvsp[-1].str_value));
 }
-#line 4954 "parser.cpp"
+#line 4999 "parser.cpp"
     break;
 
-  case 204: /* command_statement: SET GLOBAL IDENTIFIER OFF  */
-#line 1657 "parser.y"
+  case 206: /* command_statement: SET GLOBAL IDENTIFIER OFF  */
+#line 1689 "parser.y"
                             {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kBool, (yyvsp[-1].str_value), false);
     free((yyvsp[-1].str_value));
 }
-#line 4965 "parser.cpp"
+#line 5010 "parser.cpp"
     break;
 
-  case 205: /* command_statement: SET GLOBAL IDENTIFIER STRING  */
-#line 1663 "parser.y"
+  case 207: /* command_statement: SET GLOBAL IDENTIFIER STRING  */
+#line 1695 "parser.y"
                                {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -4974,60 +5019,60 @@ yyreduce:
     free((yyvsp[-1].str_value));
     free((yyvsp[0].str_value));
 }
-#line 4978 "parser.cpp"
+#line 5023 "parser.cpp"
     break;
 
-  case 206: /* command_statement: SET GLOBAL IDENTIFIER LONG_VALUE  */
-#line 1671 "parser.y"
+  case 208: /* command_statement: SET GLOBAL IDENTIFIER LONG_VALUE  */
+#line 1703 "parser.y"
                                    {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kInteger, (yyvsp[-1].str_value), (yyvsp[0].long_value));
     free((yyvsp[-1].str_value));
 }
-#line 4989 "parser.cpp"
+#line 5034 "parser.cpp"
     break;
 
-  case 207: /* command_statement: SET GLOBAL IDENTIFIER DOUBLE_VALUE  */
-#line 1677 "parser.y"
+  case 209: /* command_statement: SET GLOBAL IDENTIFIER DOUBLE_VALUE  */
+#line 1709 "parser.y"
                                      {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kDouble, (yyvsp[-1].str_value), (yyvsp[0].double_value));
     free((yyvsp[-1].str_value));
 }
-#line 5000 "parser.cpp"
+#line 5045 "parser.cpp"
     break;
 
-  case 208: /* expr_array: expr_alias  */
-#line 1688 "parser.y"
+  case 210: /* expr_array: expr_alias  */
+#line 1720 "parser.y"
                         {
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 5009 "parser.cpp"
+#line 5054 "parser.cpp"
     break;
 
-  case 209: /* expr_array: expr_array ',' expr_alias  */
-#line 1692 "parser.y"
+  case 211: /* expr_array: expr_array ',' expr_alias  */
+#line 1724 "parser.y"
                             {
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 5018 "parser.cpp"
+#line 5063 "parser.cpp"
     break;
 
-  case 210: /* expr_array_list: '(' expr_array ')'  */
-#line 1697 "parser.y"
+  case 212: /* expr_array_list: '(' expr_array ')'  */
+#line 1729 "parser.y"
                                      {
     (yyval.expr_array_list_t) = new std::vector<std::vector<infinity::ParsedExpr*>*>();
     (yyval.expr_array_list_t)->push_back((yyvsp[-1].expr_array_t));
 }
-#line 5027 "parser.cpp"
+#line 5072 "parser.cpp"
     break;
 
-  case 211: /* expr_array_list: expr_array_list ',' '(' expr_array ')'  */
-#line 1701 "parser.y"
+  case 213: /* expr_array_list: expr_array_list ',' '(' expr_array ')'  */
+#line 1733 "parser.y"
                                          {
     if(!(yyvsp[-4].expr_array_list_t)->empty() && (yyvsp[-4].expr_array_list_t)->back()->size() != (yyvsp[-1].expr_array_t)->size()) {
         yyerror(&yyloc, scanner, result, "The expr_array in list shall have the same size.");
@@ -5043,57 +5088,57 @@ yyreduce:
     (yyvsp[-4].expr_array_list_t)->push_back((yyvsp[-1].expr_array_t));
     (yyval.expr_array_list_t) = (yyvsp[-4].expr_array_list_t);
 }
-#line 5047 "parser.cpp"
+#line 5092 "parser.cpp"
     break;
 
-  case 212: /* expr_alias: expr AS IDENTIFIER  */
-#line 1728 "parser.y"
+  case 214: /* expr_alias: expr AS IDENTIFIER  */
+#line 1760 "parser.y"
                                 {
     (yyval.expr_t) = (yyvsp[-2].expr_t);
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.expr_t)->alias_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 5058 "parser.cpp"
+#line 5103 "parser.cpp"
     break;
 
-  case 213: /* expr_alias: expr  */
-#line 1734 "parser.y"
+  case 215: /* expr_alias: expr  */
+#line 1766 "parser.y"
        {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 5066 "parser.cpp"
+#line 5111 "parser.cpp"
     break;
 
-  case 219: /* operand: '(' expr ')'  */
-#line 1744 "parser.y"
+  case 221: /* operand: '(' expr ')'  */
+#line 1776 "parser.y"
                       {
    (yyval.expr_t) = (yyvsp[-1].expr_t);
 }
-#line 5074 "parser.cpp"
+#line 5119 "parser.cpp"
     break;
 
-  case 220: /* operand: '(' select_without_paren ')'  */
-#line 1747 "parser.y"
+  case 222: /* operand: '(' select_without_paren ')'  */
+#line 1779 "parser.y"
                                {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kScalar;
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 5085 "parser.cpp"
+#line 5130 "parser.cpp"
     break;
 
-  case 221: /* operand: constant_expr  */
-#line 1753 "parser.y"
+  case 223: /* operand: constant_expr  */
+#line 1785 "parser.y"
                 {
     (yyval.expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 5093 "parser.cpp"
+#line 5138 "parser.cpp"
     break;
 
-  case 230: /* knn_expr: KNN '(' expr ',' array_expr ',' STRING ',' STRING ',' LONG_VALUE ')' with_index_param_list  */
-#line 1765 "parser.y"
+  case 232: /* knn_expr: KNN '(' expr ',' array_expr ',' STRING ',' STRING ',' LONG_VALUE ')' with_index_param_list  */
+#line 1797 "parser.y"
                                                                                                       {
     infinity::KnnExpr* knn_expr = new infinity::KnnExpr();
     (yyval.expr_t) = knn_expr;
@@ -5199,12 +5244,11 @@ yyreduce:
             for(long i = 0; i < embedding_size; ++ i) {
                 char embedding_unit = 0;
                 for(long bit_idx = 0; bit_idx < 8; ++ bit_idx) {
+                    // the first element is the most significant bit of a byte
                     if((yyvsp[-8].const_expr_t)->long_array_[i * 8 + bit_idx] == 1) {
-                        char temp = embedding_unit << 1;
-                        temp &= 1;
-                        embedding_unit = temp;
+                        embedding_unit = (embedding_unit << 1) | 1;
                     } else if((yyvsp[-8].const_expr_t)->long_array_[i * 8 + bit_idx] == 0) {
-                        embedding_unit <<= 0;
+                        embedding_unit <<= 1;
                     } else {
                         for (auto* param_ptr: *(yyvsp[0].with_index_param_list_t)) {
                             delete param_ptr;
@@ -5260,11 +5304,11 @@ yyreduce:
     knn_expr->topn_ = (yyvsp[-2].long_value);
     knn_expr->opt_params_ = (yyvsp[0].with_index_param_list_t);
 }
-#line 5264 "parser.cpp"
+#line 5308 "parser.cpp"
     break;
 
-  case 231: /* match_expr: MATCH '(' STRING ',' STRING ')'  */
-#line 1932 "parser.y"
+  case 233: /* match_expr: MATCH '(' STRING ',' STRING ')'  */
+#line 1963 "parser.y"
                                              {
     infinity::MatchExpr* match_expr = new infinity::MatchExpr();
     match_expr->fields_ = std::string((yyvsp[-3].str_value));
@@ -5273,11 +5317,11 @@ yyreduce:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_expr;
 }
-#line 5277 "parser.cpp"
+#line 5321 "parser.cpp"
     break;
 
-  case 232: /* match_expr: MATCH '(' STRING ',' STRING ',' STRING ')'  */
-#line 1940 "parser.y"
+  case 234: /* match_expr: MATCH '(' STRING ',' STRING ',' STRING ')'  */
+#line 1971 "parser.y"
                                              {
     infinity::MatchExpr* match_expr = new infinity::MatchExpr();
     match_expr->fields_ = std::string((yyvsp[-5].str_value));
@@ -5288,22 +5332,22 @@ yyreduce:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_expr;
 }
-#line 5292 "parser.cpp"
+#line 5336 "parser.cpp"
     break;
 
-  case 233: /* query_expr: QUERY '(' STRING ')'  */
-#line 1951 "parser.y"
+  case 235: /* query_expr: QUERY '(' STRING ')'  */
+#line 1982 "parser.y"
                                   {
     infinity::MatchExpr* match_expr = new infinity::MatchExpr();
     match_expr->matching_text_ = std::string((yyvsp[-1].str_value));
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_expr;
 }
-#line 5303 "parser.cpp"
+#line 5347 "parser.cpp"
     break;
 
-  case 234: /* query_expr: QUERY '(' STRING ',' STRING ')'  */
-#line 1957 "parser.y"
+  case 236: /* query_expr: QUERY '(' STRING ',' STRING ')'  */
+#line 1988 "parser.y"
                                   {
     infinity::MatchExpr* match_expr = new infinity::MatchExpr();
     match_expr->matching_text_ = std::string((yyvsp[-3].str_value));
@@ -5312,22 +5356,22 @@ yyreduce:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_expr;
 }
-#line 5316 "parser.cpp"
+#line 5360 "parser.cpp"
     break;
 
-  case 235: /* fusion_expr: FUSION '(' STRING ')'  */
-#line 1966 "parser.y"
+  case 237: /* fusion_expr: FUSION '(' STRING ')'  */
+#line 1997 "parser.y"
                                     {
     infinity::FusionExpr* fusion_expr = new infinity::FusionExpr();
     fusion_expr->method_ = std::string((yyvsp[-1].str_value));
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = fusion_expr;
 }
-#line 5327 "parser.cpp"
+#line 5371 "parser.cpp"
     break;
 
-  case 236: /* fusion_expr: FUSION '(' STRING ',' STRING ')'  */
-#line 1972 "parser.y"
+  case 238: /* fusion_expr: FUSION '(' STRING ',' STRING ')'  */
+#line 2003 "parser.y"
                                    {
     infinity::FusionExpr* fusion_expr = new infinity::FusionExpr();
     fusion_expr->method_ = std::string((yyvsp[-3].str_value));
@@ -5336,83 +5380,83 @@ yyreduce:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = fusion_expr;
 }
-#line 5340 "parser.cpp"
+#line 5384 "parser.cpp"
     break;
 
-  case 237: /* sub_search_array: knn_expr  */
-#line 1982 "parser.y"
+  case 239: /* sub_search_array: knn_expr  */
+#line 2013 "parser.y"
                             {
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 5349 "parser.cpp"
+#line 5393 "parser.cpp"
     break;
 
-  case 238: /* sub_search_array: match_expr  */
-#line 1986 "parser.y"
+  case 240: /* sub_search_array: match_expr  */
+#line 2017 "parser.y"
              {
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 5358 "parser.cpp"
+#line 5402 "parser.cpp"
     break;
 
-  case 239: /* sub_search_array: query_expr  */
-#line 1990 "parser.y"
+  case 241: /* sub_search_array: query_expr  */
+#line 2021 "parser.y"
              {
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 5367 "parser.cpp"
+#line 5411 "parser.cpp"
     break;
 
-  case 240: /* sub_search_array: fusion_expr  */
-#line 1994 "parser.y"
+  case 242: /* sub_search_array: fusion_expr  */
+#line 2025 "parser.y"
               {
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 5376 "parser.cpp"
+#line 5420 "parser.cpp"
     break;
 
-  case 241: /* sub_search_array: sub_search_array ',' knn_expr  */
-#line 1998 "parser.y"
+  case 243: /* sub_search_array: sub_search_array ',' knn_expr  */
+#line 2029 "parser.y"
                                 {
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 5385 "parser.cpp"
+#line 5429 "parser.cpp"
     break;
 
-  case 242: /* sub_search_array: sub_search_array ',' match_expr  */
-#line 2002 "parser.y"
+  case 244: /* sub_search_array: sub_search_array ',' match_expr  */
+#line 2033 "parser.y"
                                   {
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 5394 "parser.cpp"
+#line 5438 "parser.cpp"
     break;
 
-  case 243: /* sub_search_array: sub_search_array ',' query_expr  */
-#line 2006 "parser.y"
+  case 245: /* sub_search_array: sub_search_array ',' query_expr  */
+#line 2037 "parser.y"
                                   {
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 5403 "parser.cpp"
+#line 5447 "parser.cpp"
     break;
 
-  case 244: /* sub_search_array: sub_search_array ',' fusion_expr  */
-#line 2010 "parser.y"
+  case 246: /* sub_search_array: sub_search_array ',' fusion_expr  */
+#line 2041 "parser.y"
                                    {
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 5412 "parser.cpp"
+#line 5456 "parser.cpp"
     break;
 
-  case 245: /* function_expr: IDENTIFIER '(' ')'  */
-#line 2015 "parser.y"
+  case 247: /* function_expr: IDENTIFIER '(' ')'  */
+#line 2046 "parser.y"
                                    {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-2].str_value));
@@ -5421,11 +5465,11 @@ yyreduce:
     func_expr->arguments_ = nullptr;
     (yyval.expr_t) = func_expr;
 }
-#line 5425 "parser.cpp"
+#line 5469 "parser.cpp"
     break;
 
-  case 246: /* function_expr: IDENTIFIER '(' expr_array ')'  */
-#line 2023 "parser.y"
+  case 248: /* function_expr: IDENTIFIER '(' expr_array ')'  */
+#line 2054 "parser.y"
                                 {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-3].str_value));
@@ -5434,11 +5478,11 @@ yyreduce:
     func_expr->arguments_ = (yyvsp[-1].expr_array_t);
     (yyval.expr_t) = func_expr;
 }
-#line 5438 "parser.cpp"
+#line 5482 "parser.cpp"
     break;
 
-  case 247: /* function_expr: IDENTIFIER '(' DISTINCT expr_array ')'  */
-#line 2031 "parser.y"
+  case 249: /* function_expr: IDENTIFIER '(' DISTINCT expr_array ')'  */
+#line 2062 "parser.y"
                                          {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-4].str_value));
@@ -5448,11 +5492,11 @@ yyreduce:
     func_expr->distinct_ = true;
     (yyval.expr_t) = func_expr;
 }
-#line 5452 "parser.cpp"
+#line 5496 "parser.cpp"
     break;
 
-  case 248: /* function_expr: operand IS NOT NULLABLE  */
-#line 2040 "parser.y"
+  case 250: /* function_expr: operand IS NOT NULLABLE  */
+#line 2071 "parser.y"
                           {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "is_not_null";
@@ -5460,11 +5504,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[-3].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5464 "parser.cpp"
+#line 5508 "parser.cpp"
     break;
 
-  case 249: /* function_expr: operand IS NULLABLE  */
-#line 2047 "parser.y"
+  case 251: /* function_expr: operand IS NULLABLE  */
+#line 2078 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "is_null";
@@ -5472,11 +5516,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[-2].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5476 "parser.cpp"
+#line 5520 "parser.cpp"
     break;
 
-  case 250: /* function_expr: NOT operand  */
-#line 2054 "parser.y"
+  case 252: /* function_expr: NOT operand  */
+#line 2085 "parser.y"
               {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "not";
@@ -5484,11 +5528,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5488 "parser.cpp"
+#line 5532 "parser.cpp"
     break;
 
-  case 251: /* function_expr: '-' operand  */
-#line 2061 "parser.y"
+  case 253: /* function_expr: '-' operand  */
+#line 2092 "parser.y"
               {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "-";
@@ -5496,11 +5540,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5500 "parser.cpp"
+#line 5544 "parser.cpp"
     break;
 
-  case 252: /* function_expr: '+' operand  */
-#line 2068 "parser.y"
+  case 254: /* function_expr: '+' operand  */
+#line 2099 "parser.y"
               {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "+";
@@ -5508,11 +5552,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5512 "parser.cpp"
+#line 5556 "parser.cpp"
     break;
 
-  case 253: /* function_expr: operand '-' operand  */
-#line 2075 "parser.y"
+  case 255: /* function_expr: operand '-' operand  */
+#line 2106 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "-";
@@ -5521,11 +5565,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5525 "parser.cpp"
+#line 5569 "parser.cpp"
     break;
 
-  case 254: /* function_expr: operand '+' operand  */
-#line 2083 "parser.y"
+  case 256: /* function_expr: operand '+' operand  */
+#line 2114 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "+";
@@ -5534,11 +5578,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5538 "parser.cpp"
+#line 5582 "parser.cpp"
     break;
 
-  case 255: /* function_expr: operand '*' operand  */
-#line 2091 "parser.y"
+  case 257: /* function_expr: operand '*' operand  */
+#line 2122 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "*";
@@ -5547,11 +5591,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5551 "parser.cpp"
+#line 5595 "parser.cpp"
     break;
 
-  case 256: /* function_expr: operand '/' operand  */
-#line 2099 "parser.y"
+  case 258: /* function_expr: operand '/' operand  */
+#line 2130 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "/";
@@ -5560,11 +5604,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5564 "parser.cpp"
+#line 5608 "parser.cpp"
     break;
 
-  case 257: /* function_expr: operand '%' operand  */
-#line 2107 "parser.y"
+  case 259: /* function_expr: operand '%' operand  */
+#line 2138 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "%";
@@ -5573,11 +5617,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5577 "parser.cpp"
+#line 5621 "parser.cpp"
     break;
 
-  case 258: /* function_expr: operand '=' operand  */
-#line 2115 "parser.y"
+  case 260: /* function_expr: operand '=' operand  */
+#line 2146 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "=";
@@ -5586,11 +5630,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5590 "parser.cpp"
+#line 5634 "parser.cpp"
     break;
 
-  case 259: /* function_expr: operand EQUAL operand  */
-#line 2123 "parser.y"
+  case 261: /* function_expr: operand EQUAL operand  */
+#line 2154 "parser.y"
                         {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "=";
@@ -5599,11 +5643,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5603 "parser.cpp"
+#line 5647 "parser.cpp"
     break;
 
-  case 260: /* function_expr: operand NOT_EQ operand  */
-#line 2131 "parser.y"
+  case 262: /* function_expr: operand NOT_EQ operand  */
+#line 2162 "parser.y"
                          {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "<>";
@@ -5612,11 +5656,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5616 "parser.cpp"
+#line 5660 "parser.cpp"
     break;
 
-  case 261: /* function_expr: operand '<' operand  */
-#line 2139 "parser.y"
+  case 263: /* function_expr: operand '<' operand  */
+#line 2170 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "<";
@@ -5625,11 +5669,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5629 "parser.cpp"
+#line 5673 "parser.cpp"
     break;
 
-  case 262: /* function_expr: operand '>' operand  */
-#line 2147 "parser.y"
+  case 264: /* function_expr: operand '>' operand  */
+#line 2178 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = ">";
@@ -5638,11 +5682,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5642 "parser.cpp"
+#line 5686 "parser.cpp"
     break;
 
-  case 263: /* function_expr: operand LESS_EQ operand  */
-#line 2155 "parser.y"
+  case 265: /* function_expr: operand LESS_EQ operand  */
+#line 2186 "parser.y"
                           {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "<=";
@@ -5651,11 +5695,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5655 "parser.cpp"
+#line 5699 "parser.cpp"
     break;
 
-  case 264: /* function_expr: operand GREATER_EQ operand  */
-#line 2163 "parser.y"
+  case 266: /* function_expr: operand GREATER_EQ operand  */
+#line 2194 "parser.y"
                              {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = ">=";
@@ -5664,11 +5708,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5668 "parser.cpp"
+#line 5712 "parser.cpp"
     break;
 
-  case 265: /* function_expr: EXTRACT '(' STRING FROM operand ')'  */
-#line 2171 "parser.y"
+  case 267: /* function_expr: EXTRACT '(' STRING FROM operand ')'  */
+#line 2202 "parser.y"
                                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-3].str_value));
@@ -5699,11 +5743,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[-1].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5703 "parser.cpp"
+#line 5747 "parser.cpp"
     break;
 
-  case 266: /* function_expr: operand LIKE operand  */
-#line 2201 "parser.y"
+  case 268: /* function_expr: operand LIKE operand  */
+#line 2232 "parser.y"
                        {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "like";
@@ -5712,11 +5756,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5716 "parser.cpp"
+#line 5760 "parser.cpp"
     break;
 
-  case 267: /* function_expr: operand NOT LIKE operand  */
-#line 2209 "parser.y"
+  case 269: /* function_expr: operand NOT LIKE operand  */
+#line 2240 "parser.y"
                            {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "not_like";
@@ -5725,11 +5769,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5729 "parser.cpp"
+#line 5773 "parser.cpp"
     break;
 
-  case 268: /* conjunction_expr: expr AND expr  */
-#line 2218 "parser.y"
+  case 270: /* conjunction_expr: expr AND expr  */
+#line 2249 "parser.y"
                                 {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "and";
@@ -5738,11 +5782,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5742 "parser.cpp"
+#line 5786 "parser.cpp"
     break;
 
-  case 269: /* conjunction_expr: expr OR expr  */
-#line 2226 "parser.y"
+  case 271: /* conjunction_expr: expr OR expr  */
+#line 2257 "parser.y"
                {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "or";
@@ -5751,11 +5795,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5755 "parser.cpp"
+#line 5799 "parser.cpp"
     break;
 
-  case 270: /* between_expr: operand BETWEEN operand AND operand  */
-#line 2235 "parser.y"
+  case 272: /* between_expr: operand BETWEEN operand AND operand  */
+#line 2266 "parser.y"
                                                   {
     infinity::BetweenExpr* between_expr = new infinity::BetweenExpr();
     between_expr->value_ = (yyvsp[-4].expr_t);
@@ -5763,44 +5807,44 @@ yyreduce:
     between_expr->upper_bound_ = (yyvsp[0].expr_t);
     (yyval.expr_t) = between_expr;
 }
-#line 5767 "parser.cpp"
+#line 5811 "parser.cpp"
     break;
 
-  case 271: /* in_expr: operand IN '(' expr_array ')'  */
-#line 2243 "parser.y"
+  case 273: /* in_expr: operand IN '(' expr_array ')'  */
+#line 2274 "parser.y"
                                        {
     infinity::InExpr* in_expr = new infinity::InExpr(true);
     in_expr->left_ = (yyvsp[-4].expr_t);
     in_expr->arguments_ = (yyvsp[-1].expr_array_t);
     (yyval.expr_t) = in_expr;
 }
-#line 5778 "parser.cpp"
+#line 5822 "parser.cpp"
     break;
 
-  case 272: /* in_expr: operand NOT IN '(' expr_array ')'  */
-#line 2249 "parser.y"
+  case 274: /* in_expr: operand NOT IN '(' expr_array ')'  */
+#line 2280 "parser.y"
                                     {
     infinity::InExpr* in_expr = new infinity::InExpr(false);
     in_expr->left_ = (yyvsp[-5].expr_t);
     in_expr->arguments_ = (yyvsp[-1].expr_array_t);
     (yyval.expr_t) = in_expr;
 }
-#line 5789 "parser.cpp"
+#line 5833 "parser.cpp"
     break;
 
-  case 273: /* case_expr: CASE expr case_check_array END  */
-#line 2256 "parser.y"
+  case 275: /* case_expr: CASE expr case_check_array END  */
+#line 2287 "parser.y"
                                           {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->expr_ = (yyvsp[-2].expr_t);
     case_expr->case_check_array_ = (yyvsp[-1].case_check_array_t);
     (yyval.expr_t) = case_expr;
 }
-#line 5800 "parser.cpp"
+#line 5844 "parser.cpp"
     break;
 
-  case 274: /* case_expr: CASE expr case_check_array ELSE expr END  */
-#line 2262 "parser.y"
+  case 276: /* case_expr: CASE expr case_check_array ELSE expr END  */
+#line 2293 "parser.y"
                                            {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->expr_ = (yyvsp[-4].expr_t);
@@ -5808,32 +5852,32 @@ yyreduce:
     case_expr->else_expr_ = (yyvsp[-1].expr_t);
     (yyval.expr_t) = case_expr;
 }
-#line 5812 "parser.cpp"
+#line 5856 "parser.cpp"
     break;
 
-  case 275: /* case_expr: CASE case_check_array END  */
-#line 2269 "parser.y"
+  case 277: /* case_expr: CASE case_check_array END  */
+#line 2300 "parser.y"
                             {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->case_check_array_ = (yyvsp[-1].case_check_array_t);
     (yyval.expr_t) = case_expr;
 }
-#line 5822 "parser.cpp"
+#line 5866 "parser.cpp"
     break;
 
-  case 276: /* case_expr: CASE case_check_array ELSE expr END  */
-#line 2274 "parser.y"
+  case 278: /* case_expr: CASE case_check_array ELSE expr END  */
+#line 2305 "parser.y"
                                       {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->case_check_array_ = (yyvsp[-3].case_check_array_t);
     case_expr->else_expr_ = (yyvsp[-1].expr_t);
     (yyval.expr_t) = case_expr;
 }
-#line 5833 "parser.cpp"
+#line 5877 "parser.cpp"
     break;
 
-  case 277: /* case_check_array: WHEN expr THEN expr  */
-#line 2281 "parser.y"
+  case 279: /* case_check_array: WHEN expr THEN expr  */
+#line 2312 "parser.y"
                                       {
     (yyval.case_check_array_t) = new std::vector<infinity::WhenThen*>();
     infinity::WhenThen* when_then_ptr = new infinity::WhenThen();
@@ -5841,11 +5885,11 @@ yyreduce:
     when_then_ptr->then_ = (yyvsp[0].expr_t);
     (yyval.case_check_array_t)->emplace_back(when_then_ptr);
 }
-#line 5845 "parser.cpp"
+#line 5889 "parser.cpp"
     break;
 
-  case 278: /* case_check_array: case_check_array WHEN expr THEN expr  */
-#line 2288 "parser.y"
+  case 280: /* case_check_array: case_check_array WHEN expr THEN expr  */
+#line 2319 "parser.y"
                                        {
     infinity::WhenThen* when_then_ptr = new infinity::WhenThen();
     when_then_ptr->when_ = (yyvsp[-2].expr_t);
@@ -5853,11 +5897,11 @@ yyreduce:
     (yyvsp[-4].case_check_array_t)->emplace_back(when_then_ptr);
     (yyval.case_check_array_t) = (yyvsp[-4].case_check_array_t);
 }
-#line 5857 "parser.cpp"
+#line 5901 "parser.cpp"
     break;
 
-  case 279: /* cast_expr: CAST '(' expr AS column_type ')'  */
-#line 2296 "parser.y"
+  case 281: /* cast_expr: CAST '(' expr AS column_type ')'  */
+#line 2327 "parser.y"
                                             {
     std::shared_ptr<infinity::TypeInfo> type_info_ptr{nullptr};
     switch((yyvsp[-1].column_type_t).logical_type_) {
@@ -5881,33 +5925,33 @@ yyreduce:
     cast_expr->expr_ = (yyvsp[-3].expr_t);
     (yyval.expr_t) = cast_expr;
 }
-#line 5885 "parser.cpp"
+#line 5929 "parser.cpp"
     break;
 
-  case 280: /* subquery_expr: EXISTS '(' select_without_paren ')'  */
-#line 2320 "parser.y"
+  case 282: /* subquery_expr: EXISTS '(' select_without_paren ')'  */
+#line 2351 "parser.y"
                                                    {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kExists;
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 5896 "parser.cpp"
+#line 5940 "parser.cpp"
     break;
 
-  case 281: /* subquery_expr: NOT EXISTS '(' select_without_paren ')'  */
-#line 2326 "parser.y"
+  case 283: /* subquery_expr: NOT EXISTS '(' select_without_paren ')'  */
+#line 2357 "parser.y"
                                           {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kNotExists;
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 5907 "parser.cpp"
+#line 5951 "parser.cpp"
     break;
 
-  case 282: /* subquery_expr: operand IN '(' select_without_paren ')'  */
-#line 2332 "parser.y"
+  case 284: /* subquery_expr: operand IN '(' select_without_paren ')'  */
+#line 2363 "parser.y"
                                           {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kIn;
@@ -5915,11 +5959,11 @@ yyreduce:
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 5919 "parser.cpp"
+#line 5963 "parser.cpp"
     break;
 
-  case 283: /* subquery_expr: operand NOT IN '(' select_without_paren ')'  */
-#line 2339 "parser.y"
+  case 285: /* subquery_expr: operand NOT IN '(' select_without_paren ')'  */
+#line 2370 "parser.y"
                                               {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kNotIn;
@@ -5927,11 +5971,11 @@ yyreduce:
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 5931 "parser.cpp"
+#line 5975 "parser.cpp"
     break;
 
-  case 284: /* column_expr: IDENTIFIER  */
-#line 2347 "parser.y"
+  case 286: /* column_expr: IDENTIFIER  */
+#line 2378 "parser.y"
                          {
     infinity::ColumnExpr* column_expr = new infinity::ColumnExpr();
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -5939,11 +5983,11 @@ yyreduce:
     free((yyvsp[0].str_value));
     (yyval.expr_t) = column_expr;
 }
-#line 5943 "parser.cpp"
+#line 5987 "parser.cpp"
     break;
 
-  case 285: /* column_expr: column_expr '.' IDENTIFIER  */
-#line 2354 "parser.y"
+  case 287: /* column_expr: column_expr '.' IDENTIFIER  */
+#line 2385 "parser.y"
                              {
     infinity::ColumnExpr* column_expr = (infinity::ColumnExpr*)(yyvsp[-2].expr_t);
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -5951,21 +5995,21 @@ yyreduce:
     free((yyvsp[0].str_value));
     (yyval.expr_t) = column_expr;
 }
-#line 5955 "parser.cpp"
+#line 5999 "parser.cpp"
     break;
 
-  case 286: /* column_expr: '*'  */
-#line 2361 "parser.y"
+  case 288: /* column_expr: '*'  */
+#line 2392 "parser.y"
       {
     infinity::ColumnExpr* column_expr = new infinity::ColumnExpr();
     column_expr->star_ = true;
     (yyval.expr_t) = column_expr;
 }
-#line 5965 "parser.cpp"
+#line 6009 "parser.cpp"
     break;
 
-  case 287: /* column_expr: column_expr '.' '*'  */
-#line 2366 "parser.y"
+  case 289: /* column_expr: column_expr '.' '*'  */
+#line 2397 "parser.y"
                       {
     infinity::ColumnExpr* column_expr = (infinity::ColumnExpr*)(yyvsp[-2].expr_t);
     if(column_expr->star_) {
@@ -5975,323 +6019,323 @@ yyreduce:
     column_expr->star_ = true;
     (yyval.expr_t) = column_expr;
 }
-#line 5979 "parser.cpp"
+#line 6023 "parser.cpp"
     break;
 
-  case 288: /* constant_expr: STRING  */
-#line 2376 "parser.y"
+  case 290: /* constant_expr: STRING  */
+#line 2407 "parser.y"
                       {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kString);
     const_expr->str_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 5989 "parser.cpp"
+#line 6033 "parser.cpp"
     break;
 
-  case 289: /* constant_expr: TRUE  */
-#line 2381 "parser.y"
+  case 291: /* constant_expr: TRUE  */
+#line 2412 "parser.y"
        {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kBoolean);
     const_expr->bool_value_ = true;
     (yyval.const_expr_t) = const_expr;
 }
-#line 5999 "parser.cpp"
+#line 6043 "parser.cpp"
     break;
 
-  case 290: /* constant_expr: FALSE  */
-#line 2386 "parser.y"
+  case 292: /* constant_expr: FALSE  */
+#line 2417 "parser.y"
         {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kBoolean);
     const_expr->bool_value_ = false;
     (yyval.const_expr_t) = const_expr;
 }
-#line 6009 "parser.cpp"
+#line 6053 "parser.cpp"
     break;
 
-  case 291: /* constant_expr: DOUBLE_VALUE  */
-#line 2391 "parser.y"
+  case 293: /* constant_expr: DOUBLE_VALUE  */
+#line 2422 "parser.y"
                {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDouble);
     const_expr->double_value_ = (yyvsp[0].double_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6019 "parser.cpp"
+#line 6063 "parser.cpp"
     break;
 
-  case 292: /* constant_expr: LONG_VALUE  */
-#line 2396 "parser.y"
+  case 294: /* constant_expr: LONG_VALUE  */
+#line 2427 "parser.y"
              {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInteger);
     const_expr->integer_value_ = (yyvsp[0].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6029 "parser.cpp"
+#line 6073 "parser.cpp"
     break;
 
-  case 293: /* constant_expr: DATE STRING  */
-#line 2401 "parser.y"
+  case 295: /* constant_expr: DATE STRING  */
+#line 2432 "parser.y"
               {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDate);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6039 "parser.cpp"
+#line 6083 "parser.cpp"
     break;
 
-  case 294: /* constant_expr: INTERVAL interval_expr  */
-#line 2406 "parser.y"
+  case 296: /* constant_expr: INTERVAL interval_expr  */
+#line 2437 "parser.y"
                          {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6047 "parser.cpp"
+#line 6091 "parser.cpp"
     break;
 
-  case 295: /* constant_expr: interval_expr  */
-#line 2409 "parser.y"
+  case 297: /* constant_expr: interval_expr  */
+#line 2440 "parser.y"
                 {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6055 "parser.cpp"
+#line 6099 "parser.cpp"
     break;
 
-  case 296: /* constant_expr: long_array_expr  */
-#line 2412 "parser.y"
+  case 298: /* constant_expr: long_array_expr  */
+#line 2443 "parser.y"
                   {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6063 "parser.cpp"
+#line 6107 "parser.cpp"
     break;
 
-  case 297: /* constant_expr: double_array_expr  */
-#line 2415 "parser.y"
+  case 299: /* constant_expr: double_array_expr  */
+#line 2446 "parser.y"
                     {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6071 "parser.cpp"
+#line 6115 "parser.cpp"
     break;
 
-  case 298: /* array_expr: long_array_expr  */
-#line 2419 "parser.y"
+  case 300: /* array_expr: long_array_expr  */
+#line 2450 "parser.y"
                             {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6079 "parser.cpp"
+#line 6123 "parser.cpp"
     break;
 
-  case 299: /* array_expr: double_array_expr  */
-#line 2422 "parser.y"
+  case 301: /* array_expr: double_array_expr  */
+#line 2453 "parser.y"
                     {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6087 "parser.cpp"
+#line 6131 "parser.cpp"
     break;
 
-  case 300: /* long_array_expr: unclosed_long_array_expr ']'  */
-#line 2426 "parser.y"
+  case 302: /* long_array_expr: unclosed_long_array_expr ']'  */
+#line 2457 "parser.y"
                                               {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 6095 "parser.cpp"
+#line 6139 "parser.cpp"
     break;
 
-  case 301: /* unclosed_long_array_expr: '[' LONG_VALUE  */
-#line 2430 "parser.y"
+  case 303: /* unclosed_long_array_expr: '[' LONG_VALUE  */
+#line 2461 "parser.y"
                                          {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kIntegerArray);
     const_expr->long_array_.emplace_back((yyvsp[0].long_value));
     (yyval.const_expr_t) = const_expr;
 }
-#line 6105 "parser.cpp"
+#line 6149 "parser.cpp"
     break;
 
-  case 302: /* unclosed_long_array_expr: unclosed_long_array_expr ',' LONG_VALUE  */
-#line 2435 "parser.y"
+  case 304: /* unclosed_long_array_expr: unclosed_long_array_expr ',' LONG_VALUE  */
+#line 2466 "parser.y"
                                           {
     (yyvsp[-2].const_expr_t)->long_array_.emplace_back((yyvsp[0].long_value));
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 6114 "parser.cpp"
+#line 6158 "parser.cpp"
     break;
 
-  case 303: /* double_array_expr: unclosed_double_array_expr ']'  */
-#line 2440 "parser.y"
+  case 305: /* double_array_expr: unclosed_double_array_expr ']'  */
+#line 2471 "parser.y"
                                                   {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 6122 "parser.cpp"
+#line 6166 "parser.cpp"
     break;
 
-  case 304: /* unclosed_double_array_expr: '[' DOUBLE_VALUE  */
-#line 2444 "parser.y"
+  case 306: /* unclosed_double_array_expr: '[' DOUBLE_VALUE  */
+#line 2475 "parser.y"
                                              {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDoubleArray);
     const_expr->double_array_.emplace_back((yyvsp[0].double_value));
     (yyval.const_expr_t) = const_expr;
 }
-#line 6132 "parser.cpp"
+#line 6176 "parser.cpp"
     break;
 
-  case 305: /* unclosed_double_array_expr: unclosed_double_array_expr ',' DOUBLE_VALUE  */
-#line 2449 "parser.y"
+  case 307: /* unclosed_double_array_expr: unclosed_double_array_expr ',' DOUBLE_VALUE  */
+#line 2480 "parser.y"
                                               {
     (yyvsp[-2].const_expr_t)->double_array_.emplace_back((yyvsp[0].double_value));
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 6141 "parser.cpp"
+#line 6185 "parser.cpp"
     break;
 
-  case 306: /* interval_expr: LONG_VALUE SECONDS  */
-#line 2454 "parser.y"
+  case 308: /* interval_expr: LONG_VALUE SECONDS  */
+#line 2485 "parser.y"
                                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kSecond;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6152 "parser.cpp"
+#line 6196 "parser.cpp"
     break;
 
-  case 307: /* interval_expr: LONG_VALUE SECOND  */
-#line 2460 "parser.y"
+  case 309: /* interval_expr: LONG_VALUE SECOND  */
+#line 2491 "parser.y"
                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kSecond;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6163 "parser.cpp"
+#line 6207 "parser.cpp"
     break;
 
-  case 308: /* interval_expr: LONG_VALUE MINUTES  */
-#line 2466 "parser.y"
+  case 310: /* interval_expr: LONG_VALUE MINUTES  */
+#line 2497 "parser.y"
                      {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMinute;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6174 "parser.cpp"
+#line 6218 "parser.cpp"
     break;
 
-  case 309: /* interval_expr: LONG_VALUE MINUTE  */
-#line 2472 "parser.y"
+  case 311: /* interval_expr: LONG_VALUE MINUTE  */
+#line 2503 "parser.y"
                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMinute;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6185 "parser.cpp"
+#line 6229 "parser.cpp"
     break;
 
-  case 310: /* interval_expr: LONG_VALUE HOURS  */
-#line 2478 "parser.y"
+  case 312: /* interval_expr: LONG_VALUE HOURS  */
+#line 2509 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kHour;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6196 "parser.cpp"
+#line 6240 "parser.cpp"
     break;
 
-  case 311: /* interval_expr: LONG_VALUE HOUR  */
-#line 2484 "parser.y"
+  case 313: /* interval_expr: LONG_VALUE HOUR  */
+#line 2515 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kHour;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6207 "parser.cpp"
+#line 6251 "parser.cpp"
     break;
 
-  case 312: /* interval_expr: LONG_VALUE DAYS  */
-#line 2490 "parser.y"
+  case 314: /* interval_expr: LONG_VALUE DAYS  */
+#line 2521 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kDay;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6218 "parser.cpp"
+#line 6262 "parser.cpp"
     break;
 
-  case 313: /* interval_expr: LONG_VALUE DAY  */
-#line 2496 "parser.y"
+  case 315: /* interval_expr: LONG_VALUE DAY  */
+#line 2527 "parser.y"
                  {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kDay;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6229 "parser.cpp"
+#line 6273 "parser.cpp"
     break;
 
-  case 314: /* interval_expr: LONG_VALUE MONTHS  */
-#line 2502 "parser.y"
+  case 316: /* interval_expr: LONG_VALUE MONTHS  */
+#line 2533 "parser.y"
                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMonth;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6240 "parser.cpp"
+#line 6284 "parser.cpp"
     break;
 
-  case 315: /* interval_expr: LONG_VALUE MONTH  */
-#line 2508 "parser.y"
+  case 317: /* interval_expr: LONG_VALUE MONTH  */
+#line 2539 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMonth;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6251 "parser.cpp"
+#line 6295 "parser.cpp"
     break;
 
-  case 316: /* interval_expr: LONG_VALUE YEARS  */
-#line 2514 "parser.y"
+  case 318: /* interval_expr: LONG_VALUE YEARS  */
+#line 2545 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kYear;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6262 "parser.cpp"
+#line 6306 "parser.cpp"
     break;
 
-  case 317: /* interval_expr: LONG_VALUE YEAR  */
-#line 2520 "parser.y"
+  case 319: /* interval_expr: LONG_VALUE YEAR  */
+#line 2551 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kYear;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6273 "parser.cpp"
+#line 6317 "parser.cpp"
     break;
 
-  case 318: /* copy_option_list: copy_option  */
-#line 2531 "parser.y"
+  case 320: /* copy_option_list: copy_option  */
+#line 2562 "parser.y"
                                {
     (yyval.copy_option_array) = new std::vector<infinity::CopyOption*>();
     (yyval.copy_option_array)->push_back((yyvsp[0].copy_option_t));
 }
-#line 6282 "parser.cpp"
+#line 6326 "parser.cpp"
     break;
 
-  case 319: /* copy_option_list: copy_option_list ',' copy_option  */
-#line 2535 "parser.y"
+  case 321: /* copy_option_list: copy_option_list ',' copy_option  */
+#line 2566 "parser.y"
                                    {
     (yyvsp[-2].copy_option_array)->push_back((yyvsp[0].copy_option_t));
     (yyval.copy_option_array) = (yyvsp[-2].copy_option_array);
 }
-#line 6291 "parser.cpp"
+#line 6335 "parser.cpp"
     break;
 
-  case 320: /* copy_option: FORMAT IDENTIFIER  */
-#line 2540 "parser.y"
+  case 322: /* copy_option: FORMAT IDENTIFIER  */
+#line 2571 "parser.y"
                                 {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kFormat;
@@ -6314,11 +6358,11 @@ yyreduce:
         YYERROR;
     }
 }
-#line 6318 "parser.cpp"
+#line 6362 "parser.cpp"
     break;
 
-  case 321: /* copy_option: DELIMITER STRING  */
-#line 2562 "parser.y"
+  case 323: /* copy_option: DELIMITER STRING  */
+#line 2593 "parser.y"
                    {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kDelimiter;
@@ -6329,53 +6373,53 @@ yyreduce:
     }
     free((yyvsp[0].str_value));
 }
-#line 6333 "parser.cpp"
+#line 6377 "parser.cpp"
     break;
 
-  case 322: /* copy_option: HEADER  */
-#line 2572 "parser.y"
+  case 324: /* copy_option: HEADER  */
+#line 2603 "parser.y"
          {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kHeader;
     (yyval.copy_option_t)->header_ = true;
 }
-#line 6343 "parser.cpp"
+#line 6387 "parser.cpp"
     break;
 
-  case 323: /* file_path: STRING  */
-#line 2578 "parser.y"
+  case 325: /* file_path: STRING  */
+#line 2609 "parser.y"
                    {
     (yyval.str_value) = (yyvsp[0].str_value);
 }
-#line 6351 "parser.cpp"
+#line 6395 "parser.cpp"
     break;
 
-  case 324: /* if_exists: IF EXISTS  */
-#line 2582 "parser.y"
+  case 326: /* if_exists: IF EXISTS  */
+#line 2613 "parser.y"
                      { (yyval.bool_value) = true; }
-#line 6357 "parser.cpp"
+#line 6401 "parser.cpp"
     break;
 
-  case 325: /* if_exists: %empty  */
-#line 2583 "parser.y"
+  case 327: /* if_exists: %empty  */
+#line 2614 "parser.y"
   { (yyval.bool_value) = false; }
-#line 6363 "parser.cpp"
+#line 6407 "parser.cpp"
     break;
 
-  case 326: /* if_not_exists: IF NOT EXISTS  */
-#line 2585 "parser.y"
+  case 328: /* if_not_exists: IF NOT EXISTS  */
+#line 2616 "parser.y"
                               { (yyval.bool_value) = true; }
-#line 6369 "parser.cpp"
+#line 6413 "parser.cpp"
     break;
 
-  case 327: /* if_not_exists: %empty  */
-#line 2586 "parser.y"
+  case 329: /* if_not_exists: %empty  */
+#line 2617 "parser.y"
   { (yyval.bool_value) = false; }
-#line 6375 "parser.cpp"
+#line 6419 "parser.cpp"
     break;
 
-  case 330: /* if_not_exists_info: if_not_exists IDENTIFIER  */
-#line 2601 "parser.y"
+  case 332: /* if_not_exists_info: if_not_exists IDENTIFIER  */
+#line 2632 "parser.y"
                                               {
     (yyval.if_not_exists_info_t) = new infinity::IfNotExistsInfo();
     (yyval.if_not_exists_info_t)->exists_ = true;
@@ -6384,63 +6428,63 @@ yyreduce:
     (yyval.if_not_exists_info_t)->info_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 6388 "parser.cpp"
+#line 6432 "parser.cpp"
     break;
 
-  case 331: /* if_not_exists_info: %empty  */
-#line 2609 "parser.y"
+  case 333: /* if_not_exists_info: %empty  */
+#line 2640 "parser.y"
   {
     (yyval.if_not_exists_info_t) = new infinity::IfNotExistsInfo();
 }
-#line 6396 "parser.cpp"
+#line 6440 "parser.cpp"
     break;
 
-  case 332: /* with_index_param_list: WITH '(' index_param_list ')'  */
-#line 2613 "parser.y"
+  case 334: /* with_index_param_list: WITH '(' index_param_list ')'  */
+#line 2644 "parser.y"
                                                       {
     (yyval.with_index_param_list_t) = std::move((yyvsp[-1].index_param_list_t));
 }
-#line 6404 "parser.cpp"
+#line 6448 "parser.cpp"
     break;
 
-  case 333: /* with_index_param_list: %empty  */
-#line 2616 "parser.y"
+  case 335: /* with_index_param_list: %empty  */
+#line 2647 "parser.y"
   {
     (yyval.with_index_param_list_t) = new std::vector<infinity::InitParameter*>();
 }
-#line 6412 "parser.cpp"
+#line 6456 "parser.cpp"
     break;
 
-  case 334: /* index_param_list: index_param  */
-#line 2620 "parser.y"
+  case 336: /* index_param_list: index_param  */
+#line 2651 "parser.y"
                                {
     (yyval.index_param_list_t) = new std::vector<infinity::InitParameter*>();
     (yyval.index_param_list_t)->push_back((yyvsp[0].index_param_t));
 }
-#line 6421 "parser.cpp"
+#line 6465 "parser.cpp"
     break;
 
-  case 335: /* index_param_list: index_param_list ',' index_param  */
-#line 2624 "parser.y"
+  case 337: /* index_param_list: index_param_list ',' index_param  */
+#line 2655 "parser.y"
                                    {
     (yyvsp[-2].index_param_list_t)->push_back((yyvsp[0].index_param_t));
     (yyval.index_param_list_t) = (yyvsp[-2].index_param_list_t);
 }
-#line 6430 "parser.cpp"
+#line 6474 "parser.cpp"
     break;
 
-  case 336: /* index_param: IDENTIFIER  */
-#line 2629 "parser.y"
+  case 338: /* index_param: IDENTIFIER  */
+#line 2660 "parser.y"
                          {
     (yyval.index_param_t) = new infinity::InitParameter();
     (yyval.index_param_t)->param_name_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 6440 "parser.cpp"
+#line 6484 "parser.cpp"
     break;
 
-  case 337: /* index_param: IDENTIFIER '=' IDENTIFIER  */
-#line 2634 "parser.y"
+  case 339: /* index_param: IDENTIFIER '=' IDENTIFIER  */
+#line 2665 "parser.y"
                             {
     (yyval.index_param_t) = new infinity::InitParameter();
     (yyval.index_param_t)->param_name_ = (yyvsp[-2].str_value);
@@ -6449,11 +6493,11 @@ yyreduce:
     (yyval.index_param_t)->param_value_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 6453 "parser.cpp"
+#line 6497 "parser.cpp"
     break;
 
-  case 338: /* index_param: IDENTIFIER '=' LONG_VALUE  */
-#line 2642 "parser.y"
+  case 340: /* index_param: IDENTIFIER '=' LONG_VALUE  */
+#line 2673 "parser.y"
                             {
     (yyval.index_param_t) = new infinity::InitParameter();
     (yyval.index_param_t)->param_name_ = (yyvsp[-2].str_value);
@@ -6461,11 +6505,11 @@ yyreduce:
 
     (yyval.index_param_t)->param_value_ = std::to_string((yyvsp[0].long_value));
 }
-#line 6465 "parser.cpp"
+#line 6509 "parser.cpp"
     break;
 
-  case 339: /* index_param: IDENTIFIER '=' DOUBLE_VALUE  */
-#line 2649 "parser.y"
+  case 341: /* index_param: IDENTIFIER '=' DOUBLE_VALUE  */
+#line 2680 "parser.y"
                               {
     (yyval.index_param_t) = new infinity::InitParameter();
     (yyval.index_param_t)->param_name_ = (yyvsp[-2].str_value);
@@ -6473,11 +6517,11 @@ yyreduce:
 
     (yyval.index_param_t)->param_value_ = std::to_string((yyvsp[0].double_value));
 }
-#line 6477 "parser.cpp"
+#line 6521 "parser.cpp"
     break;
 
-  case 340: /* index_info_list: '(' identifier_array ')' USING IDENTIFIER with_index_param_list  */
-#line 2660 "parser.y"
+  case 342: /* index_info_list: '(' identifier_array ')' USING IDENTIFIER with_index_param_list  */
+#line 2691 "parser.y"
                                                                                   {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     infinity::IndexType index_type = infinity::IndexType::kInvalid;
@@ -6487,6 +6531,12 @@ yyreduce:
         index_type = infinity::IndexType::kHnsw;
     } else if (strcmp((yyvsp[-1].str_value), "ivfflat") == 0) {
         index_type = infinity::IndexType::kIVFFlat;
+    } else if (strcmp((yyvsp[-1].str_value), "ivfpq") == 0) {
+        index_type = infinity::IndexType::kIVFPQ;
+    } else if (strcmp((yyvsp[-1].str_value), "diskann") == 0) {
+        index_type = infinity::IndexType::kDiskAnn;
+    } else if (strcmp((yyvsp[-1].str_value), "ivfsq8") == 0) {
+        index_type = infinity::IndexType::kIVFSQ8;
     } else {
         free((yyvsp[-1].str_value));
         delete (yyvsp[-4].identifier_array_t);
@@ -6526,11 +6576,11 @@ yyreduce:
     }
     delete (yyvsp[-4].identifier_array_t);
 }
-#line 6530 "parser.cpp"
+#line 6576 "parser.cpp"
     break;
 
-  case 341: /* index_info_list: index_info_list '(' identifier_array ')' USING IDENTIFIER with_index_param_list  */
-#line 2708 "parser.y"
+  case 343: /* index_info_list: index_info_list '(' identifier_array ')' USING IDENTIFIER with_index_param_list  */
+#line 2741 "parser.y"
                                                                                   {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     infinity::IndexType index_type = infinity::IndexType::kInvalid;
@@ -6540,6 +6590,12 @@ yyreduce:
         index_type = infinity::IndexType::kHnsw;
     } else if (strcmp((yyvsp[-1].str_value), "ivfflat") == 0) {
         index_type = infinity::IndexType::kIVFFlat;
+    } else if (strcmp((yyvsp[-1].str_value), "ivfpq") == 0) {
+        index_type = infinity::IndexType::kIVFPQ;
+    } else if (strcmp((yyvsp[-1].str_value), "diskann") == 0) {
+        index_type = infinity::IndexType::kDiskAnn;
+    } else if (strcmp((yyvsp[-1].str_value), "ivfsq8") == 0) {
+        index_type = infinity::IndexType::kIVFSQ8;
     } else {
         free((yyvsp[-1].str_value));
         delete (yyvsp[-4].identifier_array_t);
@@ -6580,11 +6636,11 @@ yyreduce:
     }
     delete (yyvsp[-4].identifier_array_t);
 }
-#line 6584 "parser.cpp"
+#line 6632 "parser.cpp"
     break;
 
 
-#line 6588 "parser.cpp"
+#line 6636 "parser.cpp"
 
       default: break;
     }
@@ -6813,7 +6869,7 @@ yyreturnlab:
   return yyresult;
 }
 
-#line 2758 "parser.y"
+#line 2793 "parser.y"
 
 
 void
@@ -17,6 +17,7 @@ module;
 #include "search_options.h"
 #include "sql_parser.h"
 #include "type/info/array_info.h"
+#include "type/number/bfloat16.h"
 #include "type/number/float16.h"
 
 export module parser;
@@ -89,6 +90,7 @@ export using MixedT = MixedType;
 export using TimeUnit = TimeUnit;
 
 export using float16_t = float16_t;
+export using bfloat16_t = bfloat16_t;
 
 export using IntegerMixedType = IntegerMixedType;
 export using FloatMixedType = FloatMixedType;
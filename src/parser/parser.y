@@ -754,6 +754,22 @@ BOOLEAN { $$ = infinity::ColumnType{infinity::LogicalType::kBoolean, 0, 0, 0, in
 | EMBEDDING '(' BIGINT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemInt64}; }
 | EMBEDDING '(' FLOAT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemFloat}; }
 | EMBEDDING '(' DOUBLE ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemDouble}; }
+| EMBEDDING '(' IDENTIFIER ',' LONG_VALUE ')' {
+    // half precision element types aren't keywords
+    ParserHelper::ToLower($3);
+    infinity::EmbeddingDataType elem_type = infinity::EmbeddingDataType::kElemInvalid;
+    if(strcmp($3, "float16") == 0 || strcmp($3, "half") == 0) {
+        elem_type = infinity::kElemFloat16;
+    } else if(strcmp($3, "bfloat16") == 0) {
+        elem_type = infinity::kElemBFloat16;
+    }
+    free($3);
+    if(elem_type == infinity::EmbeddingDataType::kElemInvalid) {
+        yyerror(&yyloc, scanner, result, "Invalid embedding element type");
+        YYERROR;
+    }
+    $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, elem_type};
+}
 | VECTOR '(' BIT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemBit}; }
 | VECTOR '(' TINYINT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemInt8}; }
 | VECTOR '(' SMALLINT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemInt16}; }
@@ -762,6 +778,22 @@ BOOLEAN { $$ = infinity::ColumnType{infinity::LogicalType::kBoolean, 0, 0, 0, in
 | VECTOR '(' BIGINT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemInt64}; }
 | VECTOR '(' FLOAT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemFloat}; }
 | VECTOR '(' DOUBLE ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemDouble}; }
+| VECTOR '(' IDENTIFIER ',' LONG_VALUE ')' {
+    // half precision element types aren't keywords
+    ParserHelper::ToLower($3);
+    infinity::EmbeddingDataType elem_type = infinity::EmbeddingDataType::kElemInvalid;
+    if(strcmp($3, "float16") == 0 || strcmp($3, "half") == 0) {
+        elem_type = infinity::kElemFloat16;
+    } else if(strcmp($3, "bfloat16") == 0) {
+        elem_type = infinity::kElemBFloat16;
+    }
+    free($3);
+    if(elem_type == infinity::EmbeddingDataType::kElemInvalid) {
+        yyerror(&yyloc, scanner, result, "Invalid embedding element type");
+        YYERROR;
+    }
+    $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, elem_type};
+}
 /*
 | DECIMAL opt_decimal_specification {
   $$ = infinity::ColumnType{DataType::DECIMAL, 0, $2->first, $2->second};
@@ -1867,12 +1899,11 @@ knn_expr : KNN '(' expr ',' array_expr ',' STRING ',' STRING ',' LONG_VALUE ')'
             for(long i = 0; i < embedding_size; ++ i) {
                 char embedding_unit = 0;
                 for(long bit_idx = 0; bit_idx < 8; ++ bit_idx) {
+                    // the first element is the most significant bit of a byte
                     if($5->long_array_[i * 8 + bit_idx] == 1) {
-                        char temp = embedding_unit << 1;
-                        temp &= 1;
-                        embedding_unit = temp;
+                        embedding_unit = (embedding_unit << 1) | 1;
                     } else if($5->long_array_[i * 8 + bit_idx] == 0) {
-                        embedding_unit <<= 0;
+                        embedding_unit <<= 1;
                     } else {
                         for (auto* param_ptr: *$13) {
                             delete param_ptr;
@@ -2666,6 +2697,12 @@ index_info_list : '(' identifier_array ')' USING IDENTIFIER with_index_param_lis
         index_type = infinity::IndexType::kHnsw;
     } else if (strcmp($5, "ivfflat") == 0) {
         index_type = infinity::IndexType::kIVFFlat;
+    } else if (strcmp($5, "ivfpq") == 0) {
+        index_type = infinity::IndexType::kIVFPQ;
+    } else if (strcmp($5, "diskann") == 0) {
+        index_type = infinity::IndexType::kDiskAnn;
+    } else if (strcmp($5, "ivfsq8") == 0) {
+        index_type = infinity::IndexType::kIVFSQ8;
     } else {
         free($5);
         delete $2;
@@ -2714,6 +2751,12 @@ index_info_list : '(' identifier_array ')' USING IDENTIFIER with_index_param_lis
         index_type = infinity::IndexType::kHnsw;
     } else if (strcmp($6, "ivfflat") == 0) {
         index_type = infinity::IndexType::kIVFFlat;
+    } else if (strcmp($6, "ivfpq") == 0) {
+        index_type = infinity::IndexType::kIVFPQ;
+    } else if (strcmp($6, "diskann") == 0) {
+        index_type = infinity::IndexType::kDiskAnn;
+    } else if (strcmp($6, "ivfsq8") == 0) {
+        index_type = infinity::IndexType::kIVFSQ8;
     } else {
         free($6);
         delete $3;
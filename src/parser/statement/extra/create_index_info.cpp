@@ -30,6 +30,15 @@ std::string IndexInfo::IndexTypeToString(IndexType index_type) {
         case IndexType::kIRSFullText: {
             return "FULLTEXT";
         }
+        case IndexType::kIVFPQ: {
+            return "IVFPQ";
+        }
+        case IndexType::kDiskAnn: {
+            return "DISKANN";
+        }
+        case IndexType::kIVFSQ8: {
+            return "IVFSQ8";
+        }
         case IndexType::kInvalid: {
             ParserError("Invalid conflict type.");
         }
@@ -44,6 +53,12 @@ IndexType IndexInfo::StringToIndexType(const std::string& index_type_str) {
         return IndexType::kHnsw;
     } else if (index_type_str == "FULLTEXT") {
         return IndexType::kIRSFullText;
+    } else if (index_type_str == "IVFPQ") {
+        return IndexType::kIVFPQ;
+    } else if (index_type_str == "DISKANN") {
+        return IndexType::kDiskAnn;
+    } else if (index_type_str == "IVFSQ8") {
+        return IndexType::kIVFSQ8;
     } else {
         return IndexType::kInvalid;
     }
@@ -25,6 +25,9 @@ enum class IndexType {
     kIVFFlat,
     kHnsw,
     kIRSFullText,
+    kIVFPQ,
+    kDiskAnn,
+    kIVFSQ8,
     kInvalid,
 };
 
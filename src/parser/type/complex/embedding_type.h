@@ -15,6 +15,8 @@
 #pragma once
 
 #include "parser_assert.h"
+#include "type/number/bfloat16.h"
+#include "type/number/float16.h"
 #include <bitset>
 #include <charconv>
 #include <cstdint>
@@ -23,7 +25,18 @@
 
 namespace infinity {
 
-enum EmbeddingDataType : int8_t { kElemBit, kElemInt8, kElemInt16, kElemInt32, kElemInt64, kElemFloat, kElemDouble, kElemInvalid };
+enum EmbeddingDataType : int8_t {
+    kElemBit,
+    kElemInt8,
+    kElemInt16,
+    kElemInt32,
+    kElemInt64,
+    kElemFloat,
+    kElemDouble,
+    kElemFloat16,
+    kElemBFloat16,
+    kElemInvalid
+};
 
 template <typename T>
 inline EmbeddingDataType ToEmbeddingDataType() {
@@ -65,6 +78,16 @@ inline EmbeddingDataType ToEmbeddingDataType<double>() {
     return EmbeddingDataType::kElemDouble;
 }
 
+template <>
+inline EmbeddingDataType ToEmbeddingDataType<float16_t>() {
+    return EmbeddingDataType::kElemFloat16;
+}
+
+template <>
+inline EmbeddingDataType ToEmbeddingDataType<bfloat16_t>() {
+    return EmbeddingDataType::kElemBFloat16;
+}
+
 struct EmbeddingType {
 public:
     char *ptr{};
@@ -101,6 +124,10 @@ public:
                 return "FLOAT32";
             case kElemDouble:
                 return "FLOAT64";
+            case kElemFloat16:
+                return "FLOAT16";
+            case kElemBFloat16:
+                return "BFLOAT16";
             default: {
                 ParserError("Unexpected embedding type");
             }
@@ -124,6 +151,10 @@ public:
                 return Embedding2StringInternal<float>(embedding, dimension);
             case kElemDouble:
                 return Embedding2StringInternal<double>(embedding, dimension);
+            case kElemFloat16:
+                return Embedding2StringInternal<float16_t>(embedding, dimension);
+            case kElemBFloat16:
+                return Embedding2StringInternal<bfloat16_t>(embedding, dimension);
             default: {
                 ParserError("Unexpected embedding type");
             }
@@ -162,7 +193,8 @@ private:
         std::stringstream ss;
         ParserAssert(dimension % 8 == 0, "Binary embedding dimension should be the times of 8.");
 
-        int64_t *array = (int64_t *)(embedding.ptr);
+        // every byte keeps 8 elements, the first one in the most significant bit
+        uint8_t *array = (uint8_t *)(embedding.ptr);
 
         for (size_t i = 0; i < dimension / 8; ++i) {
             ss << std::bitset<8>(array[i]);
@@ -66,6 +66,9 @@ import status;
 import default_values;
 import index_base;
 import index_ivfflat;
+import index_ivfpq;
+import index_diskann;
+import index_ivfsq8;
 import index_hnsw;
 import index_full_text;
 
@@ -482,6 +485,24 @@ Status LogicalPlanner::BuildCreateIndex(const CreateStatement *statement, Shared
                                                   *(index_info->index_param_list_));
                 break;
             }
+            case IndexType::kIVFPQ: {
+                base_index_ptr = IndexIVFPQ::Make(create_index_info->table_name_ + "_" + *index_name,
+                                                {index_info->column_name_},
+                                                *(index_info->index_param_list_));
+                break;
+            }
+            case IndexType::kIVFSQ8: {
+                base_index_ptr = IndexIVFSQ8::Make(create_index_info->table_name_ + "_" + *index_name,
+                                                   {index_info->column_name_},
+                                                   *(index_info->index_param_list_));
+                break;
+            }
+            case IndexType::kDiskAnn: {
+                base_index_ptr = IndexDiskAnn::Make(create_index_info->table_name_ + "_" + *index_name,
+                                                  {index_info->column_name_},
+                                                  *(index_info->index_param_list_));
+                break;
+            }
             case IndexType::kInvalid: {
                 Error<PlannerException>("Invalid index type.");
                 break;
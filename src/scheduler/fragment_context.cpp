@@ -114,7 +114,8 @@ UniquePtr<OperatorState> MakeMergeKnnState(PhysicalMergeKnn *physical_merge_knn,
                                                                                         knn_expr->topn_,
                                                                                         knn_expr->embedding_data_type_,
                                                                                         knn_expr->distance_type_,
-                                                                                        physical_merge_knn->table_ref_);
+                                                                                        physical_merge_knn->table_ref_,
+                                                                                        knn_expr->radius_);
 
     return operator_state;
 }
@@ -461,7 +462,8 @@ SizeT InitKnnScanFragmentContext(PhysicalKnnScan *knn_scan_operator, FragmentCon
                                                                                           1,
                                                                                           knn_expr->query_embedding_.ptr,
                                                                                           knn_expr->embedding_data_type_,
-                                                                                          knn_expr->distance_type_);
+                                                                                          knn_expr->distance_type_,
+                                                                                          knn_expr->radius_);
             break;
         }
         case FragmentType::kParallelMaterialize: {
@@ -476,7 +478,8 @@ SizeT InitKnnScanFragmentContext(PhysicalKnnScan *knn_scan_operator, FragmentCon
                                                                                             1,
                                                                                             knn_expr->query_embedding_.ptr,
                                                                                             knn_expr->embedding_data_type_,
-                                                                                            knn_expr->distance_type_);
+                                                                                            knn_expr->distance_type_,
+                                                                                            knn_expr->radius_);
             break;
         }
         default: {
@@ -35,7 +35,15 @@ public:
 private:
     void Process();
 
+    // retry the repairs deferred by the active txns, which still see the deleted rows
+    void RetryRepairs();
+
+    // retry the cleanups deferred by the active txns, which still see the dropped indexes
+    void RetryCleanups();
+
     BlockingQueue<SharedPtr<BGTask>> task_queue_;
+    Vector<SharedPtr<RepairIndexTask>> deferred_repairs_{};
+    Vector<SharedPtr<CleanupIndexTask>> deferred_cleanups_{};
     Thread processor_thread_{};
 
     WalManager* wal_manager_{};
@@ -20,6 +20,9 @@ import logger;
 import blocking_queue;
 import infinity_exception;
 import wal_manager;
+import segment_column_index_entry;
+import table_collection_entry;
+import table_index_meta;
 
 namespace infinity {
 
@@ -47,14 +50,50 @@ void BGTaskProcessor::Process() {
 
         switch (bg_task->type_) {
             case BGTaskType::kTryCheckpoint: {
+                RetryRepairs();
+                RetryCleanups();
                 wal_manager_->Checkpoint();
                 break;
             }
             case BGTaskType::kForceCheckpoint: {
                 ForceCheckpointTask *force_ckp_task = (ForceCheckpointTask *)(bg_task.get());
+                RetryRepairs();
+                RetryCleanups();
                 wal_manager_->Checkpoint(force_ckp_task);
                 break;
             }
+            case BGTaskType::kRepairIndex: {
+                // a repair never overlaps the flush of its index by a checkpoint on this thread. a checkpoint earlier than the delete
+                // may save the repaired index, whose rows are deleted again by the wal replay.
+                SharedPtr<RepairIndexTask> repair_task = static_pointer_cast<RepairIndexTask>(bg_task);
+                if (!TableCollectionEntry::RepairIndex(repair_task->table_entry_,
+                                                       repair_task->segment_id_,
+                                                       repair_task->commit_ts_,
+                                                       repair_task->segment_column_index_entry_.get(),
+                                                       repair_task->buffer_mgr_)) {
+                    deferred_repairs_.push_back(Move(repair_task));
+                }
+                break;
+            }
+            case BGTaskType::kUpdateIndex: {
+                // the checkpoints run on this thread too, so the updates submitted before a checkpoint are done before it flushes the indexes
+                UpdateIndexTask *update_task = (UpdateIndexTask *)(bg_task.get());
+                TableCollectionEntry::UpdateIndexes(update_task->table_entry_,
+                                                    update_task->txn_id_,
+                                                    update_task->commit_ts_,
+                                                    update_task->segment_ids_,
+                                                    update_task->is_import_,
+                                                    update_task->buffer_mgr_);
+                break;
+            }
+            case BGTaskType::kCleanupIndex: {
+                // the files are removed on this thread, so a checkpoint never flushes the dropped index at the same time
+                SharedPtr<CleanupIndexTask> cleanup_task = static_pointer_cast<CleanupIndexTask>(bg_task);
+                if (!TableIndexMeta::CleanupDroppedEntry(cleanup_task->table_index_meta_, cleanup_task->commit_ts_)) {
+                    deferred_cleanups_.push_back(Move(cleanup_task));
+                }
+                break;
+            }
             case BGTaskType::kStopProcessor: {
                 running = false;
                 break;
@@ -69,4 +108,28 @@ void BGTaskProcessor::Process() {
     }
 }
 
+void BGTaskProcessor::RetryRepairs() {
+    Vector<SharedPtr<RepairIndexTask>> repair_tasks = Move(deferred_repairs_);
+    deferred_repairs_.clear();
+    for (auto &repair_task : repair_tasks) {
+        if (!TableCollectionEntry::RepairIndex(repair_task->table_entry_,
+                                               repair_task->segment_id_,
+                                               repair_task->commit_ts_,
+                                               repair_task->segment_column_index_entry_.get(),
+                                               repair_task->buffer_mgr_)) {
+            deferred_repairs_.push_back(Move(repair_task));
+        }
+    }
+}
+
+void BGTaskProcessor::RetryCleanups() {
+    Vector<SharedPtr<CleanupIndexTask>> cleanup_tasks = Move(deferred_cleanups_);
+    deferred_cleanups_.clear();
+    for (auto &cleanup_task : cleanup_tasks) {
+        if (!TableIndexMeta::CleanupDroppedEntry(cleanup_task->table_index_meta_, cleanup_task->commit_ts_)) {
+            deferred_cleanups_.push_back(Move(cleanup_task));
+        }
+    }
+}
+
 } // namespace infinity
@@ -16,6 +16,10 @@ module;
 
 import stl;
 import txn;
+import segment_column_index_entry;
+import buffer_manager;
+import table_collection_entry;
+import table_index_meta;
 
 export module bg_task;
 
@@ -24,6 +28,9 @@ namespace infinity {
 export enum class BGTaskType {
     kTryCheckpoint,   // Periodically triggered by timer
     kForceCheckpoint, // Manually triggered by PhysicalImport
+    kRepairIndex,     // Triggered by deletes on an indexed segment
+    kUpdateIndex,     // Triggered by appends and imports on an indexed table
+    kCleanupIndex,    // Triggered by dropping an index
     kStopProcessor,
     kInvalid
 };
@@ -84,4 +91,58 @@ export struct ForceCheckpointTask final : public BGTask {
     Txn *txn_{};
 };
 
+export struct RepairIndexTask final : public BGTask {
+    RepairIndexTask(TableCollectionEntry *table_entry,
+                    u32 segment_id,
+                    TxnTimeStamp commit_ts,
+                    SharedPtr<SegmentColumnIndexEntry> segment_column_index_entry,
+                    BufferManager *buffer_mgr)
+        : BGTask(BGTaskType::kRepairIndex, true), table_entry_(table_entry), segment_id_(segment_id), commit_ts_(commit_ts),
+          segment_column_index_entry_(Move(segment_column_index_entry)), buffer_mgr_(buffer_mgr) {}
+
+    ~RepairIndexTask() = default;
+
+    String ToString() const final { return "Repair Index Task"; }
+
+    TableCollectionEntry *table_entry_{};
+    u32 segment_id_{};
+    TxnTimeStamp commit_ts_{};
+    SharedPtr<SegmentColumnIndexEntry> segment_column_index_entry_{};
+    BufferManager *buffer_mgr_{};
+};
+
+export struct UpdateIndexTask final : public BGTask {
+    UpdateIndexTask(TableCollectionEntry *table_entry,
+                    u64 txn_id,
+                    TxnTimeStamp commit_ts,
+                    Vector<u32> segment_ids,
+                    bool is_import,
+                    BufferManager *buffer_mgr)
+        : BGTask(BGTaskType::kUpdateIndex, true), table_entry_(table_entry), txn_id_(txn_id), commit_ts_(commit_ts),
+          segment_ids_(Move(segment_ids)), is_import_(is_import), buffer_mgr_(buffer_mgr) {}
+
+    ~UpdateIndexTask() = default;
+
+    String ToString() const final { return "Update Index Task"; }
+
+    TableCollectionEntry *table_entry_{};
+    u64 txn_id_{};
+    TxnTimeStamp commit_ts_{};
+    Vector<u32> segment_ids_{};
+    bool is_import_{false};
+    BufferManager *buffer_mgr_{};
+};
+
+export struct CleanupIndexTask final : public BGTask {
+    CleanupIndexTask(TableIndexMeta *table_index_meta, TxnTimeStamp commit_ts)
+        : BGTask(BGTaskType::kCleanupIndex, true), table_index_meta_(table_index_meta), commit_ts_(commit_ts) {}
+
+    ~CleanupIndexTask() = default;
+
+    String ToString() const final { return "Cleanup Index Task"; }
+
+    TableIndexMeta *table_index_meta_{};
+    TxnTimeStamp commit_ts_{};
+};
+
 } // namespace infinity
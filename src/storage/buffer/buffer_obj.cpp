@@ -163,6 +163,16 @@ void BufferObj::CloseFile() {
     rw_locker_.unlock();
 }
 
+void BufferObj::CleanupFile() {
+    UniqueLock<RWMutex> w_locker(rw_locker_);
+    if (rc_ > 0) {
+        Error<StorageException>("Buffer is still in use.");
+    }
+    // a persistent buffer is freed without being written
+    type_ = BufferType::kPersistent;
+    file_worker_->CleanupFile();
+}
+
 void BufferObj::CheckState() const {
     switch (status_) {
         case BufferStatus::kLoaded: {
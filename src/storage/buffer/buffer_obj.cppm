@@ -62,6 +62,9 @@ public:
 
     void CloseFile();
 
+    // called when the entry of the buffer is dropped and not visible to any txn. the buffer is not saved or spilled any more.
+    void CleanupFile();
+
     SizeT GetBufferSize() const { return file_worker_->GetMemoryCost(); }
 
     String GetFilename() const { return file_worker_->GetFilePath(); }
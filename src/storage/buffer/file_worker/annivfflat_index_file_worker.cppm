@@ -95,12 +95,14 @@ void AnnIVFFlatIndexFileWorker<DataType>::AllocateInMemory() {
         centroids_count = default_centroid_num_;
     }
     switch (GetType()) {
-        case kElemFloat: {
+        case kElemFloat:
+        case kElemFloat16:
+        case kElemBFloat16: {
             data_ = static_cast<void *>(new AnnIVFFlatIndexData<DataType>(index_ivfflat->metric_type_, dimension, centroids_count));
             break;
         }
         default: {
-            Error<StorageException>("Index should be created on float embedding column now.");
+            Error<StorageException>("Index should be created on float or half precision embedding column now.");
         }
     }
 }
@@ -0,0 +1,153 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cmath>
+
+import stl;
+import index_file_worker;
+import file_worker;
+import parser;
+import index_base;
+import annivfpq_index_data;
+import product_quantizer;
+import infinity_exception;
+import index_ivfpq;
+
+export module annivfpq_index_file_worker;
+
+namespace infinity {
+
+export struct CreateAnnIVFPQParam : public CreateIndexParam {
+    // used when ivfpq_index_def->centroids_count_ == 0
+    const SizeT row_count_{};
+
+    CreateAnnIVFPQParam(const IndexBase *index_base, const ColumnDef *column_def, SizeT row_count)
+        : CreateIndexParam(index_base, column_def), row_count_(row_count) {}
+};
+
+export template <typename DataType>
+class AnnIVFPQIndexFileWorker : public IndexFileWorker {
+    u32 default_centroid_num_;
+
+public:
+    explicit AnnIVFPQIndexFileWorker(SharedPtr<String> file_dir,
+                                     SharedPtr<String> file_name,
+                                     const IndexBase *index_base,
+                                     const ColumnDef *column_def,
+                                     SizeT row_count)
+        : IndexFileWorker(file_dir, file_name, index_base, column_def), default_centroid_num_((u32)sqrt(row_count)) {}
+
+    virtual ~AnnIVFPQIndexFileWorker() override;
+
+public:
+    void AllocateInMemory() override;
+
+    void FreeInMemory() override;
+
+protected:
+    void WriteToFileImpl(bool &prepare_success) override;
+
+    void ReadFromFileImpl() override;
+
+private:
+    EmbeddingDataType GetType() const;
+
+    SizeT GetDimension() const;
+};
+
+template <typename DataType>
+AnnIVFPQIndexFileWorker<DataType>::~AnnIVFPQIndexFileWorker() {
+    if (data_ != nullptr) {
+        FreeInMemory();
+        data_ = nullptr;
+    }
+}
+
+template <typename DataType>
+void AnnIVFPQIndexFileWorker<DataType>::AllocateInMemory() {
+    if (data_) {
+        Error<StorageException>("Data is already allocated.");
+    }
+    if (index_base_->index_type_ != IndexType::kIVFPQ) {
+        Error<StorageException>("Bug.");
+    }
+    auto data_type = column_def_->type();
+    if (data_type->type() != LogicalType::kEmbedding) {
+        StorageException("Index should be created on embedding column now.");
+    }
+    SizeT dimension = GetDimension();
+
+    const auto* index_ivfpq = static_cast<const IndexIVFPQ *>(index_base_);
+    auto centroids_count = index_ivfpq->centroids_count_;
+    if (centroids_count == 0) {
+        centroids_count = default_centroid_num_;
+    }
+    auto subspace_num = index_ivfpq->subspace_num_;
+    if (subspace_num == 0) {
+        subspace_num = ProductQuantizer::DefaultSubspaceNum(dimension);
+    }
+    switch (GetType()) {
+        case kElemFloat:
+        case kElemFloat16:
+        case kElemBFloat16: {
+            data_ = static_cast<void *>(new AnnIVFPQIndexData<DataType>(index_ivfpq->metric_type_, dimension, centroids_count, subspace_num));
+            break;
+        }
+        default: {
+            Error<StorageException>("Index should be created on float or half precision embedding column now.");
+        }
+    }
+}
+
+template <typename DataType>
+void AnnIVFPQIndexFileWorker<DataType>::FreeInMemory() {
+    if (!data_) {
+        Error<StorageException>("Data is not allocated.");
+    }
+    auto index = static_cast<AnnIVFPQIndexData<DataType> *>(data_);
+    delete index;
+    data_ = nullptr;
+}
+
+template <typename DataType>
+void AnnIVFPQIndexFileWorker<DataType>::WriteToFileImpl(bool &prepare_success) {
+    auto *index = static_cast<AnnIVFPQIndexData<DataType> *>(data_);
+    index->SaveIndexInner(*file_handler_);
+    prepare_success = true;
+}
+
+template <typename DataType>
+void AnnIVFPQIndexFileWorker<DataType>::ReadFromFileImpl() {
+    auto *index = static_cast<AnnIVFPQIndexData<DataType> *>(data_);
+    index->ReadIndexInner(*file_handler_);
+}
+
+template <typename DataType>
+EmbeddingDataType AnnIVFPQIndexFileWorker<DataType>::GetType() const {
+    auto data_type = column_def_->type();
+    auto type_info = data_type->type_info().get();
+    auto embedding_info = (EmbeddingInfo *)type_info;
+    return embedding_info->Type();
+}
+
+template <typename DataType>
+SizeT AnnIVFPQIndexFileWorker<DataType>::GetDimension() const {
+    auto data_type = column_def_->type();
+    auto type_info = data_type->type_info().get();
+    auto embedding_info = (EmbeddingInfo *)type_info;
+    return embedding_info->Dimension();
+}
+} // namespace infinity
\ No newline at end of file
@@ -0,0 +1,132 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+import stl;
+import index_file_worker;
+import file_worker;
+import parser;
+import index_base;
+import diskann_index;
+import product_quantizer;
+import infinity_exception;
+import index_diskann;
+import third_party;
+import local_file_system;
+
+export module diskann_index_file_worker;
+
+namespace infinity {
+
+// the file of the worker keeps the codes in memory, the graph is in the file of `DiskAnnIndex::disk_path` beside it.
+// the graph file is written into the temp directory when the index is built, so it is not written again when the buffer is
+// spilled. it is moved into `file_dir_` with the codes when they are saved, as the file spilled.
+export class DiskAnnIndexFileWorker : public IndexFileWorker {
+public:
+    explicit DiskAnnIndexFileWorker(SharedPtr<String> file_dir, SharedPtr<String> file_name, const IndexBase *index_base, const ColumnDef *column_def)
+        : IndexFileWorker(file_dir, file_name, index_base, column_def) {}
+
+    virtual ~DiskAnnIndexFileWorker() override {
+        if (data_ != nullptr) {
+            FreeInMemory();
+            data_ = nullptr;
+        }
+    }
+
+public:
+    void AllocateInMemory() override {
+        if (data_) {
+            Error<StorageException>("Data is already allocated.");
+        }
+        if (index_base_->index_type_ != IndexType::kDiskAnn) {
+            Error<StorageException>("Bug.");
+        }
+        auto data_type = column_def_->type();
+        if (data_type->type() != LogicalType::kEmbedding) {
+            Error<StorageException>("Index should be created on embedding column now.");
+        }
+        auto embedding_info = static_cast<EmbeddingInfo *>(data_type->type_info().get());
+        switch (embedding_info->Type()) {
+            case kElemFloat:
+            case kElemFloat16:
+            case kElemBFloat16: {
+                break;
+            }
+            default: {
+                Error<StorageException>("Index should be created on float or half precision embedding column now.");
+            }
+        }
+        SizeT dimension = embedding_info->Dimension();
+        const auto *index_diskann = static_cast<const IndexDiskAnn *>(index_base_);
+        auto subspace_num = index_diskann->subspace_num_;
+        if (subspace_num == 0) {
+            subspace_num = ProductQuantizer::DefaultSubspaceNum(dimension);
+        }
+        data_ = static_cast<void *>(new DiskAnnIndex(index_diskann->metric_type_,
+                                                     dimension,
+                                                     index_diskann->R_,
+                                                     index_diskann->L_,
+                                                     subspace_num,
+                                                     DiskPath(true)));
+    }
+
+    void FreeInMemory() override {
+        if (!data_) {
+            Error<StorageException>("Data is not allocated.");
+        }
+        auto index = static_cast<DiskAnnIndex *>(data_);
+        delete index;
+        data_ = nullptr;
+    }
+
+    // the graph spilled with the codes is moved too
+    void MoveFile() override {
+        FileWorker::MoveFile();
+        LocalFileSystem fs;
+        if (String src_path = DiskPath(true); fs.Exists(src_path)) {
+            fs.Rename(src_path, DiskPath(false));
+        }
+    }
+
+    // the graph beside the codes is removed too, an index in memory still reads the unlinked graph it opened
+    void CleanupFile() override {
+        FileWorker::CleanupFile();
+        LocalFileSystem fs;
+        for (bool spill : {false, true}) {
+            if (String path = DiskPath(spill); fs.Exists(path)) {
+                fs.DeleteFile(path);
+            }
+        }
+    }
+
+protected:
+    void WriteToFileImpl(bool &prepare_success) override {
+        auto *index = static_cast<DiskAnnIndex *>(data_);
+        index->MoveDiskFile(file_handler_->path_.string() + ".disk");
+        index->SaveIndexInner(*file_handler_);
+        prepare_success = true;
+    }
+
+    void ReadFromFileImpl() override {
+        auto *index = static_cast<DiskAnnIndex *>(data_);
+        index->SetDiskPath(file_handler_->path_.string() + ".disk");
+        index->ReadIndexInner(*file_handler_);
+    }
+
+private:
+    String DiskPath(bool spill) const { return Format("{}/{}.disk", ChooseFileDir(spill), *file_name_); }
+};
+
+} // namespace infinity
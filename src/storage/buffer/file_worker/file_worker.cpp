@@ -103,4 +103,13 @@ void FileWorker::MoveFile() {
     fs.Rename(src_path, dest_path);
 }
 
+void FileWorker::CleanupFile() {
+    LocalFileSystem fs;
+    for (bool spill : {false, true}) {
+        if (String path = Format("{}/{}", ChooseFileDir(spill), *file_name_); fs.Exists(path)) {
+            fs.DeleteFile(path);
+        }
+    }
+}
+
 } // namespace infinity
\ No newline at end of file
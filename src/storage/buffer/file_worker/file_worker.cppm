@@ -35,7 +35,11 @@ public:
 
     void ReadFromFile(bool from_spill);
 
-    void MoveFile();
+    // move the file spilled to the temp directory into `file_dir_`
+    virtual void MoveFile();
+
+    // remove the file in `file_dir_` and the file spilled, when the entry of the file is not visible to any txn
+    virtual void CleanupFile();
 
     virtual void AllocateInMemory() = 0;
 
@@ -62,7 +66,6 @@ protected:
 
     virtual void ReadFromFileImpl() = 0;
 
-private:
     String ChooseFileDir(bool spill) const { return spill ? Format("{}{}", *temp_dir_, *file_dir_) : *file_dir_; }
 
 public:
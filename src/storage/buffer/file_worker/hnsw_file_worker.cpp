@@ -18,15 +18,13 @@ import infinity_exception;
 import stl;
 import index_file_worker;
 import hnsw_alg;
+import hnsw_dispatch;
 import index_hnsw;
 import parser;
 import index_base;
-import dist_func_l2;
-import dist_func_ip;
-import lvq_store;
-import plain_store;
 import third_party;
 import logger;
+import local_file_system;
 
 module hnsw_file_worker;
 
@@ -51,61 +49,14 @@ void HnswFileWorker::AllocateInMemory() {
         StorageException("Index should be created on embedding column now.");
     }
 
-    SizeT dimension = GetDimension();
+    // the bits are packed, so the dimension of the store is the number of bytes
+    SizeT dimension = GetType() == kElemBit ? EmbeddingT::EmbeddingSize(kElemBit, GetDimension()) : GetDimension();
     const IndexHnsw *index_hnsw = static_cast<const IndexHnsw *>(index_base_);
     SizeT M = index_hnsw->M_;
     SizeT ef_c = index_hnsw->ef_construction_;
-    auto AllocateData = [&](auto *hnsw_index) { data_ = static_cast<void *>(hnsw_index); };
-
-    switch (GetType()) {
-        case kElemFloat: {
-            switch (index_hnsw->encode_type_) {
-                case HnswEncodeType::kPlain: {
-                    switch (index_hnsw->metric_type_) {
-                        case MetricType::kMerticInnerProduct: {
-                            using Hnsw = KnnHnsw<f32, u64, PlainStore<f32>, PlainIPDist<f32>>;
-                            AllocateData(Hnsw::Make(max_element_, dimension, M, ef_c, {}).release());
-                            break;
-                        }
-                        case MetricType::kMerticL2: {
-                            using Hnsw = KnnHnsw<f32, u64, PlainStore<f32>, PlainL2Dist<f32>>;
-                            AllocateData(Hnsw::Make(max_element_, dimension, M, ef_c, {}).release());
-                            break;
-                        }
-                        default: {
-                            Error<StorageException>("Bug.");
-                        }
-                    }
-                    break;
-                }
-                case HnswEncodeType::kLVQ: {
-                    switch (index_hnsw->metric_type_) {
-                        case MetricType::kMerticInnerProduct: {
-                            using Hnsw = KnnHnsw<f32, u64, LVQStore<f32, i8, LVQIPCache<f32, i8>>, LVQIPDist<f32, i8>>;
-                            AllocateData(Hnsw::Make(max_element_, dimension, M, ef_c, {}).release());
-                            break;
-                        }
-                        case MetricType::kMerticL2: {
-                            using Hnsw = KnnHnsw<f32, u64, LVQStore<f32, i8, LVQL2Cache<f32, i8>>, LVQL2Dist<f32, i8>>;
-                            AllocateData(Hnsw::Make(max_element_, dimension, M, ef_c, {}).release());
-                            break;
-                        }
-                        default: {
-                            Error<StorageException>("Bug.");
-                        }
-                    }
-                    break;
-                }
-                default: {
-                    Error<StorageException>("Bug.");
-                }
-            }
-            break;
-        }
-        default: {
-            Error<StorageException>("Index should be created on float embedding column now.");
-        }
-    }
+    DispatchHnsw(index_hnsw, GetType(), [&]<typename Hnsw>() {
+        data_ = static_cast<void *>(Hnsw::Make(max_element_, dimension, M, ef_c, {}).release());
+    });
 }
 
 void HnswFileWorker::FreeInMemory() {
@@ -113,57 +64,7 @@ void HnswFileWorker::FreeInMemory() {
         Error<StorageException>("FreeInMemory: Data is not allocated.");
     }
     const IndexHnsw *index_hnsw = static_cast<const IndexHnsw *>(index_base_);
-    auto FreeData = [&](auto *hnsw_index) { delete hnsw_index; };
-    EmbeddingDataType embedding_type = GetType();
-    switch (embedding_type) {
-        case kElemFloat: {
-            switch (index_hnsw->encode_type_) {
-                case HnswEncodeType::kPlain: {
-                    switch (index_hnsw->metric_type_) {
-                        case MetricType::kMerticInnerProduct: {
-                            using Hnsw = KnnHnsw<f32, u64, PlainStore<f32>, PlainIPDist<f32>>;
-                            FreeData(static_cast<Hnsw *>(data_));
-                            break;
-                        }
-                        case MetricType::kMerticL2: {
-                            using Hnsw = KnnHnsw<f32, u64, PlainStore<f32>, PlainL2Dist<f32>>;
-                            FreeData(static_cast<Hnsw *>(data_));
-                            break;
-                        }
-                        default: {
-                            Error<StorageException>("Bug.");
-                        }
-                    }
-                    break;
-                }
-                case HnswEncodeType::kLVQ: {
-                    switch (index_hnsw->metric_type_) {
-                        case MetricType::kMerticInnerProduct: {
-                            using Hnsw = KnnHnsw<f32, u64, LVQStore<f32, i8, LVQIPCache<f32, i8>>, LVQIPDist<f32, i8>>;
-                            FreeData(static_cast<Hnsw *>(data_));
-                            break;
-                        }
-                        case MetricType::kMerticL2: {
-                            using Hnsw = KnnHnsw<f32, u64, LVQStore<f32, i8, LVQL2Cache<f32, i8>>, LVQL2Dist<f32, i8>>;
-                            FreeData(static_cast<Hnsw *>(data_));
-                            break;
-                        }
-                        default: {
-                            Error<StorageException>("Bug.");
-                        }
-                    }
-                    break;
-                }
-                default: {
-                    Error<StorageException>("Bug.");
-                }
-            }
-            break;
-        }
-        default: {
-            Error<StorageException>(Format("Index should be created on float embedding column now, type: {}", EmbeddingDataType2String(embedding_type)));
-        }
-    }
+    DispatchHnsw(index_hnsw, GetType(), [&]<typename Hnsw>() { delete static_cast<Hnsw *>(data_); });
     data_ = nullptr;
 }
 
@@ -172,112 +73,25 @@ void HnswFileWorker::WriteToFileImpl(bool &prepare_success) {
         Error<StorageException>("WriteToFileImpl: Data is not allocated.");
     }
     const IndexHnsw *index_hnsw = static_cast<const IndexHnsw *>(index_base_);
-    auto SaveData = [&](auto *hnsw_index) { hnsw_index->Save(*file_handler_); };
-    switch (GetType()) {
-        case kElemFloat: {
-            switch (index_hnsw->encode_type_) {
-                case HnswEncodeType::kPlain: {
-                    switch (index_hnsw->metric_type_) {
-                        case MetricType::kMerticInnerProduct: {
-                            using Hnsw = KnnHnsw<f32, u64, PlainStore<f32>, PlainIPDist<f32>>;
-                            SaveData(static_cast<Hnsw *>(data_));
-                            break;
-                        }
-                        case MetricType::kMerticL2: {
-                            using Hnsw = KnnHnsw<f32, u64, PlainStore<f32>, PlainL2Dist<f32>>;
-                            SaveData(static_cast<Hnsw *>(data_));
-                            break;
-                        }
-                        default: {
-                            Error<StorageException>("Bug.");
-                        }
-                    }
-                    break;
-                }
-                case HnswEncodeType::kLVQ: {
-                    switch (index_hnsw->metric_type_) {
-                        case MetricType::kMerticInnerProduct: {
-                            using Hnsw = KnnHnsw<f32, u64, LVQStore<f32, i8, LVQIPCache<f32, i8>>, LVQIPDist<f32, i8>>;
-                            SaveData(static_cast<Hnsw *>(data_));
-                            break;
-                        }
-                        case MetricType::kMerticL2: {
-                            using Hnsw = KnnHnsw<f32, u64, LVQStore<f32, i8, LVQL2Cache<f32, i8>>, LVQL2Dist<f32, i8>>;
-                            SaveData(static_cast<Hnsw *>(data_));
-                            break;
-                        }
-                        default: {
-                            Error<StorageException>("Bug.");
-                        }
-                    }
-                    break;
-                }
-                default: {
-                    Error<StorageException>("Bug.");
-                }
-            }
-            break;
-        }
-        default: {
-            Error<StorageException>("Index should be created on float embedding column now.");
+    DispatchHnsw(index_hnsw, GetType(), [&]<typename Hnsw>() {
+        auto *hnsw_index = static_cast<Hnsw *>(data_);
+        // the file is written in place while the searches may still read the index, so the writer of the index has copied it out
+        // of the file under the exclusive lock before the buffer became dirty
+        if (hnsw_index->IsMapped()) {
+            Error<StorageException>("WriteToFileImpl: Hnsw index is still mapped from the file.");
         }
-    }
+        hnsw_index->Save(*file_handler_);
+    });
     prepare_success = true;
 }
 
 void HnswFileWorker::ReadFromFileImpl() {
     // TODO!! not save index parameter in index file.
+    // the index is mapped from the file, the vectors and the graph are read on demand.
     const IndexHnsw *index_hnsw = static_cast<const IndexHnsw *>(index_base_);
-    auto LoadData = [&](auto *hnsw_index) { data_ = static_cast<void *>(hnsw_index); };
-    switch (GetType()) {
-        case kElemFloat: {
-            switch (index_hnsw->encode_type_) {
-                case HnswEncodeType::kPlain: {
-                    switch (index_hnsw->metric_type_) {
-                        case MetricType::kMerticInnerProduct: {
-                            using Hnsw = KnnHnsw<f32, u64, PlainStore<f32>, PlainIPDist<f32>>;
-                            LoadData(Hnsw::Load(*file_handler_, {}).release());
-                            break;
-                        }
-                        case MetricType::kMerticL2: {
-                            using Hnsw = KnnHnsw<f32, u64, PlainStore<f32>, PlainL2Dist<f32>>;
-                            LoadData(Hnsw::Load(*file_handler_, {}).release());
-                            break;
-                        }
-                        default: {
-                            Error<StorageException>("Bug.");
-                        }
-                    }
-                    break;
-                }
-                case HnswEncodeType::kLVQ: {
-                    switch (index_hnsw->metric_type_) {
-                        case MetricType::kMerticInnerProduct: {
-                            using Hnsw = KnnHnsw<f32, u64, LVQStore<f32, i8, LVQIPCache<f32, i8>>, LVQIPDist<f32, i8>>;
-                            LoadData(Hnsw::Load(*file_handler_, {}).release());
-                            break;
-                        }
-                        case MetricType::kMerticL2: {
-                            using Hnsw = KnnHnsw<f32, u64, LVQStore<f32, i8, LVQL2Cache<f32, i8>>, LVQL2Dist<f32, i8>>;
-                            LoadData(Hnsw::Load(*file_handler_, {}).release());
-                            break;
-                        }
-                        default: {
-                            Error<StorageException>("Bug.");
-                        }
-                    }
-                    break;
-                }
-                default: {
-                    Error<StorageException>("Bug.");
-                }
-            }
-            break;
-        }
-        default: {
-            Error<StorageException>("Index should be created on float embedding column now.");
-        }
-    }
+    DispatchHnsw(index_hnsw, GetType(), [&]<typename Hnsw>() {
+        data_ = static_cast<void *>(Hnsw::Load(MakeUnique<MmapFile>(*file_handler_), {}).release());
+    });
 }
 
 EmbeddingDataType HnswFileWorker::GetType() const {
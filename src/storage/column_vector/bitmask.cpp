@@ -14,6 +14,8 @@
 
 module;
 
+#include "storage/knnindex/knn_hnsw/header.h"
+#include <bit>
 #include <sstream>
 import bitmask_buffer;
 import global_resource_usage;
@@ -23,11 +25,40 @@ import serialize;
 import stl;
 import parser;
 import serialize;
+import hnsw_simd_func;
 
 module bitmask;
 
 namespace infinity {
 
+// the loop over the units is compiled for avx2 as well, and the variant is chosen at run time
+
+void AndUnitsBF(u64 *dst, const u64 *src, SizeT unit_n) {
+    for (SizeT i = 0; i < unit_n; ++i) {
+        dst[i] &= src[i];
+    }
+}
+
+#if defined(USE_AVX)
+AVX2_TARGET void AndUnitsAVX2(u64 *dst, const u64 *src, SizeT unit_n) {
+    for (SizeT i = 0; i < unit_n; ++i) {
+        dst[i] &= src[i];
+    }
+}
+#endif
+
+void AndUnits(u64 *dst, const u64 *src, SizeT unit_n) {
+    static const auto func = [] {
+#if defined(USE_AVX)
+        if (SupportAVX2()) {
+            return AndUnitsAVX2;
+        }
+#endif
+        return AndUnitsBF;
+    }();
+    func(dst, src, unit_n);
+}
+
 Bitmask::Bitmask() : data_ptr_(nullptr), buffer_ptr(nullptr), count_(0) { GlobalResourceUsage::IncrObjectCount(); }
 
 Bitmask::~Bitmask() {
@@ -193,23 +224,11 @@ SizeT Bitmask::CountTrue() const {
     if (data_ptr_ == nullptr)
         return count_;
 
+    // popcnt is in the baseline of x86-64-v2
     SizeT u64_count = BitmaskBuffer::UnitCount(count_);
-
     SizeT count_true = 0;
     for (SizeT i = 0; i < u64_count; ++i) {
-
-        if (data_ptr_[i] == BitmaskBuffer::UNIT_MAX) {
-            // All bits of u64 variable are 1.
-            count_true += BitmaskBuffer::UNIT_BITS;
-        } else {
-            u64 elem = data_ptr_[i];
-
-            // Count 1 of an u64 variable.
-            while (elem) {
-                elem &= (elem - 1);
-                ++count_true;
-            }
-        }
+        count_true += std::popcount(data_ptr_[i]);
     }
     return count_true;
 }
@@ -233,10 +252,7 @@ void Bitmask::Merge(const Bitmask &other) {
         Error<TypeException>("Attempt to merge two bitmasks with different size.");
     }
 
-    SizeT u64_count = BitmaskBuffer::UnitCount(count_);
-    for (SizeT i = 0; i < u64_count; ++i) {
-        data_ptr_[i] &= other.data_ptr_[i];
-    }
+    AndUnits(data_ptr_, other.data_ptr_, BitmaskBuffer::UnitCount(count_));
 }
 
 bool Bitmask::operator==(const Bitmask &other) const {
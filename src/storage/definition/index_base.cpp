@@ -21,6 +21,9 @@ module;
 import stl;
 import serialize;
 import index_ivfflat;
+import index_ivfpq;
+import index_ivfsq8;
+import index_diskann;
 import index_hnsw;
 import index_full_text;
 import third_party;
@@ -39,6 +42,12 @@ String MetricTypeToString(MetricType metric_type) {
         case MetricType::kMerticL2: {
             return "l2";
         }
+        case MetricType::kMerticHamming: {
+            return "hamming";
+        }
+        case MetricType::kMerticCosine: {
+            return "cosine";
+        }
         case MetricType::kInvalid: {
             return "Invalid";
         }
@@ -50,6 +59,10 @@ MetricType StringToMetricType(const String &str) {
         return MetricType::kMerticInnerProduct;
     } else if (str == "l2") {
         return MetricType::kMerticL2;
+    } else if (str == "hamming") {
+        return MetricType::kMerticHamming;
+    } else if (str == "cosine") {
+        return MetricType::kMerticCosine;
     } else {
         return MetricType::kInvalid;
     }
@@ -102,7 +115,31 @@ SharedPtr<IndexBase> IndexBase::ReadAdv(char *&ptr, int32_t maxbytes) {
         case IndexType::kIVFFlat: {
             size_t centroids_count = ReadBufAdv<size_t>(ptr);
             MetricType metric_type = ReadBufAdv<MetricType>(ptr);
-            res = MakeShared<IndexIVFFlat>(file_name, column_names, centroids_count, metric_type);
+            SizeT mini_batch_size = ReadBufAdv<SizeT>(ptr);
+            res = MakeShared<IndexIVFFlat>(file_name, column_names, centroids_count, metric_type, mini_batch_size);
+            break;
+        }
+        case IndexType::kIVFPQ: {
+            size_t centroids_count = ReadBufAdv<size_t>(ptr);
+            size_t subspace_num = ReadBufAdv<size_t>(ptr);
+            MetricType metric_type = ReadBufAdv<MetricType>(ptr);
+            SizeT mini_batch_size = ReadBufAdv<SizeT>(ptr);
+            res = MakeShared<IndexIVFPQ>(file_name, column_names, centroids_count, subspace_num, metric_type, mini_batch_size);
+            break;
+        }
+        case IndexType::kIVFSQ8: {
+            size_t centroids_count = ReadBufAdv<size_t>(ptr);
+            MetricType metric_type = ReadBufAdv<MetricType>(ptr);
+            SizeT mini_batch_size = ReadBufAdv<SizeT>(ptr);
+            res = MakeShared<IndexIVFSQ8>(file_name, column_names, centroids_count, metric_type, mini_batch_size);
+            break;
+        }
+        case IndexType::kDiskAnn: {
+            MetricType metric_type = ReadBufAdv<MetricType>(ptr);
+            size_t R = ReadBufAdv<size_t>(ptr);
+            size_t L = ReadBufAdv<size_t>(ptr);
+            size_t subspace_num = ReadBufAdv<size_t>(ptr);
+            res = MakeShared<IndexDiskAnn>(file_name, column_names, metric_type, R, L, subspace_num);
             break;
         }
         case IndexType::kHnsw: {
@@ -111,7 +148,8 @@ SharedPtr<IndexBase> IndexBase::ReadAdv(char *&ptr, int32_t maxbytes) {
             SizeT M = ReadBufAdv<SizeT>(ptr);
             SizeT ef_construction = ReadBufAdv<SizeT>(ptr);
             SizeT ef = ReadBufAdv<SizeT>(ptr);
-            res = MakeShared<IndexHnsw>(file_name, column_names, metric_type, encode_type, M, ef_construction, ef);
+            bool reorder = ReadBufAdv<bool>(ptr);
+            res = MakeShared<IndexHnsw>(file_name, column_names, metric_type, encode_type, M, ef_construction, ef, reorder);
             break;
         }
         case IndexType::kIRSFullText: {
@@ -163,7 +201,37 @@ SharedPtr<IndexBase> IndexBase::Deserialize(const Json &index_def_json) {
         case IndexType::kIVFFlat: {
             size_t centroids_count = index_def_json["centroids_count"];
             MetricType metric_type = StringToMetricType(index_def_json["metric_type"]);
-            auto ptr = MakeShared<IndexIVFFlat>(file_name, Move(column_names), centroids_count, metric_type);
+            // the catalogs written before the option train the centroids with lloyd iterations
+            SizeT mini_batch_size = index_def_json.contains("mini_batch_size") ? index_def_json["mini_batch_size"].get<SizeT>() : 0;
+            auto ptr = MakeShared<IndexIVFFlat>(file_name, Move(column_names), centroids_count, metric_type, mini_batch_size);
+            res = std::static_pointer_cast<IndexBase>(ptr);
+            break;
+        }
+        case IndexType::kIVFPQ: {
+            size_t centroids_count = index_def_json["centroids_count"];
+            size_t subspace_num = index_def_json["subspace_num"];
+            MetricType metric_type = StringToMetricType(index_def_json["metric_type"]);
+            // the catalogs written before the option train the centroids with lloyd iterations
+            SizeT mini_batch_size = index_def_json.contains("mini_batch_size") ? index_def_json["mini_batch_size"].get<SizeT>() : 0;
+            auto ptr = MakeShared<IndexIVFPQ>(file_name, Move(column_names), centroids_count, subspace_num, metric_type, mini_batch_size);
+            res = std::static_pointer_cast<IndexBase>(ptr);
+            break;
+        }
+        case IndexType::kIVFSQ8: {
+            size_t centroids_count = index_def_json["centroids_count"];
+            MetricType metric_type = StringToMetricType(index_def_json["metric_type"]);
+            // the catalogs written before the option train the centroids with lloyd iterations
+            SizeT mini_batch_size = index_def_json.contains("mini_batch_size") ? index_def_json["mini_batch_size"].get<SizeT>() : 0;
+            auto ptr = MakeShared<IndexIVFSQ8>(file_name, Move(column_names), centroids_count, metric_type, mini_batch_size);
+            res = std::static_pointer_cast<IndexBase>(ptr);
+            break;
+        }
+        case IndexType::kDiskAnn: {
+            MetricType metric_type = StringToMetricType(index_def_json["metric_type"]);
+            size_t R = index_def_json["R"];
+            size_t L = index_def_json["L"];
+            size_t subspace_num = index_def_json["subspace_num"];
+            auto ptr = MakeShared<IndexDiskAnn>(file_name, Move(column_names), metric_type, R, L, subspace_num);
             res = std::static_pointer_cast<IndexBase>(ptr);
             break;
         }
@@ -173,7 +241,9 @@ SharedPtr<IndexBase> IndexBase::Deserialize(const Json &index_def_json) {
             SizeT ef = index_def_json["ef"];
             MetricType metric_type = StringToMetricType(index_def_json["metric_type"]);
             HnswEncodeType encode_type = StringToHnswEncodeType(index_def_json["encode_type"]);
-            auto ptr = MakeShared<IndexHnsw>(file_name, Move(column_names), metric_type, encode_type, M, ef_construction, ef);
+            // the catalogs written before the option have no reordering
+            bool reorder = index_def_json.contains("reorder") && index_def_json["reorder"].get<bool>();
+            auto ptr = MakeShared<IndexHnsw>(file_name, Move(column_names), metric_type, encode_type, M, ef_construction, ef, reorder);
             res = std::static_pointer_cast<IndexBase>(ptr);
             break;
         }
@@ -26,6 +26,8 @@ namespace infinity {
 export enum class MetricType {
     kMerticInnerProduct,
     kMerticL2,
+    kMerticHamming,
+    kMerticCosine, // the vectors are normalized, and compared by inner product
     kInvalid,
 };
 
@@ -0,0 +1,111 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <memory>
+#include <string>
+#include <vector>
+
+import stl;
+import index_def;
+import parser;
+import third_party;
+import serialize;
+import index_base;
+import default_values;
+
+import infinity_exception;
+
+module index_diskann;
+
+namespace infinity {
+
+SharedPtr<IndexBase> IndexDiskAnn::Make(String file_name, Vector<String> column_names, const Vector<InitParameter *> &index_param_list) {
+    MetricType metric_type = MetricType::kInvalid;
+    SizeT R = DISKANN_R;
+    SizeT L = DISKANN_L;
+    SizeT subspace_num = 0;
+    for (auto para : index_param_list) {
+        if (para->param_name_ == "metric") {
+            metric_type = StringToMetricType(para->param_value_);
+        } else if (para->param_name_ == "R") {
+            R = std::stoi(para->param_value_);
+        } else if (para->param_name_ == "L") {
+            L = std::stoi(para->param_value_);
+        } else if (para->param_name_ == "subspace_num") {
+            subspace_num = std::stoi(para->param_value_);
+        }
+    }
+    if (metric_type != MetricType::kMerticL2 && metric_type != MetricType::kMerticInnerProduct) {
+        Error<StorageException>("DiskAnn supports metric l2 and ip");
+    }
+    if (R == 0 || L == 0) {
+        Error<StorageException>("R and L of DiskAnn must be positive");
+    }
+    return MakeShared<IndexDiskAnn>(Move(file_name), Move(column_names), metric_type, R, L, subspace_num);
+}
+
+bool IndexDiskAnn::operator==(const IndexDiskAnn &other) const {
+    if (this->index_type_ != other.index_type_ || this->file_name_ != other.file_name_ || this->column_names_ != other.column_names_) {
+        return false;
+    }
+    return metric_type_ == other.metric_type_ && R_ == other.R_ && L_ == other.L_ && subspace_num_ == other.subspace_num_;
+}
+
+bool IndexDiskAnn::operator!=(const IndexDiskAnn &other) const { return !(*this == other); }
+
+i32 IndexDiskAnn::GetSizeInBytes() const {
+    SizeT size = IndexBase::GetSizeInBytes();
+    size += sizeof(metric_type_);
+    size += sizeof(R_);
+    size += sizeof(L_);
+    size += sizeof(subspace_num_);
+    return size;
+}
+
+void IndexDiskAnn::WriteAdv(char *&ptr) const {
+    IndexBase::WriteAdv(ptr);
+    WriteBufAdv(ptr, metric_type_);
+    WriteBufAdv(ptr, R_);
+    WriteBufAdv(ptr, L_);
+    WriteBufAdv(ptr, subspace_num_);
+}
+
+SharedPtr<IndexBase> IndexDiskAnn::ReadAdv(char *&, int32_t) {
+    Error<StorageException>("Not implemented");
+    return nullptr;
+}
+
+String IndexDiskAnn::ToString() const {
+    std::stringstream ss;
+    ss << IndexBase::ToString() << ", " << MetricTypeToString(metric_type_) << ", " << R_ << ", " << L_ << ", " << subspace_num_;
+    return ss.str();
+}
+
+Json IndexDiskAnn::Serialize() const {
+    Json res = IndexBase::Serialize();
+    res["metric_type"] = MetricTypeToString(metric_type_);
+    res["R"] = R_;
+    res["L"] = L_;
+    res["subspace_num"] = subspace_num_;
+    return res;
+}
+
+SharedPtr<IndexDiskAnn> IndexDiskAnn::Deserialize(const Json &) {
+    Error<StorageException>("Not implemented");
+    return nullptr;
+}
+
+} // namespace infinity
@@ -0,0 +1,66 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+import stl;
+import index_def;
+import parser;
+import index_base;
+import third_party;
+
+export module index_diskann;
+
+namespace infinity {
+// a vamana graph on the local disk with the product quantization codes of the vectors in memory
+export class IndexDiskAnn final : public IndexBase {
+public:
+    static SharedPtr<IndexBase> Make(String file_name, Vector<String> column_names, const Vector<InitParameter *> &index_param_list);
+
+    IndexDiskAnn(String file_name, Vector<String> column_names, MetricType metric_type, SizeT R, SizeT L, SizeT subspace_num)
+        : IndexBase(file_name, IndexType::kDiskAnn, Move(column_names)), metric_type_(metric_type), R_(R), L_(L), subspace_num_(subspace_num) {}
+
+    ~IndexDiskAnn() final = default;
+
+    bool operator==(const IndexDiskAnn &other) const;
+
+    bool operator!=(const IndexDiskAnn &other) const;
+
+public:
+    virtual i32 GetSizeInBytes() const override;
+
+    virtual void WriteAdv(char *&ptr) const override;
+
+    static SharedPtr<IndexBase> ReadAdv(char *&ptr, i32 maxbytes);
+
+    virtual String ToString() const override;
+
+    virtual Json Serialize() const override;
+
+    static SharedPtr<IndexDiskAnn> Deserialize(const Json &index_def_json);
+
+public:
+    const MetricType metric_type_{MetricType::kInvalid};
+
+    // the max degree of a vertex
+    const SizeT R_{};
+
+    // the size of the candidate list to search the neighbors of a vertex when the graph is built
+    const SizeT L_{};
+
+    // 0 means `ProductQuantizer::DefaultSubspaceNum` of the dimension
+    const SizeT subspace_num_{};
+};
+
+} // namespace infinity
@@ -36,6 +36,16 @@ HnswEncodeType StringToHnswEncodeType(const String &str) {
         return HnswEncodeType::kPlain;
     } else if (str == "lvq") {
         return HnswEncodeType::kLVQ;
+    } else if (str == "lvq4") {
+        return HnswEncodeType::kLVQ4;
+    } else if (str == "lvq4x8") {
+        return HnswEncodeType::kLVQ4x8;
+    } else if (str == "pq") {
+        return HnswEncodeType::kPQ;
+    } else if (str == "fp16") {
+        return HnswEncodeType::kFP16;
+    } else if (str == "bf16") {
+        return HnswEncodeType::kBF16;
     } else {
         return HnswEncodeType::kInvalid;
     }
@@ -47,6 +57,16 @@ String HnswEncodeTypeToString(HnswEncodeType encode_type) {
             return "plain";
         case HnswEncodeType::kLVQ:
             return "lvq";
+        case HnswEncodeType::kLVQ4:
+            return "lvq4";
+        case HnswEncodeType::kLVQ4x8:
+            return "lvq4x8";
+        case HnswEncodeType::kPQ:
+            return "pq";
+        case HnswEncodeType::kFP16:
+            return "fp16";
+        case HnswEncodeType::kBF16:
+            return "bf16";
         default:
             return "invalid";
     }
@@ -58,6 +78,7 @@ SharedPtr<IndexBase> IndexHnsw::Make(String file_name, Vector<String> column_nam
     SizeT ef = HNSW_EF;
     MetricType metric_type = MetricType::kInvalid;
     HnswEncodeType encode_type = HnswEncodeType::kPlain;
+    bool reorder = false;
     for (auto para : index_param_list) {
         if (para->param_name_ == "M") {
             M = std::stoi(para->param_value_);
@@ -69,6 +90,12 @@ SharedPtr<IndexBase> IndexHnsw::Make(String file_name, Vector<String> column_nam
             metric_type = StringToMetricType(para->param_value_);
         } else if (para->param_name_ == "encode") {
             encode_type = StringToHnswEncodeType(para->param_value_);
+        } else if (para->param_name_ == "reorder") {
+            if (para->param_value_ == "true") {
+                reorder = true;
+            } else if (para->param_value_ != "false") {
+                Error<StorageException>("Invalid index parameter");
+            }
         } else {
             Error<StorageException>("Invalid index parameter");
         }
@@ -76,7 +103,7 @@ SharedPtr<IndexBase> IndexHnsw::Make(String file_name, Vector<String> column_nam
     if (metric_type == MetricType::kInvalid || encode_type == HnswEncodeType::kInvalid) {
         Error<StorageException>("Lack index parameters");
     }
-    return MakeShared<IndexHnsw>(file_name, Move(column_names), metric_type, encode_type, M, ef_construction, ef);
+    return MakeShared<IndexHnsw>(file_name, Move(column_names), metric_type, encode_type, M, ef_construction, ef, reorder);
 }
 
 bool IndexHnsw::operator==(const IndexHnsw &other) const {
@@ -84,7 +111,7 @@ bool IndexHnsw::operator==(const IndexHnsw &other) const {
         return false;
     }
     return metric_type_ == other.metric_type_ && encode_type_ == other.encode_type_ && M_ == other.M_ && ef_construction_ == other.ef_construction_ &&
-           ef_ == other.ef_;
+           ef_ == other.ef_ && reorder_ == other.reorder_;
 }
 
 bool IndexHnsw::operator!=(const IndexHnsw &other) const { return !(*this == other); }
@@ -96,6 +123,7 @@ i32 IndexHnsw::GetSizeInBytes() const {
     size += sizeof(M_);
     size += sizeof(ef_construction_);
     size += sizeof(ef_);
+    size += sizeof(reorder_);
     return size;
 }
 
@@ -106,6 +134,7 @@ void IndexHnsw::WriteAdv(char *&ptr) const {
     WriteBufAdv(ptr, M_);
     WriteBufAdv(ptr, ef_construction_);
     WriteBufAdv(ptr, ef_);
+    WriteBufAdv(ptr, reorder_);
 }
 
 String IndexHnsw::ToString() const {
@@ -121,6 +150,7 @@ Json IndexHnsw::Serialize() const {
     res["M"] = M_;
     res["ef_construction"] = ef_construction_;
     res["ef"] = ef_;
+    res["reorder"] = reorder_;
     return res;
 }
 
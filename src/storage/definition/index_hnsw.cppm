@@ -27,6 +27,11 @@ namespace infinity {
 export enum class HnswEncodeType {
     kPlain,
     kLVQ,
+    kLVQ4,
+    kLVQ4x8,
+    kPQ,
+    kFP16,
+    kBF16,
     kInvalid,
 };
 
@@ -44,9 +49,10 @@ public:
               HnswEncodeType encode_type,
               SizeT M,
               SizeT ef_construction,
-              SizeT ef)
+              SizeT ef,
+              bool reorder = false)
         : IndexBase(file_name, IndexType::kHnsw, Move(column_names)), metric_type_(metric_type), encode_type_(encode_type), M_(M),
-          ef_construction_(ef_construction), ef_(ef) {}
+          ef_construction_(ef_construction), ef_(ef), reorder_(reorder) {}
 
     ~IndexHnsw() final = default;
 
@@ -69,6 +75,8 @@ public:
     const SizeT M_{};
     const SizeT ef_construction_{};
     const SizeT ef_{};
+    // renumber the vertices of level 0 for the locality of the search after the index of a segment is built
+    const bool reorder_{};
 };
 
 } // namespace infinity
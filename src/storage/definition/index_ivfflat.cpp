@@ -34,24 +34,27 @@ namespace infinity {
 SharedPtr<IndexBase> IndexIVFFlat::Make(String file_name, Vector<String> column_names, const Vector<InitParameter *> &index_param_list) {
     SizeT centroids_count = 0;
     MetricType metric_type = MetricType::kInvalid;
+    SizeT mini_batch_size = 0;
     for (auto para : index_param_list) {
         if (para->param_name_ == "centroids_count") {
             centroids_count = std::stoi(para->param_value_);
         } else if (para->param_name_ == "metric") {
             metric_type = StringToMetricType(para->param_value_);
+        } else if (para->param_name_ == "mini_batch_size") {
+            mini_batch_size = std::stoi(para->param_value_);
         }
     }
     if (metric_type == MetricType::kInvalid) {
         Error<StorageException>("Lack index parameter metric_type");
     }
-    return MakeShared<IndexIVFFlat>(Move(file_name), Move(column_names), centroids_count, metric_type);
+    return MakeShared<IndexIVFFlat>(Move(file_name), Move(column_names), centroids_count, metric_type, mini_batch_size);
 }
 
 bool IndexIVFFlat::operator==(const IndexIVFFlat &other) const {
     if (this->index_type_ != other.index_type_ || this->file_name_ != other.file_name_ || this->column_names_ != other.column_names_) {
         return false;
     }
-    return centroids_count_ == other.centroids_count_ && metric_type_ == other.metric_type_;
+    return centroids_count_ == other.centroids_count_ && metric_type_ == other.metric_type_ && mini_batch_size_ == other.mini_batch_size_;
 }
 
 bool IndexIVFFlat::operator!=(const IndexIVFFlat &other) const { return !(*this == other); }
@@ -60,6 +63,7 @@ i32 IndexIVFFlat::GetSizeInBytes() const {
     SizeT size = IndexBase::GetSizeInBytes();
     size += sizeof(centroids_count_);
     size += sizeof(metric_type_);
+    size += sizeof(mini_batch_size_);
     return size;
 }
 
@@ -67,6 +71,7 @@ void IndexIVFFlat::WriteAdv(char *&ptr) const {
     IndexBase::WriteAdv(ptr);
     WriteBufAdv(ptr, centroids_count_);
     WriteBufAdv(ptr, metric_type_);
+    WriteBufAdv(ptr, mini_batch_size_);
 }
 
 SharedPtr<IndexBase> IndexIVFFlat::ReadAdv(char *&, int32_t) {
@@ -84,6 +89,7 @@ Json IndexIVFFlat::Serialize() const {
     Json res = IndexBase::Serialize();
     res["centroids_count"] = centroids_count_;
     res["metric_type"] = MetricTypeToString(metric_type_);
+    res["mini_batch_size"] = mini_batch_size_;
     return res;
 }
 
@@ -27,8 +27,9 @@ export class IndexIVFFlat final : public IndexBase {
 public:
     static SharedPtr<IndexBase> Make(String file_name, Vector<String> column_names, const Vector<InitParameter *> &index_param_list);
 
-    IndexIVFFlat(String file_name, Vector<String> column_names, SizeT centroids_count, MetricType metric_type)
-        : IndexBase(file_name, IndexType::kIVFFlat, Move(column_names)), centroids_count_(centroids_count), metric_type_(metric_type) {}
+    IndexIVFFlat(String file_name, Vector<String> column_names, SizeT centroids_count, MetricType metric_type, SizeT mini_batch_size = 0)
+        : IndexBase(file_name, IndexType::kIVFFlat, Move(column_names)), centroids_count_(centroids_count), metric_type_(metric_type),
+          mini_batch_size_(mini_batch_size) {}
 
     ~IndexIVFFlat() final = default;
 
@@ -53,6 +54,9 @@ public:
     const SizeT centroids_count_{};
 
     const MetricType metric_type_{MetricType::kInvalid};
+
+    // the batch size of mini-batch k-means to train the centroids, 0 for lloyd iterations
+    const SizeT mini_batch_size_{};
 };
 
 } // namespace infinity
\ No newline at end of file
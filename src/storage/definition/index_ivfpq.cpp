@@ -0,0 +1,108 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <memory>
+#include <string>
+#include <vector>
+
+import stl;
+import index_def;
+import parser;
+import third_party;
+import serialize;
+import index_base;
+
+import infinity_exception;
+
+module index_ivfpq;
+
+namespace infinity {
+
+SharedPtr<IndexBase> IndexIVFPQ::Make(String file_name, Vector<String> column_names, const Vector<InitParameter *> &index_param_list) {
+    SizeT centroids_count = 0;
+    SizeT subspace_num = 0;
+    MetricType metric_type = MetricType::kInvalid;
+    SizeT mini_batch_size = 0;
+    for (auto para : index_param_list) {
+        if (para->param_name_ == "centroids_count") {
+            centroids_count = std::stoi(para->param_value_);
+        } else if (para->param_name_ == "subspace_num") {
+            subspace_num = std::stoi(para->param_value_);
+        } else if (para->param_name_ == "metric") {
+            metric_type = StringToMetricType(para->param_value_);
+        } else if (para->param_name_ == "mini_batch_size") {
+            mini_batch_size = std::stoi(para->param_value_);
+        }
+    }
+    if (metric_type == MetricType::kInvalid) {
+        Error<StorageException>("Lack index parameter metric_type");
+    }
+    return MakeShared<IndexIVFPQ>(Move(file_name), Move(column_names), centroids_count, subspace_num, metric_type, mini_batch_size);
+}
+
+bool IndexIVFPQ::operator==(const IndexIVFPQ &other) const {
+    if (this->index_type_ != other.index_type_ || this->file_name_ != other.file_name_ || this->column_names_ != other.column_names_) {
+        return false;
+    }
+    return centroids_count_ == other.centroids_count_ && subspace_num_ == other.subspace_num_ && metric_type_ == other.metric_type_ &&
+           mini_batch_size_ == other.mini_batch_size_;
+}
+
+bool IndexIVFPQ::operator!=(const IndexIVFPQ &other) const { return !(*this == other); }
+
+i32 IndexIVFPQ::GetSizeInBytes() const {
+    SizeT size = IndexBase::GetSizeInBytes();
+    size += sizeof(centroids_count_);
+    size += sizeof(subspace_num_);
+    size += sizeof(metric_type_);
+    size += sizeof(mini_batch_size_);
+    return size;
+}
+
+void IndexIVFPQ::WriteAdv(char *&ptr) const {
+    IndexBase::WriteAdv(ptr);
+    WriteBufAdv(ptr, centroids_count_);
+    WriteBufAdv(ptr, subspace_num_);
+    WriteBufAdv(ptr, metric_type_);
+    WriteBufAdv(ptr, mini_batch_size_);
+}
+
+SharedPtr<IndexBase> IndexIVFPQ::ReadAdv(char *&, int32_t) {
+    Error<StorageException>("Not implemented");
+    return nullptr;
+}
+
+String IndexIVFPQ::ToString() const {
+    std::stringstream ss;
+    ss << IndexBase::ToString() << ", " << centroids_count_ << ", " << subspace_num_ << ", " << MetricTypeToString(metric_type_);
+    return ss.str();
+}
+
+Json IndexIVFPQ::Serialize() const {
+    Json res = IndexBase::Serialize();
+    res["centroids_count"] = centroids_count_;
+    res["subspace_num"] = subspace_num_;
+    res["metric_type"] = MetricTypeToString(metric_type_);
+    res["mini_batch_size"] = mini_batch_size_;
+    return res;
+}
+
+SharedPtr<IndexIVFPQ> IndexIVFPQ::Deserialize(const Json &) {
+    Error<StorageException>("Not implemented");
+    return nullptr;
+}
+
+} // namespace infinity
\ No newline at end of file
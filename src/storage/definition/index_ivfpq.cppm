@@ -0,0 +1,71 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+import stl;
+import index_def;
+import parser;
+import index_base;
+import third_party;
+
+export module index_ivfpq;
+
+namespace infinity {
+// ivf partitions whose vectors are coded by a product quantizer in `subspace_num` bytes
+export class IndexIVFPQ final : public IndexBase {
+public:
+    static SharedPtr<IndexBase> Make(String file_name, Vector<String> column_names, const Vector<InitParameter *> &index_param_list);
+
+    IndexIVFPQ(String file_name,
+               Vector<String> column_names,
+               SizeT centroids_count,
+               SizeT subspace_num,
+               MetricType metric_type,
+               SizeT mini_batch_size = 0)
+        : IndexBase(file_name, IndexType::kIVFPQ, Move(column_names)), centroids_count_(centroids_count), subspace_num_(subspace_num),
+          metric_type_(metric_type), mini_batch_size_(mini_batch_size) {}
+
+    ~IndexIVFPQ() final = default;
+
+    bool operator==(const IndexIVFPQ &other) const;
+
+    bool operator!=(const IndexIVFPQ &other) const;
+
+public:
+    virtual i32 GetSizeInBytes() const override;
+
+    virtual void WriteAdv(char *&ptr) const override;
+
+    static SharedPtr<IndexBase> ReadAdv(char *&ptr, i32 maxbytes);
+
+    virtual String ToString() const override;
+
+    virtual Json Serialize() const override;
+
+    static SharedPtr<IndexIVFPQ> Deserialize(const Json &index_def_json);
+
+public:
+    const SizeT centroids_count_{};
+
+    // 0 means `ProductQuantizer::DefaultSubspaceNum` of the dimension
+    const SizeT subspace_num_{};
+
+    const MetricType metric_type_{MetricType::kInvalid};
+
+    // the batch size of mini-batch k-means to train the centroids, 0 for lloyd iterations
+    const SizeT mini_batch_size_{};
+};
+
+} // namespace infinity
\ No newline at end of file
@@ -19,6 +19,7 @@ module;
 #include <errno.h>
 #include <fcntl.h>
 #include <filesystem>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
 
@@ -44,6 +45,30 @@ LocalFileHandler::~LocalFileHandler() {
     }
 }
 
+MmapFile::MmapFile(FileHandler &file_handler) {
+    i32 fd = ((LocalFileHandler &)file_handler).fd_;
+    struct stat s {};
+    if (fstat(fd, &s) == -1) {
+        Error<StorageException>(Format("Can't get file size: {}: {}", file_handler.path_.string(), strerror(errno)));
+    }
+    size_ = s.st_size;
+    if (size_ == 0) {
+        return;
+    }
+    void *data = mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+        Error<StorageException>(Format("Can't mmap file: {}: {}", file_handler.path_.string(), strerror(errno)));
+    }
+    data_ = static_cast<char *>(data);
+}
+
+MmapFile::~MmapFile() {
+    if (data_ != nullptr) {
+        munmap(data_, size_);
+        data_ = nullptr;
+    }
+}
+
 UniquePtr<FileHandler> LocalFileSystem::OpenFile(const String &path, u8 flags, FileLockType lock_type) {
     i32 file_flags{O_RDWR};
     bool read_flag = flags & FileFlags::READ_FLAG;
@@ -140,6 +165,33 @@ void LocalFileSystem::Seek(FileHandler &file_handler, i64 pos) {
     }
 }
 
+i64 LocalFileSystem::ReadAt(FileHandler &file_handler, void *data, u64 nbytes, i64 offset) {
+    i32 fd = ((LocalFileHandler &)file_handler).fd_;
+    // pread may return fewer bytes than asked, the rest is read again
+    u64 read_count = 0;
+    while (read_count < nbytes) {
+        i64 count = pread(fd, static_cast<char *>(data) + read_count, nbytes - read_count, offset + read_count);
+        if (count == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            Error<StorageException>(Format("Can't read file: {}: {}", file_handler.path_.string(), strerror(errno)));
+        }
+        if (count == 0) {
+            Error<StorageException>(
+                Format("Can't read file: {}: {} bytes at {} are beyond the end", file_handler.path_.string(), nbytes, offset));
+        }
+        read_count += count;
+    }
+    return read_count;
+}
+
+void LocalFileSystem::Prefetch(FileHandler &file_handler, i64 offset, u64 nbytes) {
+    i32 fd = ((LocalFileHandler &)file_handler).fd_;
+    // only a hint, the read is done by `ReadAt` if it fails
+    posix_fadvise(fd, offset, nbytes, POSIX_FADV_WILLNEED);
+}
+
 SizeT LocalFileSystem::GetFileSize(FileHandler &file_handler) {
     i32 fd = ((LocalFileHandler &)file_handler).fd_;
     struct stat s {};
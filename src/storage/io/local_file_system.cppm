@@ -32,6 +32,25 @@ public:
     i32 fd_{-1};
 };
 
+// a file mapped privately. its pages are read from the page cache on access and can be dropped by the kernel at any time.
+// the writes to the mapped memory are copied on write, and are never written back to the file.
+export class MmapFile {
+public:
+    explicit MmapFile(FileHandler &file_handler);
+
+    MmapFile(const MmapFile &) = delete;
+
+    ~MmapFile();
+
+    char *data() const { return data_; }
+
+    SizeT size() const { return size_; }
+
+private:
+    char *data_{nullptr};
+    SizeT size_{0};
+};
+
 export class LocalFileSystem final : public FileSystem {
 public:
     LocalFileSystem() : FileSystem(FileSystemType::kPosix) {}
@@ -48,6 +67,13 @@ public:
 
     void Seek(FileHandler &file_handler, i64 pos) final;
 
+    // read `nbytes` at `offset` without moving the file position, so that a file can be read by many threads.
+    // throw if the file ends before `nbytes` are read.
+    i64 ReadAt(FileHandler &file_handler, void *data, u64 nbytes, i64 offset);
+
+    // ask the kernel to read the range into the page cache in background, the later `ReadAt` of the range won't wait for the disk
+    void Prefetch(FileHandler &file_handler, i64 offset, u64 nbytes);
+
     SizeT GetFileSize(FileHandler &file_handler) final;
 
     void DeleteFile(const String &file_name) final;
@@ -35,6 +35,7 @@ template <typename Compare, MetricType metric, KnnDistanceAlgoType algo>
 class AnnIVFFlat final : public KnnDistance<typename Compare::DistanceType> {
     using DistType = typename Compare::DistanceType;
     using ResultHandler = ReservoirResultHandler<Compare>;
+    using RangeHandler = RangeResultHandler<Compare>;
     static inline DistType Distance(const DistType *x, const DistType *y, u32 dimension) {
         if constexpr (metric == MetricType::kMerticL2) {
             return L2Distance<DistType>(x, y, dimension);
@@ -53,6 +54,12 @@ public:
         result_handler_ = MakeUnique<ResultHandler>(query_count, top_k, distance_array_.get(), id_array_.get());
     }
 
+    // keep all the vectors within `radius` of the queries in the probed partitions instead of the top k
+    explicit AnnIVFFlat(const DistType *queries, u64 query_count, u32 dimension, EmbeddingDataType elem_data_type, DistType radius)
+        : KnnDistance<DistType>(algo, elem_data_type, query_count, dimension, 0), queries_(queries) {
+        range_handler_ = MakeUnique<RangeHandler>(query_count, radius);
+    }
+
     static UniquePtr<AnnIVFFlatIndexData<DistType>> CreateIndex(u32 dimension, u32 vector_count, const DistType *vectors_ptr, u32 partition_num) {
         return AnnIVFFlat<Compare, metric, algo>::CreateIndex(dimension, vector_count, vectors_ptr, vector_count, vectors_ptr, partition_num);
     }
@@ -69,7 +76,11 @@ public:
         if (begin_ || this->query_count_ == 0) {
             return;
         }
-        result_handler_->Begin();
+        if (range_handler_.get() != nullptr) {
+            range_handler_->Begin();
+        } else {
+            result_handler_->Begin();
+        }
         begin_ = true;
     }
 
@@ -77,7 +88,11 @@ public:
         if (begin_ || this->query_count_ == 0) {
             return;
         }
-        result_handler_->ReInitialize();
+        if (range_handler_.get() != nullptr) {
+            range_handler_->ReInitialize();
+        } else {
+            result_handler_->ReInitialize();
+        }
         begin_ = true;
     }
 
@@ -108,12 +123,13 @@ public:
                                                assign_centroid_ids.get());
             for (u64 i = 0; i < this->query_count_; i++) {
                 u32 selected_centroid = assign_centroid_ids[i];
-                u32 contain_nums = base_ivf->ids_[selected_centroid].size();
+                u32 contain_nums = base_ivf->partition_size(selected_centroid);
                 const DistType *x_i = this->queries_ + i * this->dimension_;
-                const DistType *y_j = base_ivf->vectors_[selected_centroid].data();
+                const DistType *y_j = base_ivf->partition_vectors(selected_centroid);
+                const u32 *ids = base_ivf->partition_ids(selected_centroid);
                 for (u32 j = 0; j < contain_nums; j++, y_j += this->dimension_) {
                     DistType distance = Distance(x_i, y_j, this->dimension_);
-                    result_handler_->AddResult(i, distance, RowID(segment_id, base_ivf->ids_[selected_centroid][j]));
+                    AddResult(i, distance, RowID(segment_id, ids[j]));
                 }
             }
         } else {
@@ -132,11 +148,12 @@ public:
                 const DistType *x_i = queries_ + i * this->dimension_;
                 for (u32 k = 0; k < n_probes && centroid_dists[k + i * n_probes] != InvalidValue(); ++k) {
                     const u32 selected_centroid = centroid_ids[k + i * n_probes];
-                    const u32 contain_nums = base_ivf->ids_[selected_centroid].size();
-                    const DistType *y_j = base_ivf->vectors_[selected_centroid].data();
+                    const u32 contain_nums = base_ivf->partition_size(selected_centroid);
+                    const DistType *y_j = base_ivf->partition_vectors(selected_centroid);
+                    const u32 *ids = base_ivf->partition_ids(selected_centroid);
                     for (u32 j = 0; j < contain_nums; j++, y_j += this->dimension_) {
                         DistType distance = Distance(x_i, y_j, this->dimension_);
-                        result_handler_->AddResult(i, distance, RowID(segment_id, base_ivf->ids_[selected_centroid][j]));
+                        AddResult(i, distance, RowID(segment_id, ids[j]));
                     }
                 }
             }
@@ -170,14 +187,15 @@ public:
                                                assign_centroid_ids.get());
             for (u64 i = 0; i < this->query_count_; i++) {
                 u32 selected_centroid = assign_centroid_ids[i];
-                u32 contain_nums = base_ivf->ids_[selected_centroid].size();
+                u32 contain_nums = base_ivf->partition_size(selected_centroid);
                 const DistType *x_i = this->queries_ + i * this->dimension_;
-                const DistType *y_j = base_ivf->vectors_[selected_centroid].data();
+                const DistType *y_j = base_ivf->partition_vectors(selected_centroid);
+                const u32 *ids = base_ivf->partition_ids(selected_centroid);
                 for (u32 j = 0; j < contain_nums; j++, y_j += this->dimension_) {
-                    auto segment_offset = base_ivf->ids_[selected_centroid][j];
+                    auto segment_offset = ids[j];
                     if (bitmask.IsTrue(segment_offset)) {
                         DistType distance = Distance(x_i, y_j, this->dimension_);
-                        result_handler_->AddResult(i, distance, RowID(segment_id, segment_offset));
+                        AddResult(i, distance, RowID(segment_id, segment_offset));
                     }
                 }
             }
@@ -197,13 +215,14 @@ public:
                 const DistType *x_i = queries_ + i * this->dimension_;
                 for (u32 k = 0; k < n_probes && centroid_dists[k + i * n_probes] != InvalidValue(); ++k) {
                     const u32 selected_centroid = centroid_ids[k + i * n_probes];
-                    const u32 contain_nums = base_ivf->ids_[selected_centroid].size();
-                    const DistType *y_j = base_ivf->vectors_[selected_centroid].data();
+                    const u32 contain_nums = base_ivf->partition_size(selected_centroid);
+                    const DistType *y_j = base_ivf->partition_vectors(selected_centroid);
+                    const u32 *ids = base_ivf->partition_ids(selected_centroid);
                     for (u32 j = 0; j < contain_nums; j++, y_j += this->dimension_) {
-                        auto segment_offset = base_ivf->ids_[selected_centroid][j];
+                        auto segment_offset = ids[j];
                         if (bitmask.IsTrue(segment_offset)) {
                             DistType distance = Distance(x_i, y_j, this->dimension_);
-                            result_handler_->AddResult(i, distance, RowID(segment_id, segment_offset));
+                            AddResult(i, distance, RowID(segment_id, segment_offset));
                         }
                     }
                 }
@@ -215,7 +234,11 @@ public:
         if (!begin_) {
             return;
         }
-        result_handler_->End();
+        if (range_handler_.get() != nullptr) {
+            range_handler_->End();
+        } else {
+            result_handler_->End();
+        }
         begin_ = false;
     }
 
@@ -223,7 +246,11 @@ public:
         if (!begin_) {
             return;
         }
-        result_handler_->EndWithoutSort();
+        if (range_handler_.get() != nullptr) {
+            range_handler_->EndWithoutSort();
+        } else {
+            result_handler_->EndWithoutSort();
+        }
         begin_ = false;
     }
 
@@ -235,6 +262,9 @@ public:
         if (idx >= this->query_count_) {
             Error<ExecutorException>("Query index exceeds the limit");
         }
+        if (range_handler_.get() != nullptr) {
+            return range_handler_->GetDistances(idx);
+        }
         return distance_array_.get() + idx * this->top_k_;
     }
 
@@ -242,18 +272,38 @@ public:
         if (idx >= this->query_count_) {
             Error<ExecutorException>("Query index exceeds the limit");
         }
+        if (range_handler_.get() != nullptr) {
+            return range_handler_->GetIDs(idx);
+        }
         return id_array_.get() + idx * this->top_k_;
     }
 
+    // the result number of query `idx` after `End` or `EndWithoutSort`, the results of a query are at the front of its row
+    [[nodiscard]] inline SizeT GetResultCount(u64 idx) const {
+        if (range_handler_.get() != nullptr) {
+            return range_handler_->GetSize(idx);
+        }
+        return result_handler_->GetSize(idx);
+    }
+
     [[nodiscard]] static constexpr DistType InvalidValue() { return Compare::InitialValue(); }
 
     [[nodiscard]] static bool CompareDist(const DistType &a, const DistType &b) { return Compare::Compare(b, a); }
 
 private:
+    void AddResult(SizeT query_id, DistType distance, RowID row_id) {
+        if (range_handler_.get() != nullptr) {
+            range_handler_->AddResult(query_id, distance, row_id);
+        } else {
+            result_handler_->AddResult(query_id, distance, row_id);
+        }
+    }
+
     UniquePtr<RowID[]> id_array_{};
     UniquePtr<DistType[]> distance_array_{};
 
     UniquePtr<ResultHandler> result_handler_{};
+    UniquePtr<RangeHandler> range_handler_{};
 
     const DistType *queries_{};
     bool begin_{false};
@@ -0,0 +1,222 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+import stl;
+import knn_distance;
+import parser;
+import infinity_exception;
+import index_base;
+import annivfsq8_index_data;
+import hnsw_simd_func;
+import search_top_k;
+import knn_result_handler;
+import bitmask;
+
+export module ann_ivf_sq8;
+
+namespace infinity {
+
+// the query is compared with the 8-bit codes of the vectors without decoding them. for l2 the minimums of the dimensions
+// are subtracted from the query, for inner product the query is multiplied by the scales and the inner product of the
+// query and the minimums is added.
+template <typename Compare, MetricType metric, KnnDistanceAlgoType algo>
+class AnnIVFSQ8 final : public KnnDistance<typename Compare::DistanceType> {
+    using DistType = typename Compare::DistanceType;
+    using ResultHandler = ReservoirResultHandler<Compare>;
+    using RangeHandler = RangeResultHandler<Compare>;
+
+public:
+    explicit AnnIVFSQ8(const DistType *queries, u64 query_count, u32 top_k, u32 dimension, EmbeddingDataType elem_data_type)
+        : KnnDistance<DistType>(algo, elem_data_type, query_count, dimension, top_k), queries_(queries) {
+        id_array_ = MakeUniqueForOverwrite<RowID[]>(top_k * query_count);
+        distance_array_ = MakeUniqueForOverwrite<DistType[]>(top_k * query_count);
+        result_handler_ = MakeUnique<ResultHandler>(query_count, top_k, distance_array_.get(), id_array_.get());
+    }
+
+    // keep all the vectors within `radius` of the queries in the probed partitions instead of the top k
+    explicit AnnIVFSQ8(const DistType *queries, u64 query_count, u32 dimension, EmbeddingDataType elem_data_type, DistType radius)
+        : KnnDistance<DistType>(algo, elem_data_type, query_count, dimension, 0), queries_(queries) {
+        range_handler_ = MakeUnique<RangeHandler>(query_count, radius);
+    }
+
+    void Begin() final {
+        if (begin_ || this->query_count_ == 0) {
+            return;
+        }
+        if (range_handler_.get() != nullptr) {
+            range_handler_->Begin();
+        } else {
+            result_handler_->Begin();
+        }
+        begin_ = true;
+    }
+
+    void Search(const DistType *, u16, u32, u16) final { Error<ExecutorException>("Unsupported search function"); }
+
+    void Search(const DistType *, u16, u32, u16, Bitmask &) final { Error<ExecutorException>("Unsupported search function"); }
+
+    void Search(const AnnIVFSQ8IndexData<DistType> *base_ivf, u32 segment_id, u32 n_probes, const Bitmask &bitmask) {
+        if (base_ivf->metric_ != metric) {
+            Error<ExecutorException>("Metric type is invalid");
+        }
+        if (!begin_) {
+            Error<ExecutorException>("IVFSQ8 isn't begin");
+        }
+        n_probes = Min(n_probes, base_ivf->partition_num_);
+        if ((n_probes == 0) || (base_ivf->data_num_ == 0)) {
+            return;
+        }
+        this->total_base_count_ += base_ivf->data_num_;
+        auto centroid_ids = MakeUniqueForOverwrite<u32[]>(n_probes * this->query_count_);
+        if (n_probes == 1) {
+            search_top_1_without_dis<DistType>(this->dimension_,
+                                               this->query_count_,
+                                               queries_,
+                                               base_ivf->partition_num_,
+                                               base_ivf->centroids_.data(),
+                                               centroid_ids.get());
+        } else {
+            auto centroid_dists = MakeUniqueForOverwrite<DistType[]>(n_probes * this->query_count_);
+            search_top_k_with_dis(n_probes,
+                                  this->dimension_,
+                                  this->query_count_,
+                                  queries_,
+                                  base_ivf->partition_num_,
+                                  base_ivf->centroids_.data(),
+                                  centroid_ids.get(),
+                                  centroid_dists.get(),
+                                  false);
+        }
+        const u32 dimension = this->dimension_;
+        const bool use_bitmask = !bitmask.IsAllTrue();
+        Vector<f32> prepared_query(dimension);
+        for (u64 i = 0; i < this->query_count_; i++) {
+            const DistType *x_i = queries_ + i * dimension;
+            DistType base_distance = 0;
+            for (u32 j = 0; j < dimension; ++j) {
+                if constexpr (metric == MetricType::kMerticL2) {
+                    prepared_query[j] = x_i[j] - base_ivf->min_[j];
+                } else {
+                    prepared_query[j] = x_i[j] * base_ivf->scale_[j];
+                    base_distance += x_i[j] * base_ivf->min_[j];
+                }
+            }
+            for (u32 k = 0; k < n_probes; ++k) {
+                const u32 selected_centroid = centroid_ids[k + i * n_probes];
+                const auto &ids = base_ivf->ids_[selected_centroid];
+                const u8 *code = base_ivf->codes_[selected_centroid].data();
+                for (u32 j = 0; j < ids.size(); ++j, code += dimension) {
+                    if (use_bitmask && !bitmask.IsTrue(ids[j])) {
+                        continue;
+                    }
+                    DistType distance;
+                    if constexpr (metric == MetricType::kMerticL2) {
+                        distance = SQ8L2(prepared_query.data(), base_ivf->scale_.data(), code, dimension);
+                    } else {
+                        distance = base_distance + SQ8IP(prepared_query.data(), code, dimension);
+                    }
+                    AddResult(i, distance, RowID(segment_id, ids[j]));
+                }
+            }
+        }
+    }
+
+    void End() final {
+        if (!begin_) {
+            return;
+        }
+        if (range_handler_.get() != nullptr) {
+            range_handler_->End();
+        } else {
+            result_handler_->End();
+        }
+        begin_ = false;
+    }
+
+    void EndWithoutSort() {
+        if (!begin_) {
+            return;
+        }
+        if (range_handler_.get() != nullptr) {
+            range_handler_->EndWithoutSort();
+        } else {
+            result_handler_->EndWithoutSort();
+        }
+        begin_ = false;
+    }
+
+    [[nodiscard]] inline DistType *GetDistances() const final { return distance_array_.get(); }
+
+    [[nodiscard]] inline RowID *GetIDs() const final { return id_array_.get(); }
+
+    [[nodiscard]] inline DistType *GetDistanceByIdx(u64 idx) const final {
+        if (idx >= this->query_count_) {
+            Error<ExecutorException>("Query index exceeds the limit");
+        }
+        if (range_handler_.get() != nullptr) {
+            return range_handler_->GetDistances(idx);
+        }
+        return distance_array_.get() + idx * this->top_k_;
+    }
+
+    [[nodiscard]] inline RowID *GetIDByIdx(u64 idx) const final {
+        if (idx >= this->query_count_) {
+            Error<ExecutorException>("Query index exceeds the limit");
+        }
+        if (range_handler_.get() != nullptr) {
+            return range_handler_->GetIDs(idx);
+        }
+        return id_array_.get() + idx * this->top_k_;
+    }
+
+    // the result number of query `idx` after `End` or `EndWithoutSort`, the results of a query are at the front of its row
+    [[nodiscard]] inline SizeT GetResultCount(u64 idx) const {
+        if (range_handler_.get() != nullptr) {
+            return range_handler_->GetSize(idx);
+        }
+        return result_handler_->GetSize(idx);
+    }
+
+    [[nodiscard]] static constexpr DistType InvalidValue() { return Compare::InitialValue(); }
+
+    [[nodiscard]] static bool CompareDist(const DistType &a, const DistType &b) { return Compare::Compare(b, a); }
+
+private:
+    void AddResult(SizeT query_id, DistType distance, RowID row_id) {
+        if (range_handler_.get() != nullptr) {
+            range_handler_->AddResult(query_id, distance, row_id);
+        } else {
+            result_handler_->AddResult(query_id, distance, row_id);
+        }
+    }
+
+    UniquePtr<RowID[]> id_array_{};
+    UniquePtr<DistType[]> distance_array_{};
+
+    UniquePtr<ResultHandler> result_handler_{};
+    UniquePtr<RangeHandler> range_handler_{};
+
+    const DistType *queries_{};
+    bool begin_{false};
+};
+
+export template <typename DistType>
+using AnnIVFSQ8L2 = AnnIVFSQ8<CompareMax<DistType, RowID>, MetricType::kMerticL2, KnnDistanceAlgoType::kKnnFlatL2>;
+
+export template <typename DistType>
+using AnnIVFSQ8IP = AnnIVFSQ8<CompareMin<DistType, RowID>, MetricType::kMerticInnerProduct, KnnDistanceAlgoType::kKnnFlatIp>;
+
+} // namespace infinity
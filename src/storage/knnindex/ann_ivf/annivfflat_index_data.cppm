@@ -14,6 +14,9 @@
 
 module;
 
+#include <new>
+#include <numeric>
+
 import stl;
 import index_base;
 import file_system;
@@ -21,27 +24,53 @@ import file_system_type;
 import search_top_k;
 import kmeans_partition;
 import infinity_exception;
+import bitmask;
 
 export module annivfflat_index_data;
 
 namespace infinity {
 
+// the partitions of ivf are kept in one arena: the ids of all the partitions, then the vectors of all the partitions from a 64-byte
+// boundary. partition i owns the slots [partition_offsets_[i], partition_offsets_[i + 1]) of both, of which the first
+// `partition_sizes_[i]` are used, and its vectors begin at a 64-byte boundary, so that a probe streams through memory.
+// the file is the image of the arena after the offsets, so that it is written and read in one call.
 export template <typename CentroidsDataType, typename VectorDataType = CentroidsDataType>
 struct AnnIVFFlatIndexData {
+    static constexpr SizeT kArenaAlignment = 64;
+
     MetricType metric_{MetricType::kInvalid};
     u32 dimension_{};
     u32 partition_num_{};
     u32 data_num_{};
     Vector<CentroidsDataType> centroids_;
-    Vector<Vector<u32>> ids_;
-    Vector<Vector<VectorDataType>> vectors_;
+    Vector<u32> partition_offsets_;
+    Vector<u32> partition_sizes_;
+    char *arena_{};
+    SizeT arena_size_{};
+
     AnnIVFFlatIndexData(MetricType metric, u32 dimension, u32 partition_num)
-        : metric_(metric), dimension_(dimension), partition_num_(partition_num), centroids_(partition_num_ * dimension_), ids_(partition_num_),
-          vectors_(partition_num_) {}
+        : metric_(metric), dimension_(dimension), partition_num_(partition_num), centroids_(partition_num_ * dimension_),
+          partition_offsets_(partition_num_ + 1), partition_sizes_(partition_num_) {}
+
+    AnnIVFFlatIndexData(const AnnIVFFlatIndexData &) = delete;
+    AnnIVFFlatIndexData &operator=(const AnnIVFFlatIndexData &) = delete;
+
+    ~AnnIVFFlatIndexData() { FreeArena(arena_); }
+
+    u32 partition_size(u32 partition_id) const { return partition_sizes_[partition_id]; }
+
+    u32 *partition_ids(u32 partition_id) const { return IdsBegin(arena_) + partition_offsets_[partition_id]; }
+
+    VectorDataType *partition_vectors(u32 partition_id) const {
+        return VectorsBegin(arena_, partition_offsets_.back()) + SizeT(partition_offsets_[partition_id]) * dimension_;
+    }
 
     void train_centroids(u32 dimension,
                          u32 vector_count,
                          const VectorDataType *vectors_ptr,
+                         u32 mini_batch_size = 0,
+                         ThreadPool *pool = nullptr,
+                         u32 thread_n = 1,
                          u32 iteration_max = 0,
                          u32 min_points_per_centroid = 32,
                          u32 max_points_per_centroid = 256) {
@@ -64,7 +93,10 @@ struct AnnIVFFlatIndexData {
                                               partition_num_,
                                               iteration_max,
                                               min_points_per_centroid,
-                                              max_points_per_centroid);
+                                              max_points_per_centroid,
+                                              mini_batch_size,
+                                              pool,
+                                              thread_n);
     }
 
     void insert_data(i32 dimension, u64 vector_count, const VectorDataType *vectors_ptr, u32 id_begin = 0) {
@@ -82,19 +114,45 @@ struct AnnIVFFlatIndexData {
         add_data_to_partition(dimension, vector_count, vectors_ptr, this, id_begin);
     }
 
+    // remove the vectors whose bit is false in `bitmask` from the partitions. `data_num_` is kept, because it is the number of inserted rows.
+    // return the number of removed vectors.
+    u32 remove_deleted(const Bitmask &bitmask) {
+        if (bitmask.IsAllTrue()) {
+            return 0;
+        }
+        u32 removed_num = 0;
+        for (u32 i = 0; i < partition_num_; ++i) {
+            u32 *ids = partition_ids(i);
+            VectorDataType *vectors = partition_vectors(i);
+            u32 kept_num = 0;
+            for (u32 j = 0; j < partition_sizes_[i]; ++j) {
+                if (!bitmask.IsTrue(ids[j])) {
+                    continue;
+                }
+                if (kept_num != j) {
+                    ids[kept_num] = ids[j];
+                    Copy(vectors + SizeT(j) * dimension_, vectors + SizeT(j + 1) * dimension_, vectors + SizeT(kept_num) * dimension_);
+                }
+                ++kept_num;
+            }
+            // the removed vectors are not left in the free slots
+            Fill(ids + kept_num, ids + partition_sizes_[i], 0);
+            Fill(vectors + SizeT(kept_num) * dimension_, vectors + SizeT(partition_sizes_[i]) * dimension_, VectorDataType{});
+            removed_num += partition_sizes_[i] - kept_num;
+            partition_sizes_[i] = kept_num;
+        }
+        return removed_num;
+    }
+
     void SaveIndexInner(FileHandler &file_handler) {
         file_handler.Write(&metric_, sizeof(metric_));
         file_handler.Write(&dimension_, sizeof(dimension_));
         file_handler.Write(&partition_num_, sizeof(partition_num_));
         file_handler.Write(&data_num_, sizeof(data_num_));
         file_handler.Write(centroids_.data(), sizeof(CentroidsDataType) * dimension_ * partition_num_);
-        u32 vector_element_num;
-        for (u32 i = 0; i < partition_num_; ++i) {
-            vector_element_num = ids_[i].size();
-            file_handler.Write(&vector_element_num, sizeof(vector_element_num));
-            file_handler.Write(ids_[i].data(), sizeof(u32) * vector_element_num);
-            file_handler.Write(vectors_[i].data(), sizeof(VectorDataType) * dimension_ * vector_element_num);
-        }
+        file_handler.Write(partition_offsets_.data(), sizeof(u32) * (partition_num_ + 1));
+        file_handler.Write(partition_sizes_.data(), sizeof(u32) * partition_num_);
+        file_handler.Write(arena_, arena_size_);
     }
 
     void SaveIndex(const String &file_path, UniquePtr<FileSystem> fs) {
@@ -110,17 +168,15 @@ struct AnnIVFFlatIndexData {
         file_handler.Read(&partition_num_, sizeof(partition_num_));
         file_handler.Read(&data_num_, sizeof(data_num_));
         centroids_.resize(dimension_ * partition_num_);
-        ids_.resize(partition_num_);
-        vectors_.resize(partition_num_);
+        partition_offsets_.resize(partition_num_ + 1);
+        partition_sizes_.resize(partition_num_);
         file_handler.Read(centroids_.data(), sizeof(CentroidsDataType) * dimension_ * partition_num_);
-        u32 vector_element_num;
-        for (u32 i = 0; i < partition_num_; ++i) {
-            file_handler.Read(&vector_element_num, sizeof(vector_element_num));
-            ids_[i].resize(vector_element_num);
-            file_handler.Read(ids_[i].data(), sizeof(u32) * vector_element_num);
-            vectors_[i].resize(dimension_ * vector_element_num);
-            file_handler.Read(vectors_[i].data(), sizeof(VectorDataType) * dimension_ * vector_element_num);
-        }
+        file_handler.Read(partition_offsets_.data(), sizeof(u32) * (partition_num_ + 1));
+        file_handler.Read(partition_sizes_.data(), sizeof(u32) * partition_num_);
+        FreeArena(arena_);
+        arena_size_ = ArenaSize(partition_offsets_.back());
+        arena_ = AllocateArena(arena_size_);
+        file_handler.Read(arena_, arena_size_);
     }
 
     static UniquePtr<AnnIVFFlatIndexData<CentroidsDataType, VectorDataType>> LoadIndexInner(FileHandler &file_handler) {
@@ -136,6 +192,59 @@ struct AnnIVFFlatIndexData {
         file_handler->Close();
         return index_data;
     }
+
+    // the number of slots of a partition is a multiple of this, so that the vectors of every partition begin at a 64-byte boundary
+    u32 SlotAlignment() const { return kArenaAlignment / std::gcd(kArenaAlignment, sizeof(VectorDataType) * dimension_); }
+
+    // the offsets of the partitions with `capacities` slots each
+    Vector<u32> PackedOffsets(const Vector<u32> &capacities) const {
+        u32 slot_alignment = SlotAlignment();
+        Vector<u32> offsets(partition_num_ + 1);
+        for (u32 i = 0; i < partition_num_; ++i) {
+            offsets[i + 1] = offsets[i] + (capacities[i] + slot_alignment - 1) / slot_alignment * slot_alignment;
+        }
+        return offsets;
+    }
+
+    static SizeT VectorsOffset(u32 slot_num) { return (sizeof(u32) * slot_num + kArenaAlignment - 1) / kArenaAlignment * kArenaAlignment; }
+
+    SizeT ArenaSize(u32 slot_num) const { return VectorsOffset(slot_num) + sizeof(VectorDataType) * dimension_ * slot_num; }
+
+    static u32 *IdsBegin(char *arena) { return reinterpret_cast<u32 *>(arena); }
+
+    static VectorDataType *VectorsBegin(char *arena, u32 slot_num) { return reinterpret_cast<VectorDataType *>(arena + VectorsOffset(slot_num)); }
+
+    // the free slots are zeroed, because the whole arena is saved
+    static char *AllocateArena(SizeT size) {
+        auto *arena = static_cast<char *>(operator new[](size, std::align_val_t(kArenaAlignment)));
+        Memset(arena, 0, size);
+        return arena;
+    }
+
+    static void FreeArena(char *arena) {
+        if (arena != nullptr) {
+            operator delete[](arena, std::align_val_t(kArenaAlignment));
+        }
+    }
+
+    // move the partitions to a new arena with `capacities` slots each, which can't be fewer than the used ones
+    void Relayout(const Vector<u32> &capacities) {
+        Vector<u32> offsets = PackedOffsets(capacities);
+        u32 slot_num = partition_offsets_.back();
+        u32 new_slot_num = offsets.back();
+        SizeT new_arena_size = ArenaSize(new_slot_num);
+        char *new_arena = AllocateArena(new_arena_size);
+        for (u32 i = 0; i < partition_num_ && arena_ != nullptr; ++i) {
+            const u32 *ids = IdsBegin(arena_) + partition_offsets_[i];
+            Copy(ids, ids + partition_sizes_[i], IdsBegin(new_arena) + offsets[i]);
+            const VectorDataType *vectors = VectorsBegin(arena_, slot_num) + SizeT(partition_offsets_[i]) * dimension_;
+            Copy(vectors, vectors + SizeT(partition_sizes_[i]) * dimension_, VectorsBegin(new_arena, new_slot_num) + SizeT(offsets[i]) * dimension_);
+        }
+        FreeArena(arena_);
+        arena_ = new_arena;
+        arena_size_ = new_arena_size;
+        partition_offsets_ = Move(offsets);
+    }
 };
 
 export template <typename ElemType, typename CentroidsDataType, typename VectorDataType>
@@ -156,30 +265,41 @@ void add_data_to_partition(u32 dimension,
         id_begin = index_data->data_num_;
     u32 partition_num = index_data->partition_num_;
     const auto &centroids = index_data->centroids_;
-    auto &vectors = index_data->vectors_;
-    auto &ids = index_data->ids_;
+    auto &partition_sizes = index_data->partition_sizes_;
+    const auto &partition_offsets = index_data->partition_offsets_;
     Vector<u32> assigned_partition_id(vector_count);
 
-    // Classify vectors
-    // search_top_1
-    search_top_1_without_dis<f32>(dimension, vector_count, vectors_ptr, partition_num, centroids.data(), assigned_partition_id.data());
+    // Classify vectors by the metric of the index
+    if (index_data->metric_ == MetricType::kMerticInnerProduct) {
+        search_top_1_ip_without_dis<f32>(dimension, vector_count, vectors_ptr, partition_num, centroids.data(), assigned_partition_id.data());
+    } else {
+        search_top_1_without_dis<f32>(dimension, vector_count, vectors_ptr, partition_num, centroids.data(), assigned_partition_id.data());
+    }
 
     Vector<u32> partition_element_count(partition_num);
     // calculate partition_element_count
     for (u32 i = 0; i < vector_count; ++i)
         ++partition_element_count[assigned_partition_id[i]];
-    // Reserve space
+    // Reserve space. a full partition grows by half at least, so that the arena is moved a few times for continuous appends
+    bool grow = false;
+    Vector<u32> capacities(partition_num);
     for (u32 i = 0; i < partition_num; ++i) {
-        vectors[i].reserve(vectors[i].size() + partition_element_count[i] * dimension);
-        ids[i].reserve(ids[i].size() + partition_element_count[i]);
+        u32 capacity = partition_offsets[i + 1] - partition_offsets[i];
+        u32 required = partition_sizes[i] + partition_element_count[i];
+        capacities[i] = required <= capacity ? capacity : Max(required, capacity + capacity / 2);
+        grow = grow || required > capacity;
+    }
+    if (grow) {
+        index_data->Relayout(capacities);
     }
 
     // insert vectors to partition
     for (u32 i = 0; i < vector_count; ++i) {
         auto vector_pos_i = vectors_ptr + i * dimension;
         auto partition_of_i = assigned_partition_id[i];
-        vectors[partition_of_i].insert(vectors[partition_of_i].end(), vector_pos_i, vector_pos_i + dimension);
-        ids[partition_of_i].push_back(id_begin + i);
+        u32 slot = partition_sizes[partition_of_i]++;
+        Copy(vector_pos_i, vector_pos_i + dimension, index_data->partition_vectors(partition_of_i) + SizeT(slot) * dimension);
+        index_data->partition_ids(partition_of_i)[slot] = id_begin + i;
     }
     // update data_num_
     index_data->data_num_ += vector_count;
@@ -0,0 +1,193 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+import stl;
+import index_base;
+import file_system;
+import search_top_k;
+import kmeans_partition;
+import product_quantizer;
+import infinity_exception;
+import bitmask;
+
+export module annivfpq_index_data;
+
+namespace infinity {
+
+// the partitions of ivf, in which a vector is kept as the product quantization code of its residual to the centroid of its partition
+export template <typename CentroidsDataType>
+struct AnnIVFPQIndexData {
+    MetricType metric_{MetricType::kInvalid};
+    u32 dimension_{};
+    u32 partition_num_{};
+    u32 data_num_{};
+    Vector<CentroidsDataType> centroids_;
+    ProductQuantizer pq_;
+    Vector<Vector<u32>> ids_;
+    Vector<Vector<u8>> codes_; // `pq_.subspace_num()` bytes per vector
+    AnnIVFPQIndexData(MetricType metric, u32 dimension, u32 partition_num, u32 subspace_num)
+        : metric_(metric), dimension_(dimension), partition_num_(partition_num), centroids_(partition_num_ * dimension_),
+          pq_(dimension, subspace_num), ids_(partition_num_), codes_(partition_num_) {}
+
+    void train_centroids(u32 dimension,
+                         u32 vector_count,
+                         const CentroidsDataType *vectors_ptr,
+                         u32 mini_batch_size = 0,
+                         ThreadPool *pool = nullptr,
+                         u32 thread_n = 1) {
+        if (dimension != dimension_) {
+            Error<StorageException>("Dimension not match");
+        }
+        if (metric_ != MetricType::kMerticL2 && metric_ != MetricType::kMerticInnerProduct) {
+            if (metric_ != MetricType::kInvalid) {
+                Error<StorageException>("Metric type not implemented");
+            } else {
+                Error<StorageException>("Metric type not supported");
+            }
+            return;
+        }
+        k_means_partition_only_centroids<f32>(metric_,
+                                              dimension,
+                                              vector_count,
+                                              vectors_ptr,
+                                              centroids_.data(),
+                                              partition_num_,
+                                              0,
+                                              32,
+                                              256,
+                                              mini_batch_size,
+                                              pool,
+                                              thread_n);
+        // the codebooks are trained with the residuals of the training vectors
+        Vector<u32> assigned_partition_id(vector_count);
+        search_top_1_without_dis<f32>(dimension, vector_count, vectors_ptr, partition_num_, centroids_.data(), assigned_partition_id.data());
+        Vector<f32> residuals(SizeT(vector_count) * dimension);
+        for (u32 i = 0; i < vector_count; ++i) {
+            Residual(vectors_ptr + SizeT(i) * dimension, assigned_partition_id[i], residuals.data() + SizeT(i) * dimension);
+        }
+        pq_.Train(residuals.data(), vector_count);
+    }
+
+    void insert_data(u32 dimension, u32 vector_count, const CentroidsDataType *vectors_ptr, u32 id_begin = 0) {
+        if (dimension != dimension_) {
+            Error<StorageException>("Dimension not match");
+        }
+        if (vector_count == 0) {
+            return;
+        }
+        if (id_begin == 0) {
+            id_begin = data_num_;
+        }
+        Vector<u32> assigned_partition_id(vector_count);
+        search_top_1_without_dis<f32>(dimension, vector_count, vectors_ptr, partition_num_, centroids_.data(), assigned_partition_id.data());
+        Vector<f32> residuals(SizeT(vector_count) * dimension);
+        for (u32 i = 0; i < vector_count; ++i) {
+            Residual(vectors_ptr + SizeT(i) * dimension, assigned_partition_id[i], residuals.data() + SizeT(i) * dimension);
+        }
+        u32 code_size = pq_.subspace_num();
+        Vector<u8> codes(SizeT(vector_count) * code_size);
+        pq_.Encode(residuals.data(), vector_count, codes.data());
+        for (u32 i = 0; i < vector_count; ++i) {
+            u32 partition_id = assigned_partition_id[i];
+            codes_[partition_id].insert(codes_[partition_id].end(), codes.begin() + SizeT(i) * code_size, codes.begin() + SizeT(i + 1) * code_size);
+            ids_[partition_id].push_back(id_begin + i);
+        }
+        data_num_ += vector_count;
+    }
+
+    // remove the vectors whose bit is false in `bitmask` from the partitions. `data_num_` is kept, because it is the number of inserted rows.
+    // return the number of removed vectors.
+    u32 remove_deleted(const Bitmask &bitmask) {
+        if (bitmask.IsAllTrue()) {
+            return 0;
+        }
+        u32 code_size = pq_.subspace_num();
+        u32 removed_num = 0;
+        for (u32 i = 0; i < partition_num_; ++i) {
+            auto &ids = ids_[i];
+            auto &codes = codes_[i];
+            u32 kept_num = 0;
+            for (u32 j = 0; j < ids.size(); ++j) {
+                if (!bitmask.IsTrue(ids[j])) {
+                    continue;
+                }
+                if (kept_num != j) {
+                    ids[kept_num] = ids[j];
+                    Copy(codes.begin() + j * code_size, codes.begin() + (j + 1) * code_size, codes.begin() + kept_num * code_size);
+                }
+                ++kept_num;
+            }
+            removed_num += ids.size() - kept_num;
+            ids.resize(kept_num);
+            codes.resize(kept_num * code_size);
+        }
+        return removed_num;
+    }
+
+    void SaveIndexInner(FileHandler &file_handler) {
+        file_handler.Write(&metric_, sizeof(metric_));
+        file_handler.Write(&dimension_, sizeof(dimension_));
+        file_handler.Write(&partition_num_, sizeof(partition_num_));
+        file_handler.Write(&data_num_, sizeof(data_num_));
+        file_handler.Write(centroids_.data(), sizeof(CentroidsDataType) * dimension_ * partition_num_);
+        pq_.Save(file_handler);
+        u32 vector_element_num;
+        for (u32 i = 0; i < partition_num_; ++i) {
+            vector_element_num = ids_[i].size();
+            file_handler.Write(&vector_element_num, sizeof(vector_element_num));
+            file_handler.Write(ids_[i].data(), sizeof(u32) * vector_element_num);
+            file_handler.Write(codes_[i].data(), codes_[i].size());
+        }
+    }
+
+    void ReadIndexInner(FileHandler &file_handler) {
+        file_handler.Read(&metric_, sizeof(metric_));
+        file_handler.Read(&dimension_, sizeof(dimension_));
+        file_handler.Read(&partition_num_, sizeof(partition_num_));
+        file_handler.Read(&data_num_, sizeof(data_num_));
+        centroids_.resize(dimension_ * partition_num_);
+        ids_.resize(partition_num_);
+        codes_.resize(partition_num_);
+        file_handler.Read(centroids_.data(), sizeof(CentroidsDataType) * dimension_ * partition_num_);
+        pq_ = ProductQuantizer::Load(file_handler);
+        u32 vector_element_num;
+        for (u32 i = 0; i < partition_num_; ++i) {
+            file_handler.Read(&vector_element_num, sizeof(vector_element_num));
+            ids_[i].resize(vector_element_num);
+            file_handler.Read(ids_[i].data(), sizeof(u32) * vector_element_num);
+            codes_[i].resize(SizeT(vector_element_num) * pq_.subspace_num());
+            file_handler.Read(codes_[i].data(), codes_[i].size());
+        }
+    }
+
+    static UniquePtr<AnnIVFPQIndexData<CentroidsDataType>> LoadIndexInner(FileHandler &file_handler) {
+        auto index_data = MakeUnique<AnnIVFPQIndexData<CentroidsDataType>>(MetricType::kInvalid, 0, 0, 0);
+        index_data->ReadIndexInner(file_handler);
+        return index_data;
+    }
+
+    const CentroidsDataType *centroid(u32 partition_id) const { return centroids_.data() + SizeT(partition_id) * dimension_; }
+
+private:
+    void Residual(const CentroidsDataType *vector, u32 partition_id, f32 *residual) const {
+        const CentroidsDataType *c = centroid(partition_id);
+        for (u32 j = 0; j < dimension_; ++j) {
+            residual[j] = vector[j] - c[j];
+        }
+    }
+};
+
+} // namespace infinity
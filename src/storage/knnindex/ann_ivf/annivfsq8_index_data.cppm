@@ -0,0 +1,217 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cmath>
+
+import stl;
+import index_base;
+import file_system;
+import search_top_k;
+import kmeans_partition;
+import infinity_exception;
+import bitmask;
+import hnsw_simd_func;
+
+export module annivfsq8_index_data;
+
+namespace infinity {
+
+// the partitions of ivf, in which a vector is kept as one byte per dimension. the byte c of dimension j stands for
+// `min_[j] + c * scale_[j]`, where [min_[j], min_[j] + 255 * scale_[j]] is the range of the dimension in the training vectors.
+// the values of the vectors inserted later out of the range are clamped.
+export template <typename CentroidsDataType>
+struct AnnIVFSQ8IndexData {
+    MetricType metric_{MetricType::kInvalid};
+    u32 dimension_{};
+    u32 partition_num_{};
+    u32 data_num_{};
+    Vector<CentroidsDataType> centroids_;
+    Vector<f32> min_;
+    Vector<f32> scale_;
+    Vector<Vector<u32>> ids_;
+    Vector<Vector<u8>> codes_; // `dimension_` bytes per vector
+    AnnIVFSQ8IndexData(MetricType metric, u32 dimension, u32 partition_num)
+        : metric_(metric), dimension_(dimension), partition_num_(partition_num), centroids_(partition_num_ * dimension_), min_(dimension_),
+          scale_(dimension_), ids_(partition_num_), codes_(partition_num_) {}
+
+    void train_centroids(u32 dimension,
+                         u32 vector_count,
+                         const CentroidsDataType *vectors_ptr,
+                         u32 mini_batch_size = 0,
+                         ThreadPool *pool = nullptr,
+                         u32 thread_n = 1) {
+        if (dimension != dimension_) {
+            Error<StorageException>("Dimension not match");
+        }
+        if (metric_ != MetricType::kMerticL2 && metric_ != MetricType::kMerticInnerProduct) {
+            if (metric_ != MetricType::kInvalid) {
+                Error<StorageException>("Metric type not implemented");
+            } else {
+                Error<StorageException>("Metric type not supported");
+            }
+            return;
+        }
+        k_means_partition_only_centroids<f32>(metric_,
+                                              dimension,
+                                              vector_count,
+                                              vectors_ptr,
+                                              centroids_.data(),
+                                              partition_num_,
+                                              0,
+                                              32,
+                                              256,
+                                              mini_batch_size,
+                                              pool,
+                                              thread_n);
+        // the range of every dimension in the training vectors
+        Vector<f32> max(dimension_, LimitLowest<f32>());
+        Fill(min_.begin(), min_.end(), LimitMax<f32>());
+        for (u32 i = 0; i < vector_count; ++i) {
+            const CentroidsDataType *v = vectors_ptr + SizeT(i) * dimension_;
+            for (u32 j = 0; j < dimension_; ++j) {
+                min_[j] = Min(min_[j], f32(v[j]));
+                max[j] = Max(max[j], f32(v[j]));
+            }
+        }
+        for (u32 j = 0; j < dimension_; ++j) {
+            scale_[j] = (max[j] - min_[j]) / 255.0f;
+        }
+    }
+
+    void insert_data(u32 dimension, u32 vector_count, const CentroidsDataType *vectors_ptr, u32 id_begin = 0) {
+        if (dimension != dimension_) {
+            Error<StorageException>("Dimension not match");
+        }
+        if (vector_count == 0) {
+            return;
+        }
+        if (id_begin == 0) {
+            id_begin = data_num_;
+        }
+        Vector<u32> assigned_partition_id(vector_count);
+        AssignPartitions(vector_count, vectors_ptr, assigned_partition_id.data());
+        for (u32 i = 0; i < vector_count; ++i) {
+            u32 partition_id = assigned_partition_id[i];
+            auto &codes = codes_[partition_id];
+            codes.resize(codes.size() + dimension_);
+            Encode(vectors_ptr + SizeT(i) * dimension_, codes.data() + codes.size() - dimension_);
+            ids_[partition_id].push_back(id_begin + i);
+        }
+        data_num_ += vector_count;
+    }
+
+    // remove the vectors whose bit is false in `bitmask` from the partitions. `data_num_` is kept, because it is the number of inserted rows.
+    // return the number of removed vectors.
+    u32 remove_deleted(const Bitmask &bitmask) {
+        if (bitmask.IsAllTrue()) {
+            return 0;
+        }
+        u32 removed_num = 0;
+        for (u32 i = 0; i < partition_num_; ++i) {
+            auto &ids = ids_[i];
+            auto &codes = codes_[i];
+            u32 kept_num = 0;
+            for (u32 j = 0; j < ids.size(); ++j) {
+                if (!bitmask.IsTrue(ids[j])) {
+                    continue;
+                }
+                if (kept_num != j) {
+                    ids[kept_num] = ids[j];
+                    Copy(codes.begin() + j * dimension_, codes.begin() + (j + 1) * dimension_, codes.begin() + kept_num * dimension_);
+                }
+                ++kept_num;
+            }
+            removed_num += ids.size() - kept_num;
+            ids.resize(kept_num);
+            codes.resize(kept_num * dimension_);
+        }
+        return removed_num;
+    }
+
+    // the partition of a vector is the nearest centroid by l2, or the centroid of the largest inner product
+    void AssignPartitions(u32 vector_count, const CentroidsDataType *vectors_ptr, u32 *partition_ids) const {
+        if (metric_ == MetricType::kMerticInnerProduct) {
+            search_top_1_ip_without_dis<f32>(dimension_, vector_count, vectors_ptr, partition_num_, centroids_.data(), partition_ids);
+        } else {
+            search_top_1_without_dis<f32>(dimension_, vector_count, vectors_ptr, partition_num_, centroids_.data(), partition_ids);
+        }
+    }
+
+    void Encode(const CentroidsDataType *vector, u8 *code) const {
+        if constexpr (std::is_same_v<CentroidsDataType, f32>) {
+            SQ8Encode(vector, min_.data(), scale_.data(), code, dimension_);
+        } else {
+            for (u32 j = 0; j < dimension_; ++j) {
+                if (scale_[j] <= 0) {
+                    code[j] = 0;
+                    continue;
+                }
+                f32 c = std::round((f32(vector[j]) - min_[j]) / scale_[j]);
+                code[j] = u8(Min(Max(c, 0.0f), 255.0f));
+            }
+        }
+    }
+
+    void Decode(const u8 *code, f32 *vector) const { SQ8Decode(code, min_.data(), scale_.data(), vector, dimension_); }
+
+    void SaveIndexInner(FileHandler &file_handler) {
+        file_handler.Write(&metric_, sizeof(metric_));
+        file_handler.Write(&dimension_, sizeof(dimension_));
+        file_handler.Write(&partition_num_, sizeof(partition_num_));
+        file_handler.Write(&data_num_, sizeof(data_num_));
+        file_handler.Write(centroids_.data(), sizeof(CentroidsDataType) * dimension_ * partition_num_);
+        file_handler.Write(min_.data(), sizeof(f32) * dimension_);
+        file_handler.Write(scale_.data(), sizeof(f32) * dimension_);
+        u32 vector_element_num;
+        for (u32 i = 0; i < partition_num_; ++i) {
+            vector_element_num = ids_[i].size();
+            file_handler.Write(&vector_element_num, sizeof(vector_element_num));
+            file_handler.Write(ids_[i].data(), sizeof(u32) * vector_element_num);
+            file_handler.Write(codes_[i].data(), codes_[i].size());
+        }
+    }
+
+    void ReadIndexInner(FileHandler &file_handler) {
+        file_handler.Read(&metric_, sizeof(metric_));
+        file_handler.Read(&dimension_, sizeof(dimension_));
+        file_handler.Read(&partition_num_, sizeof(partition_num_));
+        file_handler.Read(&data_num_, sizeof(data_num_));
+        centroids_.resize(dimension_ * partition_num_);
+        min_.resize(dimension_);
+        scale_.resize(dimension_);
+        ids_.resize(partition_num_);
+        codes_.resize(partition_num_);
+        file_handler.Read(centroids_.data(), sizeof(CentroidsDataType) * dimension_ * partition_num_);
+        file_handler.Read(min_.data(), sizeof(f32) * dimension_);
+        file_handler.Read(scale_.data(), sizeof(f32) * dimension_);
+        u32 vector_element_num;
+        for (u32 i = 0; i < partition_num_; ++i) {
+            file_handler.Read(&vector_element_num, sizeof(vector_element_num));
+            ids_[i].resize(vector_element_num);
+            file_handler.Read(ids_[i].data(), sizeof(u32) * vector_element_num);
+            codes_[i].resize(SizeT(vector_element_num) * dimension_);
+            file_handler.Read(codes_[i].data(), codes_[i].size());
+        }
+    }
+
+    static UniquePtr<AnnIVFSQ8IndexData<CentroidsDataType>> LoadIndexInner(FileHandler &file_handler) {
+        auto index_data = MakeUnique<AnnIVFSQ8IndexData<CentroidsDataType>>(MetricType::kInvalid, 0, 0);
+        index_data->ReadIndexInner(file_handler);
+        return index_data;
+    }
+};
+
+} // namespace infinity
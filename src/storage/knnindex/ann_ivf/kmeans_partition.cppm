@@ -16,6 +16,8 @@ module;
 // #define rectime 0
 #include <algorithm>
 #include <cstring>
+#include <exception>
+#include <future>
 // #include <iomanip>
 // #include <iostream>
 #include <random>
@@ -66,9 +68,147 @@ inline void normalize_centroids(u32 dimension, u32 partition_num, CentroidType *
     }
 }
 
+// assign each vector to the nearest centroid. the vectors are split into chunks searched by the calling thread and at most
+// `thread_n - 1` workers of `pool` when there are enough of them.
+template <typename ElemType, typename CentroidsType>
+void assign_partitions(u32 dimension,
+                       u32 vector_count,
+                       const ElemType *vectors,
+                       u32 partition_num,
+                       const CentroidsType *centroids,
+                       u32 *ids,
+                       f32 *distances,
+                       ThreadPool *pool,
+                       u32 thread_n) {
+    // a chunk is a block of `search_top_1_with_sgemm`
+    constexpr u32 min_chunk_size = 4096;
+    thread_n = Min<u32>(thread_n, vector_count / min_chunk_size);
+    if (pool == nullptr || thread_n <= 1) {
+        search_top_1_with_dis(dimension, vector_count, vectors, partition_num, centroids, ids, distances);
+        return;
+    }
+    u32 chunk_size = (vector_count + thread_n - 1) / thread_n;
+    auto AssignChunk = [&](u32 begin) {
+        u32 n = Min(chunk_size, vector_count - begin);
+        search_top_1_with_dis(dimension, n, vectors + SizeT(begin) * dimension, partition_num, centroids, ids + begin, distances + begin);
+    };
+    Vector<std::future<void>> helpers;
+    std::exception_ptr first_exception;
+    try {
+        helpers.reserve(thread_n - 1);
+        for (u32 begin = chunk_size; begin < vector_count; begin += chunk_size) {
+            helpers.emplace_back(pool->push([&AssignChunk, begin](int) { AssignChunk(begin); }));
+        }
+        AssignChunk(0);
+    } catch (...) {
+        first_exception = std::current_exception();
+    }
+    // the helpers reference this frame, so all of them are done before the first exception is rethrown
+    for (auto &helper : helpers) {
+        try {
+            helper.get();
+        } catch (...) {
+            if (first_exception == nullptr) {
+                first_exception = std::current_exception();
+            }
+        }
+    }
+    if (first_exception != nullptr) {
+        std::rethrow_exception(first_exception);
+    }
+}
+
+// mini-batch k-means of Sculley: every step assigns a random batch of the training vectors, and moves each centroid toward its vectors
+// with the learning rate 1 / (the number of vectors assigned to it so far). the steps see about as many vectors as one lloyd iteration,
+// and at least `iteration_max` batches.
+template <typename ElemType, typename CentroidsType>
+void mini_batch_iterations(MetricType metric,
+                           u32 dimension,
+                           u32 training_data_num,
+                           const ElemType *training_data,
+                           u32 partition_num,
+                           CentroidsType *centroids,
+                           u32 mini_batch_size,
+                           u32 iteration_max,
+                           ThreadPool *pool,
+                           u32 thread_n) {
+    std::mt19937 gen(std::random_device{}());
+    std::uniform_int_distribution<u32> dis(0, training_data_num - 1);
+    Vector<ElemType> batch(SizeT(mini_batch_size) * dimension);
+    Vector<u32> batch_partition_id(mini_batch_size);
+    Vector<f32> batch_distance(mini_batch_size);
+    Vector<u64> partition_element_count(partition_num);
+    u32 step_num = Max(iteration_max, training_data_num / mini_batch_size);
+    for (u32 step = 0; step < step_num; ++step) {
+        for (u32 i = 0; i < mini_batch_size; ++i) {
+            const ElemType *v = training_data + SizeT(dis(gen)) * dimension;
+            Copy(v, v + dimension, batch.begin() + SizeT(i) * dimension);
+        }
+        assign_partitions(dimension,
+                          mini_batch_size,
+                          batch.data(),
+                          partition_num,
+                          centroids,
+                          batch_partition_id.data(),
+                          batch_distance.data(),
+                          pool,
+                          thread_n);
+        for (u32 i = 0; i < mini_batch_size; ++i) {
+            u32 partition_id = batch_partition_id[i];
+            f32 eta = 1.0f / f32(++partition_element_count[partition_id]);
+            CentroidsType *centroid = centroids + SizeT(partition_id) * dimension;
+            const ElemType *v = batch.data() + SizeT(i) * dimension;
+            for (u32 j = 0; j < dimension; ++j) {
+                centroid[j] += (f32(v[j]) - f32(centroid[j])) * eta;
+            }
+        }
+        if (metric == MetricType::kMerticInnerProduct) {
+            normalize_centroids(dimension, partition_num, centroids);
+        }
+    }
+}
+
+// a uniform sample of at most `capacity` vectors of a stream by reservoir sampling, so that the training vectors of a segment are
+// chosen block by block without copying the whole column.
+export class VectorReservoir {
+public:
+    VectorReservoir(u32 dimension, u32 capacity) : dimension_(dimension), capacity_(capacity), gen_(std::random_device{}()) {
+        data_.reserve(SizeT(capacity_) * dimension_);
+    }
+
+    void Add(const f32 *vectors, SizeT vector_count) {
+        for (SizeT i = 0; i < vector_count; ++i, ++seen_num_) {
+            const f32 *v = vectors + i * dimension_;
+            if (seen_num_ < capacity_) {
+                data_.insert(data_.end(), v, v + dimension_);
+                continue;
+            }
+            // the `seen_num_ + 1`th vector replaces a kept one with the probability capacity_ / (seen_num_ + 1)
+            std::uniform_int_distribution<u64> dis(0, seen_num_);
+            if (u64 j = dis(gen_); j < capacity_) {
+                Copy(v, v + dimension_, data_.begin() + j * dimension_);
+            }
+        }
+    }
+
+    u32 size() const { return data_.size() / dimension_; }
+
+    const f32 *data() const { return data_.data(); }
+
+private:
+    u32 dimension_{};
+    u32 capacity_{};
+    u64 seen_num_{};
+    Vector<f32> data_;
+    std::mt19937_64 gen_;
+};
+
 // CentroidsType: the type to calculate centroids
 // partition_num: the number of partitions, default to sqrt(vector_count)
 // iteration_max: the max iteration count, default to 10
+// mini_batch_size: the batch size of mini-batch k-means, 0 for lloyd iterations on all the training vectors
+// pool: the workers assigning the vectors with the calling thread, nullptr to assign on the calling thread only
+// thread_n: the max number of threads assigning the vectors, e.g. the worker cpu limit of the config
 export template <typename CentroidsType, typename ElemType, typename CentroidsOutputType>
 void k_means_partition_only_centroids(MetricType metric,
                                       u32 dimension,
@@ -78,7 +218,10 @@ void k_means_partition_only_centroids(MetricType metric,
                                       u32 partition_num = 0,
                                       u32 iteration_max = 0,
                                       u32 min_points_per_centroid = 32,
-                                      u32 max_points_per_centroid = 256) {
+                                      u32 max_points_per_centroid = 256,
+                                      u32 mini_batch_size = 0,
+                                      ThreadPool *pool = nullptr,
+                                      u32 thread_n = 1) {
     constexpr int default_iteration_max = 10;
     if (metric != MetricType::kMerticL2 && metric != MetricType::kMerticInnerProduct) {
         Error<ExecutorException>("metric type not implemented");
@@ -173,105 +316,120 @@ void k_means_partition_only_centroids(MetricType metric,
         }
     }
 
-    // Record some information
-    f32 previous_total_distance = std::numeric_limits<f32>::max();
-    // Assign each vector to a partition
-    Vector<u32> training_data_partition_id(training_data_num);
-    // Distance
-    Vector<f32> partition_element_distance(training_data_num);
-    // Record the number of vectors in each partition
-    Vector<u32> partition_element_count(partition_num);
+    if (mini_batch_size > 0 && mini_batch_size < training_data_num) {
+        mini_batch_iterations(metric,
+                              dimension,
+                              training_data_num,
+                              training_data,
+                              partition_num,
+                              centroids,
+                              mini_batch_size,
+                              iteration_max,
+                              pool,
+                              thread_n);
+    } else {
+        // Record some information
+        f32 previous_total_distance = std::numeric_limits<f32>::max();
+        // Assign each vector to a partition
+        Vector<u32> training_data_partition_id(training_data_num);
+        // Distance
+        Vector<f32> partition_element_distance(training_data_num);
+        // Record the number of vectors in each partition
+        Vector<u32> partition_element_count(partition_num);
 
-    // Iteration
-    for (u32 iter = 1; iter <= iteration_max; ++iter) {
-        // info
-        f32 this_iter_distance = 0;
-        // First : assign each training vector to a partition
-        {
-            // search top 1
-            search_top_1_with_dis(dimension,
+        // Iteration
+        for (u32 iter = 1; iter <= iteration_max; ++iter) {
+            // info
+            f32 this_iter_distance = 0;
+            // First : assign each training vector to a partition
+            {
+                // search top 1
+                assign_partitions(dimension,
                                   training_data_num,
                                   training_data,
                                   partition_num,
                                   centroids,
                                   training_data_partition_id.data(),
-                                  partition_element_distance.data());
-            // Clear partition_element_count
-            memset(partition_element_count.data(), 0, sizeof(u32) * partition_num);
-            // calculate partition_element_count
-            for (auto i : training_data_partition_id)
-                ++partition_element_count[i];
+                                  partition_element_distance.data(),
+                                  pool,
+                                  thread_n);
+                // Clear partition_element_count
+                memset(partition_element_count.data(), 0, sizeof(u32) * partition_num);
+                // calculate partition_element_count
+                for (auto i : training_data_partition_id)
+                    ++partition_element_count[i];
 
-            // add distance to this_iter_distance
-            this_iter_distance += std::reduce(partition_element_distance.begin(), partition_element_distance.end());
-        }
-        // Second : update centroids
-        {
-            // Clear old centroids data
-            memset(centroids, 0, sizeof(CentroidsType) * partition_num * dimension);
-            // Sum
-            for (u32 i = 0; i < training_data_num; ++i) {
-                auto vector_pos_i = training_data + i * dimension;
-                auto centroid_pos_i = centroids + training_data_partition_id[i] * dimension;
-                for (u32 j = 0; j < dimension; ++j) {
-                    centroid_pos_i[j] += vector_pos_i[j];
-                }
+                // add distance to this_iter_distance
+                this_iter_distance += std::reduce(partition_element_distance.begin(), partition_element_distance.end());
             }
-            // For L2 metric, divide the count. If there is no vector in a partition, the centroid of this partition will not be updated.
-            // For IP metric, normalize centroids.
-            if (metric == MetricType::kMerticL2) {
-                for (u32 i = 0; i < partition_num; ++i) {
-                    if (auto cnt = partition_element_count[i]; cnt > 0) {
-                        f32 inv = 1.0f / (f32)cnt;
-                        for (u32 j = 0; j < dimension; ++j) {
-                            centroids[i * dimension + j] *= inv;
+            // Second : update centroids
+            {
+                // Clear old centroids data
+                memset(centroids, 0, sizeof(CentroidsType) * partition_num * dimension);
+                // Sum
+                for (u32 i = 0; i < training_data_num; ++i) {
+                    auto vector_pos_i = training_data + i * dimension;
+                    auto centroid_pos_i = centroids + training_data_partition_id[i] * dimension;
+                    for (u32 j = 0; j < dimension; ++j) {
+                        centroid_pos_i[j] += vector_pos_i[j];
+                    }
+                }
+                // For L2 metric, divide the count. If there is no vector in a partition, the centroid of this partition will not be updated.
+                // For IP metric, normalize centroids.
+                if (metric == MetricType::kMerticL2) {
+                    for (u32 i = 0; i < partition_num; ++i) {
+                        if (auto cnt = partition_element_count[i]; cnt > 0) {
+                            f32 inv = 1.0f / (f32)cnt;
+                            for (u32 j = 0; j < dimension; ++j) {
+                                centroids[i * dimension + j] *= inv;
+                            }
                         }
                     }
+                } else if (metric == MetricType::kMerticInnerProduct) {
+                    normalize_centroids(dimension, partition_num, centroids);
                 }
-            } else if (metric == MetricType::kMerticInnerProduct) {
-                normalize_centroids(dimension, partition_num, centroids);
             }
-        }
 
-        // Third: split partitions when needed
-        // TODO: When to split? How?
-        //  Now sort the centroids by the number of vectors in each partition.
-        //  For every vacant partition, split the partition with the most vectors.
-        {
-            for (u32 i = 0; i < partition_num; ++i) {
-                if (partition_element_count[i] == 0) {
-                    // find the partition with the most vectors
-                    u32 max_partition_id = 0;
-                    u32 max_partition_element_count = 0;
-                    for (u32 j = 0; j < partition_num; ++j) {
-                        if (partition_element_count[j] > max_partition_element_count) {
-                            max_partition_id = j;
-                            max_partition_element_count = partition_element_count[j];
+            // Third: split partitions when needed
+            // TODO: When to split? How?
+            //  Now sort the centroids by the number of vectors in each partition.
+            //  For every vacant partition, split the partition with the most vectors.
+            {
+                for (u32 i = 0; i < partition_num; ++i) {
+                    if (partition_element_count[i] == 0) {
+                        // find the partition with the most vectors
+                        u32 max_partition_id = 0;
+                        u32 max_partition_element_count = 0;
+                        for (u32 j = 0; j < partition_num; ++j) {
+                            if (partition_element_count[j] > max_partition_element_count) {
+                                max_partition_id = j;
+                                max_partition_element_count = partition_element_count[j];
+                            }
+                        }
+                        // split the partition
+                        partition_element_count[i] = max_partition_element_count / 2;
+                        partition_element_count[max_partition_id] -= partition_element_count[i];
+                        // copy the centroid vector
+                        memcpy(centroids + i * dimension, centroids + max_partition_id * dimension, dimension * sizeof(CentroidsType));
+                        // slightly change che i and max_partition_id centroid vector
+                        constexpr f32 epsilon = 1 / 1024.0;
+                        constexpr f32 plus_epsilon = 1 + epsilon;
+                        constexpr f32 minus_epsilon = 1 - epsilon;
+                        for (u32 j = 0; j < dimension; ++j) {
+                            centroids[i * dimension + j] *= ((j & 1) ? plus_epsilon : minus_epsilon);
+                            centroids[max_partition_id * dimension + j] *= ((j & 1) ? minus_epsilon : plus_epsilon);
                         }
-                    }
-                    // split the partition
-                    partition_element_count[i] = max_partition_element_count / 2;
-                    partition_element_count[max_partition_id] -= partition_element_count[i];
-                    // copy the centroid vector
-                    memcpy(centroids + i * dimension, centroids + max_partition_id * dimension, dimension * sizeof(CentroidsType));
-                    // slightly change che i and max_partition_id centroid vector
-                    constexpr f32 epsilon = 1 / 1024.0;
-                    constexpr f32 plus_epsilon = 1 + epsilon;
-                    constexpr f32 minus_epsilon = 1 - epsilon;
-                    for (u32 j = 0; j < dimension; ++j) {
-                        centroids[i * dimension + j] *= ((j & 1) ? plus_epsilon : minus_epsilon);
-                        centroids[max_partition_id * dimension + j] *= ((j & 1) ? minus_epsilon : plus_epsilon);
                     }
                 }
             }
-        }
 
-        // TODO:stop condition?
-        if (metric == MetricType::kMerticL2 && this_iter_distance >= previous_total_distance)
-            break;
-        previous_total_distance = this_iter_distance;
+            // TODO:stop condition?
+            if (metric == MetricType::kMerticL2 && this_iter_distance >= previous_total_distance)
+                break;
+            previous_total_distance = this_iter_distance;
 
-        // In the next loop, training data will be re-assigned to partitions.
+            // In the next loop, training data will be re-assigned to partitions.
+        }
     }
 
     // Output results if typeof(centroids_output) != typeof(centroids)
@@ -0,0 +1,174 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+import stl;
+import file_system;
+import index_base;
+import kmeans_partition;
+import search_top_k;
+import vector_distance;
+import some_simd_functions;
+import infinity_exception;
+
+export module product_quantizer;
+
+namespace infinity {
+
+// a vector is split into `subspace_num` sub-vectors, and each sub-vector is coded by the nearest of the `CENTROID_NUM` centroids
+// of its subspace. so a f32 vector is coded in `subspace_num` bytes.
+export class ProductQuantizer {
+public:
+    static constexpr u32 CENTROID_NUM = 256;
+
+    // the largest divisor of `dimension` not greater than `dimension / 4`, which compresses a f32 vector at least 16 times
+    static u32 DefaultSubspaceNum(u32 dimension) {
+        u32 subspace_num = Max(dimension / 4, 1u);
+        while (dimension % subspace_num != 0) {
+            --subspace_num;
+        }
+        return subspace_num;
+    }
+
+    ProductQuantizer(u32 dimension, u32 subspace_num)
+        : dimension_(dimension), subspace_num_(subspace_num), subspace_dimension_(subspace_num == 0 ? 0 : dimension / subspace_num),
+          codebooks_(SizeT(subspace_num_) * CENTROID_NUM * subspace_dimension_) {
+        if (subspace_num_ != 0 && dimension_ % subspace_num_ != 0) {
+            Error<StorageException>("Dimension must be a multiple of the subspace number.");
+        }
+    }
+
+    u32 dimension() const { return dimension_; }
+    u32 subspace_num() const { return subspace_num_; }
+    u32 subspace_dimension() const { return subspace_dimension_; }
+
+    // centroids of subspace s are at [s * CENTROID_NUM * subspace_dimension, (s + 1) * CENTROID_NUM * subspace_dimension)
+    const f32 *codebooks() const { return codebooks_.data(); }
+    f32 *codebooks() { return codebooks_.data(); }
+    SizeT codebooks_size() const { return codebooks_.size(); }
+
+    // train the centroids of every subspace with k-means on the sub-vectors of `vectors`
+    void Train(const f32 *vectors, u32 vector_count) {
+        u32 centroid_num = Min(vector_count, CENTROID_NUM);
+        Vector<f32> sub_vectors(SizeT(vector_count) * subspace_dimension_);
+        for (u32 s = 0; s < subspace_num_; ++s) {
+            GatherSubspace(vectors, vector_count, s, sub_vectors.data());
+            f32 *codebook = codebooks_.data() + SizeT(s) * CENTROID_NUM * subspace_dimension_;
+            k_means_partition_only_centroids<f32>(MetricType::kMerticL2,
+                                                  subspace_dimension_,
+                                                  vector_count,
+                                                  sub_vectors.data(),
+                                                  codebook,
+                                                  centroid_num);
+            // with fewer vectors than centroids every vector is a centroid, the other centroids repeat them
+            for (u32 c = centroid_num; c < CENTROID_NUM; ++c) {
+                const f32 *centroid = codebook + (c % centroid_num) * subspace_dimension_;
+                Copy(centroid, centroid + subspace_dimension_, codebook + c * subspace_dimension_);
+            }
+        }
+    }
+
+    // code every vector of `vectors` in `subspace_num` bytes of `codes`
+    void Encode(const f32 *vectors, u32 vector_count, u8 *codes) const {
+        Vector<f32> sub_vectors(SizeT(vector_count) * subspace_dimension_);
+        Vector<u32> labels(vector_count);
+        for (u32 s = 0; s < subspace_num_; ++s) {
+            GatherSubspace(vectors, vector_count, s, sub_vectors.data());
+            search_top_1_without_dis<f32>(subspace_dimension_, vector_count, sub_vectors.data(), CENTROID_NUM, Centroid(s, 0), labels.data());
+            for (u32 i = 0; i < vector_count; ++i) {
+                codes[SizeT(i) * subspace_num_ + s] = labels[i];
+            }
+        }
+    }
+
+    void Decode(const u8 *code, f32 *vector) const {
+        for (u32 s = 0; s < subspace_num_; ++s) {
+            const f32 *centroid = Centroid(s, code[s]);
+            Copy(centroid, centroid + subspace_dimension_, vector + s * subspace_dimension_);
+        }
+    }
+
+    // table[s * CENTROID_NUM + c] is the squared l2 distance of the s-th sub-vector of `query` to the c-th centroid of subspace s
+    void MakeL2Table(const f32 *query, f32 *table) const {
+        for (u32 s = 0; s < subspace_num_; ++s) {
+            for (u32 c = 0; c < CENTROID_NUM; ++c) {
+                table[s * CENTROID_NUM + c] = L2Distance<f32>(query + s * subspace_dimension_, Centroid(s, c), subspace_dimension_);
+            }
+        }
+    }
+
+    // table[s * CENTROID_NUM + c] is the inner product of the s-th sub-vector of `query` and the c-th centroid of subspace s
+    void MakeIPTable(const f32 *query, f32 *table) const {
+        for (u32 s = 0; s < subspace_num_; ++s) {
+            for (u32 c = 0; c < CENTROID_NUM; ++c) {
+                table[s * CENTROID_NUM + c] = IPDistance<f32>(query + s * subspace_dimension_, Centroid(s, c), subspace_dimension_);
+            }
+        }
+    }
+
+    // the distance of the query of `table` to the vector of `code`
+    f32 TableDistance(const f32 *table, const u8 *code) const { return PQTableDistance_simd(table, code, subspace_num_); }
+
+    // the distances between two coded vectors, computed from the centroids of their codes
+    f32 CodeL2Distance(const u8 *code1, const u8 *code2) const {
+        f32 distance = 0;
+        for (u32 s = 0; s < subspace_num_; ++s) {
+            distance += L2Distance<f32>(Centroid(s, code1[s]), Centroid(s, code2[s]), subspace_dimension_);
+        }
+        return distance;
+    }
+
+    f32 CodeIPDistance(const u8 *code1, const u8 *code2) const {
+        f32 distance = 0;
+        for (u32 s = 0; s < subspace_num_; ++s) {
+            distance += IPDistance<f32>(Centroid(s, code1[s]), Centroid(s, code2[s]), subspace_dimension_);
+        }
+        return distance;
+    }
+
+    void Save(FileHandler &file_handler) const {
+        file_handler.Write(&dimension_, sizeof(dimension_));
+        file_handler.Write(&subspace_num_, sizeof(subspace_num_));
+        file_handler.Write(codebooks_.data(), sizeof(f32) * codebooks_.size());
+    }
+
+    static ProductQuantizer Load(FileHandler &file_handler) {
+        u32 dimension;
+        u32 subspace_num;
+        file_handler.Read(&dimension, sizeof(dimension));
+        file_handler.Read(&subspace_num, sizeof(subspace_num));
+        ProductQuantizer pq(dimension, subspace_num);
+        file_handler.Read(pq.codebooks_.data(), sizeof(f32) * pq.codebooks_.size());
+        return pq;
+    }
+
+private:
+    const f32 *Centroid(u32 subspace, u32 code) const { return codebooks_.data() + (SizeT(subspace) * CENTROID_NUM + code) * subspace_dimension_; }
+
+    // copy the `subspace`-th sub-vector of every vector to `sub_vectors` contiguously
+    void GatherSubspace(const f32 *vectors, u32 vector_count, u32 subspace, f32 *sub_vectors) const {
+        for (u32 i = 0; i < vector_count; ++i) {
+            const f32 *sub_vector = vectors + SizeT(i) * dimension_ + subspace * subspace_dimension_;
+            Copy(sub_vector, sub_vector + subspace_dimension_, sub_vectors + SizeT(i) * subspace_dimension_);
+        }
+    }
+
+    u32 dimension_{};
+    u32 subspace_num_{};
+    u32 subspace_dimension_{};
+    Vector<f32> codebooks_;
+};
+
+} // namespace infinity
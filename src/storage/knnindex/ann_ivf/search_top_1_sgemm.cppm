@@ -13,17 +13,109 @@
 // limitations under the License.
 
 module;
+#include "storage/knnindex/knn_hnsw/header.h"
 #include <algorithm>
-#include <immintrin.h>
 #include <limits>
 import stl;
 import mlas_matrix_multiply;
 import vector_distance;
+import hnsw_simd_func;
 
 export module search_top_1_sgemm;
 
 namespace infinity {
 
+// the least `square_y[j] - 2 * ip_line[j]` of j in [0, n), which is the l2 distance without the norm of the query, and its j.
+// the less j is taken for the same distance.
+void MinOfLineBF(const f32 *ip_line, const f32 *square_y, u32 n, f32 &min_distance, u32 &min_index) {
+    min_distance = LimitMax<f32>();
+    min_index = 0;
+    for (u32 j = 0; j < n; ++j) {
+        f32 distance = square_y[j] - 2 * ip_line[j];
+        if (distance < min_distance) {
+            min_distance = distance;
+            min_index = j;
+        }
+    }
+}
+
+#if defined(USE_AVX)
+AVX2_TARGET void MinOfLineAVX2(const f32 *ip_line, const f32 *square_y, u32 n, f32 &min_distance, u32 &min_index) {
+    _mm_prefetch(ip_line, _MM_HINT_NTA);
+    _mm_prefetch(ip_line + 16, _MM_HINT_NTA);
+
+    const __m256 mul_minus2 = _mm256_set1_ps(-2);
+
+    __m256 min_distances = _mm256_set1_ps(LimitMax<f32>());
+
+    __m256i min_indices = _mm256_set1_epi32(0);
+
+    __m256i current_indices = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i indices_delta = _mm256_set1_epi32(8);
+
+    u32 j = 0;
+    for (; j < (n / 16) * 16; j += 16) {
+        _mm_prefetch(ip_line + j + 32, _MM_HINT_NTA);
+        _mm_prefetch(ip_line + j + 48, _MM_HINT_NTA);
+
+        const __m256 y_norm_0 = _mm256_loadu_ps(square_y + j + 0);
+        const __m256 y_norm_1 = _mm256_loadu_ps(square_y + j + 8);
+
+        const __m256 ip_0 = _mm256_loadu_ps(ip_line + j + 0);
+        const __m256 ip_1 = _mm256_loadu_ps(ip_line + j + 8);
+
+        __m256 distances_0 = _mm256_fmadd_ps(ip_0, mul_minus2, y_norm_0);
+        __m256 distances_1 = _mm256_fmadd_ps(ip_1, mul_minus2, y_norm_1);
+
+        const __m256 comparison_0 = _mm256_cmp_ps(min_distances, distances_0, _CMP_LE_OS);
+
+        min_distances = _mm256_blendv_ps(distances_0, min_distances, comparison_0);
+        min_indices = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(current_indices), _mm256_castsi256_ps(min_indices), comparison_0));
+        current_indices = _mm256_add_epi32(current_indices, indices_delta);
+
+        const __m256 comparison_1 = _mm256_cmp_ps(min_distances, distances_1, _CMP_LE_OS);
+
+        min_distances = _mm256_blendv_ps(distances_1, min_distances, comparison_1);
+        min_indices = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(current_indices), _mm256_castsi256_ps(min_indices), comparison_1));
+        current_indices = _mm256_add_epi32(current_indices, indices_delta);
+    }
+
+    f32 min_distances_scalar[8];
+    u32 min_indices_scalar[8];
+    _mm256_storeu_ps(min_distances_scalar, min_distances);
+    _mm256_storeu_si256((__m256i *)(min_indices_scalar), min_indices);
+
+    min_distance = LimitMax<f32>();
+    min_index = 0;
+    for (u32 jv = 0; jv < 8; ++jv) {
+        if (min_distance > min_distances_scalar[jv] || (min_distance == min_distances_scalar[jv] && min_index > min_indices_scalar[jv])) {
+            min_distance = min_distances_scalar[jv];
+            min_index = min_indices_scalar[jv];
+        }
+    }
+
+    for (; j < n; ++j) {
+        f32 distance = square_y[j] - 2 * ip_line[j];
+        if (distance < min_distance) {
+            min_distance = distance;
+            min_index = j;
+        }
+    }
+}
+#endif
+
+void MinOfLine(const f32 *ip_line, const f32 *square_y, u32 n, f32 &min_distance, u32 &min_index) {
+    static const auto func = [] {
+#if defined(USE_AVX)
+        if (SupportAVX2()) {
+            return MinOfLineAVX2;
+        }
+#endif
+        return MinOfLineBF;
+    }();
+    func(ip_line, square_y, n, min_distance, min_index);
+}
+
 export template <typename ID>
 void search_top_1_with_sgemm(u32 dimension,
                              u32 nx,
@@ -44,7 +136,8 @@ void search_top_1_with_sgemm(u32 dimension,
     std::fill_n(distances, nx, LimitMax<f32>());
     auto square_x = MakeUniqueForOverwrite<f32[]>(nx);
     auto square_y = MakeUniqueForOverwrite<f32[]>(ny);
-    auto x_y_inner_product_buffer = MakeUniqueForOverwrite<f32[]>(block_size_x * block_size_y);
+    // a single block is enough for few queries, e.g. the centroids probe of one query
+    auto x_y_inner_product_buffer = MakeUniqueForOverwrite<f32[]>(Min(nx, block_size_x) * Min(ny, block_size_y));
     L2NormsSquares(square_x.get(), x, dimension, nx);
     L2NormsSquares(square_y.get(), y, dimension, ny);
     for (u32 x_part_begin = 0; x_part_begin < nx; x_part_begin += block_size_x) {
@@ -63,85 +156,13 @@ void search_top_1_with_sgemm(u32 dimension,
                 u32 x_id = i + x_part_begin;
                 float *ip_line = x_y_inner_product_buffer.get() + i * y_part_size;
 
-                _mm_prefetch(ip_line, _MM_HINT_NTA);
-                _mm_prefetch(ip_line + 16, _MM_HINT_NTA);
-
-                const __m256 mul_minus2 = _mm256_set1_ps(-2);
-
-                __m256 min_distances = _mm256_set1_ps(distances[x_id] - square_x[x_id]);
-
-                __m256i min_indices = _mm256_set1_epi32(0);
-
-                __m256i current_indices = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
-                const __m256i indices_delta = _mm256_set1_epi32(8);
-
-                u32 j = 0;
-                for (; j < (y_part_size / 16) * 16; j += 16, ip_line += 16) {
-                    u32 j_id = j + y_part_begin;
-                    _mm_prefetch(ip_line + 32, _MM_HINT_NTA);
-                    _mm_prefetch(ip_line + 48, _MM_HINT_NTA);
-
-                    const __m256 y_norm_0 = _mm256_loadu_ps(square_y.get() + j_id + 0);
-                    const __m256 y_norm_1 = _mm256_loadu_ps(square_y.get() + j_id + 8);
-
-                    const __m256 ip_0 = _mm256_loadu_ps(ip_line + 0);
-                    const __m256 ip_1 = _mm256_loadu_ps(ip_line + 8);
-
-                    __m256 distances_0 = _mm256_fmadd_ps(ip_0, mul_minus2, y_norm_0);
-                    __m256 distances_1 = _mm256_fmadd_ps(ip_1, mul_minus2, y_norm_1);
-
-                    const __m256 comparison_0 = _mm256_cmp_ps(min_distances, distances_0, _CMP_LE_OS);
-
-                    min_distances = _mm256_blendv_ps(distances_0, min_distances, comparison_0);
-                    min_indices =
-                        _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(current_indices), _mm256_castsi256_ps(min_indices), comparison_0));
-                    current_indices = _mm256_add_epi32(current_indices, indices_delta);
-
-                    const __m256 comparison_1 = _mm256_cmp_ps(min_distances, distances_1, _CMP_LE_OS);
-
-                    min_distances = _mm256_blendv_ps(distances_1, min_distances, comparison_1);
-                    min_indices =
-                        _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(current_indices), _mm256_castsi256_ps(min_indices), comparison_1));
-                    current_indices = _mm256_add_epi32(current_indices, indices_delta);
-                }
-
-                f32 min_distances_scalar[8];
-                u32 min_indices_scalar[8];
-                _mm256_storeu_ps(min_distances_scalar, min_distances);
-                _mm256_storeu_si256((__m256i *)(min_indices_scalar), min_indices);
-
-                f32 current_min_distance = distances[x_id];
-                ID current_min_index = labels[x_id];
-
-                for (u32 jv = 0; jv < 8; ++jv) {
-                    f32 distance_candidate = min_distances_scalar[jv] + square_x[x_id];
-
-                    if (distance_candidate < 0)
-                        distance_candidate = 0;
-
-                    u32 index_candidate = min_indices_scalar[jv] + y_part_begin;
-
-                    if (current_min_distance > distance_candidate) {
-                        current_min_distance = distance_candidate;
-                        current_min_index = index_candidate;
-                    } else if (current_min_distance == distance_candidate && current_min_index > index_candidate) {
-                        current_min_index = index_candidate;
-                    }
-                }
-
-                for (; j < y_part_size; ++j, ++ip_line) {
-                    f32 ip = *ip_line;
-                    f32 dis = square_x[x_id] + square_y[j + y_part_begin] - 2 * ip;
-                    if (dis < 0)
-                        dis = 0;
-                    if (current_min_distance > dis) {
-                        current_min_distance = dis;
-                        current_min_index = j + y_part_begin;
-                    }
-                }
+                f32 current_min_distance = 0;
+                u32 current_min_index = 0;
+                MinOfLine(ip_line, square_y.get() + y_part_begin, y_part_size, current_min_distance, current_min_index);
+                current_min_distance = Max(current_min_distance + square_x[x_id], 0.0f);
                 if (distances[x_id] > current_min_distance) {
                     distances[x_id] = current_min_distance;
-                    labels[x_id] = current_min_index;
+                    labels[x_id] = current_min_index + y_part_begin;
                 }
             }
         }
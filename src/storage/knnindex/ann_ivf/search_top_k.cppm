@@ -22,6 +22,7 @@ import stl;
 import vector_distance;
 import search_top_1_sgemm;
 import search_top_k_sgemm;
+import mlas_matrix_multiply;
 import heap_twin_operation;
 import knn_result_handler;
 
@@ -80,6 +81,55 @@ void search_top_1_without_dis(u32 dimension, u32 nx, const TypeX *x, u32 ny, con
     }
 }
 
+// the labels of the largest inner products, e.g. the partitions of the vectors for the inner product metric
+export template <typename DistType, typename TypeX, typename TypeY, typename ID>
+void search_top_1_ip_without_dis(u32 dimension, u32 nx, const TypeX *x, u32 ny, const TypeY *y, ID *labels) {
+    if constexpr (std::is_same_v<DistType, TypeX> && std::is_same_v<DistType, TypeY> && std::is_same_v<DistType, f32>) {
+        constexpr u32 block_size_x = 4096;
+        constexpr u32 block_size_y = 1024;
+        if (nx == 0 || ny == 0) {
+            return;
+        }
+        Vector<f32> max_ips(nx, LimitLowest<f32>());
+        Fill(labels, labels + nx, 0);
+        Vector<f32> ip_block(SizeT(Min(nx, block_size_x)) * Min(ny, block_size_y));
+        for (u32 x_begin = 0; x_begin < nx; x_begin += block_size_x) {
+            u32 x_end = Min(nx, x_begin + block_size_x);
+            for (u32 y_begin = 0; y_begin < ny; y_begin += block_size_y) {
+                u32 y_end = Min(ny, y_begin + block_size_y);
+                matrixA_multiply_transpose_matrixB_output_to_C(x + SizeT(x_begin) * dimension,
+                                                               y + SizeT(y_begin) * dimension,
+                                                               x_end - x_begin,
+                                                               y_end - y_begin,
+                                                               dimension,
+                                                               ip_block.data());
+                for (u32 i = x_begin; i < x_end; ++i) {
+                    const f32 *ip_line = ip_block.data() + SizeT(i - x_begin) * (y_end - y_begin);
+                    for (u32 j = y_begin; j < y_end; ++j, ++ip_line) {
+                        if (*ip_line > max_ips[i]) {
+                            max_ips[i] = *ip_line;
+                            labels[i] = j;
+                        }
+                    }
+                }
+            }
+        }
+    } else {
+        for (u32 i = 0; i < nx; ++i) {
+            DistType max_ip = LimitLowest<DistType>();
+            u32 max_idx = 0;
+            for (u32 j = 0; j < ny; ++j) {
+                DistType ip = IPDistance<DistType>(x + SizeT(i) * dimension, y + SizeT(j) * dimension, dimension);
+                if (ip > max_ip) {
+                    max_ip = ip;
+                    max_idx = j;
+                }
+            }
+            labels[i] = max_idx;
+        }
+    }
+}
+
 template <typename TypeX, typename TypeY, typename ID, typename DistType>
 void search_top_k_simple_with_dis(u32 k, u32 dimension, u32 nx, const TypeX *x, u32 ny, const TypeY *y, ID *labels, DistType *distances, bool sort_) {
     heap_twin_multiple<CompareMax<DistType, ID>> heap(nx, k, distances, labels);
@@ -15,7 +15,6 @@
 module;
 #include <algorithm>
 #include <functional>
-#include <immintrin.h>
 #include <limits>
 import stl;
 import knn_result_handler;
@@ -50,7 +49,8 @@ void search_top_k_with_sgemm(u32 k,
     heap.initialize();
     auto square_x = MakeUniqueForOverwrite<f32[]>(nx);
     auto square_y = MakeUniqueForOverwrite<f32[]>(ny);
-    auto x_y_inner_product_buffer = MakeUniqueForOverwrite<f32[]>(block_size_x * block_size_y);
+    // a single block is enough for few queries, e.g. the centroids probe of one query
+    auto x_y_inner_product_buffer = MakeUniqueForOverwrite<f32[]>(Min(nx, block_size_x) * Min(ny, block_size_y));
     L2NormsSquares(square_x.get(), x, dimension, nx);
     L2NormsSquares(square_y.get(), y, dimension, ny);
     for (u32 x_part_begin = 0; x_part_begin < nx; x_part_begin += block_size_x) {
@@ -69,57 +69,12 @@ void search_top_k_with_sgemm(u32 k,
                 u32 x_id = i + x_part_begin;
                 float *ip_line = x_y_inner_product_buffer.get() + i * y_part_size;
 
-                _mm_prefetch(ip_line, _MM_HINT_NTA);
-                _mm_prefetch(ip_line + 16, _MM_HINT_NTA);
-
-                const __m256 x_norm = _mm256_set1_ps(square_x[x_id]);
-                const __m256 mul_minus2 = _mm256_set1_ps(-2);
-
-                __m256i current_indices_0 = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
-                __m256i current_indices_1 = _mm256_setr_epi32(8, 9, 10, 11, 12, 13, 14, 15);
-                const __m256i indices_delta = _mm256_set1_epi32(16);
-
-                u32 j = 0;
-                for (; j < (y_part_size / 16) * 16; j += 16, ip_line += 16) {
-                    u32 j_id = j + y_part_begin;
-                    _mm_prefetch(ip_line + 32, _MM_HINT_NTA);
-                    _mm_prefetch(ip_line + 48, _MM_HINT_NTA);
-
-                    const __m256 y_norm_0 = _mm256_loadu_ps(square_y.get() + j_id + 0);
-                    const __m256 y_norm_1 = _mm256_loadu_ps(square_y.get() + j_id + 8);
-
-                    const __m256 ip_0 = _mm256_loadu_ps(ip_line + 0);
-                    const __m256 ip_1 = _mm256_loadu_ps(ip_line + 8);
-
-                    __m256 distances_0 = _mm256_fmadd_ps(ip_0, mul_minus2, y_norm_0);
-                    __m256 distances_1 = _mm256_fmadd_ps(ip_1, mul_minus2, y_norm_1);
-
-                    f32 distances_scalar_0[8];
-                    f32 distances_scalar_1[8];
-                    u32 indices_scalar_0[8];
-                    u32 indices_scalar_1[8];
-
-                    _mm256_storeu_ps(distances_scalar_0, _mm256_add_ps(distances_0, x_norm));
-                    _mm256_storeu_si256((__m256i *)(indices_scalar_0), current_indices_0);
-                    current_indices_0 = _mm256_add_epi32(current_indices_0, indices_delta);
-
-                    _mm256_storeu_ps(distances_scalar_1, _mm256_add_ps(distances_1, x_norm));
-                    _mm256_storeu_si256((__m256i *)(indices_scalar_1), current_indices_1);
-                    current_indices_1 = _mm256_add_epi32(current_indices_1, indices_delta);
-
-                    for (u32 jv = 0; jv < 8; ++jv) {
-                        f32 distance_candidate_0 = distances_scalar_0[jv];
-                        u32 index_candidate_0 = indices_scalar_0[jv] + y_part_begin;
-                        f32 distance_candidate_1 = distances_scalar_1[jv];
-                        u32 index_candidate_1 = indices_scalar_1[jv] + y_part_begin;
-                        heap.add(x_id, distance_candidate_0, index_candidate_0);
-                        heap.add(x_id, distance_candidate_1, index_candidate_1);
-                    }
+                // the distances of a line are computed in place by a loop the compiler vectorizes, then pushed to the heap
+                for (u32 j = 0; j < y_part_size; ++j) {
+                    ip_line[j] = square_x[x_id] + square_y[j + y_part_begin] - 2 * ip_line[j];
                 }
-                for (; j < y_part_size; ++j, ++ip_line) {
-                    f32 ip = *ip_line;
-                    f32 dis = square_x[x_id] + square_y[j + y_part_begin] - 2 * ip;
-                    heap.add(x_id, dis, j + y_part_begin);
+                for (u32 j = 0; j < y_part_size; ++j) {
+                    heap.add(x_id, ip_line[j], j + y_part_begin);
                 }
             }
         }
@@ -14,14 +14,52 @@
 
 module;
 
-#include <immintrin.h>
+#include "storage/knnindex/knn_hnsw/header.h"
 import stl;
+import hnsw_simd_func;
 export module some_simd_functions;
 
 namespace infinity {
 
+f32 L2DistanceBF(const f32 *vector1, const f32 *vector2, u32 dimension) {
+    f32 distance = 0;
+    for (u32 i = 0; i < dimension; ++i) {
+        auto diff = vector1[i] - vector2[i];
+        distance += diff * diff;
+    }
+    return distance;
+}
+
+f32 IPDistanceBF(const f32 *vector1, const f32 *vector2, u32 dimension) {
+    f32 distance = 0;
+    for (u32 i = 0; i < dimension; ++i) {
+        distance += vector1[i] * vector2[i];
+    }
+    return distance;
+}
+
+f32 IPAndNormSquareBF(const f32 *vector1, const f32 *vector2, u32 dimension, f32 &norm_square) {
+    f32 ip = 0;
+    norm_square = 0;
+    for (u32 i = 0; i < dimension; ++i) {
+        ip += vector1[i] * vector2[i];
+        norm_square += vector2[i] * vector2[i];
+    }
+    return ip;
+}
+
+f32 PQTableDistanceBF(const f32 *table, const u8 *codes, u32 subspace_num) {
+    f32 distance = 0;
+    for (u32 i = 0; i < subspace_num; ++i) {
+        distance += table[i * 256 + codes[i]];
+    }
+    return distance;
+}
+
+#if defined(USE_AVX)
+
 // x = ( x7, x6, x5, x4, x3, x2, x1, x0 )
-float calc_256_sum_8(__m256 x) {
+AVX2_TARGET float calc_256_sum_8(__m256 x) {
     // high_quad = ( x7, x6, x5, x4 )
     const __m128 high_quad = _mm256_extractf128_ps(x, 1);
     // low_quad = ( x3, x2, x1, x0 )
@@ -43,7 +81,7 @@ float calc_256_sum_8(__m256 x) {
     return _mm_cvtss_f32(sum);
 }
 
-export f32 L2Distance_simd(const f32 *vector1, const f32 *vector2, u32 dimension) {
+AVX2_TARGET f32 L2DistanceAVX2(const f32 *vector1, const f32 *vector2, u32 dimension) {
     u32 i = 0;
     __m256 sum_1 = _mm256_setzero_ps();
     __m256 sum_2 = _mm256_setzero_ps();
@@ -74,7 +112,7 @@ export f32 L2Distance_simd(const f32 *vector1, const f32 *vector2, u32 dimension
     return distance;
 }
 
-export f32 IPDistance_simd(const f32 *vector1, const f32 *vector2, u32 dimension) {
+AVX2_TARGET f32 IPDistanceAVX2(const f32 *vector1, const f32 *vector2, u32 dimension) {
     u32 i = 0;
     __m256 sum_1 = _mm256_setzero_ps();
     __m256 sum_2 = _mm256_setzero_ps();
@@ -101,4 +139,92 @@ export f32 IPDistance_simd(const f32 *vector1, const f32 *vector2, u32 dimension
     return distance;
 }
 
+AVX2_TARGET f32 IPAndNormSquareAVX2(const f32 *vector1, const f32 *vector2, u32 dimension, f32 &norm_square) {
+    u32 i = 0;
+    __m256 ip_sum = _mm256_setzero_ps();
+    __m256 norm_sum = _mm256_setzero_ps();
+    for (; i + 8 <= dimension; i += 8) {
+        __m256 v2 = _mm256_loadu_ps(vector2 + i);
+        ip_sum = _mm256_add_ps(ip_sum, _mm256_mul_ps(_mm256_loadu_ps(vector1 + i), v2));
+        norm_sum = _mm256_add_ps(norm_sum, _mm256_mul_ps(v2, v2));
+    }
+    f32 ip = calc_256_sum_8(ip_sum);
+    norm_square = calc_256_sum_8(norm_sum);
+    for (; i < dimension; ++i) {
+        ip += vector1[i] * vector2[i];
+        norm_square += vector2[i] * vector2[i];
+    }
+    return ip;
+}
+
+AVX2_TARGET f32 PQTableDistanceAVX2(const f32 *table, const u8 *codes, u32 subspace_num) {
+    u32 i = 0;
+    const __m256i offsets = _mm256_setr_epi32(0, 256, 512, 768, 1024, 1280, 1536, 1792);
+    __m256 sum = _mm256_setzero_ps();
+    for (; i + 8 <= subspace_num; i += 8) {
+        // 8 codes are widened to the indexes of 8 consecutive tables
+        __m256i idx = _mm256_add_epi32(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)(codes + i))), offsets);
+        sum = _mm256_add_ps(sum, _mm256_i32gather_ps(table + i * 256, idx, sizeof(f32)));
+    }
+    f32 distance = calc_256_sum_8(sum);
+    for (; i < subspace_num; ++i) {
+        distance += table[i * 256 + codes[i]];
+    }
+    return distance;
+}
+
+#endif
+
+// the avx2 kernels on the cpus that support them, the scalar loops on the others
+
+export f32 L2Distance_simd(const f32 *vector1, const f32 *vector2, u32 dimension) {
+    static const auto func = [] {
+#if defined(USE_AVX)
+        if (SupportAVX2()) {
+            return L2DistanceAVX2;
+        }
+#endif
+        return L2DistanceBF;
+    }();
+    return func(vector1, vector2, dimension);
+}
+
+export f32 IPDistance_simd(const f32 *vector1, const f32 *vector2, u32 dimension) {
+    static const auto func = [] {
+#if defined(USE_AVX)
+        if (SupportAVX2()) {
+            return IPDistanceAVX2;
+        }
+#endif
+        return IPDistanceBF;
+    }();
+    return func(vector1, vector2, dimension);
+}
+
+// the inner product of two vectors, and the squared l2 norm of `vector2` computed in the same pass
+export f32 IPAndNormSquare_simd(const f32 *vector1, const f32 *vector2, u32 dimension, f32 &norm_square) {
+    static const auto func = [] {
+#if defined(USE_AVX)
+        if (SupportAVX2()) {
+            return IPAndNormSquareAVX2;
+        }
+#endif
+        return IPAndNormSquareBF;
+    }();
+    return func(vector1, vector2, dimension, norm_square);
+}
+
+// sum of table[i * 256 + codes[i]] for i in [0, subspace_num), the distance looked up for a product quantization code
+export f32 PQTableDistance_simd(const f32 *table, const u8 *codes, u32 subspace_num) {
+    static const auto func = [] {
+#if defined(USE_AVX)
+        if (SupportAVX2()) {
+            return PQTableDistanceAVX2;
+        }
+#endif
+        return PQTableDistanceBF;
+    }();
+    return func(table, codes, subspace_num);
+}
+
 } // namespace infinity
\ No newline at end of file
@@ -13,17 +13,30 @@
 // limitations under the License.
 
 module;
+#include <cmath>
 #include <type_traits>
 import stl;
 import some_simd_functions;
+import hnsw_simd_func;
+import parser;
 
 export module vector_distance;
 
 namespace infinity {
+
+template <typename ElemType>
+constexpr bool IsHalf = std::is_same_v<ElemType, float16_t> || std::is_same_v<ElemType, bfloat16_t>;
+
 export template <typename DiffType, typename ElemType1, typename ElemType2, typename DimType = u32>
 DiffType L2Distance(const ElemType1 *vector1, const ElemType2 *vector2, const DimType dimension) {
     if constexpr (std::is_same_v<ElemType1, f32> && std::is_same_v<ElemType2, f32>) {
         return L2Distance_simd(vector1, vector2, dimension);
+    } else if constexpr (std::is_same_v<ElemType1, f32> && IsHalf<ElemType2>) {
+        // a f32 query to half precision vectors, which are widened to f32
+        return HalfL2(vector1, vector2, dimension);
+    } else if constexpr (std::is_same_v<ElemType1, i8> && std::is_same_v<ElemType2, i8>) {
+        // accumulated in i32
+        return I8L2(vector1, vector2, dimension);
     } else {
         DiffType distance{};
         for (u32 i = 0; i < dimension; ++i) {
@@ -38,6 +51,10 @@ export template <typename DiffType, typename ElemType1, typename ElemType2, type
 DiffType IPDistance(const ElemType1 *vector1, const ElemType2 *vector2, const DimType dimension) {
     if constexpr (std::is_same_v<ElemType1, f32> && std::is_same_v<ElemType2, f32>) {
         return IPDistance_simd(vector1, vector2, dimension);
+    } else if constexpr (std::is_same_v<ElemType1, f32> && IsHalf<ElemType2>) {
+        return HalfIP(vector1, vector2, dimension);
+    } else if constexpr (std::is_same_v<ElemType1, i8> && std::is_same_v<ElemType2, i8>) {
+        return I8IP(vector1, vector2, dimension);
     } else {
         DiffType distance{};
         for (u32 i = 0; i < dimension; ++i) {
@@ -47,11 +64,43 @@ DiffType IPDistance(const ElemType1 *vector1, const ElemType2 *vector2, const Di
     }
 }
 
+// the cosine similarity to a normalized `vector1`, so only the norm of `vector2` is computed
+export template <typename DiffType, typename ElemType1, typename ElemType2, typename DimType = u32>
+DiffType CosineDistance(const ElemType1 *vector1, const ElemType2 *vector2, const DimType dimension) {
+    DiffType ip{};
+    DiffType norm_square{};
+    if constexpr (std::is_same_v<ElemType1, f32> && std::is_same_v<ElemType2, f32>) {
+        ip = IPAndNormSquare_simd(vector1, vector2, dimension, norm_square);
+    } else {
+        ip = IPDistance<DiffType>(vector1, vector2, dimension);
+        norm_square = IPDistance<DiffType>(vector2, vector2, dimension);
+    }
+    return norm_square > 0 ? ip / std::sqrt(norm_square) : 0;
+}
+
+// the number of different bits of two packed bit vectors of `byte_count` bytes
+export template <typename DiffType, typename DimType = u32>
+DiffType HammingDistance(const u8 *vector1, const u8 *vector2, const DimType byte_count) {
+    return Hamming(vector1, vector2, byte_count);
+}
+
 export template <typename DiffType, typename ElemType, typename DimType = u32>
 DiffType L2NormSquare(const ElemType *vector, const DimType dimension) {
     return IPDistance<DiffType>(vector, vector, dimension);
 }
 
+// scale `vector` to unit l2 norm, a zero vector is kept
+export template <typename ElemType, typename DimType = u32>
+void L2Normalize(ElemType *vector, const DimType dimension) {
+    f32 norm_square = L2NormSquare<f32>(vector, dimension);
+    if (norm_square > 0) {
+        f32 div = 1.0f / std::sqrt(norm_square);
+        for (DimType i = 0; i < dimension; ++i) {
+            vector[i] *= div;
+        }
+    }
+}
+
 export template <typename DiffType, typename ElemType, typename DimType = u32, typename CntType = u32>
 void L2NormsSquares(DiffType *__restrict output, const ElemType *__restrict vectors, const DimType dimension, const CntType count) {
     for (u32 i = 0; i < count; ++i) {
@@ -0,0 +1,420 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <random>
+
+import stl;
+import file_system;
+import file_system_type;
+import local_file_system;
+import index_base;
+import product_quantizer;
+import vector_distance;
+import default_values;
+import infinity_exception;
+import third_party;
+import bitmask;
+
+export module diskann_index;
+
+namespace infinity {
+
+// a vamana graph whose vectors and neighbors are kept in a file on the local disk, only the product quantization codes of the
+// vectors are in memory. a node in the file is [dimension f32 of the vector][u32 degree][R u32 neighbors]. the nodes are packed
+// in sectors of `DISKANN_SECTOR_SIZE` and a node never crosses a sector unless it is larger than a sector, so that a node is
+// read from the disk in one request. the first sector is the header.
+// the graph is static, the index of new vectors is built again. a graph is built into the file of `build_path`, and moved to
+// the file beside the saved codes when they are saved, so that the graph of the codes saved before is kept until then.
+export class DiskAnnIndex {
+    // the prune keeps a neighbor unless it is this times closer to a kept neighbor than to the vertex
+    static constexpr f32 ALPHA = 1.2f;
+
+    struct Candidate {
+        f32 distance_;
+        u32 id_;
+        bool expanded_;
+    };
+
+public:
+    DiskAnnIndex(MetricType metric, u32 dimension, u32 R, u32 L, u32 subspace_num, String build_path)
+        : metric_(metric), dimension_(dimension), R_(R), L_(L), pq_(dimension, subspace_num), build_path_(Move(build_path)),
+          disk_path_(build_path_) {}
+
+    DiskAnnIndex(const DiskAnnIndex &) = delete;
+
+    u32 data_num() const { return data_num_; }
+
+    u32 dimension() const { return dimension_; }
+
+    const String &disk_path() const { return disk_path_; }
+
+    // the graph of the codes read by `ReadIndexInner` is in `disk_path`
+    void SetDiskPath(String disk_path) { disk_path_ = Move(disk_path); }
+
+    // move the graph file to `disk_path`, if the graph is built. the opened file is still read by the searches.
+    void MoveDiskFile(const String &disk_path) {
+        if (disk_path == disk_path_) {
+            return;
+        }
+        if (fs_.Exists(disk_path_)) {
+            CreateParentDirectory(disk_path);
+            fs_.Rename(disk_path_, disk_path);
+        }
+        disk_path_ = disk_path;
+    }
+
+    // build the graph of the vectors in memory and write it to the disk file, the codes of the vectors are kept
+    void Build(const f32 *vectors, u32 vector_count) {
+        if (metric_ != MetricType::kMerticL2 && metric_ != MetricType::kMerticInnerProduct) {
+            Error<StorageException>("Metric type not supported");
+        }
+        disk_file_.reset();
+        disk_path_ = build_path_;
+        data_num_ = vector_count;
+        medoid_ = 0;
+        codes_.resize(SizeT(vector_count) * pq_.subspace_num());
+        Vector<Vector<u32>> graph(vector_count);
+        if (vector_count > 0) {
+            pq_.Train(vectors, vector_count);
+            pq_.Encode(vectors, vector_count, codes_.data());
+            medoid_ = Medoid(vectors);
+            // the vertices are inserted in random order, a vertex is linked to the vertices it passes by on the way from the medoid
+            Vector<u32> order(vector_count);
+            std::iota(order.begin(), order.end(), 0u);
+            std::shuffle(order.begin(), order.end(), std::mt19937(vector_count));
+            Vector<u32> seen(vector_count, 0);
+            u32 epoch = 0;
+            Vector<Pair<f32, u32>> candidates;
+            for (u32 p : order) {
+                GreedySearch(vectors, VectorAt(vectors, p), graph, seen, ++epoch, candidates);
+                RobustPrune(vectors, p, candidates, graph[p]);
+                for (u32 q : graph[p]) {
+                    auto &q_neighbors = graph[q];
+                    if (std::find(q_neighbors.begin(), q_neighbors.end(), p) != q_neighbors.end()) {
+                        continue;
+                    }
+                    if (q_neighbors.size() < R_) {
+                        q_neighbors.push_back(p);
+                        continue;
+                    }
+                    candidates.clear();
+                    for (u32 n : q_neighbors) {
+                        candidates.emplace_back(Distance(VectorAt(vectors, q), VectorAt(vectors, n)), n);
+                    }
+                    candidates.emplace_back(Distance(VectorAt(vectors, q), VectorAt(vectors, p)), p);
+                    RobustPrune(vectors, q, candidates, q_neighbors);
+                }
+            }
+        }
+        WriteDiskFile(vectors, graph);
+        OpenDiskFile();
+    }
+
+    // beam search from the medoid. the candidates are ordered by the distance to their codes in memory, the `beam_width` closest
+    // candidates not expanded are read from the disk together, and the vectors read are compared exactly.
+    // return the `topk` vectors passing `bitmask` with the distance, smaller is closer. the inner product is negated.
+    Vector<Pair<f32, u32>> KnnSearch(const f32 *query, u32 topk, u32 L, u32 beam_width, const Bitmask &bitmask) const {
+        Vector<Pair<f32, u32>> result;
+        if (data_num_ == 0 || topk == 0) {
+            return result;
+        }
+        L = Max(L, topk);
+        beam_width = Max(beam_width, 1u);
+        Vector<f32> table(SizeT(pq_.subspace_num()) * ProductQuantizer::CENTROID_NUM);
+        if (metric_ == MetricType::kMerticL2) {
+            pq_.MakeL2Table(query, table.data());
+        } else {
+            pq_.MakeIPTable(query, table.data());
+        }
+        auto CodeDistance = [&](u32 id) {
+            f32 distance = pq_.TableDistance(table.data(), codes_.data() + SizeT(id) * pq_.subspace_num());
+            return metric_ == MetricType::kMerticL2 ? distance : -distance;
+        };
+        Vector<Candidate> candidates;
+        candidates.reserve(L + 1);
+        candidates.push_back({CodeDistance(medoid_), medoid_, false});
+        HashSet<u32> seen{medoid_};
+
+        const bool use_bitmask = !bitmask.IsAllTrue();
+        const SizeT read_size = NodeReadSize();
+        auto buffer = MakeUniqueForOverwrite<char[]>(read_size * beam_width);
+        Vector<u32> beam;
+        beam.reserve(beam_width);
+        while (true) {
+            beam.clear();
+            for (auto &candidate : candidates) {
+                if (!candidate.expanded_) {
+                    candidate.expanded_ = true;
+                    beam.push_back(candidate.id_);
+                    if (beam.size() == beam_width) {
+                        break;
+                    }
+                }
+            }
+            if (beam.empty()) {
+                break;
+            }
+            // the reads of the beam are issued before waiting for any of them, so that the disk serves them in parallel
+            for (u32 id : beam) {
+                fs_.Prefetch(*disk_file_, NodeSectorOffset(id), read_size);
+            }
+            for (SizeT i = 0; i < beam.size(); ++i) {
+                fs_.ReadAt(*disk_file_, buffer.get() + i * read_size, read_size, NodeSectorOffset(beam[i]));
+            }
+            for (SizeT i = 0; i < beam.size(); ++i) {
+                u32 id = beam[i];
+                const char *node = buffer.get() + i * read_size + NodeOffsetInSector(id);
+                const auto *vector = reinterpret_cast<const f32 *>(node);
+                const auto *neighbors = reinterpret_cast<const u32 *>(node + SizeT(dimension_) * sizeof(f32));
+                if (!use_bitmask || bitmask.IsTrue(id)) {
+                    result.emplace_back(Distance(query, vector), id);
+                }
+                u32 degree = neighbors[0];
+                for (u32 j = 1; j <= degree; ++j) {
+                    if (seen.insert(neighbors[j]).second) {
+                        InsertCandidate(candidates, L, {CodeDistance(neighbors[j]), neighbors[j], false});
+                    }
+                }
+            }
+        }
+        std::sort(result.begin(), result.end());
+        if (result.size() > topk) {
+            result.resize(topk);
+        }
+        return result;
+    }
+
+    // all the vectors passing `bitmask` within `radius`, smaller is closer. the search is repeated with twice the candidates as
+    // long as the farthest vector found is still within the radius, since more may be beyond the candidate list.
+    Vector<Pair<f32, u32>> KnnRangeSearch(const f32 *query, f32 radius, u32 L, u32 beam_width, const Bitmask &bitmask) const {
+        Vector<Pair<f32, u32>> result;
+        for (L = Max(L, 1u);; L = u32(Min(SizeT(L) * 2, SizeT(data_num_)))) {
+            result = KnnSearch(query, L, L, beam_width, bitmask);
+            if (result.empty() || result.back().first > radius || L >= data_num_) {
+                break;
+            }
+        }
+        auto end = std::upper_bound(result.begin(), result.end(), radius, [](f32 r, const Pair<f32, u32> &p) { return r < p.first; });
+        result.erase(end, result.end());
+        return result;
+    }
+
+    void SaveIndexInner(FileHandler &file_handler) {
+        file_handler.Write(&metric_, sizeof(metric_));
+        file_handler.Write(&dimension_, sizeof(dimension_));
+        file_handler.Write(&R_, sizeof(R_));
+        file_handler.Write(&L_, sizeof(L_));
+        file_handler.Write(&data_num_, sizeof(data_num_));
+        file_handler.Write(&medoid_, sizeof(medoid_));
+        pq_.Save(file_handler);
+        file_handler.Write(codes_.data(), codes_.size());
+    }
+
+    void ReadIndexInner(FileHandler &file_handler) {
+        file_handler.Read(&metric_, sizeof(metric_));
+        file_handler.Read(&dimension_, sizeof(dimension_));
+        file_handler.Read(&R_, sizeof(R_));
+        file_handler.Read(&L_, sizeof(L_));
+        file_handler.Read(&data_num_, sizeof(data_num_));
+        file_handler.Read(&medoid_, sizeof(medoid_));
+        pq_ = ProductQuantizer::Load(file_handler);
+        codes_.resize(SizeT(data_num_) * pq_.subspace_num());
+        file_handler.Read(codes_.data(), codes_.size());
+        // the graph of an empty segment is never built
+        if (data_num_ > 0) {
+            OpenDiskFile();
+        }
+    }
+
+private:
+    const f32 *VectorAt(const f32 *vectors, u32 id) const { return vectors + SizeT(id) * dimension_; }
+
+    f32 Distance(const f32 *v1, const f32 *v2) const {
+        if (metric_ == MetricType::kMerticL2) {
+            return L2Distance<f32>(v1, v2, dimension_);
+        }
+        return -IPDistance<f32>(v1, v2, dimension_);
+    }
+
+    // the vector closest to the mean of the vectors, where every search starts
+    u32 Medoid(const f32 *vectors) const {
+        Vector<f32> mean(dimension_, 0);
+        for (u32 i = 0; i < data_num_; ++i) {
+            const f32 *v = VectorAt(vectors, i);
+            for (u32 j = 0; j < dimension_; ++j) {
+                mean[j] += v[j];
+            }
+        }
+        for (auto &m : mean) {
+            m /= data_num_;
+        }
+        u32 medoid = 0;
+        f32 min_distance = L2Distance<f32>(mean.data(), vectors, dimension_);
+        for (u32 i = 1; i < data_num_; ++i) {
+            if (f32 distance = L2Distance<f32>(mean.data(), VectorAt(vectors, i), dimension_); distance < min_distance) {
+                min_distance = distance;
+                medoid = i;
+            }
+        }
+        return medoid;
+    }
+
+    // insert into the candidates ordered by distance, of which at most `capacity` are kept
+    static void InsertCandidate(Vector<Candidate> &candidates, SizeT capacity, const Candidate &candidate) {
+        if (candidates.size() >= capacity && candidate.distance_ >= candidates.back().distance_) {
+            return;
+        }
+        auto iter = std::upper_bound(candidates.begin(), candidates.end(), candidate.distance_, [](f32 d, const Candidate &c) {
+            return d < c.distance_;
+        });
+        candidates.insert(iter, candidate);
+        if (candidates.size() > capacity) {
+            candidates.pop_back();
+        }
+    }
+
+    // search `query` in the graph being built, `expanded` is all the vertices passed by with their distances to `query`
+    void GreedySearch(const f32 *vectors,
+                      const f32 *query,
+                      const Vector<Vector<u32>> &graph,
+                      Vector<u32> &seen,
+                      u32 epoch,
+                      Vector<Pair<f32, u32>> &expanded) const {
+        expanded.clear();
+        Vector<Candidate> candidates;
+        candidates.reserve(L_ + 1);
+        candidates.push_back({Distance(query, VectorAt(vectors, medoid_)), medoid_, false});
+        seen[medoid_] = epoch;
+        while (true) {
+            auto iter = std::find_if(candidates.begin(), candidates.end(), [](const Candidate &c) { return !c.expanded_; });
+            if (iter == candidates.end()) {
+                break;
+            }
+            iter->expanded_ = true;
+            u32 id = iter->id_;
+            expanded.emplace_back(iter->distance_, id);
+            for (u32 n : graph[id]) {
+                if (seen[n] == epoch) {
+                    continue;
+                }
+                seen[n] = epoch;
+                InsertCandidate(candidates, L_, {Distance(query, VectorAt(vectors, n)), n, false});
+            }
+        }
+    }
+
+    // choose at most R neighbors of `p` from `candidates` with their distances to `p`. a candidate closer to a chosen neighbor
+    // than to `p` is skipped, so the neighbors point to different directions. the distance of l2 is scaled by `ALPHA` to keep
+    // some long edges, which shortens the path of the search.
+    void RobustPrune(const f32 *vectors, u32 p, Vector<Pair<f32, u32>> &candidates, Vector<u32> &neighbors) const {
+        std::sort(candidates.begin(), candidates.end());
+        const f32 alpha = metric_ == MetricType::kMerticL2 ? ALPHA : 1.0f;
+        Vector<bool> pruned(candidates.size(), false);
+        neighbors.clear();
+        for (SizeT i = 0; i < candidates.size() && neighbors.size() < R_; ++i) {
+            u32 id = candidates[i].second;
+            if (pruned[i] || id == p) {
+                continue;
+            }
+            neighbors.push_back(id);
+            for (SizeT j = i + 1; j < candidates.size(); ++j) {
+                if (!pruned[j] && alpha * Distance(VectorAt(vectors, id), VectorAt(vectors, candidates[j].second)) <= candidates[j].first) {
+                    pruned[j] = true;
+                }
+            }
+        }
+    }
+
+    SizeT NodeSize() const { return SizeT(dimension_) * sizeof(f32) + sizeof(u32) + SizeT(R_) * sizeof(u32); }
+
+    // 0 if a node is larger than a sector
+    SizeT NodesPerSector() const { return DISKANN_SECTOR_SIZE / NodeSize(); }
+
+    SizeT NodeReadSize() const {
+        SizeT sector_n = NodesPerSector() > 0 ? 1 : (NodeSize() + DISKANN_SECTOR_SIZE - 1) / DISKANN_SECTOR_SIZE;
+        return sector_n * DISKANN_SECTOR_SIZE;
+    }
+
+    i64 NodeSectorOffset(u32 id) const {
+        SizeT nodes_per_sector = NodesPerSector();
+        SizeT sector = nodes_per_sector > 0 ? id / nodes_per_sector : SizeT(id) * (NodeReadSize() / DISKANN_SECTOR_SIZE);
+        // the first sector is the header
+        return (sector + 1) * DISKANN_SECTOR_SIZE;
+    }
+
+    SizeT NodeOffsetInSector(u32 id) const {
+        SizeT nodes_per_sector = NodesPerSector();
+        return nodes_per_sector > 0 ? id % nodes_per_sector * NodeSize() : 0;
+    }
+
+    void CreateParentDirectory(const String &path) const {
+        SizeT slash = path.rfind('/');
+        if (slash != String::npos) {
+            String dir = path.substr(0, slash);
+            if (!fs_.Exists(dir)) {
+                fs_.CreateDirectory(dir);
+            }
+        }
+    }
+
+    void WriteDiskFile(const f32 *vectors, const Vector<Vector<u32>> &graph) {
+        CreateParentDirectory(disk_path_);
+        auto file_handler = fs_.OpenFile(disk_path_, FileFlags::WRITE_FLAG | FileFlags::TRUNCATE_CREATE, FileLockType::kWriteLock);
+        Vector<char> sector(DISKANN_SECTOR_SIZE, 0);
+        u32 header[] = {data_num_, dimension_, R_, medoid_};
+        std::memcpy(sector.data(), header, sizeof(header));
+        file_handler->Write(sector.data(), sector.size());
+
+        // the nodes of a sector, or the sectors of a node, are written at once
+        Vector<char> page(NodesPerSector() > 0 ? DISKANN_SECTOR_SIZE : NodeReadSize(), 0);
+        SizeT node_per_page = Max(NodesPerSector(), SizeT(1));
+        for (u32 begin = 0; begin < data_num_; begin += node_per_page) {
+            std::fill(page.begin(), page.end(), 0);
+            u32 end = Min(u32(begin + node_per_page), data_num_);
+            for (u32 id = begin; id < end; ++id) {
+                char *node = page.data() + NodeOffsetInSector(id);
+                std::memcpy(node, VectorAt(vectors, id), SizeT(dimension_) * sizeof(f32));
+                u32 degree = graph[id].size();
+                std::memcpy(node + SizeT(dimension_) * sizeof(f32), &degree, sizeof(u32));
+                std::memcpy(node + SizeT(dimension_) * sizeof(f32) + sizeof(u32), graph[id].data(), SizeT(degree) * sizeof(u32));
+            }
+            file_handler->Write(page.data(), page.size());
+        }
+        fs_.SyncFile(*file_handler);
+        file_handler->Close();
+    }
+
+    void OpenDiskFile() { disk_file_ = fs_.OpenFile(disk_path_, FileFlags::READ_FLAG, FileLockType::kNoLock); }
+
+    MetricType metric_{MetricType::kInvalid};
+    u32 dimension_{};
+    u32 R_{};
+    u32 L_{};
+    u32 data_num_{};
+    u32 medoid_{};
+    ProductQuantizer pq_;
+    Vector<u8> codes_; // `pq_.subspace_num()` bytes per vector
+
+    String build_path_;
+    String disk_path_;
+    mutable LocalFileSystem fs_;
+    UniquePtr<FileHandler> disk_file_;
+};
+
+} // namespace infinity
@@ -0,0 +1,38 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+import stl;
+import plain_store;
+import hnsw_simd_func;
+
+export module dist_func_hamming;
+
+namespace infinity {
+
+// the vectors are packed bits, `dim` of the store is the number of bytes of a vector.
+// the distance is the number of different bits, in f32 as the distances of the other embeddings.
+export class PlainHammingDist {
+public:
+    using DataStore = PlainStore<u8>;
+    using StoreType = typename DataStore::StoreType;
+    using DistType = f32;
+
+    PlainHammingDist(SizeT) {}
+
+    DistType operator()(const StoreType &v1, const StoreType &v2, const DataStore &data_store) const { return Hamming(v1, v2, data_store.dim()); }
+};
+
+} // namespace infinity
@@ -14,13 +14,15 @@
 
 module;
 
-#include "header.h"
 #include <type_traits>
 
 import stl;
 import hnsw_common;
 import plain_store;
 import lvq_store;
+import pq_store;
+import half_store;
+import product_quantizer;
 import hnsw_simd_func;
 
 export module dist_func_ip;
@@ -41,21 +43,7 @@ private:
 public:
     PlainIPDist(SizeT dim) {
         if constexpr (std::is_same<DataType, float>()) {
-#if defined(USE_AVX512)
-            if (dim % 16 == 0) {
-                SIMDFunc = F32IPAVX512;
-            } else {
-                SIMDFunc = F32IPBF;
-            }
-#elif defined(USE_AVX)
-            if (dim % 16 == 0) {
-                SIMDFunc = F32IPAVX;
-            } else {
-                SIMDFunc = F32IPBF;
-            }
-#else
-            SIMDFunc = F32IPBF;
-#endif
+            SIMDFunc = GetF32IPFunc();
         }
     }
 
@@ -95,32 +83,26 @@ export template <typename DataType, typename CompressType>
 class LVQIPDist {
 public:
     using This = LVQIPDist<DataType, CompressType>;
-    using DataStore = LVQStore<DataType, CompressType, LVQIPCache<DataType, CompressType>>;
+    using DataStore = LVQStore<DataType, CompressType, LVQIPCache<DataType, typename LVQCodeTraits<CompressType>::ValueType>>;
     using StoreType = typename DataStore::StoreType;
 
 private:
-    using SIMDFuncType = i32 (*)(const CompressType *, const CompressType *, SizeT);
+    using CodeType = typename DataStore::CodeType;
+    using SIMDFuncType = i32 (*)(const CodeType *, const CodeType *, SizeT);
+    using RerankSIMDFuncType = DataType (*)(const DataType *, const DataType *, SizeT);
 
     SIMDFuncType SIMDFunc;
+    RerankSIMDFuncType RerankSIMDFunc = nullptr;
 
 public:
     LVQIPDist(SizeT dim) {
         if constexpr (std::is_same<CompressType, i8>()) {
-#if defined(USE_AVX512)
-            if (dim % 16 == 0) {
-                SIMDFunc = I8IPAVX512;
-            } else {
-                SIMDFunc = I8IPBF;
-            }
-#elif defined(USE_AVX)
-            if (dim % 16 == 0) {
-                SIMDFunc = I8IPAVX;
-            } else {
-                SIMDFunc = I8IPBF;
-            }
-#else
-            SIMDFunc = I8IPBF;
-#endif
+            SIMDFunc = GetLVQI8IPFunc();
+        } else {
+            SIMDFunc = GetU4IPFunc();
+        }
+        if constexpr (DataStore::HAS_RESIDUAL && std::is_same<DataType, float>()) {
+            RerankSIMDFunc = GetF32IPFunc();
         }
     }
 
@@ -136,6 +118,67 @@ public:
                     (bias1 + bias2) * norm1_mean + mean_c_scale_1 + mean_c_scale_2;
         return -dist;
     }
+
+    // the distance of `query` to the `vec_i`th vector with its residual, to re-rank the candidates found with the 4-bit codes.
+    // `buffer` holds a decompressed vector.
+    DataType Rerank(const DataType *query, SizeT vec_i, const DataStore &data_store, DataType *buffer) const
+        requires DataStore::HAS_RESIDUAL
+    {
+        data_store.Decompress(vec_i, buffer);
+        return -RerankSIMDFunc(query, buffer, data_store.dim());
+    }
+};
+
+export template <typename DataType>
+class PQIPTable {
+public:
+    static void MakeTable(const ProductQuantizer &pq, const DataType *query, DataType *table) { pq.MakeIPTable(query, table); }
+};
+
+// a query looks up its distances in its table, two stored vectors are compared through the centroids of their codes
+export template <typename DataType>
+class PQIPDist {
+public:
+    using DataStore = PQStore<DataType, PQIPTable<DataType>>;
+    using StoreType = typename DataStore::StoreType;
+
+    PQIPDist(SizeT) {}
+
+    DataType operator()(const StoreType &v1, const StoreType &v2, const DataStore &data_store) const {
+        if (v1.table_ != nullptr) {
+            return -data_store.pq().TableDistance(v1.table_, v2.codes_);
+        }
+        return -data_store.pq().CodeIPDistance(v1.codes_, v2.codes_);
+    }
+};
+
+// a query is compared in f32 with the widened stored vectors, two stored vectors are compared in their half precision
+export template <typename DataType, typename HalfType>
+class HalfIPDist {
+public:
+    using DataStore = HalfStore<DataType, HalfType>;
+    using StoreType = typename DataStore::StoreType;
+
+    HalfIPDist(SizeT) {}
+
+    DataType operator()(const StoreType &v1, const StoreType &v2, const DataStore &data_store) const {
+        if (v1.query_ != nullptr) {
+            return -HalfIP(v1.query_, v2.vec_, data_store.dim());
+        }
+        return -HalfIP(v1.vec_, v2.vec_, data_store.dim());
+    }
+};
+
+// the negative inner product of int8 vectors, accumulated in i32
+export class I8IPDist {
+public:
+    using DataStore = PlainStore<i8>;
+    using StoreType = typename DataStore::StoreType;
+    using DistType = f32;
+
+    I8IPDist(SizeT) {}
+
+    DistType operator()(const StoreType &v1, const StoreType &v2, const DataStore &data_store) const { return -I8IP(v1, v2, data_store.dim()); }
 };
 
 } // namespace infinity
\ No newline at end of file
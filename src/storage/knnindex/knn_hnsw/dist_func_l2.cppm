@@ -14,13 +14,15 @@
 
 module;
 
-#include "header.h"
 #include <type_traits>
 
 import stl;
 import hnsw_common;
 import plain_store;
 import lvq_store;
+import pq_store;
+import half_store;
+import product_quantizer;
 import hnsw_simd_func;
 
 export module dist_func_l2;
@@ -41,21 +43,7 @@ private:
 public:
     PlainL2Dist(SizeT dim) {
         if constexpr (std::is_same<DataType, float>()) {
-#if defined(USE_AVX512)
-            if (dim % 16 == 0) {
-                SIMDFunc = F32L2AVX512;
-            } else {
-                SIMDFunc = F32L2BF;
-            }
-#elif defined(USE_AVX)
-            if (dim % 16 == 0) {
-                SIMDFunc = F32L2AVX;
-            } else {
-                SIMDFunc = F32L2BF;
-            }
-#else
-            SIMDFunc = F32L2BF;
-#endif
+            SIMDFunc = GetF32L2Func();
         }
     }
 
@@ -86,32 +74,26 @@ export template <typename DataType, typename CompressType>
 class LVQL2Dist {
 public:
     using This = LVQL2Dist<DataType, CompressType>;
-    using DataStore = LVQStore<DataType, CompressType, LVQL2Cache<DataType, CompressType>>;
+    using DataStore = LVQStore<DataType, CompressType, LVQL2Cache<DataType, typename LVQCodeTraits<CompressType>::ValueType>>;
     using StoreType = typename DataStore::StoreType;
 
 private:
-    using SIMDFuncType = i32 (*)(const CompressType *, const CompressType *, SizeT);
+    using CodeType = typename DataStore::CodeType;
+    using SIMDFuncType = i32 (*)(const CodeType *, const CodeType *, SizeT);
+    using RerankSIMDFuncType = DataType (*)(const DataType *, const DataType *, SizeT);
 
     SIMDFuncType SIMDFunc = nullptr;
+    RerankSIMDFuncType RerankSIMDFunc = nullptr;
 
 public:
     LVQL2Dist(SizeT dim) {
         if constexpr (std::is_same<CompressType, i8>()) {
-#if defined(USE_AVX512)
-            if (dim % 64 == 0) {
-                SIMDFunc = I8IPAVX512;
-            } else {
-                SIMDFunc = I8IPBF;
-            }
-#elif defined(USE_AVX)
-            if (dim % 32 == 0) {
-                SIMDFunc = I8IPAVX;
-            } else {
-                SIMDFunc = I8IPBF;
-            }
-#else
-            SIMDFunc = I8IPBF;
-#endif
+            SIMDFunc = GetLVQI8IPFunc();
+        } else {
+            SIMDFunc = GetU4IPFunc();
+        }
+        if constexpr (DataStore::HAS_RESIDUAL && std::is_same<DataType, float>()) {
+            RerankSIMDFunc = GetF32L2Func();
         }
     }
 
@@ -126,6 +108,67 @@ public:
         return norm2sq_scalesq_1 + norm2sq_scalesq_2 + beta * beta * dim - 2 * scale1 * scale2 * c1c2_ip + 2 * beta * norm1_scale_1 -
                2 * beta * norm1_scale_2;
     }
+
+    // the distance of `query` to the `vec_i`th vector with its residual, to re-rank the candidates found with the 4-bit codes.
+    // `buffer` holds a decompressed vector.
+    DataType Rerank(const DataType *query, SizeT vec_i, const DataStore &data_store, DataType *buffer) const
+        requires DataStore::HAS_RESIDUAL
+    {
+        data_store.Decompress(vec_i, buffer);
+        return RerankSIMDFunc(query, buffer, data_store.dim());
+    }
+};
+
+export template <typename DataType>
+class PQL2Table {
+public:
+    static void MakeTable(const ProductQuantizer &pq, const DataType *query, DataType *table) { pq.MakeL2Table(query, table); }
+};
+
+// a query looks up its distances in its table, two stored vectors are compared through the centroids of their codes
+export template <typename DataType>
+class PQL2Dist {
+public:
+    using DataStore = PQStore<DataType, PQL2Table<DataType>>;
+    using StoreType = typename DataStore::StoreType;
+
+    PQL2Dist(SizeT) {}
+
+    DataType operator()(const StoreType &v1, const StoreType &v2, const DataStore &data_store) const {
+        if (v1.table_ != nullptr) {
+            return data_store.pq().TableDistance(v1.table_, v2.codes_);
+        }
+        return data_store.pq().CodeL2Distance(v1.codes_, v2.codes_);
+    }
+};
+
+// a query is compared in f32 with the widened stored vectors, two stored vectors are compared in their half precision
+export template <typename DataType, typename HalfType>
+class HalfL2Dist {
+public:
+    using DataStore = HalfStore<DataType, HalfType>;
+    using StoreType = typename DataStore::StoreType;
+
+    HalfL2Dist(SizeT) {}
+
+    DataType operator()(const StoreType &v1, const StoreType &v2, const DataStore &data_store) const {
+        if (v1.query_ != nullptr) {
+            return HalfL2(v1.query_, v2.vec_, data_store.dim());
+        }
+        return HalfL2(v1.vec_, v2.vec_, data_store.dim());
+    }
+};
+
+// int8 vectors, the distance is accumulated in i32 and returned in f32 as the distances of the other embeddings
+export class I8L2Dist {
+public:
+    using DataStore = PlainStore<i8>;
+    using StoreType = typename DataStore::StoreType;
+    using DistType = f32;
+
+    I8L2Dist(SizeT) {}
+
+    DistType operator()(const StoreType &v1, const StoreType &v2, const DataStore &data_store) const { return I8L2(v1, v2, data_store.dim()); }
 };
 
 } // namespace infinity
\ No newline at end of file
@@ -14,6 +14,7 @@
 
 module;
 #include <cassert>
+#include <cstdint>
 #include <iostream>
 #include <new>
 
@@ -39,12 +40,21 @@ private:
 
     const SizeT max_vertex_num_;
     char *const graph_;
+    bool graph_mapped_; // `graph_` points into a mapped file
     const SizeT loaded_vertex_n_;
     char *const loaded_layers_;
+    // the layers field of level 0 is the offset of the layers to `layers_base_`. the base is the layers section of a mapped
+    // file, whose fields are the offsets in the section. it is null otherwise, so the fields are the pointers.
+    char *layers_base_{};
 
     i32 max_layer_{};
     VertexType enterpoint_{};
 
+    // guard the neighbor lists of each vertex in concurrent insert
+    UniquePtr<Mutex[]> vertex_mutex_;
+    // guard `max_layer_` and `enterpoint_` in concurrent insert
+    Mutex global_mutex_;
+
 private:
     class VertexL0Mut {
         char *const ptr_;
@@ -90,21 +100,56 @@ private:
                     *reinterpret_cast<const VertexListSize *>(ptr_ + lx_neighbor_n_offset_)};
         }
     };
+    // unsigned arithmetic wraps around, so it holds for the layers not in the mapped section too
+    char *GetLayersP(const char *layers) const {
+        return reinterpret_cast<char *>(reinterpret_cast<std::uintptr_t>(layers_base_) + reinterpret_cast<std::uintptr_t>(layers));
+    }
+    char *GetLayersField(const char *layers_p) const {
+        return reinterpret_cast<char *>(reinterpret_cast<std::uintptr_t>(layers_p) - reinterpret_cast<std::uintptr_t>(layers_base_));
+    }
+
     VertexL0Mut GetLevel0Mut(VertexType vertex_i) { return VertexL0Mut(graph_ + level0_size_ * vertex_i); }
-    VertexLXMut GetLevelXMut(VertexL0Mut &level0, LayerSize layer_i) { return VertexLXMut(*level0.GetLayers().first + levelx_size_ * (layer_i - 1)); }
+    VertexLXMut GetLevelXMut(VertexL0Mut &level0, LayerSize layer_i) {
+        return VertexLXMut(GetLayersP(*level0.GetLayers().first) + levelx_size_ * (layer_i - 1));
+    }
     VertexL0 GetLevel0(VertexType vertex_i) const { return VertexL0(graph_ + level0_size_ * vertex_i); }
-    VertexLX GetLevelX(const VertexL0 &level0, LayerSize layer_i) const { return VertexLX(level0.GetLayers().first + levelx_size_ * (layer_i - 1)); }
+    VertexLX GetLevelX(const VertexL0 &level0, LayerSize layer_i) const {
+        return VertexLX(GetLayersP(level0.GetLayers().first) + levelx_size_ * (layer_i - 1));
+    }
+
+    static SizeT Level0Size(SizeT Mmax0) { return AlignTo(l0_neighbors_offset_ + sizeof(VertexType) * Mmax0, 8); }
+    static SizeT LevelXSize(SizeT Mmax) { return AlignTo(lx_neighbors_offset_ + sizeof(VertexType) * Mmax, 8); }
+
+    // max layer, enter point and the sum of layers
+    static constexpr SizeT header_size_ = sizeof(i32) + sizeof(VertexType) + sizeof(SizeT);
 
 private:
-    GraphStore(SizeT max_vertex, SizeT Mmax, SizeT Mmax0, SizeT loaded_vertex_n, char *loaded_layers)
-        : level0_size_(AlignTo(l0_neighbors_offset_ + sizeof(VertexType) * Mmax0, 8)),                 //
-          levelx_size_(AlignTo(lx_neighbors_offset_ + sizeof(VertexType) * Mmax, 8)),                  //
-          max_vertex_num_(max_vertex),                                                                 //
-          graph_(static_cast<char *>(operator new[](max_vertex * level0_size_, std::align_val_t(8)))), //
-          loaded_vertex_n_(loaded_vertex_n),                                                           //
-          loaded_layers_(loaded_layers)                                                                //
+    // the graph is a view of a mapped file if `graph` is not null
+    GraphStore(SizeT max_vertex, SizeT Mmax, SizeT Mmax0, SizeT loaded_vertex_n, char *loaded_layers, char *graph = nullptr)
+        : level0_size_(Level0Size(Mmax0)),                                                                                       //
+          levelx_size_(LevelXSize(Mmax)),                                                                                        //
+          max_vertex_num_(max_vertex),                                                                                           //
+          graph_(graph != nullptr ? graph : static_cast<char *>(operator new[](max_vertex * level0_size_, std::align_val_t(8)))), //
+          graph_mapped_(graph != nullptr),                                                                                       //
+          loaded_vertex_n_(loaded_vertex_n),                                                                                     //
+          loaded_layers_(loaded_layers),                                                                                         //
+          vertex_mutex_(graph != nullptr ? UniquePtr<Mutex[]>() : MakeUnique<Mutex[]>(max_vertex))                               //
     {}
 
+    // move the level 0 of the first `cur_vertex_n` vertices to a new buffer of `max_vertex` vertices
+    void Reallocate(SizeT max_vertex, VertexType cur_vertex_n) {
+        auto *graph = static_cast<char *>(operator new[](max_vertex * level0_size_, std::align_val_t(8)));
+        Copy(graph_, graph_ + cur_vertex_n * level0_size_, graph);
+        Fill(graph + cur_vertex_n * level0_size_, graph + max_vertex * level0_size_, 0);
+        if (!graph_mapped_) {
+            operator delete[](graph_, std::align_val_t(8));
+        }
+        const_cast<char *&>(graph_) = graph;
+        graph_mapped_ = false;
+        const_cast<SizeT &>(max_vertex_num_) = max_vertex;
+        vertex_mutex_ = MakeUnique<Mutex[]>(max_vertex);
+    }
+
     void Init() {
         max_layer_ = -1;
         enterpoint_ = -1;
@@ -132,10 +177,13 @@ public:
           levelx_size_(other.levelx_size_),         //
           max_vertex_num_(other.max_vertex_num_),   //
           graph_(other.graph_),                     //
+          graph_mapped_(other.graph_mapped_),       //
           loaded_vertex_n_(other.loaded_vertex_n_), //
           loaded_layers_(other.loaded_layers_),     //
+          layers_base_(other.layers_base_),         //
           max_layer_(other.max_layer_),             //
-          enterpoint_(other.enterpoint_)            //
+          enterpoint_(other.enterpoint_),           //
+          vertex_mutex_(Move(other.vertex_mutex_))  //
     {
         const_cast<char *&>(other.graph_) = nullptr;
         const_cast<char *&>(other.loaded_layers_) = nullptr;
@@ -144,15 +192,20 @@ public:
     ~GraphStore() {
         if (graph_) {
             for (VertexType vertex_i = loaded_vertex_n_; vertex_i < VertexType(max_vertex_num_); ++vertex_i) {
-                delete[] GetLevel0(vertex_i).GetLayers().first;
+                if (auto [layers, layer_n] = GetLevel0(vertex_i).GetLayers(); layer_n > 0) {
+                    delete[] GetLayersP(layers);
+                }
+            }
+            if (!graph_mapped_) {
+                operator delete[](graph_, std::align_val_t(8));
             }
-            operator delete[](graph_, std::align_val_t(8));
         }
-        if (loaded_layers_) {
+        if (loaded_layers_ && layers_base_ == nullptr) {
             delete[] loaded_layers_;
         }
     }
 
+    // allocate the layers of `vertex_i`. the enter point is not updated here, call `UpdateEnterPoint` after the vertex is connected.
     void AddVertex(VertexType vertex_i, i32 layer_n) {
         VertexL0Mut vertex = GetLevel0Mut(vertex_i);
         *vertex.GetNeighbors().second = 0;
@@ -160,11 +213,100 @@ public:
         *layer_n_p = layer_n;
         *layers = nullptr;
         if (layer_n) {
-            *layers = new char[levelx_size_ * layer_n]{0};
+            *layers = GetLayersField(new char[levelx_size_ * layer_n]{0});
             for (i32 layer_i = 1; layer_i <= layer_n; ++layer_i) {
                 *GetLevelXMut(vertex, layer_i).GetNeighbors().second = 0;
             }
         }
+    }
+
+    // enlarge the capacity to `max_vertex`. only the level 0 of the first `cur_vertex_n` vertices is moved.
+    void Grow(SizeT max_vertex, VertexType cur_vertex_n) {
+        if (max_vertex <= max_vertex_num_) {
+            return;
+        }
+        Reallocate(max_vertex, cur_vertex_n);
+    }
+
+    // copy the graph out of the mapped file. the layers fields are converted to pointers.
+    void Unmap(VertexType cur_vertex_n) {
+        if (graph_mapped_) {
+            Reallocate(max_vertex_num_, cur_vertex_n);
+        }
+        if (layers_base_ == nullptr) {
+            return;
+        }
+        SizeT layer_sum = 0;
+        for (VertexType vertex_i = 0; vertex_i < VertexType(loaded_vertex_n_); ++vertex_i) {
+            layer_sum += GetLevel0(vertex_i).GetLayers().second;
+        }
+        auto *loaded_layers = new char[levelx_size_ * layer_sum];
+        Copy(loaded_layers_, loaded_layers_ + levelx_size_ * layer_sum, loaded_layers);
+        for (VertexType vertex_i = 0; vertex_i < cur_vertex_n; ++vertex_i) {
+            auto [layers, layer_n_p] = GetLevel0Mut(vertex_i).GetLayers();
+            if (*layer_n_p == 0) {
+                *layers = nullptr;
+            } else if (vertex_i < VertexType(loaded_vertex_n_)) {
+                *layers = loaded_layers + (GetLayersP(*layers) - loaded_layers_);
+            } else {
+                *layers = GetLayersP(*layers);
+            }
+        }
+        const_cast<char *&>(loaded_layers_) = loaded_layers;
+        layers_base_ = nullptr;
+    }
+
+    // the i-th vertex becomes the `order[i]`-th vertex before, `new_ids` is the inverse of `order`. the neighbor lists are renumbered,
+    // and the layers are moved to one buffer in the new order. the graph should not be mapped.
+    void Permute(const VertexType *order, const VertexType *new_ids, VertexType cur_vertex_n) {
+        SizeT layer_sum = 0;
+        for (VertexType vertex_i = 0; vertex_i < cur_vertex_n; ++vertex_i) {
+            layer_sum += GetLevel0(vertex_i).GetLayers().second;
+        }
+        auto *graph = static_cast<char *>(operator new[](max_vertex_num_ * level0_size_, std::align_val_t(8)));
+        Fill(graph + cur_vertex_n * level0_size_, graph + max_vertex_num_ * level0_size_, 0);
+        auto *layers_buffer = new char[levelx_size_ * layer_sum];
+        SizeT layers_offset = 0;
+        auto Renumber = [&](VertexType *neighbors, VertexListSize neighbor_n) {
+            for (VertexListSize i = 0; i < neighbor_n; ++i) {
+                neighbors[i] = new_ids[neighbors[i]];
+            }
+        };
+        for (VertexType vertex_i = 0; vertex_i < cur_vertex_n; ++vertex_i) {
+            const char *old_level0 = graph_ + level0_size_ * order[vertex_i];
+            Copy(old_level0, old_level0 + level0_size_, graph + level0_size_ * vertex_i);
+            VertexL0Mut vertex(graph + level0_size_ * vertex_i);
+            auto [neighbors, neighbor_n_p] = vertex.GetNeighbors();
+            Renumber(neighbors, *neighbor_n_p);
+            auto [layers, layer_n_p] = vertex.GetLayers();
+            if (*layer_n_p == 0) {
+                continue;
+            }
+            char *layers_p = layers_buffer + layers_offset;
+            Copy(*layers, *layers + levelx_size_ * *layer_n_p, layers_p);
+            *layers = layers_p;
+            layers_offset += levelx_size_ * *layer_n_p;
+            for (LayerSize layer_i = 1; layer_i <= *layer_n_p; ++layer_i) {
+                auto [lx_neighbors, lx_neighbor_n_p] = GetLevelXMut(vertex, layer_i).GetNeighbors();
+                Renumber(lx_neighbors, *lx_neighbor_n_p);
+            }
+        }
+        // free the old layers as the destructor does
+        for (VertexType vertex_i = loaded_vertex_n_; vertex_i < cur_vertex_n; ++vertex_i) {
+            if (auto [layers, layer_n] = GetLevel0(vertex_i).GetLayers(); layer_n > 0) {
+                delete[] layers;
+            }
+        }
+        delete[] loaded_layers_;
+        operator delete[](graph_, std::align_val_t(8));
+        const_cast<char *&>(graph_) = graph;
+        const_cast<char *&>(loaded_layers_) = layers_buffer;
+        const_cast<SizeT &>(loaded_vertex_n_) = cur_vertex_n;
+        enterpoint_ = new_ids[enterpoint_];
+    }
+
+    // the caller should hold `global_mutex()` in concurrent insert
+    void UpdateEnterPoint(VertexType vertex_i, i32 layer_n) {
         if (layer_n > max_layer_) {
             max_layer_ = layer_n;
             enterpoint_ = vertex_i;
@@ -175,6 +317,12 @@ public:
 
     VertexType enterpoint() const { return enterpoint_; }
 
+    Mutex &global_mutex() { return global_mutex_; }
+
+    Mutex &vertex_mutex(VertexType vertex_i) const { return vertex_mutex_[vertex_i]; }
+
+    i32 GetLayerN(VertexType vertex_i) const { return GetLevel0(vertex_i).GetLayers().second; }
+
     Pair<const VertexType *, VertexListSize> GetNeighbors(VertexType vertex_i, i32 layer_i) const {
         VertexL0 vertex = GetLevel0(vertex_i);
         if (layer_i == 0) {
@@ -190,6 +338,7 @@ public:
         return GetLevelXMut(vertex, layer_i).GetNeighbors();
     }
 
+    // the layers fields of level 0 are saved as the offsets in the layers section
     void SaveGraph(FileHandler &file_handler, VertexType cur_vertex_n) const {
         file_handler.Write(&max_layer_, sizeof(max_layer_));
         file_handler.Write(&enterpoint_, sizeof(enterpoint_));
@@ -198,14 +347,28 @@ public:
             layer_sum += GetLevel0(vertex_i).GetLayers().second;
         }
         file_handler.Write(&layer_sum, sizeof(layer_sum));
-        file_handler.Write(graph_, cur_vertex_n * level0_size_);
+        WritePadding(file_handler, header_size_);
+
+        SizeT level0_size = cur_vertex_n * level0_size_;
+        auto level0 = MakeUniqueForOverwrite<char[]>(level0_size);
+        Copy(graph_, graph_ + level0_size, level0.get());
+        SizeT layers_offset = 0;
+        for (VertexType vertex_i = 0; vertex_i < cur_vertex_n; ++vertex_i) {
+            auto [layers, layer_n_p] = VertexL0Mut(level0.get() + level0_size_ * vertex_i).GetLayers();
+            *layers = reinterpret_cast<char *>(layers_offset);
+            layers_offset += levelx_size_ * *layer_n_p;
+        }
+        file_handler.Write(level0.get(), level0_size);
+        WritePadding(file_handler, level0_size);
+
         for (VertexType vertex_i = 0; vertex_i < cur_vertex_n; ++vertex_i) {
             VertexL0 vertex = GetLevel0(vertex_i);
             auto [layers, layer_n] = vertex.GetLayers();
             if (layer_n) {
-                file_handler.Write(layers, levelx_size_ * layer_n);
+                file_handler.Write(GetLayersP(layers), levelx_size_ * layer_n);
             }
         }
+        WritePadding(file_handler, levelx_size_ * layer_sum);
     }
 
     static GraphStore LoadGraph(FileHandler &file_handler, SizeT max_vertex, SizeT Mmax, SizeT Mmax0, VertexType cur_vertex_n) {
@@ -215,27 +378,42 @@ public:
         file_handler.Read(&enterpoint, sizeof(enterpoint));
         SizeT layer_sum;
         file_handler.Read(&layer_sum, sizeof(layer_sum));
+        ReadPadding(file_handler, header_size_);
         GraphStore graph_store(max_vertex, Mmax, Mmax0, cur_vertex_n, nullptr);
         const_cast<char *&>(graph_store.loaded_layers_) = new char[graph_store.levelx_size_ * layer_sum];
 
         graph_store.max_layer_ = max_layer;
         graph_store.enterpoint_ = enterpoint;
-        file_handler.Read(graph_store.graph_, cur_vertex_n * graph_store.level0_size_);
-        char *loaded_layers_p = graph_store.loaded_layers_;
+        SizeT level0_size = cur_vertex_n * graph_store.level0_size_;
+        file_handler.Read(graph_store.graph_, level0_size);
+        ReadPadding(file_handler, level0_size);
+        // the vertices not loaded have no layers, and the destructor relies on it
+        Fill(graph_store.graph_ + level0_size, graph_store.graph_ + max_vertex * graph_store.level0_size_, 0);
+        file_handler.Read(graph_store.loaded_layers_, graph_store.levelx_size_ * layer_sum);
+        ReadPadding(file_handler, graph_store.levelx_size_ * layer_sum);
+        // the offsets to the pointers
         for (VertexType vertex_i = 0; vertex_i < cur_vertex_n; ++vertex_i) {
-            VertexL0Mut vertex = graph_store.GetLevel0Mut(vertex_i);
-            LayerSize layer_n = *vertex.GetLayers().second;
-            if (layer_n) {
-                file_handler.Read(loaded_layers_p, graph_store.levelx_size_ * layer_n);
-                *vertex.GetLayers().first = loaded_layers_p;
-                loaded_layers_p += graph_store.levelx_size_ * layer_n;
-            } else {
-                *vertex.GetLayers().first = nullptr;
-            }
+            auto [layers, layer_n_p] = graph_store.GetLevel0Mut(vertex_i).GetLayers();
+            *layers = *layer_n_p ? graph_store.loaded_layers_ + reinterpret_cast<SizeT>(*layers) : nullptr;
         }
         return graph_store;
     }
 
+    // the graph is not copied, it is a view of the mapped file until it grows or is unmapped.
+    // no vertex can be added before it grows, so there is no vertex mutex.
+    static GraphStore LoadGraph(MmapReader &reader, SizeT Mmax, SizeT Mmax0, VertexType cur_vertex_n) {
+        const char *header = reader.ReadSection(header_size_);
+        char *graph = reader.ReadSection(cur_vertex_n * Level0Size(Mmax0));
+        SizeT layer_sum = *reinterpret_cast<const SizeT *>(header + sizeof(i32) + sizeof(VertexType));
+        char *layers = reader.ReadSection(layer_sum * LevelXSize(Mmax));
+
+        GraphStore graph_store(cur_vertex_n, Mmax, Mmax0, cur_vertex_n, layers, graph);
+        graph_store.layers_base_ = layers;
+        graph_store.max_layer_ = *reinterpret_cast<const i32 *>(header);
+        graph_store.enterpoint_ = *reinterpret_cast<const VertexType *>(header + sizeof(i32));
+        return graph_store;
+    }
+
     //---------------------------------------------- Following is the tmp debug function. ----------------------------------------------
 
     // check invariant of graph
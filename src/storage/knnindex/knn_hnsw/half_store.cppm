@@ -0,0 +1,156 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cassert>
+#include <xmmintrin.h>
+
+import stl;
+import file_system;
+import hnsw_common;
+import hnsw_simd_func;
+
+export module half_store;
+
+namespace infinity {
+
+// the vectors are kept in a 2 byte float type (float16_t or bfloat16_t), which halves the memory of a f32 store.
+// the query is not converted, it is compared with the stored vectors in f32.
+export template <typename DataType, typename HalfType>
+class HalfStore {
+    static_assert(sizeof(HalfType) == 2);
+
+public:
+    using This = HalfStore<DataType, HalfType>;
+    using InitArgs = Tuple<>;
+    struct HalfData;
+    using StoreType = HalfData;
+    using QueryType = const DataType *;
+
+    static constexpr SizeT ERR_IDX = DataStoreMeta::ERR_IDX;
+
+    // a stored vector has its half precision values, a query has its f32 values
+    struct HalfData {
+        const HalfType *vec_{};
+        const DataType *query_{};
+
+        HalfData(const HalfType *vec) : vec_(vec) {}
+        HalfData(const DataType *query) : query_(query) {}
+    };
+
+private:
+    DataStoreMeta meta_;
+    UniquePtr<HalfType[]> buffer_; // null if the vectors are in a mapped file
+    HalfType *ptr_;
+
+    HalfStore(DataStoreMeta meta, HalfType *ptr) : meta_(Move(meta)), ptr_(ptr) {}
+
+    HalfStore(DataStoreMeta meta) : meta_(Move(meta)), buffer_(MakeUnique<HalfType[]>(meta_.max_vec_num_ * meta_.dim_)), ptr_(buffer_.get()) {}
+
+    void Reallocate(SizeT max_vec_num) {
+        auto buffer = MakeUnique<HalfType[]>(max_vec_num * dim());
+        Copy(ptr_, ptr_ + cur_vec_num() * dim(), buffer.get());
+        buffer_ = Move(buffer);
+        ptr_ = buffer_.get();
+        meta_.Grow(max_vec_num);
+    }
+
+public:
+    static This Make(SizeT max_vec_num, SizeT dim, This::InitArgs = {}) {
+        DataStoreMeta meta(max_vec_num, dim);
+        return This(Move(meta));
+    }
+
+    HalfStore(This &&other) : meta_(Move(other.meta_)), buffer_(Move(other.buffer_)), ptr_(other.ptr_) { other.ptr_ = nullptr; }
+
+    void Save(FileHandler &file_handler) const {
+        meta_.Save(file_handler);
+        SizeT data_size = sizeof(HalfType) * cur_vec_num() * dim();
+        file_handler.Write(ptr_, data_size);
+        WritePadding(file_handler, data_size);
+    }
+
+    static This Load(FileHandler &file_handler, SizeT max_vec_num, This::InitArgs = {}) {
+        DataStoreMeta meta = DataStoreMeta::Load(file_handler, max_vec_num);
+        This ret(Move(meta));
+        SizeT data_size = sizeof(HalfType) * ret.cur_vec_num() * ret.dim();
+        file_handler.Read(ret.ptr_, data_size);
+        ReadPadding(file_handler, data_size);
+        return ret;
+    }
+
+    // the vectors are not copied, they are read from the mapping until the store grows or is unmapped
+    static This Load(MmapReader &reader, This::InitArgs = {}) {
+        DataStoreMeta meta = DataStoreMeta::Load(reader);
+        auto *ptr = reinterpret_cast<HalfType *>(reader.ReadSection(sizeof(HalfType) * meta.cur_vec_num() * meta.dim_));
+        return This(Move(meta), ptr);
+    }
+
+    SizeT cur_vec_num() const { return meta_.cur_vec_num(); }
+    SizeT max_vec_num() const { return meta_.max_vec_num_; }
+    SizeT dim() const { return meta_.dim_; }
+
+    // enlarge the capacity to `max_vec_num` vectors
+    void Grow(SizeT max_vec_num) {
+        if (max_vec_num <= this->max_vec_num()) {
+            return;
+        }
+        Reallocate(max_vec_num);
+    }
+
+    // copy the vectors out of the mapped file
+    void Unmap() {
+        if (buffer_.get() == nullptr) {
+            Reallocate(max_vec_num());
+        }
+    }
+
+    // the i-th vector becomes the `order[i]`-th vector before. the store should not be mapped.
+    void Permute(const VertexType *order) { PermuteRows(ptr_, dim(), order, cur_vec_num()); }
+
+    SizeT AddVec(const DataType *vec, SizeT vec_num) { return AddVec(DenseVectorIter(vec, dim(), vec_num), vec_num); }
+
+    template <typename Iterator>
+        requires DataIteratorConcept<Iterator, const DataType *>
+    SizeT AddVec(Iterator query_iter, SizeT vec_num) {
+        SizeT new_idx = meta_.AllocateVec(vec_num);
+        if (new_idx != ERR_IDX) {
+            HalfType *ptr = ptr_ + new_idx * dim();
+            while (vec_num--) {
+                auto vec = *(query_iter.Next());
+                if constexpr (std::is_same_v<DataType, f32>) {
+                    F32ToHalf(vec, ptr, dim());
+                } else {
+                    for (SizeT i = 0; i < dim(); ++i) {
+                        ptr[i] = HalfType(vec[i]);
+                    }
+                }
+                ptr += dim();
+            }
+        }
+        return new_idx;
+    }
+
+    StoreType GetVec(SizeT vec_i) const {
+        assert(vec_i < cur_vec_num());
+        return HalfData(ptr_ + vec_i * dim());
+    }
+
+    QueryType MakeQuery(const DataType *vec) const { return vec; }
+
+    void Prefetch(SizeT vec_i) const { _mm_prefetch(reinterpret_cast<const char *>(ptr_ + vec_i * dim()), _MM_HINT_T0); }
+};
+
+} // namespace infinity
@@ -2,14 +2,15 @@
 #ifndef NO_MANUAL_VECTORIZATION
 #if (defined(__SSE__) || _M_IX86_FP > 0 || defined(_M_AMD64) || defined(_M_X64))
 #define USE_SSE
-#ifdef __AVX__
+// the binary is built for x86-64-v2. the avx2 and avx512 kernels are compiled for their own targets by the attributes below,
+// which only gcc and clang of x86 take, and they are chosen at run time on the cpus that support them, see `SupportAVX2` and
+// `SupportAVX512`.
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__clang__) || __GNUC__ >= 8)
 #define USE_AVX
-#ifdef __AVX512F__
 #define USE_AVX512
 #endif
 #endif
 #endif
-#endif
 
 #if defined(USE_AVX) || defined(USE_SSE)
 #ifdef _MSC_VER
@@ -35,8 +36,16 @@ static uint64_t xgetbv(unsigned int index) {
 }
 #endif
 
-#if defined(USE_AVX512)
+#if defined(USE_AVX)
 #include <immintrin.h>
+// every cpu of avx2 has f16c as well
+#define AVX2_TARGET __attribute__((target("avx2,fma,f16c")))
+#endif
+
+#if defined(USE_AVX512)
+#define AVX512_TARGET __attribute__((target("avx512f,avx512bw,avx512dq,avx512vl")))
+#define AVX512VNNI_TARGET __attribute__((target("avx512f,avx512bw,avx512dq,avx512vl,avx512vnni")))
+#define AVX512VPOPCNTDQ_TARGET __attribute__((target("avx512f,avx512bw,avx512dq,avx512vl,avx512vpopcntdq")))
 #endif
 
 #if defined(__GNUC__)
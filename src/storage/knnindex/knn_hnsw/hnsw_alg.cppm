@@ -13,26 +13,29 @@
 // limitations under the License.
 
 module;
+#include <algorithm>
+#include <exception>
+#include <future>
 #include <iostream>
 #include <random>
 
 import stl;
 import file_system;
 import file_system_type;
+import local_file_system;
 import infinity_exception;
-import knn_result_handler;
 import bitmask;
 
 import hnsw_common;
 import plain_store;
 import graph_store;
 import lvq_store;
+import hnsw_mem_pool;
 
 export module hnsw_alg;
 
 // Fixme: some variable has implicit type conversion.
 // Fixme: some variable has confusing name.
-// Fixme: has no test for different `DataType`.
 
 // Todo: make more embedding type.
 // Todo: make module partition.
@@ -46,11 +49,12 @@ class KnnHnsw {
 public:
     using This = KnnHnsw<DataType, LabelType, DataStore, Distance>;
     using StoreType = typename DataStore::StoreType;
+    using DistType = DistanceType<Distance, DataType>;
 
-    using PDV = Pair<DataType, VertexType>;
-    using CMP = CompareByFirst<DataType, VertexType>;
-    using DistHeap = Heap<PDV, CMP>;
+    using PDV = Pair<DistType, VertexType>;
+    using CandidatePool = LinearPool<DistType, VertexType>;
     using HnswLabelType = LabelType;
+    using HnswDataType = DataType;
 
     constexpr static int prefetch_offset_ = 0;
     constexpr static int prefetch_step_ = 2;
@@ -60,16 +64,24 @@ private:
     const SizeT Mmax_;
     const SizeT Mmax0_;
     const SizeT ef_construction_;
-    SizeT ef_;
 
     // 1 / log(1.0 * M_)
     const double mult_;
     std::default_random_engine level_rng_{};
 
+    // the file that the stores are mapped from. it is declared before the stores, so it is unmapped after them.
+    UniquePtr<MmapFile> mmap_file_;
     DataStore data_store_;
     GraphStore graph_store_;
     Distance distance_;
-    const UniquePtr<LabelType[]> labels_;
+    UniquePtr<LabelType[]> labels_buffer_; // null if the labels are in the mapped file
+    LabelType *labels_;
+    // the id of each vertex before `Reorder`, which the bitmasks of the searches refer to. null if the index is not reordered.
+    UniquePtr<VertexType[]> origins_;
+
+    // reused by searches so that steady-state search does not allocate
+    mutable VisitedMemPool visited_pool_;
+    mutable LinearPoolMemPool<DistType, VertexType> candidate_pool_;
 
 private:
     KnnHnsw(SizeT M,
@@ -80,18 +92,14 @@ private:
             GraphStore graph_store,
             Distance distance,
             UniquePtr<LabelType[]> labels,
-            SizeT ef,
             SizeT random_seed)
         : M_(M), Mmax_(Mmax), Mmax0_(Mmax0), ef_construction_(Max(M_, ef_construction)), //
           mult_(1 / std::log(1.0 * M_)),                                                 //
           data_store_(Move(data_store)),                                                 //
           graph_store_(Move(graph_store)),                                               //
           distance_(Move(distance)),                                                     //
-          labels_(Move(labels)) {
-        if (ef == 0) {
-            ef = ef_construction_;
-        }
-        ef_ = ef;
+          labels_buffer_(Move(labels)),                                                  //
+          labels_(labels_buffer_.get()) {
         level_rng_.seed(random_seed);
     }
 
@@ -111,7 +119,6 @@ public:
                                         Move(graph_store),
                                         Move(distance),
                                         MakeUnique<LabelType[]>(max_vertex),
-                                        0,
                                         0));
     }
 
@@ -133,148 +140,72 @@ private:
         if (ret == DataStore::ERR_IDX) {
             Error<StorageException>("Data index is not enough.");
         }
-        std::copy(labels, labels + insert_n, labels_.get() + ret);
-        return ret;
-    }
-
-public:
-    // return the nearest `ef_construction_` neighbors of `query` in layer `layer_idx`
-    // return value is a max heap of distance
-    DistHeap SearchLayer(VertexType enter_point, const StoreType &query, i32 layer_idx, SizeT candidate_n) const {
-        DistHeap result;
-        DistHeap candidate;
-
-        data_store_.Prefetch(enter_point);
-        DataType dist = distance_(query, data_store_.GetVec(enter_point), data_store_);
-
-        candidate.emplace(-dist, enter_point);
-        result.emplace(dist, enter_point);
-
-        Vector<bool> visited(data_store_.cur_vec_num(), false);
-        visited[enter_point] = true;
-
-        while (!candidate.empty()) {
-            const auto [minus_c_dist, c_idx] = candidate.top();
-            candidate.pop();
-            if (-minus_c_dist > result.top().first && result.size() == candidate_n) {
-                break;
-            }
-            const auto [neighbors_p, neighbor_size] = graph_store_.GetNeighbors(c_idx, layer_idx);
-            int prefetch_start = neighbor_size - 1 - prefetch_offset_;
-            for (int i = neighbor_size - 1; i >= 0; --i) {
-                VertexType n_idx = neighbors_p[i];
-                if (visited[n_idx]) {
-                    continue;
-                }
-                visited[n_idx] = true;
-                if (prefetch_start >= 0) {
-                    int lower = Max(0, prefetch_start - prefetch_step_);
-                    for (int i = prefetch_start; i >= lower; --i) {
-                        data_store_.Prefetch(neighbors_p[i]);
-                    }
-                    prefetch_start -= prefetch_step_;
-                }
-                dist = distance_(query, data_store_.GetVec(n_idx), data_store_);
-                if (dist < result.top().first || result.size() < candidate_n) {
-                    candidate.emplace(-dist, n_idx);
-                    result.emplace(dist, n_idx);
-                    if (result.size() > candidate_n) {
-                        result.pop();
-                    }
-                }
+        std::copy(labels, labels + insert_n, labels_ + ret);
+        if (origins_.get() != nullptr) {
+            for (SizeT i = ret; i < ret + insert_n; ++i) {
+                origins_[i] = i;
             }
         }
-        return result;
+        return ret;
     }
 
-    DistHeap SearchLayer(VertexType enter_point, const StoreType &query, i32 layer_idx, SizeT candidate_n, const Bitmask &bitmask) const {
-        if (bitmask.IsAllTrue()) {
-            return SearchLayer(enter_point, query, layer_idx, candidate_n);
-        }
-        DistHeap result;
-        DistHeap candidate;
+    bool BitmaskIsTrue(const Bitmask &bitmask, VertexType vertex_i) const {
+        return bitmask.IsTrue(origins_.get() != nullptr ? origins_[vertex_i] : vertex_i);
+    }
 
-        DataType dist{};
-        if (bitmask.IsTrue(enter_point)) {
-            data_store_.Prefetch(enter_point);
-            dist = distance_(query, data_store_.GetVec(enter_point), data_store_);
+    VisitedMemPool::PooledT GetVisited() const {
+        SizeT vertex_n = data_store_.cur_vec_num();
+        auto visited = visited_pool_.Get(vertex_n);
+        (*visited).Reset(vertex_n);
+        return visited;
+    }
 
-            candidate.emplace(-dist, enter_point);
-            result.emplace(dist, enter_point);
+public:
+    // lock the neighbor lists of `vertex_i` if `WithLock`, else return an empty lock
+    template <bool WithLock>
+    UniqueLock<Mutex> LockVertex(VertexType vertex_i) const {
+        if constexpr (WithLock) {
+            return UniqueLock<Mutex>(graph_store_.vertex_mutex(vertex_i));
         } else {
-            candidate.emplace(LimitMax<DataType>(), enter_point);
+            return UniqueLock<Mutex>();
         }
+    }
 
-        Vector<bool> visited(data_store_.cur_vec_num(), false);
-        visited[enter_point] = true;
-
-        while (!candidate.empty()) {
-            const auto [minus_c_dist, c_idx] = candidate.top();
-            candidate.pop();
-            if (result.size() == candidate_n && -minus_c_dist > result.top().first) {
-                break;
-            }
-            const auto [neighbors_p, neighbor_size] = graph_store_.GetNeighbors(c_idx, layer_idx);
-            int prefetch_start = neighbor_size - 1 - prefetch_offset_;
-            for (int i = neighbor_size - 1; i >= 0; --i) {
-                VertexType n_idx = neighbors_p[i];
-                if (visited[n_idx]) {
-                    continue;
-                }
-                visited[n_idx] = true;
-                if (prefetch_start >= 0) {
-                    int lower = Max(0, prefetch_start - prefetch_step_);
-                    for (int i = prefetch_start; i >= lower; --i) {
-                        data_store_.Prefetch(neighbors_p[i]);
-                    }
-                    prefetch_start -= prefetch_step_;
-                }
-                dist = distance_(query, data_store_.GetVec(n_idx), data_store_);
-                if (result.size() < candidate_n || dist < result.top().first) {
-                    candidate.emplace(-dist, n_idx);
-                    if (bitmask.IsTrue(n_idx)) {
-                        result.emplace(dist, n_idx);
-                        if (result.size() > candidate_n) {
-                            result.pop();
-                        }
-                    }
-                }
-            }
-        }
-        return result;
+    // write the nearest `candidate_n` neighbors of `query` in layer `layer_idx` to `result` in ascending order of distance
+    template <bool WithLock = false>
+    void SearchLayer(VertexType enter_point, const StoreType &query, i32 layer_idx, SizeT candidate_n, CandidatePool &result) const {
+        auto visited_pooled = visited_pool_.Get(data_store_.cur_vec_num());
+        SearchLayer<WithLock>(enter_point, query, layer_idx, candidate_n, *visited_pooled, result);
     }
 
-    Pair<u32, Pair<UniquePtr<DataType[]>, UniquePtr<VertexType[]>>>
-    SearchLayerReturnPair(VertexType enter_point, const StoreType &query, i32 layer_idx, SizeT candidate_n) const {
-        auto d_ptr = MakeUniqueForOverwrite<DataType[]>(candidate_n);
-        auto i_ptr = MakeUniqueForOverwrite<VertexType[]>(candidate_n);
-        HeapResultHandler<CompareMax<DataType, VertexType>> result_handler(1, candidate_n, d_ptr.get(), i_ptr.get());
-        result_handler.Begin();
-        DistHeap candidate;
+    // search with the scratch `visited` table of the caller, which is reused across searches. `result` is the candidate set
+    // as well: the nearest vertex not expanded yet is expanded next, so the search ends when all of `result` are expanded.
+    template <bool WithLock = false>
+    void SearchLayer(VertexType enter_point,
+                     const StoreType &query,
+                     i32 layer_idx,
+                     SizeT candidate_n,
+                     VisitedTable &visited,
+                     CandidatePool &result) const {
+        result.Reset(candidate_n);
+        visited.Reset(data_store_.cur_vec_num());
 
         data_store_.Prefetch(enter_point);
-        auto dist = distance_(query, data_store_.GetVec(enter_point), data_store_);
-
-        candidate.emplace(-dist, enter_point);
-        result_handler.AddResult(0, dist, enter_point);
+        result.Insert(distance_(query, data_store_.GetVec(enter_point), data_store_), enter_point);
 
-        Vector<bool> visited(data_store_.cur_vec_num(), false);
-        visited[enter_point] = true;
+        visited.SetVisited(enter_point);
 
-        while (!candidate.empty()) {
-            const auto [minus_c_dist, c_idx] = candidate.top();
-            candidate.pop();
-            if (result_handler.GetSize(0) == candidate_n && -minus_c_dist > result_handler.GetDistance0(0)) {
-                break;
-            }
+        while (result.HasUnexpanded()) {
+            VertexType c_idx = result.ExpandNext().second;
+            auto lock = LockVertex<WithLock>(c_idx);
             const auto [neighbors_p, neighbor_size] = graph_store_.GetNeighbors(c_idx, layer_idx);
             int prefetch_start = neighbor_size - 1 - prefetch_offset_;
             for (int i = neighbor_size - 1; i >= 0; --i) {
                 VertexType n_idx = neighbors_p[i];
-                if (visited[n_idx]) {
+                if (visited.IsVisited(n_idx)) {
                     continue;
                 }
-                visited[n_idx] = true;
+                visited.SetVisited(n_idx);
                 if (prefetch_start >= 0) {
                     int lower = Max(0, prefetch_start - prefetch_step_);
                     for (int i = prefetch_start; i >= lower; --i) {
@@ -282,55 +213,84 @@ public:
                     }
                     prefetch_start -= prefetch_step_;
                 }
-                auto dist = distance_(query, data_store_.GetVec(n_idx), data_store_);
-                if (result_handler.GetSize(0) < candidate_n || dist < result_handler.GetDistance0(0)) {
-                    candidate.emplace(-dist, n_idx);
-                    result_handler.AddResult(0, dist, n_idx);
-                }
+                // dropped unless it is nearer than the farthest one of the full pool
+                result.Insert(distance_(query, data_store_.GetVec(n_idx), data_store_), n_idx);
             }
         }
-        result_handler.EndWithoutSort();
-        return {result_handler.GetSize(0), MakePair(Move(d_ptr), Move(i_ptr))};
     }
 
-    Pair<u32, Pair<UniquePtr<DataType[]>, UniquePtr<VertexType[]>>>
-    SearchLayerReturnPair(VertexType enter_point, const StoreType &query, i32 layer_idx, SizeT candidate_n, const Bitmask &bitmask) const {
+    void SearchLayer(VertexType enter_point,
+                     const StoreType &query,
+                     i32 layer_idx,
+                     SizeT candidate_n,
+                     const Bitmask &bitmask,
+                     CandidatePool &result,
+                     bool expand_filtered = false) const {
+        auto candidate_pooled = candidate_pool_.Get();
+        auto visited_pooled = visited_pool_.Get(data_store_.cur_vec_num());
+        SearchLayer(enter_point, query, layer_idx, candidate_n, bitmask, *candidate_pooled, *visited_pooled, result, expand_filtered);
+    }
+
+    // `candidate` keeps the nearest `candidate_n` vertices compared, which may not be in `bitmask`, and `result` the nearest
+    // ones in `bitmask`. with `expand_filtered` a neighbor not in `bitmask` is not compared, its neighbors in `bitmask` are
+    // compared instead. so the candidates pass the filter, and the search goes through the filtered out vertices when few
+    // vertices pass.
+    void SearchLayer(VertexType enter_point,
+                     const StoreType &query,
+                     i32 layer_idx,
+                     SizeT candidate_n,
+                     const Bitmask &bitmask,
+                     CandidatePool &candidate,
+                     VisitedTable &visited,
+                     CandidatePool &result,
+                     bool expand_filtered = false) const {
         if (bitmask.IsAllTrue()) {
-            return SearchLayerReturnPair(enter_point, query, layer_idx, candidate_n);
+            return SearchLayer(enter_point, query, layer_idx, candidate_n, visited, result);
         }
-        auto d_ptr = MakeUniqueForOverwrite<DataType[]>(candidate_n);
-        auto v_ptr = MakeUniqueForOverwrite<VertexType[]>(candidate_n);
-        HeapResultHandler<CompareMax<DataType, VertexType>> result_handler(1, candidate_n, d_ptr.get(), v_ptr.get());
-        result_handler.Begin();
-        DistHeap candidate;
-
-        if (bitmask.IsTrue(enter_point)) {
-            data_store_.Prefetch(enter_point);
-            auto dist = distance_(query, data_store_.GetVec(enter_point), data_store_);
+        candidate.Reset(candidate_n);
+        result.Reset(candidate_n);
+        visited.Reset(data_store_.cur_vec_num());
 
-            candidate.emplace(-dist, enter_point);
-            result_handler.AddResult(0, dist, enter_point);
-        } else {
-            candidate.emplace(LimitMax<DataType>(), enter_point);
+        // the enter point is expanded even if it is filtered out
+        data_store_.Prefetch(enter_point);
+        DistType dist = distance_(query, data_store_.GetVec(enter_point), data_store_);
+        candidate.Insert(dist, enter_point);
+        if (BitmaskIsTrue(bitmask, enter_point)) {
+            result.Insert(dist, enter_point);
         }
 
-        Vector<bool> visited(data_store_.cur_vec_num(), false);
-        visited[enter_point] = true;
+        visited.SetVisited(enter_point);
 
-        while (!candidate.empty()) {
-            const auto [minus_c_dist, c_idx] = candidate.top();
-            candidate.pop();
-            if (result_handler.GetSize(0) == candidate_n && -minus_c_dist > result_handler.GetDistance0(0)) {
+        auto Compare = [&](VertexType n_idx) {
+            dist = distance_(query, data_store_.GetVec(n_idx), data_store_);
+            candidate.Insert(dist, n_idx);
+            if (BitmaskIsTrue(bitmask, n_idx)) {
+                result.Insert(dist, n_idx);
+            }
+        };
+        while (candidate.HasUnexpanded()) {
+            const auto [c_dist, c_idx] = candidate.ExpandNext();
+            if (result.full() && c_dist > result.WorstDist()) {
                 break;
             }
             const auto [neighbors_p, neighbor_size] = graph_store_.GetNeighbors(c_idx, layer_idx);
             int prefetch_start = neighbor_size - 1 - prefetch_offset_;
             for (int i = neighbor_size - 1; i >= 0; --i) {
                 VertexType n_idx = neighbors_p[i];
-                if (visited[n_idx]) {
+                if (visited.IsVisited(n_idx)) {
+                    continue;
+                }
+                visited.SetVisited(n_idx);
+                if (expand_filtered && !BitmaskIsTrue(bitmask, n_idx)) {
+                    const auto [nn_p, nn_size] = graph_store_.GetNeighbors(n_idx, layer_idx);
+                    for (int j = 0; j < nn_size; ++j) {
+                        if (VertexType nn_idx = nn_p[j]; !visited.IsVisited(nn_idx) && BitmaskIsTrue(bitmask, nn_idx)) {
+                            visited.SetVisited(nn_idx);
+                            Compare(nn_idx);
+                        }
+                    }
                     continue;
                 }
-                visited[n_idx] = true;
                 if (prefetch_start >= 0) {
                     int lower = Max(0, prefetch_start - prefetch_step_);
                     for (int i = prefetch_start; i >= lower; --i) {
@@ -338,29 +298,23 @@ public:
                     }
                     prefetch_start -= prefetch_step_;
                 }
-                auto dist = distance_(query, data_store_.GetVec(n_idx), data_store_);
-                if (result_handler.GetSize(0) < candidate_n || dist < result_handler.GetDistance0(0)) {
-                    candidate.emplace(-dist, n_idx);
-                    if (bitmask.IsTrue(n_idx)) {
-                        result_handler.AddResult(0, dist, n_idx);
-                    }
-                }
+                Compare(n_idx);
             }
         }
-        result_handler.EndWithoutSort();
-        return {result_handler.GetSize(0), MakePair(Move(d_ptr), Move(v_ptr))};
     }
 
+    template <bool WithLock = false>
     VertexType SearchLayerNearest(VertexType enter_point, const StoreType &query, i32 layer_idx) const {
         VertexType cur_p = enter_point;
-        DataType cur_dist = distance_(query, data_store_.GetVec(cur_p), data_store_);
+        DistType cur_dist = distance_(query, data_store_.GetVec(cur_p), data_store_);
         bool check = true;
         while (check) {
             check = false;
+            auto lock = LockVertex<WithLock>(cur_p);
             const auto [neighbors_p, neighbor_size] = graph_store_.GetNeighbors(cur_p, layer_idx);
             for (int i = neighbor_size - 1; i >= 0; --i) {
                 VertexType n_idx = neighbors_p[i];
-                DataType n_dist = distance_(query, data_store_.GetVec(n_idx), data_store_);
+                DistType n_dist = distance_(query, data_store_.GetVec(n_idx), data_store_);
                 if (n_dist < cur_dist) {
                     cur_p = n_idx;
                     cur_dist = n_dist;
@@ -371,24 +325,23 @@ public:
         return cur_p;
     }
 
-    // DistHeap is the min heap whose key is the minus distance to query
-    // result distance is increasing
-    void SelectNeighborsHeuristic(DistHeap &candidates, SizeT M, VertexType *result_p, VertexListSize *result_size_p) const {
+    // `candidates` are in ascending order of distance, so are the selected neighbors
+    void SelectNeighborsHeuristic(const CandidatePool &candidates, SizeT M, VertexType *result_p, VertexListSize *result_size_p) const {
         VertexListSize result_size = 0;
         if (SizeT c_size = candidates.size(); c_size < M) {
-            while (!candidates.empty()) {
-                result_p[result_size++] = candidates.top().second;
-                candidates.pop();
+            for (SizeT c_i = 0; c_i < c_size; ++c_i) {
+                result_p[result_size++] = candidates.Id(c_i);
             }
         } else {
-            while (!candidates.empty() && SizeT(result_size) < M) {
-                const auto &[minus_c_dist, c_idx] = candidates.top();
+            for (SizeT c_i = 0; c_i < c_size && SizeT(result_size) < M; ++c_i) {
+                DistType c_dist = candidates.Dist(c_i);
+                VertexType c_idx = candidates.Id(c_i);
                 StoreType c_data = data_store_.GetVec(c_idx);
                 bool check = true;
                 for (SizeT i = 0; i < SizeT(result_size); ++i) {
                     VertexType r_idx = result_p[i];
-                    DataType cr_dist = distance_(c_data, data_store_.GetVec(r_idx), data_store_);
-                    if (cr_dist < -minus_c_dist) {
+                    DistType cr_dist = distance_(c_data, data_store_.GetVec(r_idx), data_store_);
+                    if (cr_dist < c_dist) {
                         check = false;
                         break;
                     }
@@ -396,15 +349,18 @@ public:
                 if (check) {
                     result_p[result_size++] = c_idx;
                 }
-                candidates.pop();
             }
         }
         *result_size_p = result_size;
     }
 
+    template <bool WithLock = false>
     void ConnectNeighbors(VertexType vertex_i, const VertexType *q_neighbors_p, VertexListSize q_neighbor_size, i32 layer_idx) {
+        auto candidates_pooled = candidate_pool_.Get();
+        CandidatePool &candidates = *candidates_pooled;
         for (int i = 0; i < q_neighbor_size; ++i) {
             VertexType n_idx = q_neighbors_p[i];
+            auto lock = LockVertex<WithLock>(n_idx);
             auto [n_neighbors_p, n_neighbor_size_p] = graph_store_.GetNeighborsMut(n_idx, layer_idx);
             VertexListSize n_neighbor_size = *n_neighbor_size_p;
             SizeT Mmax = layer_idx == 0 ? Mmax0_ : Mmax_;
@@ -414,132 +370,489 @@ public:
                 continue;
             }
             StoreType n_data = data_store_.GetVec(n_idx);
-            DataType n_dist = distance_(n_data, data_store_.GetVec(vertex_i), data_store_);
-
-            Vector<PDV> tmp;
-            tmp.reserve(n_neighbor_size + 1);
-            tmp.emplace_back(-n_dist, vertex_i);
+            candidates.Reset(n_neighbor_size + 1);
+            candidates.Insert(distance_(n_data, data_store_.GetVec(vertex_i), data_store_), vertex_i);
             for (int i = 0; i < n_neighbor_size; ++i) {
-                tmp.emplace_back(-distance_(n_data, data_store_.GetVec(n_neighbors_p[i]), data_store_), n_neighbors_p[i]);
+                candidates.Insert(distance_(n_data, data_store_.GetVec(n_neighbors_p[i]), data_store_), n_neighbors_p[i]);
             }
-
-            DistHeap candidates(tmp.begin(), tmp.end());
             SelectNeighborsHeuristic(candidates, Mmax, n_neighbors_p, n_neighbor_size_p); // write in memory
         }
     }
 
+    template <bool WithLock>
+    void InsertVertex(VertexType vertex_i, i32 q_layer) {
+        StoreType query = data_store_.GetVec(vertex_i);
+        graph_store_.AddVertex(vertex_i, q_layer);
+
+        // a vertex that raises the max layer keeps the global lock until it is connected,
+        // so that no other thread can start from an enter point without neighbors.
+        UniqueLock<Mutex> global_lock;
+        if constexpr (WithLock) {
+            global_lock = UniqueLock<Mutex>(graph_store_.global_mutex());
+        }
+        i32 max_layer = graph_store_.max_layer();
+        VertexType ep = graph_store_.enterpoint();
+        if (q_layer <= max_layer && global_lock.owns_lock()) {
+            global_lock.unlock();
+        }
+
+        for (i32 cur_layer = max_layer; cur_layer > q_layer; --cur_layer) {
+            ep = SearchLayerNearest<WithLock>(ep, query, cur_layer);
+        }
+        Vector<VertexType> q_neighbors(M_);
+        auto search_result_pooled = candidate_pool_.Get();
+        CandidatePool &search_result = *search_result_pooled;
+        for (i32 cur_layer = Min(q_layer, max_layer); cur_layer >= 0; --cur_layer) {
+            SearchLayer<WithLock>(ep, query, cur_layer, ef_construction_, search_result);
+            VertexListSize q_neighbor_size = 0;
+            {
+                auto lock = LockVertex<WithLock>(vertex_i);
+                const auto [q_neighbors_p, q_neighbor_size_p] = graph_store_.GetNeighborsMut(vertex_i, cur_layer);
+                SelectNeighborsHeuristic(search_result, M_, q_neighbors_p, q_neighbor_size_p);
+                q_neighbor_size = *q_neighbor_size_p;
+                Copy(q_neighbors_p, q_neighbors_p + q_neighbor_size, q_neighbors.begin());
+            }
+            ep = q_neighbors[0];
+            ConnectNeighbors<WithLock>(vertex_i, q_neighbors.data(), q_neighbor_size, cur_layer);
+        }
+        if (!WithLock || global_lock.owns_lock()) {
+            graph_store_.UpdateEnterPoint(vertex_i, q_layer);
+        }
+    }
+
+    // insert `insert_n` vectors with `thread_n` threads. the vectors are stored first, then connected concurrently.
     template <typename Iterator>
         requires DataIteratorConcept<Iterator, const DataType *>
-    void InsertVecs(Iterator query_iter, const LabelType *labels, SizeT insert_n) {
+    void InsertVecs(Iterator query_iter, const LabelType *labels, SizeT insert_n, SizeT thread_n = 1) {
         const VertexType vertex_i1 = StoreData(Move(query_iter), labels, insert_n);
+        // generate layers in advance because `level_rng_` is not thread safe
+        Vector<i32> q_layers(insert_n);
         for (SizeT i = 0; i < insert_n; ++i) {
-            StoreType query = data_store_.GetVec(vertex_i1 + i);
-            i32 q_layer = GenerateRandomLayer();
-            i32 max_layer = graph_store_.max_layer();
-            VertexType ep = graph_store_.enterpoint();
-            VertexType vertex_i = vertex_i1 + i;
-            graph_store_.AddVertex(vertex_i, q_layer);
-
-            for (i32 cur_layer = max_layer; cur_layer > q_layer; --cur_layer) {
-                ep = SearchLayerNearest(ep, query, cur_layer);
+            q_layers[i] = GenerateRandomLayer();
+        }
+        if (thread_n <= 1 || insert_n <= 1) {
+            for (SizeT i = 0; i < insert_n; ++i) {
+                InsertVertex<false>(vertex_i1 + i, q_layers[i]);
             }
-            for (i32 cur_layer = Min(q_layer, max_layer); cur_layer >= 0; --cur_layer) {
-                DistHeap search_result = SearchLayer(ep, query, cur_layer, ef_construction_); // TODO:: use pool
-                DistHeap candidates;
-                while (!search_result.empty()) {
-                    const auto &[dist, idx] = search_result.top();
-                    candidates.emplace(-dist, idx);
-                    search_result.pop();
+            return;
+        }
+        // the first vertex is the enter point of the others
+        InsertVertex<false>(vertex_i1, q_layers[0]);
+        atomic_u64 next_i(1);
+        Vector<Thread> threads;
+        threads.reserve(thread_n);
+        for (SizeT thread_i = 0; thread_i < thread_n; ++thread_i) {
+            threads.emplace_back([&] {
+                for (SizeT i = next_i.fetch_add(1); i < insert_n; i = next_i.fetch_add(1)) {
+                    InsertVertex<true>(vertex_i1 + i, q_layers[i]);
                 }
-                const auto [q_neighbors_p, q_neighbor_size_p] = graph_store_.GetNeighborsMut(vertex_i, cur_layer);
-                SelectNeighborsHeuristic(candidates, M_, q_neighbors_p, q_neighbor_size_p);
-                ep = q_neighbors_p[0];
-                ConnectNeighbors(vertex_i, q_neighbors_p, *q_neighbor_size_p, cur_layer);
-            }
-            if (i && i % 10000 == 0) {
-                std::cout << "Inserted " << i << " / " << insert_n << std::endl;
-            }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
         }
     }
 
     // this two interface is for test and benchmark
-    void Insert(const DataType *queries, const LabelType *labels, SizeT insert_n) {
-        InsertVecs(DenseVectorIter(queries, data_store_.dim(), insert_n), labels, insert_n);
+    void Insert(const DataType *queries, const LabelType *labels, SizeT insert_n, SizeT thread_n = 1) {
+        InsertVecs(DenseVectorIter(queries, data_store_.dim(), insert_n), labels, insert_n, thread_n);
     }
     void Insert(const DataType *query, LabelType label) { Insert(query, &label, 1); }
 
-    MaxHeap<Pair<DataType, LabelType>> KnnSearch(const DataType *q, SizeT k) const {
+    // enlarge the capacity of the index to `max_vertex` vectors. the caller should hold the index exclusively.
+    void Grow(SizeT max_vertex) {
+        if (max_vertex <= data_store_.max_vec_num()) {
+            return;
+        }
+        SizeT cur_vertex_n = data_store_.cur_vec_num();
+        data_store_.Grow(max_vertex);
+        graph_store_.Grow(max_vertex, cur_vertex_n);
+        auto labels = MakeUnique<LabelType[]>(max_vertex);
+        Copy(labels_, labels_ + cur_vertex_n, labels.get());
+        labels_buffer_ = Move(labels);
+        labels_ = labels_buffer_.get();
+        if (origins_.get() != nullptr) {
+            auto origins = MakeUniqueForOverwrite<VertexType[]>(max_vertex);
+            Copy(origins_.get(), origins_.get() + cur_vertex_n, origins.get());
+            origins_ = Move(origins);
+        }
+    }
+
+    // copy the index out of the mapped file, so that the file can be overwritten. the caller should hold the index exclusively.
+    void Unmap() {
+        if (mmap_file_.get() == nullptr) {
+            return;
+        }
+        data_store_.Unmap();
+        graph_store_.Unmap(data_store_.cur_vec_num());
+        if (labels_buffer_.get() == nullptr) {
+            auto labels = MakeUnique<LabelType[]>(data_store_.max_vec_num());
+            Copy(labels_, labels_ + data_store_.cur_vec_num(), labels.get());
+            labels_buffer_ = Move(labels);
+            labels_ = labels_buffer_.get();
+        }
+        mmap_file_.reset();
+    }
+
+    bool IsMapped() const { return mmap_file_.get() != nullptr; }
+
+    // unlink the deleted vertices, whose bit is false in `bitmask`, from the neighbor lists of the alive vertices.
+    // a neighbor list is refilled with the neighbors of its deleted neighbors. the deleted vertices keep their own
+    // neighbors, so a search still passes through a deleted enter point. the caller should hold the index exclusively.
+    // return the number of repaired neighbor lists.
+    SizeT RepairDeleted(const Bitmask &bitmask) {
+        if (bitmask.IsAllTrue()) {
+            return 0;
+        }
+        SizeT repaired_n = 0;
+        Vector<VertexType> candidate_idxes;
+        CandidatePool candidates;
+        for (VertexType vertex_i = 0; vertex_i < VertexType(data_store_.cur_vec_num()); ++vertex_i) {
+            if (!BitmaskIsTrue(bitmask, vertex_i)) {
+                continue;
+            }
+            StoreType v_data = data_store_.GetVec(vertex_i);
+            for (i32 layer_i = 0; layer_i <= graph_store_.GetLayerN(vertex_i); ++layer_i) {
+                auto [neighbors_p, neighbor_size_p] = graph_store_.GetNeighborsMut(vertex_i, layer_i);
+                candidate_idxes.clear();
+                bool has_deleted = false;
+                for (int i = 0; i < *neighbor_size_p; ++i) {
+                    VertexType n_idx = neighbors_p[i];
+                    if (BitmaskIsTrue(bitmask, n_idx)) {
+                        candidate_idxes.push_back(n_idx);
+                        continue;
+                    }
+                    has_deleted = true;
+                    const auto [nn_p, nn_size] = graph_store_.GetNeighbors(n_idx, layer_i);
+                    for (int j = 0; j < nn_size; ++j) {
+                        if (nn_p[j] != vertex_i && BitmaskIsTrue(bitmask, nn_p[j])) {
+                            candidate_idxes.push_back(nn_p[j]);
+                        }
+                    }
+                }
+                if (!has_deleted) {
+                    continue;
+                }
+                std::sort(candidate_idxes.begin(), candidate_idxes.end());
+                candidate_idxes.erase(std::unique(candidate_idxes.begin(), candidate_idxes.end()), candidate_idxes.end());
+                candidates.Reset(candidate_idxes.size());
+                for (VertexType c_idx : candidate_idxes) {
+                    candidates.Insert(distance_(v_data, data_store_.GetVec(c_idx), data_store_), c_idx);
+                }
+                SelectNeighborsHeuristic(candidates, layer_i == 0 ? Mmax0_ : Mmax_, neighbors_p, neighbor_size_p);
+                ++repaired_n;
+            }
+        }
+        return repaired_n;
+    }
+
+    // renumber the vertices in the breadth first order of level 0 from the enter point, so that the vectors and the neighbor lists
+    // of the vertices visited together in a search are close in memory. the neighbor lists are ordered by distance, so a vertex
+    // is followed by its nearest neighbors. the bitmasks of the searches still refer to the ids before the reordering.
+    // the caller should hold the index exclusively.
+    void Reorder() {
+        SizeT vertex_n = data_store_.cur_vec_num();
+        if (vertex_n == 0) {
+            return;
+        }
+        Unmap();
+        // the vertex of new id i is `order[i]`, `new_ids` is the inverse
+        Vector<VertexType> order;
+        order.reserve(vertex_n);
+        Vector<VertexType> new_ids(vertex_n, -1);
+        auto Traverse = [&](VertexType root) {
+            new_ids[root] = order.size();
+            order.push_back(root);
+            for (SizeT head = order.size() - 1; head < order.size(); ++head) {
+                const auto [neighbors_p, neighbor_size] = graph_store_.GetNeighbors(order[head], 0);
+                for (int i = 0; i < neighbor_size; ++i) {
+                    if (VertexType n_idx = neighbors_p[i]; new_ids[n_idx] == -1) {
+                        new_ids[n_idx] = order.size();
+                        order.push_back(n_idx);
+                    }
+                }
+            }
+        };
+        Traverse(graph_store_.enterpoint());
+        // the vertices not reachable from the enter point, e.g. the deleted ones unlinked by `RepairDeleted`
+        for (VertexType vertex_i = 0; vertex_i < VertexType(vertex_n); ++vertex_i) {
+            if (new_ids[vertex_i] == -1) {
+                Traverse(vertex_i);
+            }
+        }
+
+        data_store_.Permute(order.data());
+        graph_store_.Permute(order.data(), new_ids.data(), vertex_n);
+        PermuteRows(labels_, 1, order.data(), vertex_n);
+        auto origins = MakeUniqueForOverwrite<VertexType[]>(data_store_.max_vec_num());
+        for (SizeT i = 0; i < vertex_n; ++i) {
+            origins[i] = origins_.get() != nullptr ? origins_[order[i]] : order[i];
+        }
+        origins_ = Move(origins);
+    }
+
+    bool IsReordered() const { return origins_.get() != nullptr; }
+
+    SizeT GetVertexNum() const { return data_store_.cur_vec_num(); }
+
+    SizeT GetMaxVertexNum() const { return data_store_.max_vec_num(); }
+
+    SizeT GetEf(const HnswSearchParams &params) const { return params.ef_ == 0 ? ef_construction_ : params.ef_; }
+
+    // replace the distances of the level 0 candidates with the refined ones when the distance can refine them
+    void Rerank(const DataType *q, CandidatePool &search_result) const {
+        if constexpr (RerankDistanceConcept<Distance, DataType>) {
+            Vector<DataType> buffer(data_store_.dim());
+            for (SizeT i = 0; i < search_result.size(); ++i) {
+                search_result.SetDist(i, distance_.Rerank(q, search_result.Id(i), data_store_, buffer.data()));
+            }
+            search_result.Sort();
+        }
+    }
+
+    // the nearest `k` of the level 0 candidates with their labels. they are put in descending order of distance, which is a
+    // max heap already.
+    MaxHeap<Pair<DistType, LabelType>> MakeKnnResult(const DataType *q, SizeT k, CandidatePool &search_result) const {
+        Rerank(q, search_result);
+        SizeT result_n = Min(k, search_result.size());
+        Vector<Pair<DistType, LabelType>> result;
+        result.reserve(result_n);
+        for (SizeT i = result_n; i > 0; --i) {
+            result.emplace_back(search_result.Dist(i - 1), labels_[search_result.Id(i - 1)]);
+        }
+        return MaxHeap<Pair<DistType, LabelType>>({}, Move(result));
+    }
+
+    MaxHeap<Pair<DistType, LabelType>> KnnSearch(const DataType *q, SizeT k, const HnswSearchParams &params = {}) const {
         auto query = data_store_.MakeQuery(q);
         VertexType ep = graph_store_.enterpoint();
         for (i32 cur_layer = graph_store_.max_layer(); cur_layer > 0; --cur_layer) {
             ep = SearchLayerNearest(ep, query, cur_layer);
         }
-        DistHeap search_result = SearchLayer(ep, query, 0, Max(k, ef_));
-        while (search_result.size() > k) {
-            search_result.pop();
-        }
-        MaxHeap<Pair<DataType, LabelType>> result; // TODO:: reserve
-        while (!search_result.empty()) {
-            const auto &[dist, idx] = search_result.top();
-            result.emplace(dist, labels_[idx]);
-            search_result.pop();
+        auto search_result_pooled = candidate_pool_.Get();
+        CandidatePool &search_result = *search_result_pooled;
+        SearchLayer(ep, query, 0, Max(k, GetEf(params)), search_result);
+        return MakeKnnResult(q, k, search_result);
+    }
+
+    MaxHeap<Pair<DistType, LabelType>> KnnSearch(const DataType *q, SizeT k, const Bitmask &bitmask, const HnswSearchParams &params = {}) const {
+        auto query = data_store_.MakeQuery(q);
+        VertexType ep = graph_store_.enterpoint();
+        for (i32 cur_layer = graph_store_.max_layer(); cur_layer > 0; --cur_layer) {
+            ep = SearchLayerNearest(ep, query, cur_layer);
         }
-        return result;
+        auto search_result_pooled = candidate_pool_.Get();
+        CandidatePool &search_result = *search_result_pooled;
+        SearchLayer(ep, query, 0, Max(k, GetEf(params)), bitmask, search_result, params.expand_filtered_);
+        return MakeKnnResult(q, k, search_result);
     }
 
-    MaxHeap<Pair<DataType, LabelType>> KnnSearch(const DataType *q, SizeT k, const Bitmask &bitmask) const {
+    // the labels and distances of the vertices within `radius` of `q` and in `bitmask`, in ascending order of distance.
+    // the `ef` nearest vertices of level 0 start a flood through the neighbors within `radius`, so the frontier is bounded by
+    // `radius` rather than `ef`. the vertices filtered out pass the flood on to their neighbors.
+    Vector<Pair<DistType, LabelType>>
+    KnnRangeSearch(const DataType *q, DistType radius, const Bitmask &bitmask, const HnswSearchParams &params = {}) const {
         auto query = data_store_.MakeQuery(q);
         VertexType ep = graph_store_.enterpoint();
         for (i32 cur_layer = graph_store_.max_layer(); cur_layer > 0; --cur_layer) {
             ep = SearchLayerNearest(ep, query, cur_layer);
         }
-        DistHeap search_result = SearchLayer(ep, query, 0, Max(k, ef_), bitmask);
-        while (search_result.size() > k) {
-            search_result.pop();
+        auto search_result_pooled = candidate_pool_.Get();
+        CandidatePool &search_result = *search_result_pooled;
+        SearchLayer(ep, query, 0, GetEf(params), search_result);
+
+        auto visited_pooled = GetVisited();
+        VisitedTable &visited = *visited_pooled;
+        Vector<PDV> in_range;
+        Vector<VertexType> frontier;
+        for (SizeT i = 0; i < search_result.size(); ++i) {
+            DistType dist = search_result.Dist(i);
+            VertexType idx = search_result.Id(i);
+            visited.SetVisited(idx);
+            if (dist <= radius) {
+                in_range.emplace_back(dist, idx);
+                frontier.push_back(idx);
+            }
+        }
+        while (!frontier.empty()) {
+            VertexType c_idx = frontier.back();
+            frontier.pop_back();
+            const auto [neighbors_p, neighbor_size] = graph_store_.GetNeighbors(c_idx, 0);
+            for (int i = 0; i < neighbor_size; ++i) {
+                VertexType n_idx = neighbors_p[i];
+                if (visited.IsVisited(n_idx)) {
+                    continue;
+                }
+                visited.SetVisited(n_idx);
+                DistType dist = distance_(query, data_store_.GetVec(n_idx), data_store_);
+                if (dist <= radius) {
+                    in_range.emplace_back(dist, n_idx);
+                    frontier.push_back(n_idx);
+                }
+            }
         }
-        MaxHeap<Pair<DataType, LabelType>> result; // TODO:: reserve
-        while (!search_result.empty()) {
-            const auto &[dist, idx] = search_result.top();
-            result.emplace(dist, labels_[idx]);
-            search_result.pop();
+
+        Vector<Pair<DistType, LabelType>> result;
+        result.reserve(in_range.size());
+        [[maybe_unused]] Vector<DataType> buffer(RerankDistanceConcept<Distance, DataType> ? data_store_.dim() : 0);
+        for (auto [dist, idx] : in_range) {
+            if (!BitmaskIsTrue(bitmask, idx)) {
+                continue;
+            }
+            if constexpr (RerankDistanceConcept<Distance, DataType>) {
+                dist = distance_.Rerank(q, idx, data_store_, buffer.data());
+                if (dist > radius) {
+                    continue;
+                }
+            }
+            result.emplace_back(dist, labels_[idx]);
         }
+        std::sort(result.begin(), result.end(), [](const auto &a, const auto &b) { return a.first < b.first; });
         return result;
     }
 
-    Pair<u32, Pair<UniquePtr<DataType[]>, UniquePtr<LabelType[]>>> KnnSearchReturnPair(const DataType *q, SizeT k, const Bitmask &bitmask) const {
+    // search `query_n` queries together. the `k` nearest labels and distances of the i-th query are written to the i-th row
+    // of the `query_n` x `k` matrices `labels` and `distances` in ascending order of distance, and the result number of the
+    // i-th query is written to `result_ns[i]`. the queries are split into chunks, which are searched by the calling thread
+    // and at most `thread_n - 1` workers of `pool`, so the threads of concurrent searches are bounded by the pool.
+    void KnnSearchBatch(const DataType *queries,
+                        SizeT query_n,
+                        SizeT k,
+                        const Bitmask &bitmask,
+                        DistType *distances,
+                        LabelType *labels,
+                        SizeT *result_ns,
+                        const HnswSearchParams &params = {},
+                        ThreadPool *pool = nullptr,
+                        SizeT thread_n = 1) const {
+        auto SearchChunk = [&](SizeT begin, SizeT end) {
+            SizeT chunk_n = end - begin;
+            Vector<typename DataStore::QueryType> chunk_queries;
+            chunk_queries.reserve(chunk_n);
+            for (SizeT i = begin; i < end; ++i) {
+                chunk_queries.emplace_back(data_store_.MakeQuery(queries + i * data_store_.dim()));
+            }
+            // descend the upper layers layer by layer, the few vertices there stay in cache across the queries
+            Vector<VertexType> eps(chunk_n, graph_store_.enterpoint());
+            for (i32 cur_layer = graph_store_.max_layer(); cur_layer > 0; --cur_layer) {
+                for (SizeT i = 0; i < chunk_n; ++i) {
+                    eps[i] = SearchLayerNearest(eps[i], chunk_queries[i], cur_layer);
+                }
+            }
+            // the scratch memory is shared by the queries of the chunk
+            auto candidate_pooled = candidate_pool_.Get();
+            auto result_pooled = candidate_pool_.Get();
+            auto visited_pooled = visited_pool_.Get(data_store_.cur_vec_num());
+            CandidatePool &search_result = *result_pooled;
+            for (SizeT i = 0; i < chunk_n; ++i) {
+                if (i + 1 < chunk_n) {
+                    data_store_.Prefetch(eps[i + 1]);
+                }
+                SearchLayer(eps[i],
+                            chunk_queries[i],
+                            0,
+                            Max(k, GetEf(params)),
+                            bitmask,
+                            *candidate_pooled,
+                            *visited_pooled,
+                            search_result,
+                            params.expand_filtered_);
+                Rerank(queries + (begin + i) * data_store_.dim(), search_result);
+                SizeT query_i = begin + i;
+                result_ns[query_i] = Min(k, search_result.size());
+                for (SizeT j = 0; j < result_ns[query_i]; ++j) {
+                    distances[query_i * k + j] = search_result.Dist(j);
+                    labels[query_i * k + j] = labels_[search_result.Id(j)];
+                }
+            }
+        };
+        constexpr SizeT chunk_size = 16;
+        if (pool == nullptr || thread_n <= 1 || query_n <= chunk_size) {
+            SearchChunk(0, query_n);
+            return;
+        }
+        atomic_u64 next_begin(0);
+        auto SearchChunks = [&] {
+            try {
+                for (SizeT begin = next_begin.fetch_add(chunk_size); begin < query_n; begin = next_begin.fetch_add(chunk_size)) {
+                    SearchChunk(begin, Min(begin + chunk_size, query_n));
+                }
+            } catch (...) {
+                // the other threads skip the remaining chunks
+                next_begin.store(query_n);
+                throw;
+            }
+        };
+        // the calling thread searches too, so the batch completes even when all workers of the pool are busy
+        thread_n = Min(thread_n, (query_n + chunk_size - 1) / chunk_size);
+        Vector<std::future<void>> helpers;
+        std::exception_ptr first_exception;
+        try {
+            helpers.reserve(thread_n - 1);
+            for (SizeT thread_i = 1; thread_i < thread_n; ++thread_i) {
+                helpers.emplace_back(pool->push([&](int) { SearchChunks(); }));
+            }
+            SearchChunks();
+        } catch (...) {
+            first_exception = std::current_exception();
+        }
+        // the helpers reference this frame, so all of them are done before the first exception is rethrown
+        for (auto &helper : helpers) {
+            try {
+                helper.get();
+            } catch (...) {
+                if (first_exception == nullptr) {
+                    first_exception = std::current_exception();
+                }
+            }
+        }
+        if (first_exception != nullptr) {
+            std::rethrow_exception(first_exception);
+        }
+    }
+
+    // the nearest `k` labels and distances in ascending order of distance, and their number
+    Pair<u32, Pair<UniquePtr<DistType[]>, UniquePtr<LabelType[]>>>
+    KnnSearchReturnPair(const DataType *q, SizeT k, const Bitmask &bitmask, const HnswSearchParams &params = {}) const {
         auto query = data_store_.MakeQuery(q);
         VertexType ep = graph_store_.enterpoint();
         for (i32 cur_layer = graph_store_.max_layer(); cur_layer > 0; --cur_layer) {
             ep = SearchLayerNearest(ep, query, cur_layer);
         }
-        auto search_result = SearchLayerReturnPair(ep, query, 0, Max(k, ef_), bitmask);
-        auto &[result_size, unique_ptr_pair] = search_result;
-        auto &[d_ptr, v_ptr] = unique_ptr_pair;
-        UniquePtr<LabelType[]> l_ptr;
-        if constexpr (sizeof(LabelType) == sizeof(VertexType)) {
-            auto label_ptr = reinterpret_cast<LabelType *>(v_ptr.get());
-            for (SizeT i = 0; i < result_size; ++i) {
-                label_ptr[i] = labels_[v_ptr[i]];
-            }
-            l_ptr.reset(reinterpret_cast<LabelType *>(v_ptr.release()));
-        } else {
-            l_ptr = MakeUniqueForOverwrite<LabelType[]>(result_size);
-            for (SizeT i = 0; i < result_size; ++i) {
-                l_ptr[i] = labels_[v_ptr[i]];
-            }
+        auto search_result_pooled = candidate_pool_.Get();
+        CandidatePool &search_result = *search_result_pooled;
+        SearchLayer(ep, query, 0, Max(k, GetEf(params)), bitmask, search_result, params.expand_filtered_);
+        // the refined distances may change the order, so the candidates are sorted again before the nearest `k` are taken
+        Rerank(q, search_result);
+        SizeT result_size = Min(k, search_result.size());
+        auto d_ptr = MakeUniqueForOverwrite<DistType[]>(result_size);
+        auto l_ptr = MakeUniqueForOverwrite<LabelType[]>(result_size);
+        for (SizeT i = 0; i < result_size; ++i) {
+            d_ptr[i] = search_result.Dist(i);
+            l_ptr[i] = labels_[search_result.Id(i)];
         }
-        return {result_size, MakePair(Move(d_ptr), Move(l_ptr))};
+        return {u32(result_size), MakePair(Move(d_ptr), Move(l_ptr))};
     }
 
 public:
-    void SetEf(SizeT ef) { ef_ = ef; }
-
+    // the header has a flag of the reordering in its padding, which is 0 in the files written before. the ids before the
+    // reordering follow the labels.
     void Save(FileHandler &file_handler) {
+        SizeT reordered = IsReordered();
         file_handler.Write(&M_, sizeof(M_));
         file_handler.Write(&ef_construction_, sizeof(ef_construction_));
+        file_handler.Write(&reordered, sizeof(reordered));
+        WritePadding(file_handler, sizeof(SizeT) * 3);
         data_store_.Save(file_handler);
         graph_store_.SaveGraph(file_handler, data_store_.cur_vec_num());
-        file_handler.Write(labels_.get(), sizeof(LabelType) * data_store_.cur_vec_num());
+        SizeT labels_size = sizeof(LabelType) * data_store_.cur_vec_num();
+        file_handler.Write(labels_, labels_size);
+        WritePadding(file_handler, labels_size);
+        if (reordered) {
+            SizeT origins_size = sizeof(VertexType) * data_store_.cur_vec_num();
+            file_handler.Write(origins_.get(), origins_size);
+            WritePadding(file_handler, origins_size);
+        }
     }
 
     static UniquePtr<This> Load(FileHandler &file_handler, DataStore::InitArgs args) {
@@ -547,15 +860,58 @@ public:
         file_handler.Read(&M, sizeof(M));
         SizeT ef_construction;
         file_handler.Read(&ef_construction, sizeof(ef_construction));
+        SizeT reordered;
+        file_handler.Read(&reordered, sizeof(reordered));
+        ReadPadding(file_handler, sizeof(SizeT) * 3);
         auto [Mmax, Mmax0] = This::GetMmax(M);
 
         auto data_store = DataStore::Load(file_handler, 0, args);
         auto graph_store = GraphStore::LoadGraph(file_handler, data_store.max_vec_num(), Mmax, Mmax0, data_store.cur_vec_num());
         Distance distance(data_store.dim());
 
-        auto labels = MakeUnique<LabelType[]>(data_store.cur_vec_num());
-        file_handler.Read(labels.get(), sizeof(LabelType) * data_store.cur_vec_num());
-        return UniquePtr<This>(new This(M, Mmax, Mmax0, ef_construction, Move(data_store), Move(graph_store), Move(distance), Move(labels), 0, 0));
+        auto labels = MakeUnique<LabelType[]>(data_store.max_vec_num());
+        SizeT labels_size = sizeof(LabelType) * data_store.cur_vec_num();
+        file_handler.Read(labels.get(), labels_size);
+        UniquePtr<VertexType[]> origins;
+        if (reordered) {
+            ReadPadding(file_handler, labels_size);
+            origins = MakeUniqueForOverwrite<VertexType[]>(data_store.max_vec_num());
+            file_handler.Read(origins.get(), sizeof(VertexType) * data_store.cur_vec_num());
+        }
+        auto ret =
+            UniquePtr<This>(new This(M, Mmax, Mmax0, ef_construction, Move(data_store), Move(graph_store), Move(distance), Move(labels), 0));
+        ret->origins_ = Move(origins);
+        return ret;
+    }
+
+    // use the index in place of the mapped file, only the metadata is read. the pages are loaded on the first access and are
+    // shared with the page cache. the index is full, it is copied out of the mapping when it grows or is unmapped.
+    static UniquePtr<This> Load(UniquePtr<MmapFile> mmap_file, DataStore::InitArgs args) {
+        MmapReader reader(mmap_file->data(), mmap_file->size());
+        const auto *header = reinterpret_cast<const SizeT *>(reader.ReadSection(sizeof(SizeT) * 3));
+        SizeT M = header[0];
+        SizeT ef_construction = header[1];
+        SizeT reordered = header[2];
+        auto [Mmax, Mmax0] = This::GetMmax(M);
+
+        auto data_store = DataStore::Load(reader, args);
+        auto graph_store = GraphStore::LoadGraph(reader, Mmax, Mmax0, data_store.cur_vec_num());
+        Distance distance(data_store.dim());
+        auto *labels = reinterpret_cast<LabelType *>(reader.ReadSection(sizeof(LabelType) * data_store.cur_vec_num()));
+        // the ids before the reordering are copied, they are small beside the vectors
+        UniquePtr<VertexType[]> origins;
+        if (reordered) {
+            SizeT vertex_n = data_store.cur_vec_num();
+            const auto *origins_p = reinterpret_cast<const VertexType *>(reader.ReadSection(sizeof(VertexType) * vertex_n));
+            origins = MakeUniqueForOverwrite<VertexType[]>(vertex_n);
+            Copy(origins_p, origins_p + vertex_n, origins.get());
+        }
+
+        auto ret = UniquePtr<This>(new This(M, Mmax, Mmax0, ef_construction, Move(data_store), Move(graph_store), Move(distance), nullptr, 0));
+        ret->labels_ = labels;
+        ret->origins_ = Move(origins);
+        ret->mmap_file_ = Move(mmap_file);
+        return ret;
     }
 
     //---------------------------------------------- Following is the tmp debug function. ----------------------------------------------
@@ -25,8 +25,63 @@ export module hnsw_common;
 namespace infinity {
 export constexpr SizeT AlignTo(SizeT a, SizeT b) { return (a + b - 1) / b * b; }
 
+// every section of the index file starts at a multiple of it, so that a section can be used in place of a mapped file.
+export constexpr SizeT HNSW_FILE_ALIGN = 64;
+
+export void WritePadding(FileHandler &file_handler, SizeT section_size) {
+    char padding[HNSW_FILE_ALIGN]{};
+    if (SizeT padding_size = AlignTo(section_size, HNSW_FILE_ALIGN) - section_size; padding_size > 0) {
+        file_handler.Write(padding, padding_size);
+    }
+}
+
+export void ReadPadding(FileHandler &file_handler, SizeT section_size) {
+    char padding[HNSW_FILE_ALIGN];
+    if (SizeT padding_size = AlignTo(section_size, HNSW_FILE_ALIGN) - section_size; padding_size > 0) {
+        file_handler.Read(padding, padding_size);
+    }
+}
+
+// read the sections of an index file mapped in memory. the returned sections point into the mapping.
+export class MmapReader {
+    char *const data_;
+    const SizeT size_;
+    SizeT offset_{0};
+
+public:
+    MmapReader(char *data, SizeT size) : data_(data), size_(size) {}
+
+    char *ReadSection(SizeT section_size) {
+        if (offset_ + section_size > size_) {
+            Error<StorageException>("Index file is truncated.");
+        }
+        char *ret = data_ + offset_;
+        offset_ = Min(size_, offset_ + AlignTo(section_size, HNSW_FILE_ALIGN));
+        return ret;
+    }
+};
+
 export using MeanType = double;
 
+export using VertexType = i32;
+export using VertexListSize = i32;
+export using LayerSize = i32;
+
+// the distances are of `DataType`, unless the distance declares `DistType`, e.g. the hamming distance of packed bits
+template <typename Distance, typename DataType>
+struct DistanceTypeTraits {
+    using Type = DataType;
+};
+
+template <typename Distance, typename DataType>
+    requires requires { typename Distance::DistType; }
+struct DistanceTypeTraits<Distance, DataType> {
+    using Type = typename Distance::DistType;
+};
+
+export template <typename Distance, typename DataType>
+using DistanceType = typename DistanceTypeTraits<Distance, DataType>::Type;
+
 export template <typename Distance, typename DataType>
 concept DistanceConcept = requires(Distance d) {
     { Distance((SizeT)0) };
@@ -35,7 +90,15 @@ concept DistanceConcept = requires(Distance d) {
         d(std::declval<const typename Distance::StoreType &>(),
           std::declval<const typename Distance::StoreType &>(),
           std::declval<const typename Distance::DataStore &>())
-    } -> std::same_as<DataType>;
+    } -> std::same_as<DistanceType<Distance, DataType>>;
+};
+
+// a distance that can refine the distance of a candidate, e.g. with the residual kept beside the compressed vector
+export template <typename Distance, typename DataType>
+concept RerankDistanceConcept = requires(Distance d) {
+    {
+        d.Rerank((const DataType *)nullptr, (SizeT)0, std::declval<const typename Distance::DataStore &>(), (DataType *)nullptr)
+    } -> std::same_as<DistanceType<Distance, DataType>>;
 };
 
 export template <typename LVQCache, typename DataType, typename CompressType>
@@ -52,11 +115,15 @@ concept DataStoreConcept = requires(DataStore s) {
     { DataStore::Make((SizeT)0, (SizeT)0, std::declval<typename DataStore::InitArgs>()) } -> std::same_as<DataStore>;
     { s.Save(std::declval<FileHandler &>()) };
     { DataStore::Load(std::declval<FileHandler &>(), (SizeT)0, std::declval<typename DataStore::InitArgs>()) } -> std::same_as<DataStore>;
+    { DataStore::Load(std::declval<MmapReader &>(), std::declval<typename DataStore::InitArgs>()) } -> std::same_as<DataStore>;
+    { s.Unmap() };
 
     { DataStore::ERR_IDX };
     { s.cur_vec_num() } -> std::same_as<SizeT>;
     { s.dim() } -> std::same_as<SizeT>;
     { s.max_vec_num() } -> std::same_as<SizeT>;
+    { s.Grow((SizeT)0) };
+    { s.Permute((const VertexType *)nullptr) };
 
     // todo: how to add constraint for a template member function.
     // { s.AddVec(iter, (SizeT)0) } -> std::same_as<SizeT>;
@@ -97,10 +164,13 @@ public:
         return ret;
     }
 
+    void Grow(SizeT max_vec_num) { const_cast<SizeT &>(max_vec_num_) = Max(max_vec_num_, max_vec_num); }
+
     void Save(FileHandler &file_handler) const {
         file_handler.Write(&cur_vec_num_, sizeof(SizeT));
         file_handler.Write(&max_vec_num_, sizeof(SizeT));
         file_handler.Write(&dim_, sizeof(SizeT));
+        WritePadding(file_handler, sizeof(SizeT) * 3);
     }
 
     static DataStoreMeta Load(FileHandler &file_handler, SizeT new_vec_n) {
@@ -114,18 +184,41 @@ public:
             max_vec_num = new_vec_n;
         }
         file_handler.Read(&dim, sizeof(SizeT));
+        ReadPadding(file_handler, sizeof(SizeT) * 3);
         DataStoreMeta ret(max_vec_num, dim);
         ret.cur_vec_num_ = cur_vec_num;
         return ret;
     }
 
+    // the mapped store is full, it can not grow in place
+    static DataStoreMeta Load(MmapReader &reader) {
+        const auto *header = reinterpret_cast<const SizeT *>(reader.ReadSection(sizeof(SizeT) * 3));
+        DataStoreMeta ret(header[0], header[2]);
+        ret.cur_vec_num_ = header[0];
+        return ret;
+    }
+
 public:
     SizeT cur_vec_num() const { return cur_vec_num_; }
 };
 
-export using VertexType = i32;
-export using VertexListSize = i32;
-export using LayerSize = i32;
+// per query search parameters. the index is not modified by the search, so queries with different parameters can run concurrently.
+export struct HnswSearchParams {
+    SizeT ef_{0}; // size of the dynamic candidate list. 0 means `ef_construction` of the index.
+    // pass through the vertices filtered out by the bitmask to their neighbors, for the filters that few vertices pass
+    bool expand_filtered_{false};
+};
+
+// reorder the rows of `row_size` elements, so that the i-th row is the `order[i]`-th row before
+export template <typename T>
+void PermuteRows(T *rows, SizeT row_size, const VertexType *order, SizeT row_n) {
+    auto permuted = MakeUniqueForOverwrite<T[]>(row_n * row_size);
+    for (SizeT i = 0; i < row_n; ++i) {
+        const T *row = rows + order[i] * row_size;
+        Copy(row, row + row_size, permuted.get() + i * row_size);
+    }
+    Copy(permuted.get(), permuted.get() + row_n * row_size, rows);
+}
 
 export template <typename Iterator, typename DataType>
 concept DataIteratorConcept = requires(Iterator iter) {
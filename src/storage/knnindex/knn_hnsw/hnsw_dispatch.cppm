@@ -0,0 +1,134 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+import stl;
+import parser;
+import third_party;
+import index_base;
+import index_hnsw;
+import infinity_exception;
+import hnsw_alg;
+import plain_store;
+import lvq_store;
+import pq_store;
+import half_store;
+import dist_func_l2;
+import dist_func_ip;
+import dist_func_hamming;
+
+export module hnsw_dispatch;
+
+namespace infinity {
+
+// a cosine index keeps the normalized vectors, which are compared by inner product
+template <typename IPHnsw, typename L2Hnsw, typename Func>
+void DispatchHnswMetric(MetricType metric_type, Func &func) {
+    switch (metric_type) {
+        case MetricType::kMerticInnerProduct:
+        case MetricType::kMerticCosine: {
+            func.template operator()<IPHnsw>();
+            break;
+        }
+        case MetricType::kMerticL2: {
+            func.template operator()<L2Hnsw>();
+            break;
+        }
+        default: {
+            Error<StorageException>(Format("Index on float embedding column doesn't support metric: {}", MetricTypeToString(metric_type)));
+        }
+    }
+}
+
+// call `func.template operator()<Hnsw>()` with the `KnnHnsw` type of the index `index_hnsw` on an embedding column of `elem_type`,
+// which is chosen by the element type, the encoding and the metric. the half precision vectors are widened to f32, so they share
+// the indexes of f32. the int8 and bit indexes are plain encoded.
+export template <typename Func>
+void DispatchHnsw(const IndexHnsw *index_hnsw, EmbeddingDataType elem_type, Func &&func) {
+    MetricType metric_type = index_hnsw->metric_type_;
+    switch (elem_type) {
+        case kElemFloat:
+        case kElemFloat16:
+        case kElemBFloat16: {
+            switch (index_hnsw->encode_type_) {
+                case HnswEncodeType::kPlain: {
+                    DispatchHnswMetric<KnnHnsw<f32, u64, PlainStore<f32>, PlainIPDist<f32>>,
+                                       KnnHnsw<f32, u64, PlainStore<f32>, PlainL2Dist<f32>>>(metric_type, func);
+                    break;
+                }
+                case HnswEncodeType::kLVQ: {
+                    DispatchHnswMetric<KnnHnsw<f32, u64, LVQStore<f32, i8, LVQIPCache<f32, i8>>, LVQIPDist<f32, i8>>,
+                                       KnnHnsw<f32, u64, LVQStore<f32, i8, LVQL2Cache<f32, i8>>, LVQL2Dist<f32, i8>>>(metric_type, func);
+                    break;
+                }
+                case HnswEncodeType::kLVQ4: {
+                    DispatchHnswMetric<KnnHnsw<f32, u64, LVQStore<f32, U4, LVQIPCache<f32, i8>>, LVQIPDist<f32, U4>>,
+                                       KnnHnsw<f32, u64, LVQStore<f32, U4, LVQL2Cache<f32, i8>>, LVQL2Dist<f32, U4>>>(metric_type, func);
+                    break;
+                }
+                case HnswEncodeType::kLVQ4x8: {
+                    DispatchHnswMetric<KnnHnsw<f32, u64, LVQStore<f32, U4x8, LVQIPCache<f32, i8>>, LVQIPDist<f32, U4x8>>,
+                                       KnnHnsw<f32, u64, LVQStore<f32, U4x8, LVQL2Cache<f32, i8>>, LVQL2Dist<f32, U4x8>>>(metric_type, func);
+                    break;
+                }
+                case HnswEncodeType::kPQ: {
+                    DispatchHnswMetric<KnnHnsw<f32, u64, PQStore<f32, PQIPTable<f32>>, PQIPDist<f32>>,
+                                       KnnHnsw<f32, u64, PQStore<f32, PQL2Table<f32>>, PQL2Dist<f32>>>(metric_type, func);
+                    break;
+                }
+                case HnswEncodeType::kFP16: {
+                    DispatchHnswMetric<KnnHnsw<f32, u64, HalfStore<f32, float16_t>, HalfIPDist<f32, float16_t>>,
+                                       KnnHnsw<f32, u64, HalfStore<f32, float16_t>, HalfL2Dist<f32, float16_t>>>(metric_type, func);
+                    break;
+                }
+                case HnswEncodeType::kBF16: {
+                    DispatchHnswMetric<KnnHnsw<f32, u64, HalfStore<f32, bfloat16_t>, HalfIPDist<f32, bfloat16_t>>,
+                                       KnnHnsw<f32, u64, HalfStore<f32, bfloat16_t>, HalfL2Dist<f32, bfloat16_t>>>(metric_type, func);
+                    break;
+                }
+                default: {
+                    Error<StorageException>(Format("Invalid hnsw encode type: {}", HnswEncodeTypeToString(index_hnsw->encode_type_)));
+                }
+            }
+            break;
+        }
+        case kElemInt8: {
+            if (index_hnsw->encode_type_ != HnswEncodeType::kPlain) {
+                Error<StorageException>("Index on int8 embedding column should be plain encoded.");
+            }
+            if (metric_type == MetricType::kMerticInnerProduct) {
+                func.template operator()<KnnHnsw<i8, u64, PlainStore<i8>, I8IPDist>>();
+            } else if (metric_type == MetricType::kMerticL2) {
+                func.template operator()<KnnHnsw<i8, u64, PlainStore<i8>, I8L2Dist>>();
+            } else {
+                Error<StorageException>("Index on int8 embedding column should use l2 or inner product metric.");
+            }
+            break;
+        }
+        case kElemBit: {
+            // the bits are packed, so the dimension of the store is the number of bytes
+            if (index_hnsw->encode_type_ != HnswEncodeType::kPlain || metric_type != MetricType::kMerticHamming) {
+                Error<StorageException>("Index on bit embedding column should be plain encoded with hamming metric.");
+            }
+            func.template operator()<KnnHnsw<u8, u64, PlainStore<u8>, PlainHammingDist>>();
+            break;
+        }
+        default: {
+            Error<StorageException>("Index should be created on float, half precision, int8 or bit embedding column now.");
+        }
+    }
+}
+
+} // namespace infinity
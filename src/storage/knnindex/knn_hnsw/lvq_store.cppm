@@ -28,12 +28,57 @@ export module lvq_store;
 
 namespace infinity {
 
-export template <typename DataType, typename CompressType, LVQCacheConcept<DataType, CompressType> LVQCache>
+// 4-bit codes. two codes are packed in one byte, the first one in the low nibble.
+export struct U4 {};
+
+// 4-bit codes followed by the 8-bit codes of the residual to the 4-bit vector. the graph is traversed with the 4-bit codes,
+// and the candidates are re-ranked with the residual.
+export struct U4x8 {};
+
+// how the codes of `CompressType` are stored. the codes are decoded to `ValueType` for the caches.
+export template <typename CompressType>
+struct LVQCodeTraits;
+
+template <>
+struct LVQCodeTraits<i8> {
+    using CodeType = i8;
+    using ValueType = i8;
+    static constexpr i32 MIN_CODE = LimitMin<i8>();
+    static constexpr i32 MAX_CODE = LimitMax<i8>();
+    static constexpr bool HAS_RESIDUAL = false;
+
+    static constexpr SizeT CodeSize(SizeT dim) { return dim; }
+    static i32 Get(const CodeType *codes, SizeT i) { return codes[i]; }
+    static void Set(CodeType *codes, SizeT i, i32 code) { codes[i] = code; }
+};
+
+template <>
+struct LVQCodeTraits<U4> {
+    using CodeType = u8;
+    using ValueType = i8;
+    static constexpr i32 MIN_CODE = 0;
+    static constexpr i32 MAX_CODE = 15;
+    static constexpr bool HAS_RESIDUAL = false;
+
+    static constexpr SizeT CodeSize(SizeT dim) { return (dim + 1) / 2; }
+    static i32 Get(const CodeType *codes, SizeT i) { return (codes[i >> 1] >> ((i & 1) << 2)) & 0x0F; }
+    static void Set(CodeType *codes, SizeT i, i32 code) {
+        u32 shift = (i & 1) << 2;
+        codes[i >> 1] = (codes[i >> 1] & ~(0x0F << shift)) | (code << shift);
+    }
+};
+
+template <>
+struct LVQCodeTraits<U4x8> : LVQCodeTraits<U4> {
+    static constexpr bool HAS_RESIDUAL = true;
+};
+
+export template <typename DataType, typename CompressType, typename LVQCache>
+    requires LVQCacheConcept<LVQCache, DataType, typename LVQCodeTraits<CompressType>::ValueType>
 class LVQStore {
-public:
-    // Compress type must be i8 temporarily
-    static_assert(std::is_same<CompressType, i8>());
+    using Code = LVQCodeTraits<CompressType>;
 
+public:
     using This = LVQStore<DataType, CompressType, LVQCache>;
     using InitArgs = SizeT; // buffer size
     class LVQData;
@@ -43,9 +88,14 @@ public:
 
     static constexpr SizeT ERR_IDX = DataStoreMeta::ERR_IDX;
     static constexpr SizeT PADDING_SIZE = 32;
+    static constexpr bool HAS_RESIDUAL = Code::HAS_RESIDUAL;
+
+    using CodeType = typename Code::CodeType;
 
 private:
-    constexpr static SizeT max_bucket_idx_ = LimitMax<CompressType>() - LimitMin<CompressType>(); // 255 for i8
+    using ValueType = typename Code::ValueType;
+
+    constexpr static SizeT max_bucket_idx_ = Code::MAX_CODE - Code::MIN_CODE; // 255 for i8
 
     // Decompress: Q = scale * C + bias + Mean
     using ScalarType = DataType; // type for scale and bias
@@ -60,7 +110,11 @@ private:
     constexpr static SizeT scale_offset_ = 0;
     constexpr static SizeT bias_offset_ = AlignTo(scale_offset_ + sizeof(ScalarType), sizeof(ScalarType));
     constexpr static SizeT local_cache_offset_ = AlignTo(bias_offset_ + sizeof(ScalarType), sizeof(LocalCacheType));
-    constexpr static SizeT compress_vec_offset_ = AlignTo(local_cache_offset_ + sizeof(LocalCacheType), sizeof(CompressType));
+    // the scale and bias of the residual, only if the store has the residual. the residual codes follow the codes.
+    constexpr static SizeT residual_scale_offset_ = AlignTo(local_cache_offset_ + sizeof(LocalCacheType), sizeof(ScalarType));
+    constexpr static SizeT residual_bias_offset_ = residual_scale_offset_ + sizeof(ScalarType);
+    constexpr static SizeT compress_vec_offset_ = HAS_RESIDUAL ? residual_bias_offset_ + sizeof(ScalarType)
+                                                               : AlignTo(local_cache_offset_ + sizeof(LocalCacheType), sizeof(CodeType));
 
     DataStoreMeta meta_;
 
@@ -68,6 +122,7 @@ private:
     const SizeT compress_data_size_;
 
     char *const ptr_;
+    bool mapped_; // `ptr_` points into a mapped file
 
     const SizeT buffer_plain_size_;
     PlainStore<DataType> plain_data_;
@@ -83,7 +138,7 @@ public:
     constexpr const MeanType *GetMean() const { return reinterpret_cast<const MeanType *>(ptr_ + mean_offset_); }
 
     struct QueryLVQ {
-        const UniquePtr<char[]> ptr_;
+        UniquePtr<char[]> ptr_;
     };
 
     class LVQData {
@@ -94,7 +149,11 @@ public:
             return {reinterpret_cast<ScalarType *>(ptr_ + scale_offset_), reinterpret_cast<ScalarType *>(ptr_ + bias_offset_)};
         }
         LocalCacheType *GetLocalCacheMut() const { return reinterpret_cast<LocalCacheType *>(ptr_ + local_cache_offset_); }
-        CompressType *GetCompressVecMut() const { return reinterpret_cast<CompressType *>(ptr_ + compress_vec_offset_); }
+        CodeType *GetCompressVecMut() const { return reinterpret_cast<CodeType *>(ptr_ + compress_vec_offset_); }
+        Pair<ScalarType *, ScalarType *> GetResidualScalarMut() const {
+            return {reinterpret_cast<ScalarType *>(ptr_ + residual_scale_offset_), reinterpret_cast<ScalarType *>(ptr_ + residual_bias_offset_)};
+        }
+        i8 *GetResidualVecMut(SizeT dim) const { return reinterpret_cast<i8 *>(ptr_ + compress_vec_offset_ + Code::CodeSize(dim)); }
 
     public:
         LVQData(char *c) : ptr_(c) {}
@@ -105,7 +164,12 @@ public:
             return {*reinterpret_cast<const ScalarType *>(ptr_ + scale_offset_), *reinterpret_cast<const ScalarType *>(ptr_ + bias_offset_)};
         }
         LocalCacheType GetLocalCache() const { return *reinterpret_cast<const LocalCacheType *>(ptr_ + local_cache_offset_); }
-        const CompressType *GetCompressVec() const { return reinterpret_cast<const CompressType *>(ptr_ + compress_vec_offset_); }
+        const CodeType *GetCompressVec() const { return reinterpret_cast<const CodeType *>(ptr_ + compress_vec_offset_); }
+        Pair<ScalarType, ScalarType> GetResidualScalar() const {
+            return {*reinterpret_cast<const ScalarType *>(ptr_ + residual_scale_offset_),
+                    *reinterpret_cast<const ScalarType *>(ptr_ + residual_bias_offset_)};
+        }
+        const i8 *GetResidualVec(SizeT dim) const { return reinterpret_cast<const i8 *>(ptr_ + compress_vec_offset_ + Code::CodeSize(dim)); }
     };
 
     SizeT cur_vec_num() const { return meta_.cur_vec_num() + plain_data_.cur_vec_num(); }
@@ -113,15 +177,41 @@ public:
     SizeT dim() const { return meta_.dim_; }
 
 private:
-    LVQStore(DataStoreMeta meta, This::InitArgs init_args)
-        : meta_(Move(meta)),                                                                                                                      //
-          compress_data_offset_(AlignTo(mean_offset_ + dim() * sizeof(MeanType), PADDING_SIZE)),                                                  //
-          compress_data_size_(AlignTo(compress_vec_offset_ + sizeof(CompressType) * dim(), PADDING_SIZE)),                                        //
-          ptr_(static_cast<char *>(operator new[](compress_data_offset_ + compress_data_size_ * max_vec_num(), std::align_val_t(PADDING_SIZE)))), //
-          buffer_plain_size_(init_args),                                                                                                          //
-          plain_data_(PlainStore<DataType>::Make(0, dim()))                                                                                       //
+    static constexpr SizeT CompressDataOffset(SizeT dim) { return AlignTo(mean_offset_ + dim * sizeof(MeanType), PADDING_SIZE); }
+    static constexpr SizeT CompressDataSize(SizeT dim) {
+        return AlignTo(compress_vec_offset_ + Code::CodeSize(dim) + (HAS_RESIDUAL ? sizeof(i8) * dim : 0), PADDING_SIZE);
+    }
+
+    // allocate the buffer if `ptr` is null
+    LVQStore(DataStoreMeta meta, This::InitArgs init_args, char *ptr = nullptr)
+        : meta_(Move(meta)),                                    //
+          compress_data_offset_(CompressDataOffset(dim())),     //
+          compress_data_size_(CompressDataSize(dim())),         //
+          ptr_(ptr != nullptr ? ptr : Allocate(max_vec_num())), //
+          mapped_(ptr != nullptr),                              //
+          buffer_plain_size_(init_args),                        //
+          plain_data_(PlainStore<DataType>::Make(0, dim()))     //
     {}
 
+    char *Allocate(SizeT max_vec_num) const {
+        return static_cast<char *>(operator new[](compress_data_offset_ + compress_data_size_ * max_vec_num, std::align_val_t(PADDING_SIZE)));
+    }
+
+    // the buffered plain vectors are kept
+    void Reallocate(SizeT max_vec_num) {
+        SizeT used_size = compress_data_offset_ + compress_data_size_ * meta_.cur_vec_num();
+        SizeT new_size = compress_data_offset_ + compress_data_size_ * max_vec_num;
+        char *ptr = Allocate(max_vec_num);
+        Copy(ptr_, ptr_ + used_size, ptr);
+        Fill(ptr + used_size, ptr + new_size, 0);
+        if (!mapped_) {
+            operator delete[](ptr_, std::align_val_t(PADDING_SIZE));
+        }
+        const_cast<char *&>(ptr_) = ptr;
+        mapped_ = false;
+        meta_.Grow(max_vec_num);
+    }
+
     void Init() {
         // MeanType *mean = GetMeanMut();
         // Fill(mean, mean + dim(), 0);
@@ -141,18 +231,19 @@ public:
     LVQStore &operator=(This &&other) = delete;
 
     LVQStore(This &&other)
-        : meta_(Move(other.meta_)),                         //
-          compress_data_offset_(other.compress_data_size_), //
-          compress_data_size_(other.compress_data_offset_), //
-          ptr_(other.ptr_),                                 //
-          buffer_plain_size_(other.buffer_plain_size_),     //
-          plain_data_(Move(other.plain_data_))              //
+        : meta_(Move(other.meta_)),                           //
+          compress_data_offset_(other.compress_data_offset_), //
+          compress_data_size_(other.compress_data_size_),     //
+          ptr_(other.ptr_),                                   //
+          mapped_(other.mapped_),                             //
+          buffer_plain_size_(other.buffer_plain_size_),       //
+          plain_data_(Move(other.plain_data_))                //
     {
         const_cast<char *&>(other.ptr_) = nullptr;
     }
 
     ~LVQStore() {
-        if (ptr_ != nullptr) {
+        if (ptr_ != nullptr && !mapped_) {
             operator delete[](ptr_, std::align_val_t(PADDING_SIZE));
         }
     }
@@ -160,32 +251,90 @@ public:
     void Save(FileHandler &file_handler) {
         Compress();
         meta_.Save(file_handler);
-        file_handler.Write(ptr_, compress_data_offset_ + compress_data_size_ * cur_vec_num());
+        SizeT data_size = compress_data_offset_ + compress_data_size_ * cur_vec_num();
+        file_handler.Write(ptr_, data_size);
+        WritePadding(file_handler, data_size);
     }
 
     static This Load(FileHandler &file_handler, SizeT max_vec_num, This::InitArgs init_args) {
         DataStoreMeta meta = DataStoreMeta::Load(file_handler, max_vec_num);
         auto ret = This(Move(meta), Move(init_args));
-        file_handler.Read(ret.ptr_, ret.compress_data_offset_ + ret.compress_data_size_ * ret.cur_vec_num());
+        SizeT data_size = ret.compress_data_offset_ + ret.compress_data_size_ * ret.cur_vec_num();
+        file_handler.Read(ret.ptr_, data_size);
+        ReadPadding(file_handler, data_size);
         return ret;
     }
 
-private:
-    // the caller is responsible for allocate the `result`
+    // the compressed vectors are not copied, they are read from the mapping until the store grows or is unmapped
+    static This Load(MmapReader &reader, This::InitArgs init_args) {
+        DataStoreMeta meta = DataStoreMeta::Load(reader);
+        SizeT dim = meta.dim_;
+        char *ptr = reader.ReadSection(CompressDataOffset(dim) + CompressDataSize(dim) * meta.cur_vec_num());
+        return This(Move(meta), Move(init_args), ptr);
+    }
+
+    // enlarge the capacity to `max_vec_num` vectors. the buffered plain vectors are kept.
+    void Grow(SizeT max_vec_num) {
+        if (max_vec_num <= this->max_vec_num()) {
+            return;
+        }
+        Reallocate(max_vec_num);
+    }
+
+    // copy the compressed vectors out of the mapped file
+    void Unmap() {
+        if (mapped_) {
+            Reallocate(max_vec_num());
+        }
+    }
+
+    // the i-th vector becomes the `order[i]`-th vector before. the buffered plain vectors are compressed first, so that every
+    // vector has a slot of the same size. the store should not be mapped.
+    void Permute(const VertexType *order) {
+        if (plain_data_.cur_vec_num() > 0) {
+            Compress();
+        }
+        PermuteRows(ptr_ + compress_data_offset_, compress_data_size_, order, cur_vec_num());
+    }
+
+public:
+    // decompress the `vec_i`th vector with its residual if there is. the caller is responsible for allocate the `result`
     void Decompress(SizeT vec_i, DataType *result) const {
+        if (vec_i >= meta_.cur_vec_num()) {
+            const DataType *vec = plain_data_.GetVec(vec_i - meta_.cur_vec_num());
+            Copy(vec, vec + dim(), result);
+            return;
+        }
         const MeanType *mean = GetMean();
         LVQData lvq = GetVec(vec_i);
-        const CompressType *compress_vec = lvq.GetCompressVec();
+        const CodeType *compress_vec = lvq.GetCompressVec();
         auto [scale, bias] = lvq.GetScalar();
         for (SizeT j = 0; j < dim(); ++j) {
-            result[j] = scale * compress_vec[j] + bias + mean[j];
+            result[j] = scale * Code::Get(compress_vec, j) + bias + mean[j];
+        }
+        if constexpr (HAS_RESIDUAL) {
+            auto [residual_scale, residual_bias] = lvq.GetResidualScalar();
+            const i8 *residual_vec = lvq.GetResidualVec(dim());
+            for (SizeT j = 0; j < dim(); ++j) {
+                result[j] += residual_scale * residual_vec[j] + residual_bias;
+            }
         }
     }
 
+private:
     void CompressVec(const DataType *vec, const LVQData &lvq) const {
         const MeanType *mean = GetMean();
         auto [scale_p, bias_p] = lvq.GetScalarMut();
-        CompressType *compress = lvq.GetCompressVecMut();
+        CodeType *compress = lvq.GetCompressVecMut();
+        // the codes are written to `compress` directly if they are not packed
+        Vector<ValueType> value_buffer;
+        ValueType *values = nullptr;
+        if constexpr (std::is_same_v<CodeType, ValueType>) {
+            values = compress;
+        } else {
+            value_buffer.resize(dim());
+            values = value_buffer.data();
+        }
 
         ScalarType lower = LimitMax<ScalarType>();
         ScalarType upper = -LimitMax<ScalarType>();
@@ -195,22 +344,59 @@ private:
             upper = Max(upper, x);
         }
         ScalarType scale = (upper - lower) / max_bucket_idx_;
-        ScalarType bias = lower - LimitMin<CompressType>() * scale;
+        ScalarType bias = lower - Code::MIN_CODE * scale;
         if (scale == 0) {
-            Fill(compress, compress + dim(), 0);
+            Fill(values, values + dim(), 0);
         } else {
             ScalarType scale_inv = 1 / scale;
             for (SizeT j = 0; j < dim(); ++j) {
                 auto c = std::floor((vec[j] - mean[j] - bias) * scale_inv + 0.5);
-                if(!(c <= LimitMax<CompressType>() && c >= LimitMin<CompressType>())) {
+                if(!(c <= Code::MAX_CODE && c >= Code::MIN_CODE)) {
                     Error<StorageException>("CompressVec error");
                 }
-                compress[j] = c;
+                values[j] = c;
+            }
+        }
+        if constexpr (!std::is_same_v<CodeType, ValueType>) {
+            // the unused nibble of an odd dimension stays 0 for the inner product
+            Fill(compress, compress + Code::CodeSize(dim()), 0);
+            for (SizeT j = 0; j < dim(); ++j) {
+                Code::Set(compress, j, values[j]);
             }
         }
         *bias_p = bias;
         *scale_p = scale;
-        *lvq.GetLocalCacheMut() = LVQCache::MakeLocalCache(compress, scale, dim(), mean);
+        *lvq.GetLocalCacheMut() = LVQCache::MakeLocalCache(values, scale, dim(), mean);
+        if constexpr (HAS_RESIDUAL) {
+            CompressResidual(vec, values, scale, bias, lvq);
+        }
+    }
+
+    // compress the residual of `vec` to its decompressed codes `values` with 8-bit codes of its own scale and bias
+    void CompressResidual(const DataType *vec, const ValueType *values, ScalarType scale, ScalarType bias, const LVQData &lvq) const {
+        const MeanType *mean = GetMean();
+        auto Residual = [&](SizeT j) { return static_cast<ScalarType>(vec[j] - mean[j] - (scale * values[j] + bias)); };
+        ScalarType lower = LimitMax<ScalarType>();
+        ScalarType upper = -LimitMax<ScalarType>();
+        for (SizeT j = 0; j < dim(); ++j) {
+            lower = Min(lower, Residual(j));
+            upper = Max(upper, Residual(j));
+        }
+        ScalarType residual_scale = (upper - lower) / (LimitMax<i8>() - LimitMin<i8>());
+        ScalarType residual_bias = lower - LimitMin<i8>() * residual_scale;
+        i8 *residual_vec = lvq.GetResidualVecMut(dim());
+        if (residual_scale == 0) {
+            Fill(residual_vec, residual_vec + dim(), 0);
+        } else {
+            ScalarType scale_inv = 1 / residual_scale;
+            for (SizeT j = 0; j < dim(); ++j) {
+                auto c = std::floor((Residual(j) - residual_bias) * scale_inv + 0.5);
+                residual_vec[j] = Min<double>(Max<double>(c, LimitMin<i8>()), LimitMax<i8>());
+            }
+        }
+        auto [residual_scale_p, residual_bias_p] = lvq.GetResidualScalarMut();
+        *residual_scale_p = residual_scale;
+        *residual_bias_p = residual_bias;
     }
 
     // TODO SIMD optimization here
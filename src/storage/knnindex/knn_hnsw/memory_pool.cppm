@@ -14,8 +14,13 @@
 
 module;
 
-#include <concepts>
 #include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstring>
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
 
 import stl;
 import specific_concurrent_queue;
@@ -92,38 +97,182 @@ private:
 
 // -------------- implement concept below ----------------
 
-struct PooledVectorBoolFunctor {
-    using DataT = Vector<bool>;
-
-    const SizeT used_size_;
+// visited flags of one graph search. a vertex is visited iff its tag equals the current epoch,
+// so a new search only increases the epoch instead of zero filling the whole table.
+export class VisitedTable {
+public:
+    using EpochType = u16;
 
-    PooledVectorBoolFunctor([[maybe_unused]] SizeT alloc_size, SizeT used_size) : used_size_(used_size) {}
+    VisitedTable() = default;
 
-    DataT Alloc(SizeT alloc_size, [[maybe_unused]] SizeT used_size) { return Vector<bool>(alloc_size, false); }
+    explicit VisitedTable(SizeT size) : tags_(size, 0) {}
 
-    void Release(DataT &data) {
-        std::fill(data.begin(), data.begin() + used_size_, false); // TODO:: memset
+    // start a new search on `size` vertices
+    void Reset(SizeT size) {
+        if (tags_.size() < size) {
+            tags_.resize(size, 0);
+        }
+        if (++epoch_ == 0) [[unlikely]] {
+            std::fill(tags_.begin(), tags_.end(), 0);
+            epoch_ = 1;
+        }
     }
+
+    bool IsVisited(SizeT idx) const { return tags_[idx] == epoch_; }
+
+    void SetVisited(SizeT idx) { tags_[idx] = epoch_; }
+
+private:
+    Vector<EpochType> tags_{};
+    EpochType epoch_{0};
 };
 
-template <typename T, typename C>
-struct PooledMaxHeapFunctor {
-    using DataT = Heap<T, C>;
+struct PooledVisitedTableFunctor {
+    using DataT = VisitedTable;
 
-    PooledMaxHeapFunctor() = default;
+    PooledVisitedTableFunctor([[maybe_unused]] SizeT alloc_size) {}
 
-    DataT Alloc() { return Heap<T, C>(); }
+    DataT Alloc(SizeT alloc_size) { return VisitedTable(alloc_size); }
 
-    void Release(DataT &data) {
-        while (!data.empty()) {
-            data.pop();
+    void Release([[maybe_unused]] DataT &data) {} // cleared lazily by `VisitedTable::Reset`
+};
+
+// the nearest `capacity` candidates of a graph search in ascending order of distance, in arrays allocated once and reused.
+// it is both the result set and the candidate set: a cursor points to the nearest candidate that is not expanded yet, so
+// the next candidate is taken and the result is read out in order without any heap operation.
+export template <typename DistType, typename IdType>
+class LinearPool {
+public:
+    // the distances are padded to a multiple of this, so the position search loads whole vectors
+    static constexpr SizeT LANE_N = 8;
+
+    LinearPool() = default;
+
+    // clear the pool to hold at most `capacity` candidates
+    void Reset(SizeT capacity) {
+        if (dists_.size() < capacity) {
+            SizeT padded = (capacity + LANE_N - 1) / LANE_N * LANE_N;
+            dists_.resize(padded);
+            ids_.resize(padded);
+            expanded_.resize(padded);
         }
+        capacity_ = capacity;
+        size_ = 0;
+        cursor_ = 0;
     }
+
+    SizeT size() const { return size_; }
+
+    bool empty() const { return size_ == 0; }
+
+    bool full() const { return size_ == capacity_; }
+
+    DistType Dist(SizeT i) const { return dists_[i]; }
+
+    IdType Id(SizeT i) const { return ids_[i]; }
+
+    DistType WorstDist() const { return dists_[size_ - 1]; }
+
+    // insert after the candidates of no larger distance. the farthest candidate is dropped when the pool is full.
+    // return false if the candidate is not nearer than the farthest one of a full pool.
+    bool Insert(DistType dist, IdType id) {
+        if (size_ == capacity_ && (capacity_ == 0 || !(dist < dists_[size_ - 1]))) {
+            return false;
+        }
+        SizeT pos = InsertPos(dist);
+        SizeT move_n = (size_ < capacity_ ? size_ : size_ - 1) - pos;
+        std::memmove(dists_.data() + pos + 1, dists_.data() + pos, move_n * sizeof(DistType));
+        std::memmove(ids_.data() + pos + 1, ids_.data() + pos, move_n * sizeof(IdType));
+        std::memmove(expanded_.data() + pos + 1, expanded_.data() + pos, move_n * sizeof(u8));
+        dists_[pos] = dist;
+        ids_[pos] = id;
+        expanded_[pos] = false;
+        size_ += size_ < capacity_;
+        cursor_ = Min(cursor_, pos);
+        return true;
+    }
+
+    bool HasUnexpanded() const { return cursor_ < size_; }
+
+    // mark the nearest candidate not expanded yet as expanded and return it
+    Pair<DistType, IdType> ExpandNext() {
+        SizeT pos = cursor_;
+        expanded_[pos] = true;
+        while (cursor_ < size_ && expanded_[cursor_]) {
+            ++cursor_;
+        }
+        return {dists_[pos], ids_[pos]};
+    }
+
+    // keep the nearest `size` candidates
+    void Truncate(SizeT size) {
+        size_ = Min(size_, size);
+        cursor_ = Min(cursor_, size_);
+    }
+
+    // replace the distance of the i-th candidate, `Sort` restores the order after all are replaced
+    void SetDist(SizeT i, DistType dist) { dists_[i] = dist; }
+
+    // the refined distances keep the candidates nearly sorted, so a stable insertion sort in place moves few of them
+    void Sort() {
+        for (SizeT i = 1; i < size_; ++i) {
+            DistType dist = dists_[i];
+            IdType id = ids_[i];
+            SizeT j = i;
+            for (; j > 0 && dist < dists_[j - 1]; --j) {
+                dists_[j] = dists_[j - 1];
+                ids_[j] = ids_[j - 1];
+            }
+            dists_[j] = dist;
+            ids_[j] = id;
+        }
+    }
+
+private:
+    // the number of the candidates of no larger distance
+    SizeT InsertPos(DistType dist) const {
+#if defined(__SSE2__)
+        if constexpr (std::same_as<DistType, f32>) {
+            // the distances are sorted, so the lanes of no larger distance are the low bits of the mask. the lanes
+            // beyond `size_` may be any value, the position is clamped to `size_`. a block is compared by two sse compares.
+            const __m128 key = _mm_set1_ps(dist);
+            for (SizeT i = 0; i < size_; i += LANE_N) {
+                __m128 low = _mm_cmple_ps(_mm_loadu_ps(dists_.data() + i), key);
+                __m128 high = _mm_cmple_ps(_mm_loadu_ps(dists_.data() + i + 4), key);
+                auto mask = static_cast<u32>(_mm_movemask_ps(low) | (_mm_movemask_ps(high) << 4));
+                if (mask != 0xFF) {
+                    return Min(size_, i + std::countr_one(mask));
+                }
+            }
+            return size_;
+        }
+#endif
+        return std::upper_bound(dists_.begin(), dists_.begin() + size_, dist) - dists_.begin();
+    }
+
+    Vector<DistType> dists_{};
+    Vector<IdType> ids_{};
+    Vector<u8> expanded_{};
+    SizeT capacity_{0};
+    SizeT size_{0};
+    // every candidate before it is expanded
+    SizeT cursor_{0};
+};
+
+template <typename DistType, typename IdType>
+struct PooledLinearPoolFunctor {
+    using DataT = LinearPool<DistType, IdType>;
+
+    PooledLinearPoolFunctor() = default;
+
+    DataT Alloc() { return DataT(); }
+
+    void Release([[maybe_unused]] DataT &data) {} // cleared by `LinearPool::Reset`
 };
 
-export using VisitedMemPool = MemPool<PooledVectorBoolFunctor, SizeT, SizeT>;
+export using VisitedMemPool = MemPool<PooledVisitedTableFunctor, SizeT>;
 
-export template <typename T, typename C>
-using MaxHeapMemPool = MemPool<PooledMaxHeapFunctor<T, C>>;
+export template <typename DistType, typename IdType>
+using LinearPoolMemPool = MemPool<PooledLinearPoolFunctor<DistType, IdType>>;
 
 } // namespace infinity
\ No newline at end of file
@@ -35,7 +35,18 @@ public:
 
 private:
     DataStoreMeta meta_;
-    const UniquePtr<DataType[]> ptr_;
+    UniquePtr<DataType[]> buffer_; // null if the vectors are in a mapped file
+    DataType *ptr_;
+
+    PlainStore(DataStoreMeta meta, DataType *ptr) : meta_(Move(meta)), ptr_(ptr) {}
+
+    void Reallocate(SizeT max_vec_num) {
+        auto buffer = MakeUnique<DataType[]>(max_vec_num * dim());
+        Copy(ptr_, ptr_ + cur_vec_num() * dim(), buffer.get());
+        buffer_ = Move(buffer);
+        ptr_ = buffer_.get();
+        meta_.Grow(max_vec_num);
+    }
 
 public:
     static This Make(SizeT max_vec_num, SizeT dim, This::InitArgs = {}) {
@@ -43,12 +54,14 @@ public:
         return This(Move(data_store));
     }
 
-    PlainStore(DataStoreMeta meta) : meta_(Move(meta)), ptr_(MakeUnique<DataType[]>(meta_.max_vec_num_ * meta_.dim_)) {}
+    PlainStore(DataStoreMeta meta) : meta_(Move(meta)), buffer_(MakeUnique<DataType[]>(meta_.max_vec_num_ * meta_.dim_)), ptr_(buffer_.get()) {}
 
-    PlainStore(This &&other) : meta_(Move(other.meta_)), ptr_(Move(const_cast<UniquePtr<DataType[]> &>(other.ptr_))) {}
+    PlainStore(This &&other) : meta_(Move(other.meta_)), buffer_(Move(other.buffer_)), ptr_(other.ptr_) { other.ptr_ = nullptr; }
     PlainStore &operator=(This &&other) {
         meta_ = Move(other.meta_);
-        const_cast<UniquePtr<DataType[]> &>(ptr_) = Move(const_cast<UniquePtr<DataType[]> &>(other.ptr_));
+        buffer_ = Move(other.buffer_);
+        ptr_ = other.ptr_;
+        other.ptr_ = nullptr;
         return *this;
     }
 
@@ -56,22 +69,51 @@ public:
 
     void Save(FileHandler &file_handler) const {
         meta_.Save(file_handler);
-        file_handler.Write(ptr_.get(), sizeof(DataType) * cur_vec_num() * dim());
+        SizeT data_size = sizeof(DataType) * cur_vec_num() * dim();
+        file_handler.Write(ptr_, data_size);
+        WritePadding(file_handler, data_size);
     }
 
     static This Load(FileHandler &file_handler, SizeT max_vec_num, This::InitArgs = {}) {
         DataStoreMeta meta = DataStoreMeta::Load(file_handler, max_vec_num);
         This ret(Move(meta));
-        file_handler.Read(ret.ptr_.get(), sizeof(DataType) * ret.cur_vec_num() * ret.dim());
+        SizeT data_size = sizeof(DataType) * ret.cur_vec_num() * ret.dim();
+        file_handler.Read(ret.ptr_, data_size);
+        ReadPadding(file_handler, data_size);
         return ret;
     }
 
+    // the vectors are not copied, they are read from the mapping until the store grows or is unmapped
+    static This Load(MmapReader &reader, This::InitArgs = {}) {
+        DataStoreMeta meta = DataStoreMeta::Load(reader);
+        auto *ptr = reinterpret_cast<DataType *>(reader.ReadSection(sizeof(DataType) * meta.cur_vec_num() * meta.dim_));
+        return This(Move(meta), ptr);
+    }
+
 public:
     static constexpr SizeT ERR_IDX = DataStoreMeta::ERR_IDX;
     SizeT cur_vec_num() const { return meta_.cur_vec_num(); }
     SizeT max_vec_num() const { return meta_.max_vec_num_; }
     SizeT dim() const { return meta_.dim_; }
 
+    // enlarge the capacity to `max_vec_num` vectors
+    void Grow(SizeT max_vec_num) {
+        if (max_vec_num <= this->max_vec_num()) {
+            return;
+        }
+        Reallocate(max_vec_num);
+    }
+
+    // copy the vectors out of the mapped file
+    void Unmap() {
+        if (buffer_.get() == nullptr) {
+            Reallocate(max_vec_num());
+        }
+    }
+
+    // the i-th vector becomes the `order[i]`-th vector before. the store should not be mapped.
+    void Permute(const VertexType *order) { PermuteRows(ptr_, dim(), order, cur_vec_num()); }
+
 public:
     SizeT AddVec(const DataType *vec, SizeT vec_num) { return AddVec(DenseVectorIterator(vec, dim()), vec_num); }
 
@@ -80,7 +122,7 @@ public:
     SizeT AddVec(Iterator query_iter, SizeT vec_num) {
         SizeT new_idx = meta_.AllocateVec(vec_num);
         if (new_idx != ERR_IDX) {
-            DataType *ptr = ptr_.get() + new_idx * dim();
+            DataType *ptr = ptr_ + new_idx * dim();
             while (vec_num--) {
                 // not check optional here. because vec_num already contains the number of elements in the iterator.
                 auto vec = *(query_iter.Next());
@@ -93,7 +135,7 @@ public:
 
     StoreType GetVec(SizeT vec_i) const {
         assert(vec_i < cur_vec_num());
-        return ptr_.get() + vec_i * dim();
+        return ptr_ + vec_i * dim();
     }
 
     QueryType MakeQuery(const DataType *vec) const { return vec; }
@@ -0,0 +1,234 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <type_traits>
+#include <xmmintrin.h>
+
+import stl;
+import hnsw_common;
+import file_system;
+import product_quantizer;
+import infinity_exception;
+
+export module pq_store;
+
+namespace infinity {
+
+// builds the table of the distances of a query to the centroids, in which the distance to a coded vector is looked up
+export template <typename PQTable, typename DataType>
+concept PQTableConcept = requires(PQTable) {
+    { PQTable::MakeTable(std::declval<const ProductQuantizer &>(), std::declval<const DataType *>(), std::declval<DataType *>()) };
+};
+
+// the vectors are coded by a product quantizer in `subspace_num` bytes each.
+export template <typename DataType, typename PQTable>
+    requires PQTableConcept<PQTable, DataType>
+class PQStore {
+    static_assert(std::is_same<DataType, f32>());
+
+public:
+    using This = PQStore<DataType, PQTable>;
+    using InitArgs = SizeT; // subspace number, 0 for `ProductQuantizer::DefaultSubspaceNum`
+    struct PQQuery;
+    struct PQData;
+    using StoreType = PQData;
+    using QueryType = PQQuery;
+
+    static constexpr SizeT ERR_IDX = DataStoreMeta::ERR_IDX;
+
+    struct PQQuery {
+        UniquePtr<DataType[]> table_;
+    };
+
+    // a stored vector has its codes, a query has its distance table
+    struct PQData {
+        const u8 *codes_{};
+        const DataType *table_{};
+
+        PQData(const u8 *codes) : codes_(codes) {}
+        PQData(const PQQuery &query) : table_(query.table_.get()) {}
+    };
+
+    // the codebooks are trained on the first `TRAIN_NUM` vectors. they are trained again whenever these vectors double, and the
+    // vectors are coded again. the vectors are kept in f32 until then, so the codebooks are fixed on a sample much larger than
+    // the centroids.
+    static constexpr SizeT TRAIN_NUM = 64 * ProductQuantizer::CENTROID_NUM;
+
+private:
+    DataStoreMeta meta_;
+    ProductQuantizer pq_;
+    SizeT trained_num_{0};
+    Vector<DataType> train_vecs_; // empty if the codebooks are fixed or the store is loaded
+    UniquePtr<u8[]> buffer_; // null if the codes are in a mapped file
+    u8 *codes_;
+
+    static u32 SubspaceNum(SizeT dim, InitArgs init_args) { return init_args != 0 ? init_args : ProductQuantizer::DefaultSubspaceNum(dim); }
+
+    PQStore(DataStoreMeta meta, u32 subspace_num, u8 *codes = nullptr)
+        : meta_(Move(meta)), pq_(dim(), subspace_num),
+          buffer_(codes != nullptr ? nullptr : MakeUnique<u8[]>(max_vec_num() * subspace_num)),
+          codes_(codes != nullptr ? codes : buffer_.get()) {}
+
+    void Reallocate(SizeT max_vec_num) {
+        auto buffer = MakeUnique<u8[]>(max_vec_num * code_size());
+        Copy(codes_, codes_ + cur_vec_num() * code_size(), buffer.get());
+        buffer_ = Move(buffer);
+        codes_ = buffer_.get();
+        meta_.Grow(max_vec_num);
+    }
+
+public:
+    static This Make(SizeT max_vec_num, SizeT dim, This::InitArgs init_args) {
+        DataStoreMeta meta(max_vec_num, dim);
+        return This(Move(meta), SubspaceNum(dim, init_args));
+    }
+
+    PQStore(This &&other)
+        : meta_(Move(other.meta_)), pq_(Move(other.pq_)), trained_num_(other.trained_num_), train_vecs_(Move(other.train_vecs_)),
+          buffer_(Move(other.buffer_)), codes_(other.codes_) {
+        other.codes_ = nullptr;
+    }
+
+    void Save(FileHandler &file_handler) const {
+        meta_.Save(file_handler);
+        SizeT header[2] = {pq_.subspace_num(), trained_num_};
+        file_handler.Write(header, sizeof(header));
+        WritePadding(file_handler, sizeof(header));
+        SizeT codebooks_size = sizeof(f32) * pq_.codebooks_size();
+        file_handler.Write(pq_.codebooks(), codebooks_size);
+        WritePadding(file_handler, codebooks_size);
+        SizeT codes_size = cur_vec_num() * code_size();
+        file_handler.Write(codes_, codes_size);
+        WritePadding(file_handler, codes_size);
+    }
+
+    static This Load(FileHandler &file_handler, SizeT max_vec_num, This::InitArgs) {
+        DataStoreMeta meta = DataStoreMeta::Load(file_handler, max_vec_num);
+        SizeT header[2];
+        file_handler.Read(header, sizeof(header));
+        ReadPadding(file_handler, sizeof(header));
+        This ret(Move(meta), header[0]);
+        ret.trained_num_ = header[1];
+        SizeT codebooks_size = sizeof(f32) * ret.pq_.codebooks_size();
+        file_handler.Read(ret.pq_.codebooks(), codebooks_size);
+        ReadPadding(file_handler, codebooks_size);
+        SizeT codes_size = ret.cur_vec_num() * ret.code_size();
+        file_handler.Read(ret.codes_, codes_size);
+        ReadPadding(file_handler, codes_size);
+        return ret;
+    }
+
+    // the codebooks are copied, the codes are read from the mapping until the store grows or is unmapped
+    static This Load(MmapReader &reader, This::InitArgs) {
+        DataStoreMeta meta = DataStoreMeta::Load(reader);
+        const auto *header = reinterpret_cast<const SizeT *>(reader.ReadSection(sizeof(SizeT) * 2));
+        SizeT subspace_num = header[0];
+        SizeT codebooks_size = SizeT(ProductQuantizer::CENTROID_NUM) * meta.dim_;
+        const auto *codebooks = reinterpret_cast<const f32 *>(reader.ReadSection(sizeof(f32) * codebooks_size));
+        auto *codes = reinterpret_cast<u8 *>(reader.ReadSection(meta.cur_vec_num() * subspace_num));
+        This ret(Move(meta), subspace_num, codes);
+        ret.trained_num_ = header[1];
+        Copy(codebooks, codebooks + codebooks_size, ret.pq_.codebooks());
+        return ret;
+    }
+
+    SizeT cur_vec_num() const { return meta_.cur_vec_num(); }
+    SizeT max_vec_num() const { return meta_.max_vec_num_; }
+    SizeT dim() const { return meta_.dim_; }
+    SizeT code_size() const { return pq_.subspace_num(); }
+    const ProductQuantizer &pq() const { return pq_; }
+
+    // enlarge the capacity to `max_vec_num` vectors
+    void Grow(SizeT max_vec_num) {
+        if (max_vec_num <= this->max_vec_num()) {
+            return;
+        }
+        Reallocate(max_vec_num);
+    }
+
+    // copy the codes out of the mapped file
+    void Unmap() {
+        if (buffer_.get() == nullptr) {
+            Reallocate(max_vec_num());
+        }
+    }
+
+    // the i-th vector becomes the `order[i]`-th vector before. the codebooks are kept. the store should not be mapped.
+    void Permute(const VertexType *order) {
+        PermuteRows(codes_, code_size(), order, cur_vec_num());
+        if (!train_vecs_.empty()) {
+            PermuteRows(train_vecs_.data(), dim(), order, cur_vec_num());
+        }
+    }
+
+    SizeT AddVec(const DataType *vec, SizeT vec_num) { return AddVec(DenseVectorIter(vec, dim(), vec_num), vec_num); }
+
+    template <typename Iterator>
+        requires DataIteratorConcept<Iterator, const DataType *>
+    SizeT AddVec(Iterator query_iter, SizeT vec_num) {
+        SizeT new_idx = meta_.AllocateVec(vec_num);
+        if (new_idx == ERR_IDX || vec_num == 0) {
+            return new_idx;
+        }
+        SizeT train_end = new_idx;
+        if (trained_num_ < TRAIN_NUM && new_idx < TRAIN_NUM) {
+            train_end = Min(cur_vec_num(), TRAIN_NUM);
+            if (train_vecs_.size() < new_idx * dim()) {
+                // the f32 vectors are not saved, so a loaded store is trained on the decoded vectors
+                train_vecs_.resize(new_idx * dim());
+                for (SizeT i = 0; i < new_idx; ++i) {
+                    pq_.Decode(codes_ + i * code_size(), train_vecs_.data() + i * dim());
+                }
+            }
+            for (SizeT i = new_idx; i < train_end; ++i) {
+                auto vec = *(query_iter.Next());
+                train_vecs_.insert(train_vecs_.end(), vec, vec + dim());
+            }
+            if (train_end >= 2 * trained_num_ || train_end == TRAIN_NUM) {
+                pq_.Train(train_vecs_.data(), train_end);
+                trained_num_ = train_end;
+                pq_.Encode(train_vecs_.data(), train_end, codes_);
+            } else {
+                pq_.Encode(train_vecs_.data() + new_idx * dim(), train_end - new_idx, codes_ + new_idx * code_size());
+            }
+            if (trained_num_ == TRAIN_NUM) {
+                Vector<DataType>().swap(train_vecs_);
+            }
+        }
+        // the vectors after the first `TRAIN_NUM` are coded by the fixed codebooks
+        if (SizeT rest_n = cur_vec_num() - train_end; rest_n > 0) {
+            auto vecs = MakeUniqueForOverwrite<DataType[]>(rest_n * dim());
+            for (SizeT i = 0; i < rest_n; ++i) {
+                auto vec = *(query_iter.Next());
+                Copy(vec, vec + dim(), vecs.get() + i * dim());
+            }
+            pq_.Encode(vecs.get(), rest_n, codes_ + train_end * code_size());
+        }
+        return new_idx;
+    }
+
+    StoreType GetVec(SizeT vec_i) const { return PQData(codes_ + vec_i * code_size()); }
+
+    void Prefetch(SizeT vec_i) const { _mm_prefetch(reinterpret_cast<const char *>(codes_ + vec_i * code_size()), _MM_HINT_T0); }
+
+    QueryType MakeQuery(const DataType *vec) const {
+        auto table = MakeUniqueForOverwrite<DataType[]>(code_size() * ProductQuantizer::CENTROID_NUM);
+        PQTable::MakeTable(pq_, vec, table.get());
+        return QueryType{Move(table)};
+    }
+};
+
+} // namespace infinity
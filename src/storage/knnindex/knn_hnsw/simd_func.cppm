@@ -16,17 +16,20 @@ module;
 
 #include "header.h"
 #include <cassert>
+#include <cmath>
 #include <iostream>
 
 import stl;
+import parser;
 
 export module hnsw_simd_func;
 
 namespace infinity {
 
+#if defined(USE_AVX)
 // for debug
 template <typename T>
-void log_m256(const __m256i &value) {
+AVX2_TARGET void log_m256(const __m256i &value) {
     const size_t n = sizeof(__m256i) / sizeof(T);
     T buffer[n];
     _mm256_storeu_si256((__m256i_u *)buffer, value);
@@ -40,8 +43,46 @@ void log_m256(const __m256i &value) {
     std::cout << "]" << std::endl;
 }
 
+export bool SupportAVX2() {
+    static const bool support = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    return support;
+}
+#else
+export bool SupportAVX2() { return false; }
+#endif
+
 #if defined(USE_AVX512)
-export int32_t I8IPAVX512(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+export bool SupportAVX512() {
+    static const bool support = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512dq") &&
+                                __builtin_cpu_supports("avx512vl");
+    return support;
+}
+
+export bool SupportAVX512VNNI() {
+    static const bool support = SupportAVX512() && __builtin_cpu_supports("avx512vnni");
+    return support;
+}
+
+export bool SupportAVX512VPOPCNTDQ() {
+    static const bool support = SupportAVX512() && __builtin_cpu_supports("avx512vpopcntdq");
+    return support;
+}
+#else
+export bool SupportAVX512() { return false; }
+export bool SupportAVX512VNNI() { return false; }
+export bool SupportAVX512VPOPCNTDQ() { return false; }
+#endif
+
+export int32_t I8IPBF(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+    int32_t res = 0;
+    for (size_t i = 0; i < dim; i++) {
+        res += (int16_t)(pv1[i]) * pv2[i];
+    }
+    return res;
+}
+
+#if defined(USE_AVX512)
+export AVX512_TARGET int32_t I8IPAVX512(const int8_t *pv1, const int8_t *pv2, size_t dim) {
     size_t dim64 = dim >> 6;
     const int8_t *pend1 = pv1 + (dim64 << 6);
 
@@ -63,19 +104,18 @@ export int32_t I8IPAVX512(const int8_t *pv1, const int8_t *pv2, size_t dim) {
         sum = _mm512_add_epi32(sum, _mm512_sub_epi32(low7, msb));
     }
 
-    // Reduce add
-    return _mm512_reduce_add_epi32(sum);
+    return _mm512_reduce_add_epi32(sum) + I8IPBF(pv1, pv2, dim - (dim64 << 6));
 }
 #endif
 
 #if defined(USE_AVX)
-export int32_t I8IPAVX(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+export AVX2_TARGET int32_t I8IPAVX(const int8_t *pv1, const int8_t *pv2, size_t dim) {
     size_t dim32 = dim >> 5;
     const int8_t *pend1 = pv1 + (dim32 << 5);
 
     __m256i v1, v2, msb, low7;
-    __m256i sum = _mm256_set1_ps(0);
-    const __m256 highest_bit = _mm256_set1_epi8(0x80);
+    __m256i sum = _mm256_setzero_si256();
+    const __m256i highest_bit = _mm256_set1_epi8(0x80);
     while (pv1 < pend1) {
         v1 = _mm256_loadu_si256((__m256i_u *)pv1);
         pv1 += 32;
@@ -96,23 +136,225 @@ export int32_t I8IPAVX(const int8_t *pv1, const int8_t *pv2, size_t dim) {
     sum = _mm256_hadd_epi32(sum, sum);
 
     // Extract the result
-    return _mm256_extract_epi32(sum, 0) + _mm256_extract_epi32(sum, 4);
+    return _mm256_extract_epi32(sum, 0) + _mm256_extract_epi32(sum, 4) + I8IPBF(pv1, pv2, dim - (dim32 << 5));
 }
 #endif
 
-export int32_t I8IPBF(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+
+//------------------------------//------------------------------//------------------------------
+// int8 embeddings of any dimension. the values are widened to i16, and the products of pairs are added to i32 lanes,
+// by one vpdpwssd with vnni, or by vpmaddwd and vpaddd without it.
+
+#if defined(USE_AVX512)
+export AVX512_TARGET int32_t I8IPWidenAVX512(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+    __m512i sum = _mm512_setzero_si512();
+    size_t i = 0;
+    for (; i + 32 <= dim; i += 32) {
+        __m512i v1 = _mm512_cvtepi8_epi16(_mm256_loadu_si256((const __m256i *)(pv1 + i)));
+        __m512i v2 = _mm512_cvtepi8_epi16(_mm256_loadu_si256((const __m256i *)(pv2 + i)));
+        sum = _mm512_add_epi32(sum, _mm512_madd_epi16(v1, v2));
+    }
+    return _mm512_reduce_add_epi32(sum) + I8IPBF(pv1 + i, pv2 + i, dim - i);
+}
+
+export AVX512VNNI_TARGET int32_t I8IPWidenVNNIAVX512(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+    __m512i sum = _mm512_setzero_si512();
+    size_t i = 0;
+    for (; i + 32 <= dim; i += 32) {
+        __m512i v1 = _mm512_cvtepi8_epi16(_mm256_loadu_si256((const __m256i *)(pv1 + i)));
+        __m512i v2 = _mm512_cvtepi8_epi16(_mm256_loadu_si256((const __m256i *)(pv2 + i)));
+        sum = _mm512_dpwssd_epi32(sum, v1, v2);
+    }
+    return _mm512_reduce_add_epi32(sum) + I8IPBF(pv1 + i, pv2 + i, dim - i);
+}
+#endif
+
+#if defined(USE_AVX)
+AVX2_TARGET int32_t ReduceAddI32(__m256i sum) {
+    __m128i res = _mm_add_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+    res = _mm_hadd_epi32(res, res);
+    res = _mm_hadd_epi32(res, res);
+    return _mm_cvtsi128_si32(res);
+}
+
+export AVX2_TARGET int32_t I8IPWidenAVX(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+    __m256i sum = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 16 <= dim; i += 16) {
+        __m256i v1 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(pv1 + i)));
+        __m256i v2 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(pv2 + i)));
+        sum = _mm256_add_epi32(sum, _mm256_madd_epi16(v1, v2));
+    }
+    return ReduceAddI32(sum) + I8IPBF(pv1 + i, pv2 + i, dim - i);
+}
+#endif
+
+export int32_t I8IP(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+    static const auto func = [] {
+#if defined(USE_AVX512)
+        if (SupportAVX512VNNI()) {
+            return I8IPWidenVNNIAVX512;
+        }
+        if (SupportAVX512()) {
+            return I8IPWidenAVX512;
+        }
+#endif
+#if defined(USE_AVX)
+        if (SupportAVX2()) {
+            return I8IPWidenAVX;
+        }
+#endif
+        return I8IPBF;
+    }();
+    return func(pv1, pv2, dim);
+}
+
+export int32_t I8L2BF(const int8_t *pv1, const int8_t *pv2, size_t dim) {
     int32_t res = 0;
     for (size_t i = 0; i < dim; i++) {
-        res += (int16_t)(pv1[i]) * pv2[i];
+        int32_t diff = int32_t(pv1[i]) - pv2[i];
+        res += diff * diff;
     }
     return res;
 }
 
+// the differences are in [-255, 255], so they fit in i16 as well
+#if defined(USE_AVX512)
+export AVX512_TARGET int32_t I8L2AVX512(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+    __m512i sum = _mm512_setzero_si512();
+    size_t i = 0;
+    for (; i + 32 <= dim; i += 32) {
+        __m512i v1 = _mm512_cvtepi8_epi16(_mm256_loadu_si256((const __m256i *)(pv1 + i)));
+        __m512i v2 = _mm512_cvtepi8_epi16(_mm256_loadu_si256((const __m256i *)(pv2 + i)));
+        __m512i diff = _mm512_sub_epi16(v1, v2);
+        sum = _mm512_add_epi32(sum, _mm512_madd_epi16(diff, diff));
+    }
+    return _mm512_reduce_add_epi32(sum) + I8L2BF(pv1 + i, pv2 + i, dim - i);
+}
+
+export AVX512VNNI_TARGET int32_t I8L2VNNIAVX512(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+    __m512i sum = _mm512_setzero_si512();
+    size_t i = 0;
+    for (; i + 32 <= dim; i += 32) {
+        __m512i v1 = _mm512_cvtepi8_epi16(_mm256_loadu_si256((const __m256i *)(pv1 + i)));
+        __m512i v2 = _mm512_cvtepi8_epi16(_mm256_loadu_si256((const __m256i *)(pv2 + i)));
+        __m512i diff = _mm512_sub_epi16(v1, v2);
+        sum = _mm512_dpwssd_epi32(sum, diff, diff);
+    }
+    return _mm512_reduce_add_epi32(sum) + I8L2BF(pv1 + i, pv2 + i, dim - i);
+}
+#endif
+
+#if defined(USE_AVX)
+export AVX2_TARGET int32_t I8L2AVX(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+    __m256i sum = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 16 <= dim; i += 16) {
+        __m256i v1 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(pv1 + i)));
+        __m256i v2 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(pv2 + i)));
+        __m256i diff = _mm256_sub_epi16(v1, v2);
+        sum = _mm256_add_epi32(sum, _mm256_madd_epi16(diff, diff));
+    }
+    return ReduceAddI32(sum) + I8L2BF(pv1 + i, pv2 + i, dim - i);
+}
+#endif
+
+export int32_t I8L2(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+    static const auto func = [] {
+#if defined(USE_AVX512)
+        if (SupportAVX512VNNI()) {
+            return I8L2VNNIAVX512;
+        }
+        if (SupportAVX512()) {
+            return I8L2AVX512;
+        }
+#endif
+#if defined(USE_AVX)
+        if (SupportAVX2()) {
+            return I8L2AVX;
+        }
+#endif
+        return I8L2BF;
+    }();
+    return func(pv1, pv2, dim);
+}
+
 //------------------------------//------------------------------//------------------------------
 
+// inner product of two vectors of 4-bit unsigned codes, two codes in a byte. `dim` is the number of codes.
+export int32_t U4IPBF(const uint8_t *pv1, const uint8_t *pv2, size_t dim) {
+    int32_t res = 0;
+    for (size_t i = 0; i < (dim + 1) / 2; i++) {
+        res += (pv1[i] & 0x0F) * (pv2[i] & 0x0F) + (pv1[i] >> 4) * (pv2[i] >> 4);
+    }
+    return res;
+}
+
 #if defined(USE_AVX512)
+export AVX512_TARGET int32_t U4IPAVX512(const uint8_t *pv1, const uint8_t *pv2, size_t dim) {
+    size_t dim128 = dim >> 7;
+    const uint8_t *pend1 = pv1 + (dim128 << 6);
+
+    const __m512i low4 = _mm512_set1_epi8(0x0F);
+    __m512i sum = _mm512_set1_epi32(0);
+    while (pv1 < pend1) {
+        __m512i v1 = _mm512_loadu_si512((__m512i_u *)pv1);
+        pv1 += 64;
+        __m512i v2 = _mm512_loadu_si512((__m512i_u *)pv2);
+        pv2 += 64;
 
-export float F32L2AVX512(const float *pv1, const float *pv2, size_t dim) {
+        // the codes are not greater than 15, so they are safe as both unsigned and signed bytes
+        __m512i low = _mm512_maddubs_epi16(_mm512_and_si512(v1, low4), _mm512_and_si512(v2, low4));
+        __m512i high = _mm512_maddubs_epi16(_mm512_and_si512(_mm512_srli_epi16(v1, 4), low4), _mm512_and_si512(_mm512_srli_epi16(v2, 4), low4));
+        sum = _mm512_add_epi32(sum, _mm512_madd_epi16(_mm512_add_epi16(low, high), _mm512_set1_epi16(1)));
+    }
+
+    return _mm512_reduce_add_epi32(sum) + U4IPBF(pv1, pv2, dim - (dim128 << 7));
+}
+#endif
+
+#if defined(USE_AVX)
+export AVX2_TARGET int32_t U4IPAVX(const uint8_t *pv1, const uint8_t *pv2, size_t dim) {
+    size_t dim64 = dim >> 6;
+    const uint8_t *pend1 = pv1 + (dim64 << 5);
+
+    const __m256i low4 = _mm256_set1_epi8(0x0F);
+    __m256i sum = _mm256_set1_epi32(0);
+    while (pv1 < pend1) {
+        __m256i v1 = _mm256_loadu_si256((__m256i_u *)pv1);
+        pv1 += 32;
+        __m256i v2 = _mm256_loadu_si256((__m256i_u *)pv2);
+        pv2 += 32;
+
+        __m256i low = _mm256_maddubs_epi16(_mm256_and_si256(v1, low4), _mm256_and_si256(v2, low4));
+        __m256i high = _mm256_maddubs_epi16(_mm256_and_si256(_mm256_srli_epi16(v1, 4), low4), _mm256_and_si256(_mm256_srli_epi16(v2, 4), low4));
+        sum = _mm256_add_epi32(sum, _mm256_madd_epi16(_mm256_add_epi16(low, high), _mm256_set1_epi16(1)));
+    }
+
+    // Horizontal add
+    sum = _mm256_hadd_epi32(sum, sum);
+    sum = _mm256_hadd_epi32(sum, sum);
+
+    // Extract the result
+    return _mm256_extract_epi32(sum, 0) + _mm256_extract_epi32(sum, 4) + U4IPBF(pv1, pv2, dim - (dim64 << 6));
+}
+#endif
+
+
+//------------------------------//------------------------------//------------------------------
+
+export float F32L2BF(const float *pv1, const float *pv2, size_t dim) {
+    float res = 0;
+    for (size_t i = 0; i < dim; i++) {
+        float t = pv1[i] - pv2[i];
+        res += t * t;
+    }
+    return res;
+}
+
+#if defined(USE_AVX512)
+
+export AVX512_TARGET float F32L2AVX512(const float *pv1, const float *pv2, size_t dim) {
     float PORTABLE_ALIGN64 TmpRes[16];
     size_t dim16 = dim >> 4;
 
@@ -135,14 +377,14 @@ export float F32L2AVX512(const float *pv1, const float *pv2, size_t dim) {
     float res = TmpRes[0] + TmpRes[1] + TmpRes[2] + TmpRes[3] + TmpRes[4] + TmpRes[5] + TmpRes[6] + TmpRes[7] + TmpRes[8] + TmpRes[9] + TmpRes[10] +
                 TmpRes[11] + TmpRes[12] + TmpRes[13] + TmpRes[14] + TmpRes[15];
 
-    return (res);
+    return res + F32L2BF(pv1, pv2, dim - (dim16 << 4));
 }
 
 #endif
 
 #if defined(USE_AVX)
 
-export float F32L2AVX(const float *pv1, const float *pv2, size_t dim) {
+export AVX2_TARGET float F32L2AVX(const float *pv1, const float *pv2, size_t dim) {
     float PORTABLE_ALIGN32 TmpRes[8];
     size_t dim16 = dim >> 4;
 
@@ -168,24 +410,24 @@ export float F32L2AVX(const float *pv1, const float *pv2, size_t dim) {
     }
 
     _mm256_store_ps(TmpRes, sum);
-    return TmpRes[0] + TmpRes[1] + TmpRes[2] + TmpRes[3] + TmpRes[4] + TmpRes[5] + TmpRes[6] + TmpRes[7];
+    return TmpRes[0] + TmpRes[1] + TmpRes[2] + TmpRes[3] + TmpRes[4] + TmpRes[5] + TmpRes[6] + TmpRes[7] + F32L2BF(pv1, pv2, dim - (dim16 << 4));
 }
 
 #endif
 
-export float F32L2BF(const float *pv1, const float *pv2, size_t dim) {
+
+//------------------------------//------------------------------//------------------------------
+export float F32IPBF(const float *pv1, const float *pv2, size_t dim) {
     float res = 0;
     for (size_t i = 0; i < dim; i++) {
-        float t = pv1[i] - pv2[i];
-        res += t * t;
+        res += pv1[i] * pv2[i];
     }
     return res;
 }
 
-//------------------------------//------------------------------//------------------------------
 #if defined(USE_AVX512)
 
-export float F32IPAVX512(const float *pVect1, const float *pVect2, SizeT qty) {
+export AVX512_TARGET float F32IPAVX512(const float *pVect1, const float *pVect2, SizeT qty) {
     float PORTABLE_ALIGN64 TmpRes[16];
 
     size_t qty16 = qty / 16;
@@ -208,14 +450,14 @@ export float F32IPAVX512(const float *pVect1, const float *pVect2, SizeT qty) {
     float sum = TmpRes[0] + TmpRes[1] + TmpRes[2] + TmpRes[3] + TmpRes[4] + TmpRes[5] + TmpRes[6] + TmpRes[7] + TmpRes[8] + TmpRes[9] + TmpRes[10] +
                 TmpRes[11] + TmpRes[12] + TmpRes[13] + TmpRes[14] + TmpRes[15];
 
-    return sum;
+    return sum + F32IPBF(pVect1, pVect2, qty - 16 * qty16);
 }
 
 #endif
 
 #if defined(USE_AVX)
 
-export float F32IPAVX(const float *pVect1, const float *pVect2, SizeT qty) {
+export AVX2_TARGET float F32IPAVX(const float *pVect1, const float *pVect2, SizeT qty) {
     float PORTABLE_ALIGN32 TmpRes[8];
 
     size_t qty16 = qty / 16;
@@ -243,17 +485,540 @@ export float F32IPAVX(const float *pVect1, const float *pVect2, SizeT qty) {
     _mm256_store_ps(TmpRes, sum256);
     float sum = TmpRes[0] + TmpRes[1] + TmpRes[2] + TmpRes[3] + TmpRes[4] + TmpRes[5] + TmpRes[6] + TmpRes[7];
 
-    return sum;
+    return sum + F32IPBF(pVect1, pVect2, qty - 16 * qty16);
 }
 
 #endif
 
-export float F32IPBF(const float *pv1, const float *pv2, size_t dim) {
+
+//------------------------------//------------------------------//------------------------------
+// half precision vectors are widened to f32 in the registers, so the products are accumulated in f32.
+// the first vector is either a f32 query or a stored half precision vector.
+
+inline float HalfToFloat(float v) { return v; }
+inline float HalfToFloat(float16_t v) { return float(v); }
+inline float HalfToFloat(bfloat16_t v) { return float(v); }
+
+#if defined(USE_AVX512)
+
+AVX512_TARGET inline __m512 Load16(const float *p) { return _mm512_loadu_ps(p); }
+AVX512_TARGET inline __m512 Load16(const float16_t *p) { return _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i *)p)); }
+AVX512_TARGET inline __m512 Load16(const bfloat16_t *p) {
+    return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i *)p)), 16));
+}
+
+export template <typename T1, typename T2>
+AVX512_TARGET float HalfL2AVX512(const T1 *pv1, const T2 *pv2, SizeT dim) {
+    __m512 sum = _mm512_set1_ps(0);
+    SizeT i = 0;
+    for (; i + 16 <= dim; i += 16) {
+        __m512 diff = _mm512_sub_ps(Load16(pv1 + i), Load16(pv2 + i));
+        sum = _mm512_add_ps(sum, _mm512_mul_ps(diff, diff));
+    }
+    float res = _mm512_reduce_add_ps(sum);
+    for (; i < dim; ++i) {
+        float t = HalfToFloat(pv1[i]) - HalfToFloat(pv2[i]);
+        res += t * t;
+    }
+    return res;
+}
+
+export template <typename T1, typename T2>
+AVX512_TARGET float HalfIPAVX512(const T1 *pv1, const T2 *pv2, SizeT dim) {
+    __m512 sum = _mm512_set1_ps(0);
+    SizeT i = 0;
+    for (; i + 16 <= dim; i += 16) {
+        sum = _mm512_add_ps(sum, _mm512_mul_ps(Load16(pv1 + i), Load16(pv2 + i)));
+    }
+    float res = _mm512_reduce_add_ps(sum);
+    for (; i < dim; ++i) {
+        res += HalfToFloat(pv1[i]) * HalfToFloat(pv2[i]);
+    }
+    return res;
+}
+
+#endif
+
+#if defined(USE_AVX)
+
+AVX2_TARGET inline __m256 Load8(const float *p) { return _mm256_loadu_ps(p); }
+AVX2_TARGET inline __m256 Load8(const float16_t *p) { return _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)p)); }
+AVX2_TARGET inline __m256 Load8(const bfloat16_t *p) {
+    return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)p)), 16));
+}
+
+export template <typename T1, typename T2>
+AVX2_TARGET float HalfL2AVX(const T1 *pv1, const T2 *pv2, SizeT dim) {
+    float PORTABLE_ALIGN32 TmpRes[8];
+    __m256 sum = _mm256_set1_ps(0);
+    SizeT i = 0;
+    for (; i + 8 <= dim; i += 8) {
+        __m256 diff = _mm256_sub_ps(Load8(pv1 + i), Load8(pv2 + i));
+        sum = _mm256_add_ps(sum, _mm256_mul_ps(diff, diff));
+    }
+    _mm256_store_ps(TmpRes, sum);
+    float res = TmpRes[0] + TmpRes[1] + TmpRes[2] + TmpRes[3] + TmpRes[4] + TmpRes[5] + TmpRes[6] + TmpRes[7];
+    for (; i < dim; ++i) {
+        float t = HalfToFloat(pv1[i]) - HalfToFloat(pv2[i]);
+        res += t * t;
+    }
+    return res;
+}
+
+export template <typename T1, typename T2>
+AVX2_TARGET float HalfIPAVX(const T1 *pv1, const T2 *pv2, SizeT dim) {
+    float PORTABLE_ALIGN32 TmpRes[8];
+    __m256 sum = _mm256_set1_ps(0);
+    SizeT i = 0;
+    for (; i + 8 <= dim; i += 8) {
+        sum = _mm256_add_ps(sum, _mm256_mul_ps(Load8(pv1 + i), Load8(pv2 + i)));
+    }
+    _mm256_store_ps(TmpRes, sum);
+    float res = TmpRes[0] + TmpRes[1] + TmpRes[2] + TmpRes[3] + TmpRes[4] + TmpRes[5] + TmpRes[6] + TmpRes[7];
+    for (; i < dim; ++i) {
+        res += HalfToFloat(pv1[i]) * HalfToFloat(pv2[i]);
+    }
+    return res;
+}
+
+#endif
+
+export template <typename T1, typename T2>
+float HalfL2BF(const T1 *pv1, const T2 *pv2, SizeT dim) {
     float res = 0;
-    for (size_t i = 0; i < dim; i++) {
-        res += pv1[i] * pv2[i];
+    for (SizeT i = 0; i < dim; i++) {
+        float t = HalfToFloat(pv1[i]) - HalfToFloat(pv2[i]);
+        res += t * t;
     }
     return res;
 }
 
-} // namespace infinity
\ No newline at end of file
+export template <typename T1, typename T2>
+float HalfIPBF(const T1 *pv1, const T2 *pv2, SizeT dim) {
+    float res = 0;
+    for (SizeT i = 0; i < dim; i++) {
+        res += HalfToFloat(pv1[i]) * HalfToFloat(pv2[i]);
+    }
+    return res;
+}
+
+// the best kernel of the cpu the binary runs on
+export template <typename T1, typename T2>
+float HalfL2(const T1 *pv1, const T2 *pv2, SizeT dim) {
+    static const auto func = [] {
+#if defined(USE_AVX512)
+        if (SupportAVX512()) {
+            return HalfL2AVX512<T1, T2>;
+        }
+#endif
+#if defined(USE_AVX)
+        if (SupportAVX2()) {
+            return HalfL2AVX<T1, T2>;
+        }
+#endif
+        return HalfL2BF<T1, T2>;
+    }();
+    return func(pv1, pv2, dim);
+}
+
+export template <typename T1, typename T2>
+float HalfIP(const T1 *pv1, const T2 *pv2, SizeT dim) {
+    static const auto func = [] {
+#if defined(USE_AVX512)
+        if (SupportAVX512()) {
+            return HalfIPAVX512<T1, T2>;
+        }
+#endif
+#if defined(USE_AVX)
+        if (SupportAVX2()) {
+            return HalfIPAVX<T1, T2>;
+        }
+#endif
+        return HalfIPBF<T1, T2>;
+    }();
+    return func(pv1, pv2, dim);
+}
+
+//------------------------------//------------------------------//------------------------------
+// the conversions of f32 vectors to and from half precision. f16 is converted by f16c, which the scalar conversions of
+// float16_t only use when the whole binary is built for it. bf16 is the upper half of f32, which the baseline vectorizes.
+
+export void F32ToHalfBF(const float *src, float16_t *dst, SizeT n) {
+    for (SizeT i = 0; i < n; ++i) {
+        dst[i] = float16_t(src[i]);
+    }
+}
+
+export void HalfToF32BF(const float16_t *src, float *dst, SizeT n) {
+    for (SizeT i = 0; i < n; ++i) {
+        dst[i] = float(src[i]);
+    }
+}
+
+#if defined(USE_AVX)
+export AVX2_TARGET void F32ToHalfAVX(const float *src, float16_t *dst, SizeT n) {
+    SizeT i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm_storeu_si128((__m128i *)(dst + i), _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT));
+    }
+    // the tail is converted by f16c too, so that a vector doesn't mix the rounding of two conversions
+    for (; i < n; ++i) {
+        dst[i].raw = _mm_cvtsi128_si32(_mm_cvtps_ph(_mm_set_ss(src[i]), _MM_FROUND_TO_NEAREST_INT));
+    }
+}
+
+export AVX2_TARGET void HalfToF32AVX(const float16_t *src, float *dst, SizeT n) {
+    SizeT i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)(src + i))));
+    }
+    for (; i < n; ++i) {
+        dst[i] = _mm_cvtss_f32(_mm_cvtph_ps(_mm_cvtsi32_si128(src[i].raw)));
+    }
+}
+#endif
+
+export void F32ToHalf(const float *src, float16_t *dst, SizeT n) {
+    static const auto func = [] {
+#if defined(USE_AVX)
+        if (SupportAVX2()) {
+            return F32ToHalfAVX;
+        }
+#endif
+        return F32ToHalfBF;
+    }();
+    func(src, dst, n);
+}
+
+export void F32ToHalf(const float *src, bfloat16_t *dst, SizeT n) { Copy(src, src + n, dst); }
+
+export void HalfToF32(const float16_t *src, float *dst, SizeT n) {
+    static const auto func = [] {
+#if defined(USE_AVX)
+        if (SupportAVX2()) {
+            return HalfToF32AVX;
+        }
+#endif
+        return HalfToF32BF;
+    }();
+    func(src, dst, n);
+}
+
+export void HalfToF32(const bfloat16_t *src, float *dst, SizeT n) { Copy(src, src + n, dst); }
+
+//------------------------------//------------------------------//------------------------------
+// hamming distance of packed bit vectors, `byte_n` is the number of bytes of a vector
+
+export u32 HammingBF(const u8 *pv1, const u8 *pv2, SizeT byte_n) {
+    u32 res = 0;
+    SizeT i = 0;
+    for (; i + 8 <= byte_n; i += 8) {
+        u64 x1, x2;
+        __builtin_memcpy(&x1, pv1 + i, 8);
+        __builtin_memcpy(&x2, pv2 + i, 8);
+        res += __builtin_popcountll(x1 ^ x2);
+    }
+    for (; i < byte_n; ++i) {
+        res += __builtin_popcount(pv1[i] ^ pv2[i]);
+    }
+    return res;
+}
+
+#if defined(USE_AVX512)
+export AVX512VPOPCNTDQ_TARGET u32 HammingAVX512(const u8 *pv1, const u8 *pv2, SizeT byte_n) {
+    __m512i sum = _mm512_setzero_si512();
+    SizeT i = 0;
+    for (; i + 64 <= byte_n; i += 64) {
+        __m512i x = _mm512_xor_si512(_mm512_loadu_si512(pv1 + i), _mm512_loadu_si512(pv2 + i));
+        sum = _mm512_add_epi64(sum, _mm512_popcnt_epi64(x));
+    }
+    return _mm512_reduce_add_epi64(sum) + HammingBF(pv1 + i, pv2 + i, byte_n - i);
+}
+#endif
+
+#if defined(USE_AVX)
+// the bits of every nibble are counted by a table lookup, and the counts of 8 bytes are summed by vpsadbw
+export AVX2_TARGET u32 HammingAVX(const u8 *pv1, const u8 *pv2, SizeT byte_n) {
+    const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low_mask = _mm256_set1_epi8(0x0f);
+    __m256i sum = _mm256_setzero_si256();
+    SizeT i = 0;
+    for (; i + 32 <= byte_n; i += 32) {
+        __m256i x = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(pv1 + i)), _mm256_loadu_si256((const __m256i *)(pv2 + i)));
+        __m256i lo = _mm256_shuffle_epi8(lookup, _mm256_and_si256(x, low_mask));
+        __m256i hi = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(x, 4), low_mask));
+        sum = _mm256_add_epi64(sum, _mm256_sad_epu8(_mm256_add_epi8(lo, hi), _mm256_setzero_si256()));
+    }
+    u64 PORTABLE_ALIGN32 TmpRes[4];
+    _mm256_store_si256((__m256i *)TmpRes, sum);
+    return TmpRes[0] + TmpRes[1] + TmpRes[2] + TmpRes[3] + HammingBF(pv1 + i, pv2 + i, byte_n - i);
+}
+#endif
+
+export u32 Hamming(const u8 *pv1, const u8 *pv2, SizeT byte_n) {
+    static const auto func = [] {
+#if defined(USE_AVX512)
+        if (SupportAVX512VPOPCNTDQ()) {
+            return HammingAVX512;
+        }
+#endif
+#if defined(USE_AVX)
+        if (SupportAVX2()) {
+            return HammingAVX;
+        }
+#endif
+        return HammingBF;
+    }();
+    return func(pv1, pv2, byte_n);
+}
+
+//------------------------------//------------------------------//------------------------------
+// the distances of a f32 query to the 8-bit codes of ivf-sq8. the code c of a dimension stands for `min + c * scale`,
+// so l2 takes the query minus the minimums and sums (q - c * scale)^2, and inner product takes the query multiplied by
+// the scales and sums q * c. the codes are widened to f32 in the registers.
+
+export float SQ8L2BF(const float *query, const float *scale, const u8 *code, SizeT dim) {
+    float res = 0;
+    for (SizeT i = 0; i < dim; ++i) {
+        float t = query[i] - code[i] * scale[i];
+        res += t * t;
+    }
+    return res;
+}
+
+export float SQ8IPBF(const float *query, const u8 *code, SizeT dim) {
+    float res = 0;
+    for (SizeT i = 0; i < dim; ++i) {
+        res += query[i] * code[i];
+    }
+    return res;
+}
+
+#if defined(USE_AVX512)
+AVX512_TARGET inline __m512 LoadCode16(const u8 *p) { return _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i *)p))); }
+
+export AVX512_TARGET float SQ8L2AVX512(const float *query, const float *scale, const u8 *code, SizeT dim) {
+    __m512 sum = _mm512_setzero_ps();
+    SizeT i = 0;
+    for (; i + 16 <= dim; i += 16) {
+        __m512 diff = _mm512_sub_ps(_mm512_loadu_ps(query + i), _mm512_mul_ps(LoadCode16(code + i), _mm512_loadu_ps(scale + i)));
+        sum = _mm512_fmadd_ps(diff, diff, sum);
+    }
+    return _mm512_reduce_add_ps(sum) + SQ8L2BF(query + i, scale + i, code + i, dim - i);
+}
+
+export AVX512_TARGET float SQ8IPAVX512(const float *query, const u8 *code, SizeT dim) {
+    __m512 sum = _mm512_setzero_ps();
+    SizeT i = 0;
+    for (; i + 16 <= dim; i += 16) {
+        sum = _mm512_fmadd_ps(_mm512_loadu_ps(query + i), LoadCode16(code + i), sum);
+    }
+    return _mm512_reduce_add_ps(sum) + SQ8IPBF(query + i, code + i, dim - i);
+}
+#endif
+
+#if defined(USE_AVX)
+AVX2_TARGET inline __m256 LoadCode8(const u8 *p) { return _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)p))); }
+
+AVX2_TARGET inline float ReduceAddF32(__m256 sum) {
+    __m128 x = _mm_add_ps(_mm256_castps256_ps128(sum), _mm256_extractf128_ps(sum, 1));
+    x = _mm_add_ps(x, _mm_movehl_ps(x, x));
+    x = _mm_add_ss(x, _mm_movehdup_ps(x));
+    return _mm_cvtss_f32(x);
+}
+
+export AVX2_TARGET float SQ8L2AVX(const float *query, const float *scale, const u8 *code, SizeT dim) {
+    __m256 sum = _mm256_setzero_ps();
+    SizeT i = 0;
+    for (; i + 8 <= dim; i += 8) {
+        __m256 diff = _mm256_sub_ps(_mm256_loadu_ps(query + i), _mm256_mul_ps(LoadCode8(code + i), _mm256_loadu_ps(scale + i)));
+        sum = _mm256_add_ps(sum, _mm256_mul_ps(diff, diff));
+    }
+    return ReduceAddF32(sum) + SQ8L2BF(query + i, scale + i, code + i, dim - i);
+}
+
+export AVX2_TARGET float SQ8IPAVX(const float *query, const u8 *code, SizeT dim) {
+    __m256 sum = _mm256_setzero_ps();
+    SizeT i = 0;
+    for (; i + 8 <= dim; i += 8) {
+        sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_loadu_ps(query + i), LoadCode8(code + i)));
+    }
+    return ReduceAddF32(sum) + SQ8IPBF(query + i, code + i, dim - i);
+}
+#endif
+
+export float SQ8L2(const float *query, const float *scale, const u8 *code, SizeT dim) {
+    static const auto func = [] {
+#if defined(USE_AVX512)
+        if (SupportAVX512()) {
+            return SQ8L2AVX512;
+        }
+#endif
+#if defined(USE_AVX)
+        if (SupportAVX2()) {
+            return SQ8L2AVX;
+        }
+#endif
+        return SQ8L2BF;
+    }();
+    return func(query, scale, code, dim);
+}
+
+export float SQ8IP(const float *query, const u8 *code, SizeT dim) {
+    static const auto func = [] {
+#if defined(USE_AVX512)
+        if (SupportAVX512()) {
+            return SQ8IPAVX512;
+        }
+#endif
+#if defined(USE_AVX)
+        if (SupportAVX2()) {
+            return SQ8IPAVX;
+        }
+#endif
+        return SQ8IPBF;
+    }();
+    return func(query, code, dim);
+}
+
+//------------------------------//------------------------------//------------------------------
+// the 8-bit codes of ivf-sq8. the code of a dimension is `(x - min) / scale` rounded half away from zero and clamped to
+// [0, 255], or 0 if the scale is not positive. a code is decoded to `min + c * scale`.
+
+export void SQ8EncodeBF(const float *vec, const float *min, const float *scale, u8 *code, SizeT dim) {
+    for (SizeT i = 0; i < dim; ++i) {
+        if (scale[i] <= 0) {
+            code[i] = 0;
+            continue;
+        }
+        float c = std::round((vec[i] - min[i]) / scale[i]);
+        code[i] = u8(Min(Max(c, 0.0f), 255.0f));
+    }
+}
+
+export void SQ8DecodeBF(const u8 *code, const float *min, const float *scale, float *vec, SizeT dim) {
+    for (SizeT i = 0; i < dim; ++i) {
+        vec[i] = min[i] + code[i] * scale[i];
+    }
+}
+
+#if defined(USE_AVX)
+export AVX2_TARGET void SQ8EncodeAVX(const float *vec, const float *min, const float *scale, u8 *code, SizeT dim) {
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 max_code = _mm256_set1_ps(255.0f);
+    SizeT i = 0;
+    for (; i + 8 <= dim; i += 8) {
+        __m256 s = _mm256_loadu_ps(scale + i);
+        // the nan of a zero scale becomes 0 here, and the code is masked below
+        __m256 x = _mm256_max_ps(_mm256_div_ps(_mm256_sub_ps(_mm256_loadu_ps(vec + i), _mm256_loadu_ps(min + i)), s), zero);
+        // x is not negative, so rounding half away from zero adds 1 to the truncation when the fraction is at least 0.5
+        __m256 t = _mm256_round_ps(x, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        __m256 c = _mm256_add_ps(t, _mm256_and_ps(_mm256_cmp_ps(_mm256_sub_ps(x, t), half, _CMP_GE_OQ), one));
+        c = _mm256_and_ps(_mm256_min_ps(c, max_code), _mm256_cmp_ps(s, zero, _CMP_GT_OQ));
+        __m256i c32 = _mm256_cvttps_epi32(c);
+        __m128i c16 = _mm_packus_epi32(_mm256_castsi256_si128(c32), _mm256_extracti128_si256(c32, 1));
+        _mm_storel_epi64((__m128i *)(code + i), _mm_packus_epi16(c16, c16));
+    }
+    SQ8EncodeBF(vec + i, min + i, scale + i, code + i, dim - i);
+}
+
+export AVX2_TARGET void SQ8DecodeAVX(const u8 *code, const float *min, const float *scale, float *vec, SizeT dim) {
+    SizeT i = 0;
+    for (; i + 8 <= dim; i += 8) {
+        _mm256_storeu_ps(vec + i, _mm256_add_ps(_mm256_loadu_ps(min + i), _mm256_mul_ps(LoadCode8(code + i), _mm256_loadu_ps(scale + i))));
+    }
+    SQ8DecodeBF(code + i, min + i, scale + i, vec + i, dim - i);
+}
+#endif
+
+export void SQ8Encode(const float *vec, const float *min, const float *scale, u8 *code, SizeT dim) {
+    static const auto func = [] {
+#if defined(USE_AVX)
+        if (SupportAVX2()) {
+            return SQ8EncodeAVX;
+        }
+#endif
+        return SQ8EncodeBF;
+    }();
+    func(vec, min, scale, code, dim);
+}
+
+export void SQ8Decode(const u8 *code, const float *min, const float *scale, float *vec, SizeT dim) {
+    static const auto func = [] {
+#if defined(USE_AVX)
+        if (SupportAVX2()) {
+            return SQ8DecodeAVX;
+        }
+#endif
+        return SQ8DecodeBF;
+    }();
+    func(code, min, scale, vec, dim);
+}
+
+//------------------------------//------------------------------//------------------------------
+// the kernels of the plain and lvq distances for the cpu the binary runs on. the simd kernels take any dimension, the
+// tail shorter than their width is computed by the scalar kernel.
+
+export using F32DistFuncType = float (*)(const float *, const float *, SizeT);
+export using I8IPFuncType = int32_t (*)(const int8_t *, const int8_t *, size_t);
+export using U4IPFuncType = int32_t (*)(const uint8_t *, const uint8_t *, size_t);
+
+export F32DistFuncType GetF32L2Func() {
+#if defined(USE_AVX512)
+    if (SupportAVX512()) {
+        return F32L2AVX512;
+    }
+#endif
+#if defined(USE_AVX)
+    if (SupportAVX2()) {
+        return F32L2AVX;
+    }
+#endif
+    return F32L2BF;
+}
+
+export F32DistFuncType GetF32IPFunc() {
+#if defined(USE_AVX512)
+    if (SupportAVX512()) {
+        return F32IPAVX512;
+    }
+#endif
+#if defined(USE_AVX)
+    if (SupportAVX2()) {
+        return F32IPAVX;
+    }
+#endif
+    return F32IPBF;
+}
+
+export I8IPFuncType GetLVQI8IPFunc() {
+#if defined(USE_AVX512)
+    if (SupportAVX512()) {
+        return I8IPAVX512;
+    }
+#endif
+#if defined(USE_AVX)
+    if (SupportAVX2()) {
+        return I8IPAVX;
+    }
+#endif
+    return I8IPBF;
+}
+
+export U4IPFuncType GetU4IPFunc() {
+#if defined(USE_AVX512)
+    if (SupportAVX512()) {
+        return U4IPAVX512;
+    }
+#endif
+#if defined(USE_AVX)
+    if (SupportAVX2()) {
+        return U4IPAVX;
+    }
+#endif
+    return U4IPBF;
+}
+
+} // namespace infinity
@@ -14,6 +14,8 @@
 
 module;
 
+#include <cmath>
+
 import stl;
 import parser;
 import knn_result_handler;
@@ -21,6 +23,8 @@ import knn_result_handler;
 import infinity_exception;
 import bitmask;
 import default_values;
+import vector_distance;
+import mlas_matrix_multiply;
 
 export module merge_knn;
 
@@ -34,25 +38,72 @@ public:
 export template <typename DataType, template <typename, typename> typename C>
 class MergeKnn final : public MergeKnnBase {
     using ResultHandler = ReservoirResultHandler<C<DataType, RowID>>;
-    using DistFunc = DataType (*)(const DataType *, const DataType *, SizeT);
+    using RangeHandler = RangeResultHandler<C<DataType, RowID>>;
+    // the vectors of a column may be of a narrower type than the query, e.g. float16,
+    // or the query and the vectors are packed bits with a distance of `DataType`
+    template <typename QueryType, typename ElemType>
+    using DistFunc = DataType (*)(const QueryType *, const ElemType *, SizeT);
 
 public:
-    explicit MergeKnn(u64 query_count, u64 topk)
-        : total_count_(0), query_count_(query_count), topk_(topk), idx_array_(MakeUniqueForOverwrite<RowID[]>(topk * query_count)),
-          distance_array_(MakeUniqueForOverwrite<DataType[]>(topk * query_count)) {
+    // keep the `topk` best results of every query, or all the results within `radius` if it is given
+    explicit MergeKnn(u64 query_count, u64 topk, Optional<DataType> radius = {}) : total_count_(0), query_count_(query_count), topk_(topk) {
+        if (radius.has_value()) {
+            range_handler_ = MakeUnique<RangeHandler>(query_count, *radius);
+            return;
+        }
+        idx_array_ = MakeUniqueForOverwrite<RowID[]>(topk * query_count);
+        distance_array_ = MakeUniqueForOverwrite<DataType[]>(topk * query_count);
         result_handler_ = MakeUnique<ResultHandler>(query_count, topk, this->distance_array_.get(), this->idx_array_.get());
     }
 
     ~MergeKnn() final = default;
 
 public:
-    void Search(const DataType *query, const DataType *data, u32 dim, DistFunc dist_f, u16 row_cnt, u32 segment_id, u16 block_id);
-
-    void Search(const DataType *query, const DataType *data, u32 dim, DistFunc dist_f, u16 row_cnt, u32 segment_id, u16 block_id, Bitmask &bitmask);
+    template <typename QueryType, typename ElemType>
+    void Search(const QueryType *query,
+                const ElemType *data,
+                u32 dim,
+                DistFunc<QueryType, ElemType> dist_f,
+                u16 row_cnt,
+                u32 segment_id,
+                u16 block_id);
+
+    template <typename QueryType, typename ElemType>
+    void Search(const QueryType *query,
+                const ElemType *data,
+                u32 dim,
+                DistFunc<QueryType, ElemType> dist_f,
+                u16 row_cnt,
+                u32 segment_id,
+                u16 block_id,
+                Bitmask &bitmask);
+
+    // search the rows of the block at `offsets` only, e.g. the few rows passing a filter
+    template <typename QueryType, typename ElemType>
+    void Search(const QueryType *query,
+                const ElemType *data,
+                u32 dim,
+                DistFunc<QueryType, ElemType> dist_f,
+                const u16 *offsets,
+                u16 offset_cnt,
+                u32 segment_id,
+                u16 block_id);
+
+    // search the rows of a f32 column by `distance_type` without a distance function. the distances of several queries are the
+    // blocked products of the queries and the rows, a single query is compared row by row by the simd kernels.
+    // the cosine queries are normalized.
+    void Search(const DataType *query,
+                const DataType *data,
+                u32 dim,
+                KnnDistanceType distance_type,
+                u16 row_cnt,
+                u32 segment_id,
+                u16 block_id,
+                Bitmask &bitmask);
 
     void Search(const DataType *dist, const RowID *row_ids, u16 count);
 
-    void Search(SizeT query_id, const DataType *dist, const RowID *row_ids, u16 count);
+    void Search(SizeT query_id, const DataType *dist, const RowID *row_ids, SizeT count);
 
     void Begin();
 
@@ -70,6 +121,36 @@ public:
 
     i64 total_count() const { return total_count_; }
 
+    bool IsRangeSearch() const { return range_handler_.get() != nullptr; }
+
+    // the number of the results of query `idx` after `End`
+    SizeT ResultCount(u64 idx) const { return IsRangeSearch() ? range_handler_->GetSize(idx) : result_handler_->GetSize(idx); }
+
+private:
+    void AddResult(SizeT query_id, DataType dist, RowID row_id) {
+        if (range_handler_.get() != nullptr) {
+            range_handler_->AddResult(query_id, dist, row_id);
+        } else {
+            result_handler_->AddResult(query_id, dist, row_id);
+        }
+    }
+
+    // add the distances of the queries [i0, i1) to the rows [j0, j1) of a block, which are `dis_tab` in row major
+    void AddResults(SizeT i0, SizeT i1, u16 j0, u16 j1, const DataType *dis_tab, u32 segment_id, u32 segment_offset_start, Bitmask &bitmask) {
+        if (range_handler_.get() == nullptr && bitmask.IsAllTrue()) {
+            result_handler_->AddResults(i0, i1, j0, j1, dis_tab, segment_id, segment_offset_start);
+            return;
+        }
+        for (SizeT i = i0; i < i1; ++i) {
+            const DataType *dis_tab_i = dis_tab + (i - i0) * (j1 - j0) - j0;
+            for (u16 j = j0; j < j1; ++j) {
+                if (bitmask.IsTrue(j)) {
+                    AddResult(i, dis_tab_i[j], RowID(segment_id, segment_offset_start + j));
+                }
+            }
+        }
+    }
+
 private:
     i64 total_count_{};
     bool begin_{false};
@@ -77,30 +158,43 @@ private:
     i64 topk_{};
     UniquePtr<RowID[]> idx_array_{};
     UniquePtr<DataType[]> distance_array_{};
+    // the products of a block of queries and a block of rows, and the norms of the queries and the rows
+    Vector<DataType> ip_block_{};
+    Vector<DataType> x_norms_{};
+    Vector<DataType> y_norms_{};
 
 private:
     UniquePtr<ResultHandler> result_handler_{};
+    UniquePtr<RangeHandler> range_handler_{};
 };
 
 template <typename DataType, template <typename, typename> typename C>
-void MergeKnn<DataType, C>::Search(const DataType *query, const DataType *data, u32 dim, DistFunc dist_f, u16 row_cnt, u32 segment_id, u16 block_id) {
+template <typename QueryType, typename ElemType>
+void MergeKnn<DataType, C>::Search(const QueryType *query,
+                                   const ElemType *data,
+                                   u32 dim,
+                                   DistFunc<QueryType, ElemType> dist_f,
+                                   u16 row_cnt,
+                                   u32 segment_id,
+                                   u16 block_id) {
     this->total_count_ += row_cnt;
     u32 segment_offset_start = block_id * DEFAULT_BLOCK_CAPACITY;
     for (u64 i = 0; i < this->query_count_; ++i) {
-        const DataType *x_i = query + i * dim;
-        const DataType *y_j = data;
+        const QueryType *x_i = query + i * dim;
+        const ElemType *y_j = data;
         for (u16 j = 0; j < row_cnt; ++j, y_j += dim) {
             auto dist = dist_f(x_i, y_j, dim);
-            result_handler_->AddResult(i, dist, RowID(segment_id, segment_offset_start + j));
+            AddResult(i, dist, RowID(segment_id, segment_offset_start + j));
         }
     }
 }
 
 template <typename DataType, template <typename, typename> typename C>
-void MergeKnn<DataType, C>::Search(const DataType *query,
-                                   const DataType *data,
+template <typename QueryType, typename ElemType>
+void MergeKnn<DataType, C>::Search(const QueryType *query,
+                                   const ElemType *data,
                                    u32 dim,
-                                   DistFunc dist_f,
+                                   DistFunc<QueryType, ElemType> dist_f,
                                    u16 row_cnt,
                                    u32 segment_id,
                                    u16 block_id,
@@ -111,16 +205,123 @@ void MergeKnn<DataType, C>::Search(const DataType *query,
     }
     u32 segment_offset_start = block_id * DEFAULT_BLOCK_CAPACITY;
     for (u64 i = 0; i < this->query_count_; ++i) {
-        const DataType *x_i = query + i * dim;
-        const DataType *y_j = data;
+        const QueryType *x_i = query + i * dim;
+        const ElemType *y_j = data;
         for (u16 j = 0; j < row_cnt; ++j, y_j += dim) {
             if (bitmask.IsTrue(j)) {
                 if (i == 0) {
                     ++this->total_count_;
                 }
                 auto dist = dist_f(x_i, y_j, dim);
-                result_handler_->AddResult(i, dist, RowID(segment_id, segment_offset_start + j));
+                AddResult(i, dist, RowID(segment_id, segment_offset_start + j));
+            }
+        }
+    }
+}
+
+template <typename DataType, template <typename, typename> typename C>
+template <typename QueryType, typename ElemType>
+void MergeKnn<DataType, C>::Search(const QueryType *query,
+                                   const ElemType *data,
+                                   u32 dim,
+                                   DistFunc<QueryType, ElemType> dist_f,
+                                   const u16 *offsets,
+                                   u16 offset_cnt,
+                                   u32 segment_id,
+                                   u16 block_id) {
+    this->total_count_ += offset_cnt;
+    u32 segment_offset_start = block_id * DEFAULT_BLOCK_CAPACITY;
+    for (u64 i = 0; i < this->query_count_; ++i) {
+        const QueryType *x_i = query + i * dim;
+        for (u16 j = 0; j < offset_cnt; ++j) {
+            auto dist = dist_f(x_i, data + SizeT(offsets[j]) * dim, dim);
+            AddResult(i, dist, RowID(segment_id, segment_offset_start + offsets[j]));
+        }
+    }
+}
+
+template <typename DataType, template <typename, typename> typename C>
+void MergeKnn<DataType, C>::Search(const DataType *query,
+                                   const DataType *data,
+                                   u32 dim,
+                                   KnnDistanceType distance_type,
+                                   u16 row_cnt,
+                                   u32 segment_id,
+                                   u16 block_id,
+                                   Bitmask &bitmask) {
+    if (distance_type != KnnDistanceType::kL2 && distance_type != KnnDistanceType::kInnerProduct && distance_type != KnnDistanceType::kCosine) {
+        Error<ExecutorException>("Not implemented");
+    }
+    if (bitmask.IsAllTrue()) {
+        this->total_count_ += row_cnt;
+    } else {
+        for (u16 j = 0; j < row_cnt; ++j) {
+            this->total_count_ += bitmask.IsTrue(j);
+        }
+    }
+    u32 segment_offset_start = block_id * DEFAULT_BLOCK_CAPACITY;
+    if (this->query_count_ == 1) {
+        auto SearchRows = [&](auto distance) {
+            const DataType *y_j = data;
+            for (u16 j = 0; j < row_cnt; ++j, y_j += dim) {
+                if (bitmask.IsTrue(j)) {
+                    AddResult(0, distance(query, y_j, dim), RowID(segment_id, segment_offset_start + j));
+                }
+            }
+        };
+        switch (distance_type) {
+            case KnnDistanceType::kL2: {
+                SearchRows([](const DataType *x, const DataType *y, u32 d) { return L2Distance<DataType>(x, y, d); });
+                break;
+            }
+            case KnnDistanceType::kInnerProduct: {
+                SearchRows([](const DataType *x, const DataType *y, u32 d) { return IPDistance<DataType>(x, y, d); });
+                break;
             }
+            default: {
+                SearchRows([](const DataType *x, const DataType *y, u32 d) { return CosineDistance<DataType>(x, y, d); });
+            }
+        }
+        return;
+    }
+
+    // the l2 distance is |x|^2 + |y|^2 - 2 * x.y, the cosine is x.y / |y| with the normalized x
+    const SizeT bs_x = Min<SizeT>(DISTANCE_COMPUTE_BLAS_QUERY_BS, this->query_count_);
+    const SizeT bs_y = Min<SizeT>(DISTANCE_COMPUTE_BLAS_DATABASE_BS, row_cnt);
+    if (ip_block_.size() < bs_x * bs_y) {
+        ip_block_.resize(bs_x * bs_y);
+    }
+    // the norms of the queries are computed per call, which is cheap compared to the products of a block
+    if (distance_type == KnnDistanceType::kL2) {
+        x_norms_.resize(this->query_count_);
+        L2NormsSquares(x_norms_.data(), query, dim, this->query_count_);
+    }
+    if (distance_type != KnnDistanceType::kInnerProduct) {
+        y_norms_.resize(row_cnt);
+        L2NormsSquares(y_norms_.data(), data, dim, row_cnt);
+    }
+    for (SizeT i0 = 0; i0 < this->query_count_; i0 += bs_x) {
+        SizeT i1 = Min<SizeT>(i0 + bs_x, this->query_count_);
+        for (u16 j0 = 0; j0 < row_cnt; j0 += bs_y) {
+            u16 j1 = u16(Min<SizeT>(j0 + bs_y, row_cnt));
+            matrixA_multiply_transpose_matrixB_output_to_C(query + i0 * dim, data + SizeT(j0) * dim, i1 - i0, j1 - j0, dim, ip_block_.data());
+            if (distance_type == KnnDistanceType::kL2) {
+                for (SizeT i = i0; i < i1; ++i) {
+                    DataType *ip_line = ip_block_.data() + (i - i0) * (j1 - j0);
+                    for (u16 j = j0; j < j1; ++j, ++ip_line) {
+                        // negative values can occur for identical vectors due to roundoff errors
+                        *ip_line = Max<DataType>(x_norms_[i] + y_norms_[j] - 2 * *ip_line, 0);
+                    }
+                }
+            } else if (distance_type == KnnDistanceType::kCosine) {
+                for (SizeT i = i0; i < i1; ++i) {
+                    DataType *ip_line = ip_block_.data() + (i - i0) * (j1 - j0);
+                    for (u16 j = j0; j < j1; ++j, ++ip_line) {
+                        *ip_line = y_norms_[j] > 0 ? *ip_line / std::sqrt(y_norms_[j]) : 0;
+                    }
+                }
+            }
+            AddResults(i0, i1, j0, j1, ip_block_.data(), segment_id, segment_offset_start, bitmask);
         }
     }
 }
@@ -132,18 +333,18 @@ void MergeKnn<DataType, C>::Search(const DataType *dist, const RowID *row_ids, u
         const DataType *d = dist + i * topk_;
         const RowID *r = row_ids + i * topk_;
         for (u16 j = 0; j < count; j++) {
-            result_handler_->AddResult(i, d[j], r[j]);
+            AddResult(i, d[j], r[j]);
         }
     }
 }
 
 template <typename DataType, template <typename, typename> typename C>
-void MergeKnn<DataType, C>::Search(SizeT query_id, const DataType *dist, const RowID *row_ids, u16 count) {
+void MergeKnn<DataType, C>::Search(SizeT query_id, const DataType *dist, const RowID *row_ids, SizeT count) {
     if (query_id == 0) {
         this->total_count_ += count;
     }
-    for (u16 j = 0; j < count; j++) {
-        result_handler_->AddResult(query_id, dist[j], row_ids[j]);
+    for (SizeT j = 0; j < count; j++) {
+        AddResult(query_id, dist[j], row_ids[j]);
     }
 }
 
@@ -152,7 +353,11 @@ void MergeKnn<DataType, C>::Begin() {
     if (this->begin_ || this->query_count_ == 0) {
         return;
     }
-    result_handler_->Begin();
+    if (IsRangeSearch()) {
+        range_handler_->Begin();
+    } else {
+        result_handler_->Begin();
+    }
     this->begin_ = true;
 }
 
@@ -161,7 +366,11 @@ void MergeKnn<DataType, C>::End() {
     if (!this->begin_)
         return;
 
-    result_handler_->End();
+    if (IsRangeSearch()) {
+        range_handler_->End();
+    } else {
+        result_handler_->End();
+    }
 
     this->begin_ = false;
 }
@@ -171,7 +380,11 @@ void MergeKnn<DataType, C>::EndWithoutSort() {
     if (!this->begin_)
         return;
 
-    result_handler_->EndWithoutSort();
+    if (IsRangeSearch()) {
+        range_handler_->EndWithoutSort();
+    } else {
+        result_handler_->EndWithoutSort();
+    }
 
     this->begin_ = false;
 }
@@ -191,6 +404,9 @@ DataType *MergeKnn<DataType, C>::GetDistancesByIdx(u64 idx) const {
     if (idx >= this->query_count_) {
         Error<ExecutorException>("Query index exceeds the limit");
     }
+    if (IsRangeSearch()) {
+        return range_handler_->GetDistances(idx);
+    }
     return distance_array_.get() + idx * this->topk_;
 }
 
@@ -199,6 +415,9 @@ RowID *MergeKnn<DataType, C>::GetIDsByIdx(u64 idx) const {
     if (idx >= this->query_count_) {
         Error<ExecutorException>("Query index exceeds the limit");
     }
+    if (IsRangeSearch()) {
+        return range_handler_->GetIDs(idx);
+    }
     return idx_array_.get() + idx * this->topk_;
 }
 
@@ -53,6 +53,7 @@ enum class ResultHandlerType {
     kHeap,
     kReservoir,
     kSingleBest,
+    kRange,
     kInvalid,
 };
 
@@ -563,4 +564,78 @@ public:
     }
 };
 
+// keeps all the results within `radius` rather than the top k, i.e. not worse than `radius` by `Compare`. the results of a
+// query grow with the ones found instead of being preallocated, and are sorted from the best by `End`.
+export template <class Compare>
+class RangeResultHandler : public ResultHandlerBase {
+    using DistType = typename Compare::DistanceType;
+    using ID = typename Compare::IDType;
+
+public:
+    explicit RangeResultHandler(SizeT n_queries, DistType radius)
+        : ResultHandlerBase(ResultHandlerType::kRange), radius_(radius), results_(n_queries), distances_(n_queries), ids_(n_queries) {}
+
+    ~RangeResultHandler() = default;
+
+    void Begin() {}
+
+    void ReInitialize() {
+        for (SizeT q_id = 0; q_id < results_.size(); ++q_id) {
+            results_[q_id].clear();
+            distances_[q_id].clear();
+            ids_[q_id].clear();
+        }
+    }
+
+    [[nodiscard]] DistType radius() const { return radius_; }
+
+    [[nodiscard]] bool InRange(DistType distance) const { return !Compare::Compare(distance, radius_); }
+
+    void AddResult(SizeT q_id, DistType distance, ID id) {
+        if (InRange(distance)) {
+            results_[q_id].emplace_back(distance, id);
+        }
+    }
+
+    void End(SizeT q_id) {
+        auto &results = results_[q_id];
+        std::sort(results.begin(), results.end(), [](const auto &a, const auto &b) { return Compare::Compare(b.first, a.first); });
+        EndWithoutSort(q_id);
+    }
+
+    void End() {
+        for (SizeT q_id = 0; q_id < results_.size(); ++q_id) {
+            End(q_id);
+        }
+    }
+
+    // move the results of `q_id` to the arrays of distances and ids
+    void EndWithoutSort(SizeT q_id) {
+        auto &results = results_[q_id];
+        for (const auto &[distance, id] : results) {
+            distances_[q_id].push_back(distance);
+            ids_[q_id].push_back(id);
+        }
+        results.clear();
+    }
+
+    void EndWithoutSort() {
+        for (SizeT q_id = 0; q_id < results_.size(); ++q_id) {
+            EndWithoutSort(q_id);
+        }
+    }
+
+    [[nodiscard]] SizeT GetSize(SizeT q_id) const { return ids_[q_id].size(); }
+
+    [[nodiscard]] DistType *GetDistances(SizeT q_id) { return distances_[q_id].data(); }
+
+    [[nodiscard]] ID *GetIDs(SizeT q_id) { return ids_[q_id].data(); }
+
+private:
+    DistType radius_{};
+    Vector<Vector<Pair<DistType, ID>>> results_;
+    Vector<Vector<DistType>> distances_;
+    Vector<Vector<ID>> ids_;
+};
+
 } // namespace infinity
\ No newline at end of file
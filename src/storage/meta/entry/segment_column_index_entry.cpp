@@ -14,9 +14,13 @@
 
 module;
 
+#include <bit>
+#include <type_traits>
+
 import stl;
 import base_entry;
 // import segment_entry;
+import default_values;
 import buffer_manager;
 import buffer_handle;
 import buffer_obj;
@@ -27,10 +31,33 @@ import infinity_exception;
 
 import index_file_worker;
 import annivfflat_index_file_worker;
+import annivfpq_index_file_worker;
+import annivfsq8_index_file_worker;
 import hnsw_file_worker;
+import diskann_index_file_worker;
 import column_index_entry;
 import table_collection_entry;
 import segment_entry;
+import block_entry;
+import block_column_entry;
+import index_hnsw;
+import index_ivfflat;
+import index_ivfpq;
+import index_ivfsq8;
+import kmeans_partition;
+import annivfflat_index_data;
+import annivfpq_index_data;
+import annivfsq8_index_data;
+import diskann_index;
+import hnsw_common;
+import hnsw_alg;
+import hnsw_dispatch;
+import vector_distance;
+import hnsw_simd_func;
+import infinity_context;
+import config;
+import resource_manager;
+import bitmask;
 
 module segment_column_index_entry;
 
@@ -65,11 +92,236 @@ BufferHandle SegmentColumnIndexEntry::GetIndex(SegmentColumnIndexEntry *segment_
     return segment_column_index_entry->buffer_->Load();
 }
 
-void SegmentColumnIndexEntry::UpdateIndex(SegmentColumnIndexEntry *,
-                                          TxnTimeStamp,
-                                          FaissIndexPtr *,
-                                          BufferManager *) {
-    Error<NotImplementException>("Not implemented");
+void SegmentColumnIndexEntry::UpdateIndex(SegmentColumnIndexEntry *segment_column_index_entry,
+                                          TxnTimeStamp commit_ts,
+                                          const SegmentEntry *segment_entry,
+                                          BufferManager *buffer_mgr) {
+    const ColumnIndexEntry *column_index_entry = segment_column_index_entry->column_index_entry_;
+    const IndexBase *index_base = column_index_entry->index_base_.get();
+    u64 column_id = column_index_entry->column_id_;
+    const ColumnDef *column_def = segment_entry->table_entry_->columns_[column_id].get();
+    auto embedding_info = static_cast<EmbeddingInfo *>(column_def->type()->type_info().get());
+    EmbeddingDataType elem_type = embedding_info->Type();
+    if (elem_type != kElemFloat && elem_type != kElemFloat16 && elem_type != kElemBFloat16 && elem_type != kElemBit && elem_type != kElemInt8) {
+        Error<StorageException>("Not implemented");
+    }
+    SizeT dimension = embedding_info->Dimension();
+    SizeT row_count = segment_entry->row_count_;
+
+    UniqueLock<RWMutex> w_locker(segment_column_index_entry->rw_locker_);
+    BufferHandle buffer_handle = SegmentColumnIndexEntry::GetIndex(segment_column_index_entry, buffer_mgr);
+    // rows are appended to a segment in commit order, so the first `begin_row` rows of the segment are already in the index.
+    // it also makes the update idempotent when the wal is replayed on an index flushed after the checkpoint.
+    // the rows are passed as f32, as packed bits with `ElemType` u8, or as int8 with `ElemType` i8.
+    // a cosine index keeps the normalized vectors, which are compared by inner product
+    const bool normalize =
+        index_base->index_type_ == IndexType::kHnsw && static_cast<const IndexHnsw *>(index_base)->metric_type_ == MetricType::kMerticCosine;
+    auto ForEachBlock = [&]<typename ElemType = f32>(SizeT begin_row, auto &&Insert) {
+        for (const auto &block_entry : segment_entry->block_entries_) {
+            SizeT block_begin = block_entry->block_id_ * DEFAULT_BLOCK_CAPACITY;
+            SizeT block_end = block_begin + block_entry->row_count_;
+            if (block_end <= begin_row) {
+                continue;
+            }
+            SizeT begin = Max(begin_row, block_begin);
+            BufferHandle column_buffer_handle = block_entry->columns_[column_id]->buffer_->Load();
+            SizeT offset = (begin - block_begin) * dimension;
+            SizeT row_n = block_end - begin;
+            if constexpr (IsSame<ElemType, u8>()) {
+                SizeT byte_n = EmbeddingT::EmbeddingSize(kElemBit, dimension);
+                Insert(reinterpret_cast<const u8 *>(column_buffer_handle.GetData()) + (begin - block_begin) * byte_n, begin, row_n);
+                continue;
+            } else if constexpr (IsSame<ElemType, i8>()) {
+                Insert(reinterpret_cast<const i8 *>(column_buffer_handle.GetData()) + offset, begin, row_n);
+                continue;
+            }
+            if (elem_type == kElemFloat && !normalize) {
+                Insert(reinterpret_cast<const f32 *>(column_buffer_handle.GetData()) + offset, begin, row_n);
+                continue;
+            }
+            // the indexes are built in f32, so half precision rows are widened first
+            Vector<f32> widened(row_n * dimension);
+            if (elem_type == kElemFloat) {
+                const auto *column_data = reinterpret_cast<const f32 *>(column_buffer_handle.GetData()) + offset;
+                Copy(column_data, column_data + widened.size(), widened.begin());
+            } else if (elem_type == kElemFloat16) {
+                const auto *column_data = reinterpret_cast<const float16_t *>(column_buffer_handle.GetData()) + offset;
+                HalfToF32(column_data, widened.data(), widened.size());
+            } else {
+                const auto *column_data = reinterpret_cast<const bfloat16_t *>(column_buffer_handle.GetData()) + offset;
+                HalfToF32(column_data, widened.data(), widened.size());
+            }
+            if (normalize) {
+                for (SizeT i = 0; i < row_n; ++i) {
+                    L2Normalize(widened.data() + i * dimension, dimension);
+                }
+            }
+            Insert(widened.data(), begin, row_n);
+        }
+    };
+    // the threads of the training and the insertion are bounded by the worker cpu limit
+    SizeT thread_n = Thread::hardware_concurrency();
+    if (Config *config = InfinityContext::instance().config(); config != nullptr) {
+        thread_n = config->worker_cpu_limit();
+    }
+    ThreadPool *pool = nullptr;
+    if (ResourceManager *resource_manager = InfinityContext::instance().resource_manager(); resource_manager != nullptr) {
+        pool = &resource_manager->worker_pool();
+    }
+    // the element type of the column is checked against the index by `TableCollectionEntry::CreateIndex`
+    switch (index_base->index_type_) {
+        case IndexType::kIVFFlat:
+        case IndexType::kIVFPQ:
+        case IndexType::kIVFSQ8: {
+            auto UpdateIVF = [&](auto *ivf_index, SizeT mini_batch_size) {
+                SizeT begin_row = ivf_index->data_num_;
+                if (begin_row >= row_count) {
+                    return;
+                }
+                if (begin_row == 0) {
+                    // a new index, train the centroids on a uniform sample of the rows, which is as many as k-means would sample
+                    VectorReservoir reservoir(dimension, IVF_TRAIN_POINTS_PER_CENTROID * ivf_index->partition_num_);
+                    ForEachBlock(0, [&](const f32 *data, SizeT, SizeT row_n) { reservoir.Add(data, row_n); });
+                    ivf_index->train_centroids(dimension, reservoir.size(), reservoir.data(), mini_batch_size, pool, thread_n);
+                }
+                // the new rows go to the partitions of the nearest trained centroids
+                ForEachBlock(begin_row, [&](const f32 *data, SizeT segment_offset, SizeT row_n) {
+                    ivf_index->insert_data(dimension, row_n, data, segment_offset);
+                });
+            };
+            if (index_base->index_type_ == IndexType::kIVFFlat) {
+                UpdateIVF(static_cast<AnnIVFFlatIndexData<f32> *>(buffer_handle.GetDataMut()),
+                          static_cast<const IndexIVFFlat *>(index_base)->mini_batch_size_);
+            } else if (index_base->index_type_ == IndexType::kIVFPQ) {
+                UpdateIVF(static_cast<AnnIVFPQIndexData<f32> *>(buffer_handle.GetDataMut()),
+                          static_cast<const IndexIVFPQ *>(index_base)->mini_batch_size_);
+            } else {
+                UpdateIVF(static_cast<AnnIVFSQ8IndexData<f32> *>(buffer_handle.GetDataMut()),
+                          static_cast<const IndexIVFSQ8 *>(index_base)->mini_batch_size_);
+            }
+            break;
+        }
+        case IndexType::kDiskAnn: {
+            // the graph on the disk is static, so it is built again with all rows once the rows appended since the last build are
+            // many. the rows not in the graph are searched exactly before.
+            SizeT built_n = static_cast<const DiskAnnIndex *>(buffer_handle.GetData())->data_num();
+            if (built_n >= row_count || (built_n > 0 && row_count - built_n < built_n * DISKANN_REBUILD_APPENDED_RATIO)) {
+                break;
+            }
+            // the buffer is modified only if the graph is built, which is written to the temp directory
+            auto *diskann_index = static_cast<DiskAnnIndex *>(buffer_handle.GetDataMut());
+            Vector<f32> segment_column_data;
+            segment_column_data.reserve(row_count * dimension);
+            ForEachBlock(0, [&](const f32 *data, SizeT, SizeT row_n) {
+                segment_column_data.insert(segment_column_data.end(), data, data + row_n * dimension);
+            });
+            diskann_index->Build(segment_column_data.data(), segment_column_data.size() / dimension);
+            break;
+        }
+        case IndexType::kHnsw: {
+            auto index_hnsw = static_cast<const IndexHnsw *>(index_base);
+            auto InsertHnsw = [&](auto *hnsw_index) {
+                SizeT begin_row = hnsw_index->GetVertexNum();
+                if (begin_row >= row_count) {
+                    return;
+                }
+                // the index is copied out of its file under the exclusive lock, so that the checkpoint can overwrite the file while
+                // the searches hold the shared lock
+                hnsw_index->Unmap();
+                if (row_count > hnsw_index->GetMaxVertexNum()) {
+                    // grow geometrically, so that continuous small appends don't copy the whole index every time
+                    hnsw_index->Grow(Min(Max(row_count, hnsw_index->GetMaxVertexNum() * 2), segment_entry->row_capacity_));
+                }
+                using HnswDataType = typename std::remove_reference_t<decltype(*hnsw_index)>::HnswDataType;
+                ForEachBlock.template operator()<HnswDataType>(begin_row, [&](const HnswDataType *data, SizeT segment_offset, SizeT row_n) {
+                    Vector<u64> row_ids(row_n);
+                    for (SizeT i = 0; i < row_n; ++i) {
+                        row_ids[i] = RowID(segment_entry->segment_id_, segment_offset + i).ToUint64();
+                    }
+                    // the dimension of the store is the number of bytes for packed bits
+                    SizeT dim = IsSame<HnswDataType, u8>() ? EmbeddingT::EmbeddingSize(kElemBit, dimension) : dimension;
+                    hnsw_index->InsertVecs(DenseVectorIter<HnswDataType>(data, dim, row_n), row_ids.data(), row_n, thread_n);
+                });
+                // a new index is reordered once all rows are inserted, the appended vertices keep their order
+                if (begin_row == 0 && index_hnsw->reorder_) {
+                    hnsw_index->Reorder();
+                }
+            };
+            DispatchHnsw(index_hnsw, elem_type, [&]<typename Hnsw>() { InsertHnsw(static_cast<Hnsw *>(buffer_handle.GetDataMut())); });
+            break;
+        }
+        default: {
+            Error<StorageException>(Format("Update index isn't implemented: {}", IndexInfo::IndexTypeToString(index_base->index_type_)));
+        }
+    }
+    segment_column_index_entry->max_ts_ = Max(segment_column_index_entry->max_ts_, commit_ts);
+}
+
+bool SegmentColumnIndexEntry::NeedRepair(SegmentColumnIndexEntry *segment_column_index_entry, const SegmentEntry *segment_entry) {
+    SizeT deleted_n = segment_entry->deleted_row_count_;
+    SizeT repaired_n = segment_column_index_entry->repaired_deleted_n_;
+    if (deleted_n <= repaired_n || deleted_n - repaired_n <= segment_entry->row_count_ * VECTOR_INDEX_REPAIR_DELETED_RATIO) {
+        return false;
+    }
+    return !segment_column_index_entry->repair_submitted_.exchange(true);
+}
+
+void SegmentColumnIndexEntry::RepairIndex(SegmentColumnIndexEntry *segment_column_index_entry,
+                                          TxnTimeStamp commit_ts,
+                                          TxnTimeStamp visible_ts,
+                                          SegmentEntry *segment_entry,
+                                          BufferManager *buffer_mgr) {
+    const ColumnIndexEntry *column_index_entry = segment_column_index_entry->column_index_entry_;
+    const IndexBase *index_base = column_index_entry->index_base_.get();
+    const ColumnDef *column_def = segment_entry->table_entry_->columns_[column_index_entry->column_id_].get();
+    EmbeddingDataType elem_type = static_cast<EmbeddingInfo *>(column_def->type()->type_info().get())->Type();
+
+    UniqueLock<RWMutex> w_locker(segment_column_index_entry->rw_locker_);
+    BufferHandle buffer_handle = SegmentColumnIndexEntry::GetIndex(segment_column_index_entry, buffer_mgr);
+    // the bit i of the mask is the row i of the segment, which is the vertex i of hnsw and the id i of ivf
+    Bitmask bitmask;
+    auto MaskDeleted = [&](SizeT row_n) {
+        bitmask.Initialize(std::bit_ceil(Max(row_n, SizeT(1))));
+        SegmentEntry::MaskDeletedRows(segment_entry, 0, row_n, visible_ts, bitmask);
+    };
+    switch (index_base->index_type_) {
+        case IndexType::kIVFFlat:
+        case IndexType::kIVFPQ:
+        case IndexType::kIVFSQ8: {
+            auto RepairIVF = [&](auto *ivf_index) {
+                MaskDeleted(ivf_index->data_num_);
+                u32 removed_n = ivf_index->remove_deleted(bitmask);
+                LOG_TRACE(Format("Segment: {}, IVF index removed {} deleted rows", segment_entry->segment_id_, removed_n));
+            };
+            if (index_base->index_type_ == IndexType::kIVFFlat) {
+                RepairIVF(static_cast<AnnIVFFlatIndexData<f32> *>(buffer_handle.GetDataMut()));
+            } else if (index_base->index_type_ == IndexType::kIVFPQ) {
+                RepairIVF(static_cast<AnnIVFPQIndexData<f32> *>(buffer_handle.GetDataMut()));
+            } else {
+                RepairIVF(static_cast<AnnIVFSQ8IndexData<f32> *>(buffer_handle.GetDataMut()));
+            }
+            break;
+        }
+        case IndexType::kHnsw: {
+            auto index_hnsw = static_cast<const IndexHnsw *>(index_base);
+            auto RepairHnsw = [&](auto *hnsw_index) {
+                // copied out of the file before it is modified, as `UpdateIndex` does
+                hnsw_index->Unmap();
+                MaskDeleted(hnsw_index->GetVertexNum());
+                SizeT repaired_n = hnsw_index->RepairDeleted(bitmask);
+                LOG_TRACE(Format("Segment: {}, Hnsw index repaired {} neighbor lists", segment_entry->segment_id_, repaired_n));
+            };
+            DispatchHnsw(index_hnsw, elem_type, [&]<typename Hnsw>() { RepairHnsw(static_cast<Hnsw *>(buffer_handle.GetDataMut())); });
+            break;
+        }
+        default: {
+            Error<StorageException>(Format("Repair index isn't implemented: {}", IndexInfo::IndexTypeToString(index_base->index_type_)));
+        }
+    }
+    // the rows deleted after `visible_ts` are left to the next repair
+    segment_column_index_entry->repaired_deleted_n_ = bitmask.count() - bitmask.CountTrue();
+    segment_column_index_entry->max_ts_ = Max(segment_column_index_entry->max_ts_, commit_ts);
+    segment_column_index_entry->repair_submitted_ = false;
 }
 
 bool SegmentColumnIndexEntry::Flush(SegmentColumnIndexEntry *segment_column_index_entry, TxnTimeStamp checkpoint_ts) {
@@ -86,6 +338,7 @@ bool SegmentColumnIndexEntry::Flush(SegmentColumnIndexEntry *segment_column_inde
         LOG_WARN("Index entry is not initialized");
         return false;
     }
+    SharedLock<RWMutex> r_locker(segment_column_index_entry->rw_locker_);
     if (segment_column_index_entry->buffer_->Save()) {
         segment_column_index_entry->buffer_->Sync();
         segment_column_index_entry->buffer_->CloseFile();
@@ -96,6 +349,17 @@ bool SegmentColumnIndexEntry::Flush(SegmentColumnIndexEntry *segment_column_inde
     return true;
 }
 
+void SegmentColumnIndexEntry::Cleanup(SegmentColumnIndexEntry *segment_column_index_entry) {
+    if (segment_column_index_entry->buffer_ == nullptr) {
+        return;
+    }
+    UniqueLock<RWMutex> w_locker(segment_column_index_entry->rw_locker_);
+    segment_column_index_entry->buffer_->CleanupFile();
+    LOG_TRACE(Format("Segment: {}, Index: {} is cleaned up",
+                     segment_column_index_entry->segment_id_,
+                     *segment_column_index_entry->column_index_entry_->index_dir_));
+}
+
 Json SegmentColumnIndexEntry::Serialize(SegmentColumnIndexEntry *segment_column_index_entry) {
     if (segment_column_index_entry->deleted_) {
         Error<StorageException>("Segment Column index entry can't be deleted.");
@@ -157,7 +421,9 @@ UniquePtr<IndexFileWorker> SegmentColumnIndexEntry::CreateFileWorker(ColumnIndex
             auto create_annivfflat_param = static_cast<CreateAnnIVFFlatParam *>(param);
             auto elem_type = ((EmbeddingInfo *)(column_def->type()->type_info().get()))->Type();
             switch (elem_type) {
-                case kElemFloat: {
+                case kElemFloat:
+                case kElemFloat16:
+                case kElemBFloat16: {
                     file_worker = MakeUnique<AnnIVFFlatIndexFileWorker<f32>>(column_index_entry->index_dir_,
                                                                              file_name,
                                                                              index_base,
@@ -171,12 +437,56 @@ UniquePtr<IndexFileWorker> SegmentColumnIndexEntry::CreateFileWorker(ColumnIndex
             }
             break;
         }
+        case IndexType::kIVFPQ: {
+            auto create_annivfpq_param = static_cast<CreateAnnIVFPQParam *>(param);
+            auto elem_type = ((EmbeddingInfo *)(column_def->type()->type_info().get()))->Type();
+            switch (elem_type) {
+                case kElemFloat:
+                case kElemFloat16:
+                case kElemBFloat16: {
+                    file_worker = MakeUnique<AnnIVFPQIndexFileWorker<f32>>(column_index_entry->index_dir_,
+                                                                           file_name,
+                                                                           index_base,
+                                                                           column_def,
+                                                                           create_annivfpq_param->row_count_);
+                    break;
+                }
+                default: {
+                    ExecutorException("Create IVF PQ index: unsupported element type.");
+                }
+            }
+            break;
+        }
+        case IndexType::kIVFSQ8: {
+            auto create_annivfsq8_param = static_cast<CreateAnnIVFSQ8Param *>(param);
+            auto elem_type = ((EmbeddingInfo *)(column_def->type()->type_info().get()))->Type();
+            switch (elem_type) {
+                case kElemFloat:
+                case kElemFloat16:
+                case kElemBFloat16: {
+                    file_worker = MakeUnique<AnnIVFSQ8IndexFileWorker<f32>>(column_index_entry->index_dir_,
+                                                                            file_name,
+                                                                            index_base,
+                                                                            column_def,
+                                                                            create_annivfsq8_param->row_count_);
+                    break;
+                }
+                default: {
+                    ExecutorException("Create IVF SQ8 index: unsupported element type.");
+                }
+            }
+            break;
+        }
         case IndexType::kHnsw: {
             auto create_hnsw_param = static_cast<CreateHnswParam *>(param);
             file_worker =
                 MakeUnique<HnswFileWorker>(column_index_entry->index_dir_, file_name, index_base, column_def, create_hnsw_param->max_element_);
             break;
         }
+        case IndexType::kDiskAnn: {
+            file_worker = MakeUnique<DiskAnnIndexFileWorker>(column_index_entry->index_dir_, file_name, index_base, column_def);
+            break;
+        }
         case IndexType::kIRSFullText: {
 //            auto create_fulltext_param = static_cast<CreateFullTextParam *>(param);
             UniquePtr<String> err_msg =
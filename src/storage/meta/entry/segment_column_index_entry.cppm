@@ -28,7 +28,6 @@ namespace infinity {
 
 class TableCollectionEntry;
 class ColumnIndexEntry;
-class FaissIndexPtr;
 class BufferManager;
 class IndexDef;
 class SegmentEntry;
@@ -54,11 +53,29 @@ private:
 public:
     [[nodiscard]] static BufferHandle GetIndex(SegmentColumnIndexEntry *segment_column_index_entry, BufferManager *buffer_mgr);
 
-    static void
-    UpdateIndex(SegmentColumnIndexEntry *segment_column_index_entry, TxnTimeStamp commit_ts, FaissIndexPtr *index, BufferManager *buffer_mgr);
+    // insert the rows of `segment_entry` that are not in the index yet. it is called when the rows are committed.
+    static void UpdateIndex(SegmentColumnIndexEntry *segment_column_index_entry,
+                            TxnTimeStamp commit_ts,
+                            const SegmentEntry *segment_entry,
+                            BufferManager *buffer_mgr);
+
+    // whether the rows deleted since the last repair exceed `VECTOR_INDEX_REPAIR_DELETED_RATIO` of the segment.
+    // it returns true only once until `RepairIndex` is done.
+    static bool NeedRepair(SegmentColumnIndexEntry *segment_column_index_entry, const SegmentEntry *segment_entry);
+
+    // remove the rows of `segment_entry` deleted at or before `visible_ts` from the index, so that the searches don't visit them any more.
+    // no active txn may have begun before `visible_ts`, and `commit_ts` is the ts of the delete that submitted the repair.
+    static void RepairIndex(SegmentColumnIndexEntry *segment_column_index_entry,
+                            TxnTimeStamp commit_ts,
+                            TxnTimeStamp visible_ts,
+                            SegmentEntry *segment_entry,
+                            BufferManager *buffer_mgr);
 
     static bool Flush(SegmentColumnIndexEntry *segment_column_index_entry, TxnTimeStamp checkpoint_ts);
 
+    // remove the index files of a dropped index, which no txn sees any more
+    static void Cleanup(SegmentColumnIndexEntry *segment_column_index_entry);
+
     static Json Serialize(SegmentColumnIndexEntry *segment_column_index_entry);
 
     static UniquePtr<SegmentColumnIndexEntry> Deserialize(const Json &index_entry_json,
@@ -77,14 +94,18 @@ public:
     const ColumnIndexEntry *column_index_entry_;
     u32 segment_id_{};
 
+    // searches of the index hold it shared, because `UpdateIndex` modifies the index in place
+    RWMutex rw_locker_{};
+
 private:
     BufferObj *const buffer_{};
 
-    RWMutex rw_locker_{};
-
     TxnTimeStamp min_ts_{0}; // Indicate the commit_ts which create this SegmentColumnIndexEntry
     TxnTimeStamp max_ts_{0}; // Indicate the max commit_ts which update data inside this SegmentColumnIndexEntry
     TxnTimeStamp checkpoint_ts_{0};
+
+    SizeT repaired_deleted_n_{}; // the deleted row count of the segment at the last repair
+    atomic_bool repair_submitted_{false};
 };
 
 } // namespace infinity
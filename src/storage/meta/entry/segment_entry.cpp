@@ -14,6 +14,7 @@
 
 module;
 
+#include <bit>
 #include <ctime>
 #include <string>
 #include <vector>
@@ -35,8 +36,9 @@ import defer_op;
 import index_ivfflat;
 import index_hnsw;
 import buffer_handle;
-import annivfflat_index_data;
 import annivfflat_index_file_worker;
+import annivfpq_index_file_worker;
+import annivfsq8_index_file_worker;
 import index_file_worker;
 import hnsw_file_worker;
 import logger;
@@ -48,15 +50,11 @@ import table_index_entry;
 import segment_column_index_entry;
 import column_index_entry;
 import index_base;
+import bitmask;
+import bitmask_buffer;
 
 import hnsw_common;
-import dist_func_l2;
-import dist_func_ip;
 import hnsw_alg;
-import lvq_store;
-import plain_store;
-
-import segment_iter;
 
 module segment_entry;
 
@@ -164,22 +162,6 @@ void SegmentEntry::DeleteData(SegmentEntry *segment_entry, Txn *txn_ptr, const H
     }
 }
 
-template <typename DataType>
-class OneColumnIterator {
-public:
-    OneColumnIterator(const SegmentEntry *entry, SizeT column_id) : segment_iter_(entry, MakeShared<Vector<SizeT>>(Vector<SizeT>{column_id})) {}
-
-    Optional<const DataType *> Next() {
-        if (auto ret = segment_iter_.Next(); ret) {
-            return reinterpret_cast<const DataType *>((*ret)[0]);
-        }
-        return None;
-    }
-
-private:
-    SegmentIter segment_iter_;
-};
-
 SharedPtr<SegmentColumnIndexEntry> SegmentEntry::CreateIndexFile(SegmentEntry *segment_entry,
                                                                  ColumnIndexEntry *column_index_entry,
                                                                  SharedPtr<ColumnDef> column_def,
@@ -195,120 +177,27 @@ SharedPtr<SegmentColumnIndexEntry> SegmentEntry::CreateIndexFile(SegmentEntry *s
         SegmentColumnIndexEntry::NewIndexEntry(column_index_entry, segment_entry->segment_id_, create_ts, buffer_mgr, create_index_param.get());
     switch (index_base->index_type_) {
 
-        case IndexType::kIVFFlat: {
+        case IndexType::kIVFFlat:
+        case IndexType::kIVFPQ:
+        case IndexType::kIVFSQ8: {
             if (column_def->type()->type() != LogicalType::kEmbedding) {
                 Error<StorageException>("AnnIVFFlat supports embedding type.");
             }
-            TypeInfo *type_info = column_def->type()->type_info().get();
-            auto embedding_info = static_cast<EmbeddingInfo *>(type_info);
-            SizeT dimension = embedding_info->Dimension();
-            BufferHandle buffer_handle = SegmentColumnIndexEntry::GetIndex(segment_column_index_entry.get(), buffer_mgr);
-            switch (embedding_info->Type()) {
-                case kElemFloat: {
-                    auto annivfflat_index = static_cast<AnnIVFFlatIndexData<f32> *>(buffer_handle.GetDataMut());
-                    // TODO: How to select training data?
-                    Vector<f32> segment_column_data;
-                    segment_column_data.reserve(segment_entry->row_count_ * dimension);
-                    for (const auto &block_entry : segment_entry->block_entries_) {
-                        auto block_column_entry = block_entry->columns_[column_id].get();
-                        BufferHandle block_column_buffer_handle = block_column_entry->buffer_->Load();
-                        auto block_column_data_ptr = reinterpret_cast<const float *>(block_column_buffer_handle.GetData());
-                        SizeT block_row_cnt = block_entry->row_count_;
-                        segment_column_data.insert(segment_column_data.end(),
-                                                   block_column_data_ptr,
-                                                   block_column_data_ptr + block_row_cnt * dimension);
-                    }
-                    SizeT total_row_cnt = segment_column_data.size() / dimension;
-                    annivfflat_index->train_centroids(dimension, total_row_cnt, segment_column_data.data());
-                    annivfflat_index->insert_data(dimension, total_row_cnt, segment_column_data.data());
-                    break;
-                }
-                default: {
-                    Error<StorageException>("Not implemented");
-                }
-            }
+            // the centroids are trained on a sample of the rows streamed block by block, as an update of the empty index
+            SegmentColumnIndexEntry::UpdateIndex(segment_column_index_entry.get(), create_ts, segment_entry, buffer_mgr);
             break;
         }
         case IndexType::kHnsw: {
-            auto index_hnsw = static_cast<IndexHnsw *>(index_base);
             if (column_def->type()->type() != LogicalType::kEmbedding) {
                 Error<StorageException>("HNSW supports embedding type.");
             }
-            TypeInfo *type_info = column_def->type()->type_info().get();
-            auto embedding_info = static_cast<EmbeddingInfo *>(type_info);
-
-            BufferHandle buffer_handle = SegmentColumnIndexEntry::GetIndex(segment_column_index_entry.get(), buffer_mgr);
-            auto InsertHnsw = [&](auto &hnsw_index) {
-                u32 segment_offset = 0;
-                Vector<u64> row_ids;
-                for (const auto &block_entry : segment_entry->block_entries_) {
-                    SizeT block_row_cnt = block_entry->row_count_;
-
-                    for (SizeT block_offset = 0; block_offset < block_row_cnt; ++block_offset) {
-                        RowID row_id(segment_entry->segment_id_, segment_offset + block_offset);
-                        row_ids.push_back(row_id.ToUint64());
-                    }
-                    segment_offset += DEFAULT_BLOCK_CAPACITY;
-                }
-                OneColumnIterator<float> one_column_iter(segment_entry, column_id);
-                hnsw_index->InsertVecs(one_column_iter, row_ids.data(), row_ids.size());
-            };
-            switch (embedding_info->Type()) {
-                case kElemFloat: {
-                    switch (index_hnsw->encode_type_) {
-                        case HnswEncodeType::kPlain: {
-                            switch (index_hnsw->metric_type_) {
-                                case MetricType::kMerticInnerProduct: {
-                                    auto hnsw_index =
-                                        static_cast<KnnHnsw<float, u64, PlainStore<float>, PlainIPDist<float>> *>(buffer_handle.GetDataMut());
-                                    InsertHnsw(hnsw_index);
-                                    break;
-                                }
-                                case MetricType::kMerticL2: {
-                                    auto hnsw_index =
-                                        static_cast<KnnHnsw<float, u64, PlainStore<float>, PlainL2Dist<float>> *>(buffer_handle.GetDataMut());
-                                    InsertHnsw(hnsw_index);
-                                    break;
-                                }
-                                default: {
-                                    Error<StorageException>("Not implemented");
-                                }
-                            }
-                            break;
-                        }
-                        case HnswEncodeType::kLVQ: {
-                            switch (index_hnsw->metric_type_) {
-                                case MetricType::kMerticInnerProduct: {
-                                    // too long type. fix it.
-                                    auto hnsw_index =
-                                        static_cast<KnnHnsw<float, u64, LVQStore<float, i8, LVQIPCache<float, i8>>, LVQIPDist<float, i8>> *>(
-                                            buffer_handle.GetDataMut());
-                                    InsertHnsw(hnsw_index);
-                                    break;
-                                }
-                                case MetricType::kMerticL2: {
-                                    auto hnsw_index =
-                                        static_cast<KnnHnsw<float, u64, LVQStore<float, i8, LVQL2Cache<float, i8>>, LVQL2Dist<float, i8>> *>(
-                                            buffer_handle.GetDataMut());
-                                    InsertHnsw(hnsw_index);
-                                    break;
-                                }
-                                default: {
-                                    Error<StorageException>("Not implemented");
-                                }
-                            }
-                            break;
-                        }
-                        default: {
-                            Error<StorageException>("Not implemented");
-                        }
-                    }
-                    break;
-                }
-                default: {
-                    Error<StorageException>("Not implemented");
-                }
-            }
+            // the graph is built from all rows of the segment with the worker cpus as an update of the empty index
+            SegmentColumnIndexEntry::UpdateIndex(segment_column_index_entry.get(), create_ts, segment_entry, buffer_mgr);
+            break;
+        }
+        case IndexType::kDiskAnn: {
+            // the graph is built from all rows of the segment as an update of the empty index
+            SegmentColumnIndexEntry::UpdateIndex(segment_column_index_entry.get(), create_ts, segment_entry, buffer_mgr);
             break;
         }
         case IndexType::kIRSFullText: {
@@ -354,6 +243,62 @@ void SegmentEntry::CommitDelete(SegmentEntry *segment_entry, Txn *txn_ptr, const
 
         BlockEntry::CommitDelete(block_entry, txn_ptr);
         segment_entry->max_row_ts_ = Max(segment_entry->max_row_ts_, commit_ts);
+        for (RowID row_id : row_hash_map.second) {
+            SegmentEntry::MarkDeleted(segment_entry, row_id.segment_offset_);
+        }
+    }
+}
+
+void SegmentEntry::MaskDeletedRows(SegmentEntry *segment_entry, SizeT begin_row, SizeT row_count, TxnTimeStamp begin_ts, Bitmask &bitmask) {
+    SharedLock<RWMutex> lck(segment_entry->rw_locker_);
+    const u64 *alive_data = segment_entry->deleted_rows_.GetData();
+    if (alive_data == nullptr) {
+        return;
+    }
+    // deleted rows are sparse, so only the bits of the deleted rows are visited
+    SizeT end_row = Min(begin_row + row_count, segment_entry->deleted_rows_.count());
+    for (SizeT unit_i = begin_row / BitmaskBuffer::UNIT_BITS; unit_i * BitmaskBuffer::UNIT_BITS < end_row; ++unit_i) {
+        for (u64 deleted_bits = ~alive_data[unit_i]; deleted_bits != 0; deleted_bits &= deleted_bits - 1) {
+            SizeT row = unit_i * BitmaskBuffer::UNIT_BITS + std::countr_zero(deleted_bits);
+            if (row < begin_row || row >= end_row) {
+                continue;
+            }
+            // the rows deleted after the reader began are still visible to it
+            const BlockEntry *block_entry = segment_entry->block_entries_[row / DEFAULT_BLOCK_CAPACITY].get();
+            if (block_entry->block_version_->deleted_[row % DEFAULT_BLOCK_CAPACITY] <= begin_ts) {
+                bitmask.SetFalse(row - begin_row);
+            }
+        }
+    }
+}
+
+void SegmentEntry::MarkDeleted(SegmentEntry *segment_entry, SizeT segment_offset) {
+    Bitmask &deleted_rows = segment_entry->deleted_rows_;
+    SizeT capacity = std::bit_ceil(Max(segment_entry->row_capacity_, segment_offset + 1));
+    if (deleted_rows.count() == 0) {
+        deleted_rows.Initialize(capacity);
+    } else if (deleted_rows.count() < capacity) {
+        deleted_rows.Resize(capacity);
+    }
+    if (deleted_rows.IsTrue(segment_offset)) {
+        deleted_rows.SetFalse(segment_offset);
+        ++segment_entry->deleted_row_count_;
+    }
+}
+
+void SegmentEntry::LoadDeletedRows(SegmentEntry *segment_entry) {
+    segment_entry->deleted_rows_.Reset();
+    segment_entry->deleted_row_count_ = 0;
+    for (const auto &block_entry : segment_entry->block_entries_) {
+        if (block_entry.get() == nullptr || block_entry->block_version_.get() == nullptr) {
+            continue;
+        }
+        const auto &deleted = block_entry->block_version_->deleted_;
+        for (SizeT i = 0; i < block_entry->row_count_; ++i) {
+            if (deleted[i] != 0) {
+                SegmentEntry::MarkDeleted(segment_entry, block_entry->block_id_ * DEFAULT_BLOCK_CAPACITY + i);
+            }
+        }
     }
 }
 
@@ -429,6 +374,7 @@ SharedPtr<SegmentEntry> SegmentEntry::Deserialize(const Json &segment_entry_json
             segment_entry->block_entries_[block_entry->block_id_] = Move(block_entry);
         }
     }
+    SegmentEntry::LoadDeletedRows(segment_entry.get());
     LOG_TRACE(Format("Segment: {}, Block count: {}", segment_entry->segment_id_, segment_entry->block_entries_.size()));
 
     return segment_entry;
@@ -488,6 +434,7 @@ void SegmentEntry::MergeFrom(BaseEntry &other) {
     for (; idx < segment2_block_count; ++idx) {
         this->block_entries_.emplace_back(segment_entry2->block_entries_[idx]);
     }
+    SegmentEntry::LoadDeletedRows(this);
 
     // for (const auto &[index_name, index_entry] : segment_entry2->index_entry_map_) {
     //     if (this->index_entry_map_.find(index_name) == this->index_entry_map_.end()) {
@@ -504,10 +451,19 @@ SegmentEntry::GetCreateIndexParam(const SegmentEntry *segment_entry, const Index
         case IndexType::kIVFFlat: {
             return MakeUnique<CreateAnnIVFFlatParam>(index_base, column_def, segment_entry->row_count_);
         }
+        case IndexType::kIVFPQ: {
+            return MakeUnique<CreateAnnIVFPQParam>(index_base, column_def, segment_entry->row_count_);
+        }
+        case IndexType::kIVFSQ8: {
+            return MakeUnique<CreateAnnIVFSQ8Param>(index_base, column_def, segment_entry->row_count_);
+        }
         case IndexType::kHnsw: {
             SizeT max_element = segment_entry->row_count_;
             return MakeUnique<CreateHnswParam>(index_base, column_def, max_element);
         }
+        case IndexType::kDiskAnn: {
+            return MakeUnique<CreateIndexParam>(index_base, column_def);
+        }
         case IndexType::kIRSFullText: {
             return MakeUnique<CreateFullTextParam>(index_base, column_def);
         }
@@ -29,6 +29,7 @@ import table_index_entry;
 import txn_store;
 import index_file_worker;
 import column_index_entry;
+import bitmask;
 
 export module segment_entry;
 
@@ -58,6 +59,10 @@ public:
 
     Vector<SharedPtr<BlockEntry>> block_entries_{};
 
+    // the bit of a row is false once its delete is committed. the vector index searches skip the deleted rows with it.
+    Bitmask deleted_rows_{};
+    SizeT deleted_row_count_{};
+
 public:
     static SharedPtr<SegmentEntry> MakeNewSegmentEntry(const TableCollectionEntry *table_entry, u32 segment_id, BufferManager *buffer_mgr);
 
@@ -79,6 +84,9 @@ public:
 
     static void CommitDelete(SegmentEntry *segment_entry, Txn *txn_ptr, const HashMap<u16, Vector<RowID>> &block_row_hashmap);
 
+    // set the bits of the rows deleted at or before `begin_ts` false in `bitmask`, whose bit i is the row `begin_row + i` of the segment
+    static void MaskDeletedRows(SegmentEntry *segment_entry, SizeT begin_row, SizeT row_count, TxnTimeStamp begin_ts, Bitmask &bitmask);
+
     static u16 GetMaxBlockID(const SegmentEntry *segment_entry);
 
     static BlockEntry *GetBlockEntryByID(const SegmentEntry *segment_entry, u16 block_id);
@@ -96,6 +104,11 @@ public:
 private:
     static SharedPtr<String> DetermineSegmentDir(const String &parent_dir, u32 seg_id);
 
+    static void MarkDeleted(SegmentEntry *segment_entry, SizeT segment_offset);
+
+    // rebuild `deleted_rows_` from the block versions
+    static void LoadDeletedRows(SegmentEntry *segment_entry);
+
 public:
     static UniquePtr<CreateIndexParam>
     GetCreateIndexParam(const SegmentEntry *segment_entry, const IndexBase* index_base, const ColumnDef* column_def);
@@ -14,6 +14,7 @@
 
 module;
 
+#include <cmath>
 #include <iostream>
 #include <memory>
 #include <string>
@@ -35,6 +36,10 @@ import txn_store;
 import status;
 import infinity_exception;
 import index_ivfflat;
+import index_ivfpq;
+import index_ivfsq8;
+import index_hnsw;
+import hnsw_dispatch;
 import table_index_meta;
 import txn_manager;
 import segment_column_index_entry;
@@ -44,6 +49,12 @@ import column_index_entry;
 import irs_index_entry;
 import index_base;
 import index_full_text;
+import index_file_worker;
+import infinity_context;
+import storage;
+import backgroud_process;
+import bg_task;
+import default_values;
 
 module table_collection_entry;
 
@@ -68,6 +79,28 @@ TableCollectionEntry::TableCollectionEntry(const SharedPtr<String> &db_entry_dir
     txn_id_ = txn_id;
 }
 
+// the element type of the column is checked when a vector index is created, so that the commit of the rows doesn't fail on the index
+static void CheckVectorIndexColumn(const IndexBase *index_base, const ColumnDef *column_def) {
+    IndexType index_type = index_base->index_type_;
+    if (index_type != IndexType::kHnsw && index_type != IndexType::kIVFFlat && index_type != IndexType::kIVFPQ &&
+        index_type != IndexType::kIVFSQ8 && index_type != IndexType::kDiskAnn) {
+        return;
+    }
+    if (column_def->type()->type() != LogicalType::kEmbedding) {
+        Error<StorageException>(Format("{} index should be created on embedding column.", IndexInfo::IndexTypeToString(index_type)));
+    }
+    EmbeddingDataType elem_type = static_cast<const EmbeddingInfo *>(column_def->type()->type_info().get())->Type();
+    if (index_type == IndexType::kHnsw) {
+        // the index type is chosen by the element type, the encoding and the metric, which throws if there is none
+        DispatchHnsw(static_cast<const IndexHnsw *>(index_base), elem_type, []<typename Hnsw>() {});
+        return;
+    }
+    if (elem_type != kElemFloat && elem_type != kElemFloat16 && elem_type != kElemBFloat16) {
+        Error<StorageException>(
+            Format("{} index should be created on float or half precision embedding column.", IndexInfo::IndexTypeToString(index_type)));
+    }
+}
+
 Status TableCollectionEntry::CreateIndex(TableCollectionEntry *table_entry,
                                          const SharedPtr<IndexDef> &index_def,
                                          ConflictType conflict_type,
@@ -79,6 +112,11 @@ Status TableCollectionEntry::CreateIndex(TableCollectionEntry *table_entry,
         // Index name shouldn't be empty
         Error<StorageException>("Attempt to create no name index.");
     }
+    for (const auto &index_base : index_def->index_array_) {
+        for (const String &column_name : index_base->column_names_) {
+            CheckVectorIndexColumn(index_base.get(), table_entry->columns_[table_entry->GetColumnIdByName(column_name)].get());
+        }
+    }
 
     TableIndexMeta *table_index_meta{nullptr};
 
@@ -275,8 +313,12 @@ UniquePtr<String> TableCollectionEntry::Delete(TableCollectionEntry *table_entry
     return nullptr;
 }
 
-void TableCollectionEntry::CommitAppend(TableCollectionEntry *table_entry, Txn *txn_ptr, const AppendState *append_state_ptr) {
+void TableCollectionEntry::CommitAppend(TableCollectionEntry *table_entry,
+                                        Txn *txn_ptr,
+                                        const AppendState *append_state_ptr,
+                                        BufferManager *buffer_mgr) {
     SizeT row_count = 0;
+    Vector<u32> segment_ids;
     for (const auto &range : append_state_ptr->append_ranges_) {
         LOG_TRACE(Format("Commit, segment: {}, block: {} start offset: {}, count: {}",
                          range.segment_id_,
@@ -286,8 +328,111 @@ void TableCollectionEntry::CommitAppend(TableCollectionEntry *table_entry, Txn *
         SegmentEntry *segment_ptr = table_entry->segment_map_[range.segment_id_].get();
         SegmentEntry::CommitAppend(segment_ptr, txn_ptr, range.block_id_, range.start_offset_, range.row_count_);
         row_count += range.row_count_;
+        if (segment_ids.empty() || segment_ids.back() != range.segment_id_) {
+            segment_ids.push_back(range.segment_id_);
+        }
     }
     table_entry->row_count_ += row_count;
+    TableCollectionEntry::SubmitUpdateIndexes(table_entry, txn_ptr, Move(segment_ids), false, buffer_mgr);
+}
+
+void TableCollectionEntry::SubmitUpdateIndexes(TableCollectionEntry *table_entry,
+                                               Txn *txn_ptr,
+                                               Vector<u32> segment_ids,
+                                               bool is_import,
+                                               BufferManager *buffer_mgr) {
+    Storage *storage = InfinityContext::instance().storage();
+    if (storage == nullptr || storage->bg_processor() == nullptr) {
+        TableCollectionEntry::UpdateIndexes(table_entry, txn_ptr->TxnID(), txn_ptr->CommitTS(), segment_ids, is_import, buffer_mgr);
+        return;
+    }
+    storage->bg_processor()->Submit(
+        MakeShared<UpdateIndexTask>(table_entry, txn_ptr->TxnID(), txn_ptr->CommitTS(), Move(segment_ids), is_import, buffer_mgr));
+}
+
+// the centroids of IVF on an appended segment are trained once the segment has this many rows per centroid, which is the least
+// that k-means is run on without a warning by faiss. the rows are searched exactly before.
+static bool EnoughRowsToTrainIVF(const IndexBase *index_base, SizeT row_count) {
+    SizeT centroids_count = 0;
+    switch (index_base->index_type_) {
+        case IndexType::kIVFFlat: {
+            centroids_count = static_cast<const IndexIVFFlat *>(index_base)->centroids_count_;
+            break;
+        }
+        case IndexType::kIVFPQ: {
+            centroids_count = static_cast<const IndexIVFPQ *>(index_base)->centroids_count_;
+            break;
+        }
+        case IndexType::kIVFSQ8: {
+            centroids_count = static_cast<const IndexIVFSQ8 *>(index_base)->centroids_count_;
+            break;
+        }
+        default: {
+            Error<StorageException>("Not IVF index.");
+        }
+    }
+    if (centroids_count == 0) {
+        // as the default of the index file workers
+        centroids_count = (SizeT)std::sqrt(row_count);
+    }
+    return row_count > 0 && row_count >= centroids_count * IVF_MIN_POINTS_PER_CENTROID;
+}
+
+void TableCollectionEntry::UpdateIndexes(TableCollectionEntry *table_entry,
+                                         u64 txn_id,
+                                         TxnTimeStamp commit_ts,
+                                         const Vector<u32> &segment_ids,
+                                         bool is_import,
+                                         BufferManager *buffer_mgr) {
+    for (auto &[index_name, table_index_meta] : table_entry->index_meta_map_) {
+        BaseEntry *base_entry{nullptr};
+        if (auto status = TableIndexMeta::GetEntry(table_index_meta.get(), txn_id, commit_ts, base_entry); !status.ok()) {
+            // the index is dropped
+            continue;
+        }
+        auto *table_index_entry = static_cast<TableIndexEntry *>(base_entry);
+        for (const auto &[column_id, column_index_entry] : table_index_entry->column_index_map_) {
+            if (column_index_entry->entry_type_ != EntryType::kColumnIndex) {
+                continue;
+            }
+            IndexBase *index_base = column_index_entry->index_base_.get();
+            IndexType index_type = index_base->index_type_;
+            if (index_type != IndexType::kHnsw && index_type != IndexType::kIVFFlat && index_type != IndexType::kIVFPQ &&
+                index_type != IndexType::kIVFSQ8 && index_type != IndexType::kDiskAnn) {
+                continue;
+            }
+            for (u32 segment_id : segment_ids) {
+                SegmentEntry *segment_entry = TableCollectionEntry::GetSegmentByID(table_entry, segment_id);
+                SharedPtr<SegmentColumnIndexEntry> segment_column_index_entry;
+                {
+                    SharedLock<RWMutex> r_locker(column_index_entry->rw_locker_);
+                    if (auto iter = column_index_entry->index_by_segment.find(segment_id); iter != column_index_entry->index_by_segment.end()) {
+                        segment_column_index_entry = iter->second;
+                    }
+                }
+                if (segment_column_index_entry.get() != nullptr) {
+                    SegmentColumnIndexEntry::UpdateIndex(segment_column_index_entry.get(), commit_ts, segment_entry, buffer_mgr);
+                    continue;
+                }
+                if (!is_import) {
+                    if (index_type == IndexType::kDiskAnn) {
+                        continue;
+                    }
+                    if (index_type != IndexType::kHnsw && !EnoughRowsToTrainIVF(index_base, segment_entry->row_count_)) {
+                        continue;
+                    }
+                }
+                // build the index before it is visible to the knn scan
+                UniquePtr<CreateIndexParam> create_index_param =
+                    SegmentEntry::GetCreateIndexParam(segment_entry, index_base, table_entry->columns_[column_id].get());
+                segment_column_index_entry =
+                    SegmentColumnIndexEntry::NewIndexEntry(column_index_entry.get(), segment_id, commit_ts, buffer_mgr, create_index_param.get());
+                SegmentColumnIndexEntry::UpdateIndex(segment_column_index_entry.get(), commit_ts, segment_entry, buffer_mgr);
+                UniqueLock<RWMutex> w_locker(column_index_entry->rw_locker_);
+                column_index_entry->index_by_segment.emplace(segment_id, segment_column_index_entry);
+            }
+        }
+    }
 }
 
 void TableCollectionEntry::CommitCreateIndex(TableCollectionEntry *, HashMap<String, TxnIndexStore> &txn_indexes_store_) {
@@ -312,6 +457,7 @@ void TableCollectionEntry::RollbackAppend(TableCollectionEntry *, Txn *, void *)
 
 void TableCollectionEntry::CommitDelete(TableCollectionEntry *table_entry, Txn *txn_ptr, const DeleteState &delete_state) {
     SizeT row_count = 0;
+    Vector<SegmentEntry *> segment_entries;
     for (const auto &to_delete_seg_rows : delete_state.rows_) {
         u32 segment_id = to_delete_seg_rows.first;
         SegmentEntry *segment = TableCollectionEntry::GetSegmentByID(table_entry, segment_id);
@@ -321,8 +467,67 @@ void TableCollectionEntry::CommitDelete(TableCollectionEntry *table_entry, Txn *
         const HashMap<u16, Vector<RowID>> &block_row_hashmap = to_delete_seg_rows.second;
         SegmentEntry::CommitDelete(segment, txn_ptr, block_row_hashmap);
         row_count += block_row_hashmap.size();
+        segment_entries.push_back(segment);
     }
     table_entry->row_count_ += row_count;
+
+    // remove the deleted rows from the vector indexes in background once there are too many of them
+    Storage *storage = InfinityContext::instance().storage();
+    if (storage == nullptr || storage->bg_processor() == nullptr) {
+        // the wal is being replayed
+        return;
+    }
+    for (auto &[index_name, table_index_meta] : table_entry->index_meta_map_) {
+        BaseEntry *base_entry{nullptr};
+        if (auto status = TableIndexMeta::GetEntry(table_index_meta.get(), txn_ptr->TxnID(), txn_ptr->CommitTS(), base_entry); !status.ok()) {
+            continue;
+        }
+        auto *table_index_entry = static_cast<TableIndexEntry *>(base_entry);
+        for (const auto &[column_id, column_index_entry] : table_index_entry->column_index_map_) {
+            IndexType index_type = column_index_entry->index_base_->index_type_;
+            if (index_type != IndexType::kHnsw && index_type != IndexType::kIVFFlat && index_type != IndexType::kIVFPQ &&
+                index_type != IndexType::kIVFSQ8) {
+                continue;
+            }
+            SharedLock<RWMutex> r_locker(column_index_entry->rw_locker_);
+            for (SegmentEntry *segment_entry : segment_entries) {
+                auto iter = column_index_entry->index_by_segment.find(segment_entry->segment_id_);
+                if (iter != column_index_entry->index_by_segment.end() && SegmentColumnIndexEntry::NeedRepair(iter->second.get(), segment_entry)) {
+                    storage->bg_processor()->Submit(MakeShared<RepairIndexTask>(table_entry,
+                                                                                segment_entry->segment_id_,
+                                                                                txn_ptr->CommitTS(),
+                                                                                iter->second,
+                                                                                storage->buffer_manager()));
+                }
+            }
+        }
+    }
+}
+
+bool TableCollectionEntry::RepairIndex(TableCollectionEntry *table_entry,
+                                       u32 segment_id,
+                                       TxnTimeStamp commit_ts,
+                                       SegmentColumnIndexEntry *segment_column_index_entry,
+                                       BufferManager *buffer_mgr) {
+    // the rows deleted at or before `visible_ts` are invisible to the active txns and to the ones begin later
+    TxnTimeStamp visible_ts = InfinityContext::instance().storage()->txn_manager()->GetMinActiveBeginTS();
+    if (commit_ts > visible_ts) {
+        LOG_TRACE(Format("Segment: {} isn't repaired until the txns began before {} are done", segment_id, commit_ts));
+        return false;
+    }
+    SharedPtr<SegmentEntry> segment_entry;
+    {
+        SharedLock<RWMutex> r_locker(table_entry->rw_locker_);
+        if (auto iter = table_entry->segment_map_.find(segment_id); iter != table_entry->segment_map_.end()) {
+            segment_entry = iter->second;
+        }
+    }
+    if (segment_entry.get() == nullptr) {
+        LOG_TRACE(Format("Segment: {} is gone before its index is repaired", segment_id));
+        return true;
+    }
+    SegmentColumnIndexEntry::RepairIndex(segment_column_index_entry, commit_ts, visible_ts, segment_entry.get(), buffer_mgr);
+    return true;
 }
 
 UniquePtr<String> TableCollectionEntry::RollbackDelete(TableCollectionEntry *, Txn *, DeleteState &, BufferManager *) {
@@ -347,9 +552,13 @@ UniquePtr<String> TableCollectionEntry::ImportSegment(TableCollectionEntry *tabl
         block_entry->block_version_->created_.emplace_back(commit_ts, block_entry->row_count_);
     }
 
-    UniqueLock<RWMutex> rw_locker(table_entry->rw_locker_);
-    table_entry->row_count_ += row_count;
-    table_entry->segment_map_.emplace(segment->segment_id_, Move(segment));
+    u32 segment_id = segment->segment_id_;
+    {
+        UniqueLock<RWMutex> rw_locker(table_entry->rw_locker_);
+        table_entry->row_count_ += row_count;
+        table_entry->segment_map_.emplace(segment_id, Move(segment));
+    }
+    TableCollectionEntry::SubmitUpdateIndexes(table_entry, txn_ptr, {segment_id}, true, txn_ptr->GetBufferMgr());
     return nullptr;
 }
 
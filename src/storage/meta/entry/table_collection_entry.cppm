@@ -87,7 +87,7 @@ public:
 
     static UniquePtr<String> Delete(TableCollectionEntry *table_entry, Txn *txn_ptr, DeleteState &delete_state);
 
-    static void CommitAppend(TableCollectionEntry *table_entry, Txn *txn_ptr, const AppendState *append_state_ptr);
+    static void CommitAppend(TableCollectionEntry *table_entry, Txn *txn_ptr, const AppendState *append_state_ptr, BufferManager *buffer_mgr);
 
     static void CommitCreateIndex(TableCollectionEntry *table_entry, HashMap<String, TxnIndexStore> &txn_indexes_store_);
 
@@ -99,6 +99,29 @@ public:
 
     static UniquePtr<String> ImportSegment(TableCollectionEntry *table_entry, Txn *txn_ptr, SharedPtr<SegmentEntry> segment);
 
+    // insert the rows committed at `commit_ts` into the indexes of `segment_ids`. a segment without an index gets a new one, except
+    // for an appended segment with too few rows to train the centroids of IVF, and for DiskAnn on appended segments.
+    static void UpdateIndexes(TableCollectionEntry *table_entry,
+                              u64 txn_id,
+                              TxnTimeStamp commit_ts,
+                              const Vector<u32> &segment_ids,
+                              bool is_import,
+                              BufferManager *buffer_mgr);
+
+    // update the indexes by `UpdateIndexes` in background, so that the commit doesn't wait for the insertion or the training.
+    // the knn scan searches the rows not in the index yet exactly. the indexes are updated at once during the wal replay.
+    static void
+    SubmitUpdateIndexes(TableCollectionEntry *table_entry, Txn *txn_ptr, Vector<u32> segment_ids, bool is_import, BufferManager *buffer_mgr);
+
+    // repair `segment_column_index_entry` by the rows deleted at or before `commit_ts`. the segment is resolved by its id when the
+    // repair runs, and it is skipped if the segment is gone. it returns false without repairing while a txn that began before
+    // `commit_ts` is active, since the deleted rows are still visible to it.
+    static bool RepairIndex(TableCollectionEntry *table_entry,
+                            u32 segment_id,
+                            TxnTimeStamp commit_ts,
+                            SegmentColumnIndexEntry *segment_column_index_entry,
+                            BufferManager *buffer_mgr);
+
     static inline u32 GetNextSegmentID(TableCollectionEntry *table_entry) { return table_entry->next_segment_id_++; }
 
     static inline u32 GetMaxSegmentID(const TableCollectionEntry *table_entry) { return table_entry->next_segment_id_; }
@@ -106,6 +106,22 @@ void TableIndexEntry::CommitCreateIndex(TableIndexEntry *table_index_entry, Shar
     table_index_entry->irs_index_entry_ = irs_index_entry;
 }
 
+void TableIndexEntry::Cleanup(TableIndexEntry *table_index_entry) {
+    Vector<SharedPtr<SegmentColumnIndexEntry>> segment_column_index_entries;
+    {
+        SharedLock<RWMutex> lck(table_index_entry->rw_locker_);
+        for (const auto &[column_id, column_index_entry] : table_index_entry->column_index_map_) {
+            SharedLock<RWMutex> column_lck(column_index_entry->rw_locker_);
+            for (const auto &[segment_id, segment_column_index_entry] : column_index_entry->index_by_segment) {
+                segment_column_index_entries.push_back(segment_column_index_entry);
+            }
+        }
+    }
+    for (const auto &segment_column_index_entry : segment_column_index_entries) {
+        SegmentColumnIndexEntry::Cleanup(segment_column_index_entry.get());
+    }
+}
+
 Json TableIndexEntry::Serialize(TableIndexEntry *table_index_entry, TxnTimeStamp max_commit_ts) {
     Json json;
 
@@ -50,6 +50,9 @@ public:
     static void CommitCreateIndex(TableIndexEntry *table_index_entry, u64 column_id, u32 segment_id, SharedPtr<SegmentColumnIndexEntry> index_entry);
     static void CommitCreateIndex(TableIndexEntry *table_index_entry, SharedPtr<IrsIndexEntry> irs_index_entry);
 
+    // remove the files of the segment indexes when the entry is dropped and no txn sees it any more
+    static void Cleanup(TableIndexEntry *table_index_entry);
+
     static Json Serialize(TableIndexEntry *table_index_entry, TxnTimeStamp max_commit_ts);
 
     static UniquePtr<TableIndexEntry>
@@ -33,6 +33,10 @@ import status;
 import iresearch_datastore;
 import table_index_entry;
 import base_meta;
+import infinity_context;
+import storage;
+import backgroud_process;
+import bg_task;
 
 module table_index_meta;
 
@@ -335,4 +339,39 @@ void TableIndexMeta::MergeFrom(TableIndexMeta &other) {
     MergeLists(this->entry_list_, other.entry_list_);
 }
 
+void TableIndexMeta::SubmitCleanup(TableIndexMeta *table_index_meta, TxnTimeStamp commit_ts) {
+    Storage *storage = InfinityContext::instance().storage();
+    if (storage == nullptr || storage->bg_processor() == nullptr) {
+        // the wal is being replayed
+        return;
+    }
+    storage->bg_processor()->Submit(MakeShared<CleanupIndexTask>(table_index_meta, commit_ts));
+}
+
+bool TableIndexMeta::CleanupDroppedEntry(TableIndexMeta *table_index_meta, TxnTimeStamp commit_ts) {
+    // the txns began after `commit_ts` don't see the dropped entry
+    if (commit_ts > InfinityContext::instance().storage()->txn_manager()->GetMinActiveBeginTS()) {
+        LOG_TRACE(Format("Index: {} isn't cleaned up until the txns began before {} are done", *table_index_meta->index_name_, commit_ts));
+        return false;
+    }
+    TableIndexEntry *dropped_entry{nullptr};
+    {
+        SharedLock<RWMutex> r_locker(table_index_meta->rw_locker_);
+        for (auto iter = table_index_meta->entry_list_.begin(); iter != table_index_meta->entry_list_.end(); ++iter) {
+            if (!(*iter)->deleted_ || (*iter)->commit_ts_ != commit_ts) {
+                continue;
+            }
+            // the entry dropped is the one before the drop
+            if (++iter != table_index_meta->entry_list_.end() && (*iter)->entry_type_ == EntryType::kTableIndex && !(*iter)->deleted_) {
+                dropped_entry = static_cast<TableIndexEntry *>(iter->get());
+            }
+            break;
+        }
+    }
+    if (dropped_entry != nullptr) {
+        TableIndexEntry::Cleanup(dropped_entry);
+    }
+    return true;
+}
+
 } // namespace infinity
@@ -65,6 +65,13 @@ public:
 
     static void DeleteNewEntry(TableIndexMeta *meta, u64 txn_id, TxnManager *txn_mgr);
 
+    // remove the files of the entry dropped at `commit_ts` in background
+    static void SubmitCleanup(TableIndexMeta *table_index_meta, TxnTimeStamp commit_ts);
+
+    // remove the files of the entry dropped at `commit_ts`. return false if a txn began before `commit_ts` is still active,
+    // which may search the dropped entry.
+    static bool CleanupDroppedEntry(TableIndexMeta *table_index_meta, TxnTimeStamp commit_ts);
+
 
     void MergeFrom(TableIndexMeta &other);
 
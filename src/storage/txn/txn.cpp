@@ -507,7 +507,7 @@ Status Txn::GetViews(const String &, Vector<ViewDetail> &output_view_array) {
     return {ErrorCode::kNotImplemented, "Not Implemented"};
 }
 
-void Txn::Begin() { txn_context_.BeginCommit(txn_mgr_->GetTimestamp()); }
+void Txn::Begin() { txn_context_.BeginCommit(txn_mgr_->GetBeginTimestamp()); }
 
 TxnTimeStamp Txn::Commit() {
     TxnTimeStamp commit_ts = txn_mgr_->GetTimestamp(true);
@@ -568,6 +568,10 @@ void Txn::CommitBottom() {
     //  Commit indexes in catalog
     for (const auto &[index_name, table_index_entry] : txn_indexes_) {
         table_index_entry->Commit(commit_ts);
+        if (table_index_entry->deleted_) {
+            // the files of the dropped index are removed once the txns that may still search it are done
+            TableIndexMeta::SubmitCleanup(table_index_entry->table_index_meta_, commit_ts);
+        }
     }
     LOG_TRACE(Format("Txn: {} is committed.", txn_id_));
 
@@ -75,6 +75,18 @@ TxnTimeStamp TxnManager::GetTimestamp(bool prepare_wal) {
     return ts;
 }
 
+TxnTimeStamp TxnManager::GetBeginTimestamp() {
+    LockGuard<Mutex> guard(mutex_);
+    TxnTimeStamp ts = txn_ts_++;
+    active_begin_ts_.insert(ts);
+    return ts;
+}
+
+TxnTimeStamp TxnManager::GetMinActiveBeginTS() {
+    LockGuard<Mutex> guard(mutex_);
+    return active_begin_ts_.empty() ? txn_ts_ : *active_begin_ts_.begin();
+}
+
 void TxnManager::Invalidate(TxnTimeStamp commit_ts) {
     // Check if the is_running_ is true
     if (is_running_.load() == false) {
@@ -137,6 +149,10 @@ bool TxnManager::Stopped() { return !is_running_.load(); }
 
 TxnTimeStamp TxnManager::CommitTxn(Txn* txn) {
     TxnTimeStamp txn_ts = txn->Commit();
+    {
+        LockGuard<Mutex> guard(mutex_);
+        active_begin_ts_.erase(txn->BeginTS());
+    }
     rw_locker_.lock();
     txn_map_.erase(txn->TxnID());
     rw_locker_.unlock();
@@ -145,6 +161,10 @@ TxnTimeStamp TxnManager::CommitTxn(Txn* txn) {
 
 void TxnManager::RollBackTxn(Txn* txn) {
     txn->Rollback();
+    {
+        LockGuard<Mutex> guard(mutex_);
+        active_begin_ts_.erase(txn->BeginTS());
+    }
     rw_locker_.lock();
     txn_map_.erase(txn->TxnID());
     rw_locker_.unlock();
@@ -54,6 +54,12 @@ public:
 
     TxnTimeStamp GetTimestamp(bool prepare_wal = false);
 
+    // the begin ts of a txn, which stays active until the txn is committed or rolled back
+    TxnTimeStamp GetBeginTimestamp();
+
+    // the least begin ts of the active txns. the rows deleted at or before it are invisible to every txn from now on.
+    TxnTimeStamp GetMinActiveBeginTS();
+
     void Invalidate(TxnTimeStamp commit_ts);
 
     void PutWalEntry(SharedPtr<WalEntry> entry);
@@ -84,6 +90,7 @@ private:
     Mutex mutex_;
     TxnTimeStamp txn_ts_{};
     Map<TxnTimeStamp, SharedPtr<WalEntry>> priority_que_; // TODO: use C++23 std::flat_map?
+    Set<TxnTimeStamp> active_begin_ts_;
     // For stop the txn manager
     atomic_bool is_running_{false};
 };
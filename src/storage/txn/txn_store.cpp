@@ -169,7 +169,7 @@ void TxnTableStore::PrepareCommit() {
  * @brief Call for really commit the data to disk.
  */
 void TxnTableStore::Commit() const {
-    TableCollectionEntry::CommitAppend(table_entry_, txn_, append_state_.get());
+    TableCollectionEntry::CommitAppend(table_entry_, txn_, append_state_.get(), txn_->GetBufferMgr());
     TableCollectionEntry::CommitDelete(table_entry_, txn_, delete_state_);
 }
 
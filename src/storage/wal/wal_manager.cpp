@@ -754,6 +754,9 @@ void WalManager::WalCmdImportReplay(const WalCmdImport &cmd, u64 txn_id, i64 com
     table_entry->segment_map_.emplace(cmd.segment_id, Move(segment_entry));
     // ATTENTION: focusing on the segment id
     table_entry->next_segment_id_++;
+
+    // the txn manager is not started during replay, so the buffer manager is passed explicitly
+    TableCollectionEntry::UpdateIndexes(table_entry, txn_id, commit_ts, {cmd.segment_id}, true, storage_->buffer_manager());
 }
 void WalManager::WalCmdDeleteReplay(const WalCmdDelete &cmd, u64 txn_id, i64 commit_ts) {
     BaseEntry *base_db_entry{nullptr};
@@ -800,7 +803,7 @@ void WalManager::WalCmdAppendReplay(const WalCmdAppend &cmd, u64 txn_id, i64 com
 
     fake_txn->FakeCommit(commit_ts);
     TableCollectionEntry::Append(table_store->table_entry_, table_store->txn_, table_store.get(), storage_->buffer_manager());
-    TableCollectionEntry::CommitAppend(table_store->table_entry_, table_store->txn_, table_store->append_state_.get());
+    TableCollectionEntry::CommitAppend(table_store->table_entry_, table_store->txn_, table_store->append_state_.get(), storage_->buffer_manager());
 }
 
 } // namespace infinity
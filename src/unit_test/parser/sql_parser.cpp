@@ -139,7 +139,9 @@ TEST_F(SQLParserTest, good_test2) {
                            "                 primary key (a, b), "
                            "                 unique (c, d), "
                            "                 ae int not null, "
-                           "                 af embedding(int, 32)); ";
+                           "                 af embedding(int, 32), "
+                           "                 ag embedding(float16, 64), "
+                           "                 ah vector(bfloat16, 64)); ";
 
         parser->Parse(input_sql, result.get());
 
@@ -153,7 +155,7 @@ TEST_F(SQLParserTest, good_test2) {
             auto *create_table_info = (CreateTableInfo *)(create_statement->create_info_.get());
             EXPECT_EQ(create_table_info->schema_name_, String("default"));
             EXPECT_EQ(create_table_info->table_name_, String("t1"));
-            EXPECT_EQ(create_table_info->column_defs_.size(), 27);
+            EXPECT_EQ(create_table_info->column_defs_.size(), 29);
 
             u64 column_id = 0;
             {
@@ -457,6 +459,24 @@ TEST_F(SQLParserTest, good_test2) {
                 EXPECT_EQ(*column_def->column_type_, column_type);
                 EXPECT_EQ(column_def->constraints_.size(), 0);
             }
+
+            {
+                auto &column_def = create_table_info->column_defs_[column_id++];
+                EXPECT_EQ(column_def->name_, "ag");
+                SharedPtr<TypeInfo> type_info = EmbeddingInfo::Make(kElemFloat16, 64);
+                DataType column_type(LogicalType::kEmbedding, type_info);
+                EXPECT_EQ(*column_def->column_type_, column_type);
+                EXPECT_EQ(column_def->constraints_.size(), 0);
+            }
+
+            {
+                auto &column_def = create_table_info->column_defs_[column_id++];
+                EXPECT_EQ(column_def->name_, "ah");
+                SharedPtr<TypeInfo> type_info = EmbeddingInfo::Make(kElemBFloat16, 64);
+                DataType column_type(LogicalType::kEmbedding, type_info);
+                EXPECT_EQ(*column_def->column_type_, column_type);
+                EXPECT_EQ(column_def->constraints_.size(), 0);
+            }
         }
 
         result->Reset();
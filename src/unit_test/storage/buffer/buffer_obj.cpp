@@ -24,6 +24,7 @@ import buffer_obj;
 import data_file_worker;
 import global_resource_usage;
 import infinity_context;
+import local_file_system;
 
 using namespace infinity;
 
@@ -210,3 +211,30 @@ TEST_F(BufferObjTest, test1) {
     EXPECT_EQ(buf1->status(), BufferStatus::kUnloaded);
     EXPECT_EQ(buf1->type(), BufferType::kPersistent);
 }
+
+// the files of a dropped entry are removed, and the buffer is not written again
+TEST_F(BufferObjTest, cleanup_file) {
+    SizeT memory_limit = 1024;
+    auto temp_dir = MakeShared<String>("/tmp/infinity/spill");
+    auto base_dir = MakeShared<String>("/tmp/infinity/data");
+
+    BufferManager buffer_manager(memory_limit, base_dir, temp_dir);
+
+    auto file_dir = MakeShared<String>("/tmp/infinity/data/dir_cleanup");
+    auto file_name = MakeShared<String>("test_cleanup");
+    auto buf = buffer_manager.Allocate(MakeUnique<DataFileWorker>(file_dir, file_name, 1024));
+    {
+        auto handle = buf->Load();
+        __attribute__((unused)) auto data = handle.GetDataMut();
+    }
+    SaveBufferObj(buf);
+    LocalFileSystem fs;
+    String file_path = *file_dir + "/" + *file_name;
+    EXPECT_TRUE(fs.Exists(file_path));
+
+    buf->CleanupFile();
+    EXPECT_FALSE(fs.Exists(file_path));
+    EXPECT_EQ(buf->type(), BufferType::kPersistent);
+    SaveBufferObj(buf);
+    EXPECT_FALSE(fs.Exists(file_path));
+}
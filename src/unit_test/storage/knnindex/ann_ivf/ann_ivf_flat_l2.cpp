@@ -13,12 +13,20 @@
 // limitations under the License.
 
 #include "unit_test/base_test.h"
+#include <algorithm>
+#include <cstdint>
+#include <random>
 
 import infinity_exception;
 import stl;
 import parser;
 import ann_ivf_flat;
+import annivfflat_index_data;
 import bitmask;
+import index_base;
+import local_file_system;
+import file_system;
+import file_system_type;
 
 class AnnIVFFlatL2Test : public BaseTest {};
 
@@ -146,3 +154,105 @@ TEST_F(AnnIVFFlatL2Test, test1) {
         }
     }
 }
+
+TEST_F(AnnIVFFlatL2Test, multiple_queries) {
+    using namespace infinity;
+
+    u32 dimension = 8;
+    u32 base_embedding_count = 200;
+    u32 partition_num = 8;
+    UniquePtr<f32[]> base_embedding = MakeUnique<f32[]>(dimension * base_embedding_count);
+    std::default_random_engine rng;
+    std::uniform_real_distribution<f32> distrib_real;
+    for (u32 i = 0; i < dimension * base_embedding_count; ++i) {
+        base_embedding[i] = distrib_real(rng);
+    }
+    auto ann_ivf_l2_index = AnnIVFFlatL2<f32>::CreateIndex(dimension, base_embedding_count, base_embedding.get(), partition_num);
+
+    // the queries are the base vectors 0, 7 and 42, all the partitions are probed so every query finds itself first
+    Vector<u32> query_ids = {0, 7, 42};
+    UniquePtr<f32[]> query_embedding = MakeUnique<f32[]>(dimension * query_ids.size());
+    for (SizeT i = 0; i < query_ids.size(); ++i) {
+        std::copy_n(base_embedding.get() + query_ids[i] * dimension, dimension, query_embedding.get() + i * dimension);
+    }
+    {
+        u32 top_k = 5;
+        AnnIVFFlatL2<f32> ann_distance(query_embedding.get(), query_ids.size(), top_k, dimension, EmbeddingDataType::kElemFloat);
+        ann_distance.Begin();
+        ann_distance.Search(ann_ivf_l2_index.get(), 0, partition_num);
+        ann_distance.End();
+        for (SizeT i = 0; i < query_ids.size(); ++i) {
+            EXPECT_EQ(ann_distance.GetResultCount(i), top_k);
+            EXPECT_FLOAT_EQ(ann_distance.GetDistanceByIdx(i)[0], 0);
+            EXPECT_EQ(ann_distance.GetIDByIdx(i)[0].segment_offset_, query_ids[i]);
+        }
+    }
+    {
+        // fewer vectors than top_k, the result count of every query is the vector count
+        u32 top_k = 300;
+        AnnIVFFlatL2<f32> ann_distance(query_embedding.get(), query_ids.size(), top_k, dimension, EmbeddingDataType::kElemFloat);
+        ann_distance.Begin();
+        ann_distance.Search(ann_ivf_l2_index.get(), 0, partition_num);
+        ann_distance.EndWithoutSort();
+        for (SizeT i = 0; i < query_ids.size(); ++i) {
+            EXPECT_EQ(ann_distance.GetResultCount(i), base_embedding_count);
+        }
+    }
+}
+
+TEST_F(AnnIVFFlatL2Test, arena) {
+    using namespace infinity;
+
+    // 12 bytes per vector, so that the partitions need padding slots to begin at 64-byte boundaries
+    u32 dimension = 3;
+    u32 base_embedding_count = 1000;
+    u32 partition_num = 4;
+    Vector<f32> base_embedding(dimension * base_embedding_count);
+    std::default_random_engine rng;
+    std::uniform_real_distribution<f32> distrib_real;
+    for (auto &v : base_embedding) {
+        v = distrib_real(rng);
+    }
+    AnnIVFFlatIndexData<f32> index(MetricType::kMerticL2, dimension, partition_num);
+    index.train_centroids(dimension, base_embedding_count, base_embedding.data());
+    // the appends move the arena when a partition is full
+    for (u32 i = 0; i < base_embedding_count; i += 100) {
+        index.insert_data(dimension, 100, base_embedding.data() + i * dimension, i);
+    }
+    auto ExpectAllVectors = [&](const AnnIVFFlatIndexData<f32> &index_data) {
+        u32 total = 0;
+        for (u32 i = 0; i < partition_num; ++i) {
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(index_data.partition_vectors(i)) % 64, 0u);
+            for (u32 j = 0; j < index_data.partition_size(i); ++j) {
+                u32 id = index_data.partition_ids(i)[j];
+                const f32 *v = index_data.partition_vectors(i) + j * dimension;
+                EXPECT_TRUE(std::equal(v, v + dimension, base_embedding.data() + id * dimension));
+            }
+            // the free slots are zero, so the saved arena doesn't depend on the memory it was allocated from
+            u32 capacity = index_data.partition_offsets_[i + 1] - index_data.partition_offsets_[i];
+            for (u32 j = index_data.partition_size(i); j < capacity; ++j) {
+                EXPECT_EQ(index_data.partition_ids(i)[j], 0u);
+                const f32 *v = index_data.partition_vectors(i) + j * dimension;
+                EXPECT_TRUE(std::all_of(v, v + dimension, [](f32 x) { return x == 0.0f; }));
+            }
+            total += index_data.partition_size(i);
+        }
+        EXPECT_EQ(total, base_embedding_count);
+    };
+    ExpectAllVectors(index);
+
+    LocalFileSystem fs;
+    String file_path = String(tmp_data_path()) + "/ivfflat_arena.bin";
+    {
+        UniquePtr<FileHandler> file_handler = fs.OpenFile(file_path, FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG, FileLockType::kWriteLock);
+        index.SaveIndexInner(*file_handler);
+    }
+    {
+        UniquePtr<FileHandler> file_handler = fs.OpenFile(file_path, FileFlags::READ_FLAG, FileLockType::kReadLock);
+        auto loaded_index = AnnIVFFlatIndexData<f32>::LoadIndexInner(*file_handler);
+        EXPECT_EQ(loaded_index->data_num_, base_embedding_count);
+        EXPECT_EQ(loaded_index->partition_offsets_, index.partition_offsets_);
+        ExpectAllVectors(*loaded_index);
+    }
+    fs.DeleteFile(file_path);
+}
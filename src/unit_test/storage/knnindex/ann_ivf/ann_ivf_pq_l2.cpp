@@ -0,0 +1,114 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+#include <random>
+
+import infinity_exception;
+import stl;
+import parser;
+import index_base;
+import ann_ivf_pq;
+import annivfpq_index_data;
+import product_quantizer;
+import bitmask;
+
+class AnnIVFPQL2Test : public BaseTest {};
+
+TEST_F(AnnIVFPQL2Test, test1) {
+    using namespace infinity;
+
+    u32 dimension = 16;
+    u32 base_embedding_count = 1000;
+    u32 query_count = 100;
+    Vector<f32> base_embedding(dimension * base_embedding_count);
+    std::default_random_engine rng;
+    std::uniform_real_distribution<f32> distrib_real;
+    for (auto &v : base_embedding) {
+        v = distrib_real(rng);
+    }
+
+    AnnIVFPQIndexData<f32> index(MetricType::kMerticL2, dimension, 4, 8);
+    index.train_centroids(dimension, base_embedding_count, base_embedding.data());
+    index.insert_data(dimension, base_embedding_count, base_embedding.data());
+    EXPECT_EQ(index.data_num_, base_embedding_count);
+
+    // every base vector is its own nearest neighbor when all partitions are probed
+    auto bitmask = Bitmask::Make(1024);
+    {
+        AnnIVFPQL2<f32> ann_distance(base_embedding.data(), query_count, 1, dimension, EmbeddingDataType::kElemFloat);
+        ann_distance.Begin();
+        ann_distance.Search(&index, 0, 4, *bitmask);
+        ann_distance.End();
+
+        u32 correct = 0;
+        for (u32 i = 0; i < query_count; ++i) {
+            RowID *id_array = ann_distance.GetIDByIdx(i);
+            EXPECT_EQ(id_array[0].segment_id_, 0u);
+            correct += id_array[0].segment_offset_ == i;
+        }
+        EXPECT_GE(correct, query_count * 0.9);
+    }
+
+    bitmask->SetFalse(0);
+    {
+        AnnIVFPQL2<f32> ann_distance(base_embedding.data(), 1, 4, dimension, EmbeddingDataType::kElemFloat);
+        ann_distance.Begin();
+        ann_distance.Search(&index, 0, 4, *bitmask);
+        ann_distance.End();
+
+        RowID *id_array = ann_distance.GetIDByIdx(0);
+        for (u32 i = 0; i < 4; ++i) {
+            EXPECT_NE(id_array[i].segment_offset_, 0u);
+        }
+    }
+
+    EXPECT_EQ(index.remove_deleted(*bitmask), 1u);
+}
+
+TEST_F(AnnIVFPQL2Test, product_quantizer) {
+    using namespace infinity;
+
+    u32 dimension = 16;
+    u32 vector_count = 1000;
+    Vector<f32> vectors(dimension * vector_count);
+    std::default_random_engine rng;
+    std::uniform_real_distribution<f32> distrib_real;
+    for (auto &v : vectors) {
+        v = distrib_real(rng);
+    }
+
+    EXPECT_EQ(ProductQuantizer::DefaultSubspaceNum(dimension), 4u);
+    EXPECT_EQ(ProductQuantizer::DefaultSubspaceNum(18), 3u);
+
+    ProductQuantizer pq(dimension, 8);
+    pq.Train(vectors.data(), vector_count);
+    Vector<u8> codes(pq.subspace_num() * vector_count);
+    pq.Encode(vectors.data(), vector_count, codes.data());
+
+    // the distance looked up in the table of a query is the distance to the decoded vector
+    Vector<f32> table(pq.subspace_num() * ProductQuantizer::CENTROID_NUM);
+    Vector<f32> decoded(dimension);
+    for (u32 i = 0; i < 10; ++i) {
+        const f32 *query = vectors.data() + (i + 1) % vector_count * dimension;
+        const u8 *code = codes.data() + i * pq.subspace_num();
+        pq.MakeL2Table(query, table.data());
+        pq.Decode(code, decoded.data());
+        f32 distance = 0;
+        for (u32 j = 0; j < dimension; ++j) {
+            distance += (query[j] - decoded[j]) * (query[j] - decoded[j]);
+        }
+        EXPECT_NEAR(pq.TableDistance(table.data(), code), distance, 1e-4);
+    }
+}
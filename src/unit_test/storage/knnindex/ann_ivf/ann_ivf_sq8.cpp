@@ -0,0 +1,159 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+#include <cmath>
+#include <random>
+
+import infinity_exception;
+import stl;
+import parser;
+import index_base;
+import ann_ivf_sq8;
+import annivfsq8_index_data;
+import hnsw_simd_func;
+import bitmask;
+
+class AnnIVFSQ8Test : public BaseTest {
+protected:
+    static infinity::Vector<infinity::f32> RandomVectors(infinity::u32 dimension, infinity::u32 count) {
+        infinity::Vector<infinity::f32> vectors(dimension * count);
+        std::default_random_engine rng;
+        std::uniform_real_distribution<infinity::f32> distrib_real(-1.0f, 1.0f);
+        for (auto &v : vectors) {
+            v = distrib_real(rng);
+        }
+        return vectors;
+    }
+};
+
+TEST_F(AnnIVFSQ8Test, l2) {
+    using namespace infinity;
+
+    u32 dimension = 20;
+    u32 base_embedding_count = 1000;
+    u32 query_count = 100;
+    auto base_embedding = RandomVectors(dimension, base_embedding_count);
+
+    AnnIVFSQ8IndexData<f32> index(MetricType::kMerticL2, dimension, 4);
+    index.train_centroids(dimension, base_embedding_count, base_embedding.data());
+    index.insert_data(dimension, base_embedding_count, base_embedding.data());
+    EXPECT_EQ(index.data_num_, base_embedding_count);
+
+    // a decoded vector is within half a step of the original one in every dimension
+    Vector<u8> code(dimension);
+    Vector<f32> decoded(dimension);
+    for (u32 i = 0; i < query_count; ++i) {
+        index.Encode(base_embedding.data() + i * dimension, code.data());
+        index.Decode(code.data(), decoded.data());
+        for (u32 j = 0; j < dimension; ++j) {
+            EXPECT_LE(std::abs(decoded[j] - base_embedding[i * dimension + j]), index.scale_[j] * 0.5f + 1e-6f);
+        }
+    }
+
+    // every base vector is its own nearest neighbor when all partitions are probed
+    auto bitmask = Bitmask::Make(1024);
+    {
+        AnnIVFSQ8L2<f32> ann_distance(base_embedding.data(), query_count, 1, dimension, EmbeddingDataType::kElemFloat);
+        ann_distance.Begin();
+        ann_distance.Search(&index, 0, 4, *bitmask);
+        ann_distance.End();
+
+        u32 correct = 0;
+        for (u32 i = 0; i < query_count; ++i) {
+            RowID *id_array = ann_distance.GetIDByIdx(i);
+            EXPECT_EQ(id_array[0].segment_id_, 0u);
+            correct += id_array[0].segment_offset_ == i;
+        }
+        EXPECT_GE(correct, query_count * 0.95);
+    }
+
+    bitmask->SetFalse(0);
+    {
+        AnnIVFSQ8L2<f32> ann_distance(base_embedding.data(), 1, 4, dimension, EmbeddingDataType::kElemFloat);
+        ann_distance.Begin();
+        ann_distance.Search(&index, 0, 4, *bitmask);
+        ann_distance.End();
+
+        RowID *id_array = ann_distance.GetIDByIdx(0);
+        for (u32 i = 0; i < 4; ++i) {
+            EXPECT_NE(id_array[i].segment_offset_, 0u);
+        }
+    }
+
+    EXPECT_EQ(index.remove_deleted(*bitmask), 1u);
+}
+
+TEST_F(AnnIVFSQ8Test, inner_product) {
+    using namespace infinity;
+
+    u32 dimension = 20;
+    u32 base_embedding_count = 1000;
+    auto base_embedding = RandomVectors(dimension, base_embedding_count);
+
+    AnnIVFSQ8IndexData<f32> index(MetricType::kMerticInnerProduct, dimension, 4);
+    index.train_centroids(dimension, base_embedding_count, base_embedding.data());
+    index.insert_data(dimension, base_embedding_count, base_embedding.data());
+
+    // a vector is in the partition of the centroid of the largest inner product
+    for (u32 p = 0; p < 4; ++p) {
+        for (u32 id : index.ids_[p]) {
+            const f32 *v = base_embedding.data() + id * dimension;
+            for (u32 c = 0; c < 4; ++c) {
+                f32 ip_p = 0, ip_c = 0;
+                for (u32 j = 0; j < dimension; ++j) {
+                    ip_p += v[j] * index.centroids_[p * dimension + j];
+                    ip_c += v[j] * index.centroids_[c * dimension + j];
+                }
+                EXPECT_GE(ip_p, ip_c - 1e-4f);
+            }
+        }
+    }
+
+    // the inner product to the codes is the one to the decoded vector
+    const f32 *query = base_embedding.data();
+    auto bitmask = Bitmask::Make(1024);
+    AnnIVFSQ8IP<f32> ann_distance(query, 1, 1, dimension, EmbeddingDataType::kElemFloat);
+    ann_distance.Begin();
+    ann_distance.Search(&index, 0, 4, *bitmask);
+    ann_distance.End();
+    u32 id = ann_distance.GetIDByIdx(0)[0].segment_offset_;
+    Vector<u8> code(dimension);
+    Vector<f32> decoded(dimension);
+    index.Encode(base_embedding.data() + id * dimension, code.data());
+    index.Decode(code.data(), decoded.data());
+    f32 ip = 0;
+    for (u32 j = 0; j < dimension; ++j) {
+        ip += query[j] * decoded[j];
+    }
+    EXPECT_NEAR(ann_distance.GetDistanceByIdx(0)[0], ip, 1e-3);
+}
+
+TEST_F(AnnIVFSQ8Test, simd_kernels) {
+    using namespace infinity;
+
+    // the dimensions cover the simd part and the tail
+    for (u32 dimension : {7, 16, 37}) {
+        auto query = RandomVectors(dimension, 1);
+        Vector<f32> scale(dimension, 2.0f / 255);
+        Vector<u8> code(dimension);
+        for (u32 j = 0; j < dimension; ++j) {
+            code[j] = u8(j * 37 % 256);
+        }
+        EXPECT_NEAR(SQ8L2(query.data(), scale.data(), code.data(), dimension),
+                    SQ8L2BF(query.data(), scale.data(), code.data(), dimension),
+                    1e-3);
+        EXPECT_NEAR(SQ8IP(query.data(), code.data(), dimension), SQ8IPBF(query.data(), code.data(), dimension), 1e-1);
+    }
+}
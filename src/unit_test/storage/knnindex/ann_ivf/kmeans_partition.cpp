@@ -0,0 +1,126 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+#include <algorithm>
+#include <limits>
+#include <random>
+
+import stl;
+import index_base;
+import kmeans_partition;
+import annivfflat_index_data;
+
+class KMeansPartitionTest : public BaseTest {
+protected:
+    // `cluster_num` clusters of `count / cluster_num` vectors each, the center of cluster c is (c * 10, ..., c * 10)
+    static infinity::Vector<infinity::f32> ClusteredVectors(infinity::u32 dimension, infinity::u32 count, infinity::u32 cluster_num) {
+        infinity::Vector<infinity::f32> vectors(dimension * count);
+        std::default_random_engine rng;
+        std::uniform_real_distribution<infinity::f32> distrib_real(-1.0f, 1.0f);
+        for (infinity::u32 i = 0; i < count; ++i) {
+            for (infinity::u32 j = 0; j < dimension; ++j) {
+                vectors[i * dimension + j] = (i % cluster_num) * 10.0f + distrib_real(rng);
+            }
+        }
+        return vectors;
+    }
+
+    // the mean squared l2 distance of the vectors to the nearest centroids
+    static infinity::f32 Distortion(const infinity::Vector<infinity::f32> &vectors,
+                                    const infinity::Vector<infinity::f32> &centroids,
+                                    infinity::u32 dimension) {
+        infinity::u32 count = vectors.size() / dimension;
+        infinity::u32 centroid_num = centroids.size() / dimension;
+        infinity::f64 total = 0;
+        for (infinity::u32 i = 0; i < count; ++i) {
+            infinity::f32 min_distance = std::numeric_limits<infinity::f32>::max();
+            for (infinity::u32 c = 0; c < centroid_num; ++c) {
+                infinity::f32 distance = 0;
+                for (infinity::u32 j = 0; j < dimension; ++j) {
+                    infinity::f32 diff = vectors[i * dimension + j] - centroids[c * dimension + j];
+                    distance += diff * diff;
+                }
+                min_distance = std::min(min_distance, distance);
+            }
+            total += min_distance;
+        }
+        return total / count;
+    }
+};
+
+TEST_F(KMeansPartitionTest, reservoir) {
+    using namespace infinity;
+
+    u32 dimension = 2;
+    VectorReservoir reservoir(dimension, 100);
+    Vector<f32> vectors(dimension * 1000);
+    for (u32 i = 0; i < 1000; ++i) {
+        vectors[i * dimension] = i;
+        vectors[i * dimension + 1] = -f32(i);
+    }
+    // fewer vectors than the capacity are all kept in order
+    reservoir.Add(vectors.data(), 50);
+    EXPECT_EQ(reservoir.size(), 50u);
+    EXPECT_EQ(reservoir.data()[49 * dimension], 49.0f);
+
+    // the vectors added block by block are kept whole, and the later ones have the chance to be kept
+    for (u32 i = 50; i < 1000; i += 50) {
+        reservoir.Add(vectors.data() + i * dimension, 50);
+    }
+    EXPECT_EQ(reservoir.size(), 100u);
+    u32 later_num = 0;
+    for (u32 i = 0; i < reservoir.size(); ++i) {
+        EXPECT_EQ(reservoir.data()[i * dimension + 1], -reservoir.data()[i * dimension]);
+        later_num += reservoir.data()[i * dimension] >= 500;
+    }
+    EXPECT_GT(later_num, 20u);
+    EXPECT_LT(later_num, 80u);
+}
+
+TEST_F(KMeansPartitionTest, lloyd_and_mini_batch) {
+    using namespace infinity;
+
+    u32 dimension = 8;
+    u32 cluster_num = 4;
+    // more than one chunk of the parallel assignment on 4 threads
+    u32 count = 20000;
+    auto vectors = ClusteredVectors(dimension, count, cluster_num);
+    // a single centroid at the mean is about 125 per dimension away. the clusters found are about 0.33 away, and even two centroids
+    // stuck in one cluster are below a quarter of the single one.
+    Vector<f32> mean(dimension, 15.0f);
+    f32 max_distortion = Distortion(vectors, mean, dimension) * 0.25f;
+    ThreadPool pool(3);
+    for (u32 mini_batch_size : {0u, 256u}) {
+        Vector<f32> centroids(cluster_num * dimension);
+        k_means_partition_only_centroids<f32>(MetricType::kMerticL2,
+                                              dimension,
+                                              count,
+                                              vectors.data(),
+                                              centroids.data(),
+                                              cluster_num,
+                                              0,
+                                              32,
+                                              count / cluster_num,
+                                              mini_batch_size,
+                                              &pool,
+                                              4);
+        EXPECT_LT(Distortion(vectors, centroids, dimension), max_distortion) << "mini_batch_size " << mini_batch_size;
+    }
+
+    // the index data trains with the mini-batch
+    AnnIVFFlatIndexData<f32> index(MetricType::kMerticL2, dimension, cluster_num);
+    index.train_centroids(dimension, count, vectors.data(), 256, &pool, 4);
+    EXPECT_LT(Distortion(vectors, index.centroids_, dimension), max_distortion);
+}
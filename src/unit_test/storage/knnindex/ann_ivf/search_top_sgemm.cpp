@@ -0,0 +1,85 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+#include <algorithm>
+#include <random>
+
+import stl;
+import search_top_1_sgemm;
+import search_top_k_sgemm;
+
+class SearchTopSgemmTest : public BaseTest {
+protected:
+    static infinity::Vector<infinity::f32> RandomVectors(infinity::u32 dimension, infinity::u32 count, infinity::u32 seed) {
+        infinity::Vector<infinity::f32> vectors(dimension * count);
+        std::default_random_engine rng(seed);
+        std::uniform_real_distribution<infinity::f32> distrib_real(-1.0f, 1.0f);
+        for (auto &v : vectors) {
+            v = distrib_real(rng);
+        }
+        return vectors;
+    }
+
+    // the squared l2 distances of the query `i` of `x` to all vectors of `y`
+    static infinity::Vector<infinity::f32>
+    Distances(const infinity::Vector<infinity::f32> &x, infinity::u32 i, const infinity::Vector<infinity::f32> &y, infinity::u32 dimension) {
+        infinity::u32 ny = y.size() / dimension;
+        infinity::Vector<infinity::f32> distances(ny);
+        for (infinity::u32 j = 0; j < ny; ++j) {
+            infinity::f32 distance = 0;
+            for (infinity::u32 d = 0; d < dimension; ++d) {
+                infinity::f32 diff = x[i * dimension + d] - y[j * dimension + d];
+                distance += diff * diff;
+            }
+            distances[j] = distance;
+        }
+        return distances;
+    }
+};
+
+// the vectors are not a multiple of the simd width, and span several blocks of `y`
+TEST_F(SearchTopSgemmTest, top_1_and_top_k) {
+    using namespace infinity;
+
+    u32 dimension = 20;
+    u32 nx = 10;
+    u32 ny = 2500;
+    u32 k = 5;
+    auto x = RandomVectors(dimension, nx, 1);
+    auto y = RandomVectors(dimension, ny, 2);
+
+    Vector<u32> labels_1(nx);
+    Vector<f32> distances_1(nx);
+    search_top_1_with_sgemm(dimension, nx, x.data(), ny, y.data(), labels_1.data(), distances_1.data());
+
+    Vector<u32> labels_k(nx * k);
+    Vector<f32> distances_k(nx * k);
+    search_top_k_with_sgemm(k, dimension, nx, x.data(), ny, y.data(), labels_k.data(), distances_k.data());
+
+    for (u32 i = 0; i < nx; ++i) {
+        auto distances = Distances(x, i, y, dimension);
+        Vector<u32> order(ny);
+        for (u32 j = 0; j < ny; ++j) {
+            order[j] = j;
+        }
+        std::partial_sort(order.begin(), order.begin() + k, order.end(), [&](u32 a, u32 b) { return distances[a] < distances[b]; });
+        EXPECT_EQ(labels_1[i], order[0]);
+        EXPECT_NEAR(distances_1[i], distances[order[0]], 1e-4);
+        for (u32 r = 0; r < k; ++r) {
+            EXPECT_EQ(labels_k[i * k + r], order[r]);
+            EXPECT_NEAR(distances_k[i * k + r], distances[order[r]], 1e-4);
+        }
+    }
+}
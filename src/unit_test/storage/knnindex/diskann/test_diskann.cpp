@@ -0,0 +1,174 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+#include <algorithm>
+#include <bit>
+#include <random>
+
+import stl;
+import parser;
+import index_base;
+import diskann_index;
+import bitmask;
+import local_file_system;
+import file_system;
+import file_system_type;
+
+class DiskAnnTest : public BaseTest {
+protected:
+    static std::vector<float> RandomVectors(uint32_t dimension, uint32_t count) {
+        std::vector<float> vectors(dimension * count);
+        std::default_random_engine rng;
+        std::uniform_real_distribution<float> distrib_real;
+        for (auto &v : vectors) {
+            v = distrib_real(rng);
+        }
+        return vectors;
+    }
+
+    // the number of vectors which find themselves as the nearest one
+    static uint32_t
+    SelfHit(const infinity::DiskAnnIndex &index, const std::vector<float> &vectors, uint32_t count, const infinity::Bitmask &bitmask) {
+        uint32_t dimension = index.dimension();
+        uint32_t correct = 0;
+        for (uint32_t i = 0; i < count; ++i) {
+            auto result = index.KnnSearch(vectors.data() + i * dimension, 1, 50, 4, bitmask);
+            correct += !result.empty() && result[0].second == i;
+        }
+        return correct;
+    }
+};
+
+TEST_F(DiskAnnTest, build_and_search) {
+    using namespace infinity;
+
+    LocalFileSystem fs;
+    std::string file_dir = tmp_data_path();
+    uint32_t dimension = 16;
+    uint32_t count = 2000;
+    auto vectors = RandomVectors(dimension, count);
+
+    DiskAnnIndex index(MetricType::kMerticL2, dimension, 16, 50, 8, file_dir + "/diskann/l2.disk");
+    index.Build(vectors.data(), count);
+    EXPECT_EQ(index.data_num(), count);
+
+    Bitmask bitmask;
+    bitmask.Initialize(std::bit_ceil(count));
+    EXPECT_GE(SelfHit(index, vectors, count, bitmask), count * 0.95);
+
+    // the filtered out vectors are traversed but never returned
+    for (uint32_t i = 0; i < count; i += 2) {
+        bitmask.SetFalse(i);
+    }
+    for (uint32_t i = 0; i < 100; ++i) {
+        auto result = index.KnnSearch(vectors.data() + i * dimension, 10, 50, 4, bitmask);
+        EXPECT_EQ(result.size(), 10u);
+        for (const auto &[distance, id] : result) {
+            EXPECT_TRUE(bitmask.IsTrue(id));
+        }
+    }
+
+    // the codes in memory are saved, the graph is read from the same disk file after the load
+    std::string file_path = file_dir + "/diskann/l2.bin";
+    {
+        uint8_t file_flags = FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG;
+        std::unique_ptr<FileHandler> file_handler = fs.OpenFile(file_path, file_flags, FileLockType::kWriteLock);
+        index.SaveIndexInner(*file_handler);
+    }
+    {
+        std::unique_ptr<FileHandler> file_handler = fs.OpenFile(file_path, FileFlags::READ_FLAG, FileLockType::kReadLock);
+        DiskAnnIndex loaded_index(MetricType::kInvalid, 0, 0, 0, 0, file_dir + "/diskann/l2.disk");
+        loaded_index.ReadIndexInner(*file_handler);
+        EXPECT_EQ(loaded_index.data_num(), count);
+        Bitmask all_true;
+        all_true.Initialize(std::bit_ceil(count));
+        EXPECT_GE(SelfHit(loaded_index, vectors, count, all_true), count * 0.95);
+    }
+    fs.DeleteFile(file_path);
+    fs.DeleteFile(index.disk_path());
+}
+
+TEST_F(DiskAnnTest, node_larger_than_sector) {
+    using namespace infinity;
+
+    LocalFileSystem fs;
+    std::string file_dir = tmp_data_path();
+    // a node of 1100 f32 takes two sectors
+    uint32_t dimension = 1100;
+    uint32_t count = 300;
+    auto vectors = RandomVectors(dimension, count);
+
+    DiskAnnIndex index(MetricType::kMerticInnerProduct, dimension, 16, 50, 100, file_dir + "/diskann/ip.disk");
+    index.Build(vectors.data(), count);
+
+    // the inner product is negated. the candidate list is as large as the vectors, so the first result is the largest inner product
+    Bitmask bitmask;
+    bitmask.Initialize(std::bit_ceil(count));
+    const float *query = vectors.data();
+    auto result = index.KnnSearch(query, 5, count, 4, bitmask);
+    EXPECT_EQ(result.size(), 5u);
+    float max_ip = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+        float ip = 0;
+        for (uint32_t j = 0; j < dimension; ++j) {
+            ip += query[j] * vectors[i * dimension + j];
+        }
+        max_ip = std::max(max_ip, ip);
+    }
+    EXPECT_NEAR(-result[0].first, max_ip, max_ip * 1e-4);
+    fs.DeleteFile(index.disk_path());
+}
+
+TEST_F(DiskAnnTest, range_search_after_move) {
+    using namespace infinity;
+
+    LocalFileSystem fs;
+    std::string file_dir = tmp_data_path();
+    uint32_t dimension = 16;
+    uint32_t count = 2000;
+    auto vectors = RandomVectors(dimension, count);
+
+    DiskAnnIndex index(MetricType::kMerticL2, dimension, 16, 50, 8, file_dir + "/diskann/build/range.disk");
+    index.Build(vectors.data(), count);
+
+    // the graph is searched at its new path after the move
+    std::string disk_path = file_dir + "/diskann/moved/range.disk";
+    index.MoveDiskFile(disk_path);
+    EXPECT_EQ(index.disk_path(), disk_path);
+    EXPECT_TRUE(fs.Exists(disk_path));
+
+    // the radius covers more vectors than the first candidate list, so the list is enlarged until it reaches beyond the radius
+    Bitmask bitmask;
+    bitmask.Initialize(std::bit_ceil(count));
+    float radius = 1.0;
+    for (uint32_t i = 0; i < 10; ++i) {
+        const float *query = vectors.data() + i * dimension;
+        uint32_t expected = 0;
+        for (uint32_t j = 0; j < count; ++j) {
+            float dist = 0;
+            for (uint32_t k = 0; k < dimension; ++k) {
+                float diff = query[k] - vectors[j * dimension + k];
+                dist += diff * diff;
+            }
+            expected += dist <= radius;
+        }
+        auto result = index.KnnRangeSearch(query, radius, 8, 4, bitmask);
+        for (const auto &[distance, id] : result) {
+            EXPECT_LE(distance, radius);
+        }
+        EXPECT_GE(result.size(), expected * 0.9);
+    }
+    fs.DeleteFile(disk_path);
+}
@@ -0,0 +1,115 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+#include <random>
+
+import stl;
+import parser;
+import merge_knn;
+import knn_result_handler;
+import vector_distance;
+import bitmask;
+
+class MergeKnnTest : public BaseTest {
+protected:
+    static infinity::Vector<infinity::f32> RandomVectors(infinity::u32 dimension, infinity::u32 count) {
+        infinity::Vector<infinity::f32> vectors(dimension * count);
+        std::default_random_engine rng;
+        std::uniform_real_distribution<infinity::f32> distrib_real(-1.0f, 1.0f);
+        for (auto &v : vectors) {
+            v = distrib_real(rng);
+        }
+        return vectors;
+    }
+
+    // search a block by `distance_type` and by `dist_f`, the results are the same
+    template <template <typename, typename> typename C>
+    static void Compare(infinity::KnnDistanceType distance_type,
+                        infinity::f32 (*dist_f)(const infinity::f32 *, const infinity::f32 *, infinity::SizeT),
+                        infinity::u64 query_count,
+                        infinity::Bitmask &bitmask) {
+        using namespace infinity;
+        u32 dimension = 37;
+        u16 row_count = 1500;
+        u64 topk = 10;
+        auto queries = RandomVectors(dimension, query_count);
+        auto rows = RandomVectors(dimension, row_count);
+
+        MergeKnn<f32, C> by_type(query_count, topk);
+        by_type.Begin();
+        by_type.Search(queries.data(), rows.data(), dimension, distance_type, row_count, 0, 1, bitmask);
+        by_type.End();
+        MergeKnn<f32, C> by_func(query_count, topk);
+        by_func.Begin();
+        by_func.Search(queries.data(), rows.data(), dimension, dist_f, row_count, 0, 1, bitmask);
+        by_func.End();
+
+        EXPECT_EQ(by_type.total_count(), by_func.total_count());
+        for (u64 i = 0; i < query_count; ++i) {
+            for (u64 k = 0; k < topk; ++k) {
+                EXPECT_EQ(by_type.GetIDsByIdx(i)[k].segment_offset_, by_func.GetIDsByIdx(i)[k].segment_offset_);
+                EXPECT_NEAR(by_type.GetDistancesByIdx(i)[k], by_func.GetDistancesByIdx(i)[k], 1e-3);
+            }
+        }
+    }
+};
+
+TEST_F(MergeKnnTest, search_by_distance_type) {
+    using namespace infinity;
+
+    auto bitmask = Bitmask::Make(2048);
+    // a single query by the simd kernels, several queries by the blocked products
+    for (u64 query_count : {1, 5}) {
+        Compare<CompareMax>(KnnDistanceType::kL2, L2Distance<f32, f32, f32, SizeT>, query_count, *bitmask);
+        Compare<CompareMin>(KnnDistanceType::kInnerProduct, IPDistance<f32, f32, f32, SizeT>, query_count, *bitmask);
+        Compare<CompareMin>(KnnDistanceType::kCosine, CosineDistance<f32, f32, f32, SizeT>, query_count, *bitmask);
+    }
+
+    // the filtered rows are skipped
+    for (u32 i = 0; i < 1500; i += 3) {
+        bitmask->SetFalse(i);
+    }
+    Compare<CompareMax>(KnnDistanceType::kL2, L2Distance<f32, f32, f32, SizeT>, 5, *bitmask);
+}
+
+TEST_F(MergeKnnTest, reused_query_buffer) {
+    using namespace infinity;
+
+    u32 dimension = 16;
+    u64 query_count = 3;
+    u64 topk = 5;
+    u16 row_count = 100;
+    auto rows = RandomVectors(dimension, row_count);
+    auto bitmask = Bitmask::Make(128);
+    // the second block is searched with new queries in the same buffer
+    Vector<f32> queries(dimension * query_count, 0.5f);
+    MergeKnn<f32, CompareMax> by_type(query_count, topk);
+    MergeKnn<f32, CompareMax> by_func(query_count, topk);
+    by_type.Begin();
+    by_func.Begin();
+    for (u16 block_id = 0; block_id < 2; ++block_id) {
+        by_type.Search(queries.data(), rows.data(), dimension, KnnDistanceType::kL2, row_count, 0, block_id, *bitmask);
+        by_func.Search(queries.data(), rows.data(), dimension, L2Distance<f32, f32, f32, SizeT>, row_count, 0, block_id, *bitmask);
+        Fill(queries.begin(), queries.end(), -2.0f);
+    }
+    by_type.End();
+    by_func.End();
+    for (u64 i = 0; i < query_count; ++i) {
+        for (u64 k = 0; k < topk; ++k) {
+            EXPECT_EQ(by_type.GetIDsByIdx(i)[k], by_func.GetIDsByIdx(i)[k]);
+            EXPECT_NEAR(by_type.GetDistancesByIdx(i)[k], by_func.GetDistancesByIdx(i)[k], 1e-3);
+        }
+    }
+}
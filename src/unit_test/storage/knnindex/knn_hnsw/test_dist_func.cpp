@@ -13,13 +13,17 @@
 // limitations under the License.
 
 #include "unit_test/base_test.h"
+#include <cmath>
 #include <cstdint>
 #include <random>
+#include <vector>
 
 import dist_func_l2;
 import hnsw_simd_func;
 import lvq_store;
 import hnsw_common;
+import parser;
+import vector_distance;
 
 using namespace infinity;
 
@@ -43,6 +47,10 @@ float F32L2Test(const float *v1, const float *v2, size_t dim) {
 }
 
 TEST_F(DistFuncTest, test1) {
+    // the avx2 kernel is called directly, which the binary of the x86-64-v2 baseline only runs on the cpus of avx2
+    if (!SupportAVX2()) {
+        GTEST_SKIP();
+    }
     size_t dim = 32;
     size_t vec_n = 10000;
 
@@ -131,3 +139,188 @@ TEST_F(DistFuncTest, test2) {
         // EXPECT_NEAR(dist1, dist2, 1e-5);
     }
 }
+
+TEST_F(DistFuncTest, half) {
+    // a dimension not a multiple of the simd width, so that the tail is computed too
+    size_t dim = 37;
+    size_t vec_n = 1000;
+
+    std::default_random_engine rng;
+    std::uniform_real_distribution<float> dist(-1, 1);
+    std::vector<float> query(dim);
+    std::vector<float> f16_widened(dim);
+    std::vector<float> bf16_widened(dim);
+    std::vector<float16_t> f16_vec(dim);
+    std::vector<bfloat16_t> bf16_vec(dim);
+    for (size_t i = 0; i < vec_n; ++i) {
+        for (size_t j = 0; j < dim; ++j) {
+            query[j] = dist(rng);
+            float v = dist(rng);
+            f16_vec[j] = float16_t(v);
+            bf16_vec[j] = bfloat16_t(v);
+            f16_widened[j] = float(f16_vec[j]);
+            bf16_widened[j] = float(bf16_vec[j]);
+        }
+        // the half precision values are exact in f32, so only the order of the additions differs
+        EXPECT_NEAR(HalfL2(query.data(), f16_vec.data(), dim), F32L2Test(query.data(), f16_widened.data(), dim), 1e-4);
+        EXPECT_NEAR(HalfL2(query.data(), bf16_vec.data(), dim), F32L2Test(query.data(), bf16_widened.data(), dim), 1e-4);
+        EXPECT_NEAR(HalfL2(f16_vec.data(), f16_vec.data(), dim), 0, 1e-6);
+        float ip = 0;
+        for (size_t j = 0; j < dim; ++j) {
+            ip += query[j] * bf16_widened[j];
+        }
+        EXPECT_NEAR(HalfIP(query.data(), bf16_vec.data(), dim), ip, 1e-4);
+    }
+}
+
+TEST_F(DistFuncTest, int8) {
+    std::default_random_engine rng;
+    std::uniform_int_distribution<int> dist(-128, 127);
+    // dimensions around the simd widths, so that every tail is computed
+    for (size_t dim : {1, 15, 16, 31, 32, 33, 64, 100}) {
+        std::vector<int8_t> v1(dim);
+        std::vector<int8_t> v2(dim);
+        for (size_t i = 0; i < 100; ++i) {
+            int32_t l2 = 0;
+            for (size_t j = 0; j < dim; ++j) {
+                v1[j] = dist(rng);
+                v2[j] = dist(rng);
+                l2 += (int32_t(v1[j]) - v2[j]) * (int32_t(v1[j]) - v2[j]);
+            }
+            EXPECT_EQ(I8IP(v1.data(), v2.data(), dim), I8IPTest(v1.data(), v2.data(), dim));
+            EXPECT_EQ(I8L2(v1.data(), v2.data(), dim), l2);
+            EXPECT_EQ(I8L2BF(v1.data(), v2.data(), dim), l2);
+        }
+    }
+}
+
+TEST_F(DistFuncTest, codec) {
+    std::default_random_engine rng;
+    std::uniform_real_distribution<float> dist(-1, 1);
+    // dimensions around the simd widths, so that every tail is converted
+    for (size_t dim : {1, 7, 8, 9, 37, 64}) {
+        std::vector<float> vec(dim);
+        std::vector<float> min(dim);
+        std::vector<float> scale(dim);
+        for (size_t j = 0; j < dim; ++j) {
+            vec[j] = dist(rng);
+            min[j] = dist(rng) - 1;
+            // a zero scale codes the dimension as 0
+            scale[j] = j % 5 == 0 ? 0 : (dist(rng) + 1) / 255;
+        }
+        // (0.75 + 0.5) / 0.5 = 2.5 is rounded half away from zero by every kernel
+        vec[0] = 0.75f;
+        min[0] = -0.5f;
+        scale[0] = 0.5f;
+
+        std::vector<float16_t> f16_vec(dim);
+        std::vector<bfloat16_t> bf16_vec(dim);
+        std::vector<float> widened(dim);
+        F32ToHalf(vec.data(), f16_vec.data(), dim);
+        F32ToHalf(vec.data(), bf16_vec.data(), dim);
+        for (size_t j = 0; j < dim; ++j) {
+            EXPECT_EQ(f16_vec[j].raw, float16_t(vec[j]).raw);
+            EXPECT_EQ(bf16_vec[j].raw, bfloat16_t(vec[j]).raw);
+        }
+        HalfToF32(f16_vec.data(), widened.data(), dim);
+        for (size_t j = 0; j < dim; ++j) {
+            EXPECT_EQ(widened[j], float(f16_vec[j]));
+        }
+
+        std::vector<u8> code(dim);
+        std::vector<u8> code_bf(dim);
+        SQ8Encode(vec.data(), min.data(), scale.data(), code.data(), dim);
+        SQ8EncodeBF(vec.data(), min.data(), scale.data(), code_bf.data(), dim);
+        EXPECT_EQ(code, code_bf);
+        EXPECT_EQ(code[0], 3);
+        std::vector<float> decoded(dim);
+        SQ8Decode(code.data(), min.data(), scale.data(), decoded.data(), dim);
+        for (size_t j = 0; j < dim; ++j) {
+            EXPECT_NEAR(decoded[j], min[j] + code[j] * scale[j], 1e-5);
+        }
+    }
+}
+
+TEST_F(DistFuncTest, hamming) {
+    std::default_random_engine rng;
+    std::uniform_int_distribution<int> dist(0, 255);
+    // byte counts around the simd widths, so that every tail is computed
+    for (size_t byte_n : {1, 7, 8, 31, 32, 33, 64, 100}) {
+        std::vector<uint8_t> v1(byte_n);
+        std::vector<uint8_t> v2(byte_n);
+        for (size_t i = 0; i < 100; ++i) {
+            uint32_t res = 0;
+            for (size_t j = 0; j < byte_n; ++j) {
+                v1[j] = dist(rng);
+                v2[j] = dist(rng);
+                for (int b = 0; b < 8; ++b) {
+                    res += ((v1[j] ^ v2[j]) >> b) & 1;
+                }
+            }
+            EXPECT_EQ(Hamming(v1.data(), v2.data(), byte_n), res);
+            EXPECT_EQ(HammingBF(v1.data(), v2.data(), byte_n), res);
+            EXPECT_EQ(Hamming(v1.data(), v1.data(), byte_n), 0u);
+        }
+    }
+}
+
+TEST_F(DistFuncTest, dispatch) {
+    std::default_random_engine rng;
+    std::uniform_real_distribution<float> dist(-1, 1);
+    // the kernels chosen for this cpu take any dimension, the tails are computed by the scalar kernels
+    for (size_t dim : {1, 15, 16, 33, 48, 64, 100}) {
+        std::vector<float> v1(dim);
+        std::vector<float> v2(dim);
+        for (size_t j = 0; j < dim; ++j) {
+            v1[j] = dist(rng);
+            v2[j] = dist(rng);
+        }
+        EXPECT_NEAR(GetF32L2Func()(v1.data(), v2.data(), dim), F32L2BF(v1.data(), v2.data(), dim), 1e-4);
+        EXPECT_NEAR(GetF32IPFunc()(v1.data(), v2.data(), dim), F32IPBF(v1.data(), v2.data(), dim), 1e-4);
+    }
+    std::uniform_int_distribution<int> code_dist(-128, 127);
+    for (size_t dim : {1, 16, 32, 33, 64, 100, 128, 129}) {
+        std::vector<int8_t> c1(dim);
+        std::vector<int8_t> c2(dim);
+        for (size_t j = 0; j < dim; ++j) {
+            c1[j] = code_dist(rng);
+            c2[j] = code_dist(rng);
+        }
+        EXPECT_EQ(GetLVQI8IPFunc()(c1.data(), c2.data(), dim), I8IPTest(c1.data(), c2.data(), dim));
+        // two 4-bit codes in a byte
+        auto *u1 = reinterpret_cast<const uint8_t *>(c1.data());
+        auto *u2 = reinterpret_cast<const uint8_t *>(c2.data());
+        EXPECT_EQ(GetU4IPFunc()(u1, u2, dim * 2), U4IPBF(u1, u2, dim * 2));
+        EXPECT_EQ(GetU4IPFunc()(u1, u2, dim * 2 - 1), U4IPBF(u1, u2, dim * 2 - 1));
+    }
+}
+
+TEST_F(DistFuncTest, cosine) {
+    std::default_random_engine rng;
+    std::uniform_real_distribution<float> dist(-1, 1);
+    // dimensions around the simd width, so that every tail is computed
+    for (size_t dim : {1, 7, 8, 9, 16, 100}) {
+        std::vector<float> v1(dim);
+        std::vector<float> v2(dim);
+        for (size_t i = 0; i < 100; ++i) {
+            float ip = 0, norm1 = 0, norm2 = 0;
+            for (size_t j = 0; j < dim; ++j) {
+                v1[j] = dist(rng);
+                v2[j] = dist(rng);
+                ip += v1[j] * v2[j];
+                norm1 += v1[j] * v1[j];
+                norm2 += v2[j] * v2[j];
+            }
+            float cosine = ip / std::sqrt(norm1 * norm2);
+            L2Normalize(v1.data(), dim);
+            EXPECT_NEAR(L2NormSquare<float>(v1.data(), dim), 1.0f, 1e-5);
+            EXPECT_NEAR(CosineDistance<float>(v1.data(), v2.data(), dim), cosine, 1e-5);
+            // the normalized vectors are compared by inner product
+            L2Normalize(v2.data(), dim);
+            EXPECT_NEAR(IPDistance<float>(v1.data(), v2.data(), dim), cosine, 1e-5);
+        }
+    }
+    std::vector<float> zero(8, 0.0f);
+    L2Normalize(zero.data(), zero.size());
+    EXPECT_EQ(L2NormSquare<float>(zero.data(), zero.size()), 0.0f);
+}
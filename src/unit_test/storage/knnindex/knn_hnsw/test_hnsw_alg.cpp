@@ -0,0 +1,848 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <vector>
+
+import stl;
+import hnsw_alg;
+import hnsw_common;
+import plain_store;
+import lvq_store;
+import pq_store;
+import product_quantizer;
+import half_store;
+import parser;
+import dist_func_l2;
+import dist_func_hamming;
+import hnsw_mem_pool;
+import bitmask;
+import local_file_system;
+import file_system;
+import file_system_type;
+import compilation_config;
+
+using namespace infinity;
+
+class HnswAlgTest : public BaseTest {
+public:
+    using LabelT = uint64_t;
+
+    static constexpr size_t dim_ = 16;
+    static constexpr size_t element_size_ = 2000;
+    static constexpr size_t M_ = 16;
+    static constexpr size_t ef_construction_ = 200;
+
+    static constexpr size_t query_n_ = 100;
+
+    std::unique_ptr<float[]> data_;
+    std::unique_ptr<LabelT[]> labels_;
+    std::unique_ptr<float[]> queries_; // not in `data_`
+
+    void SetUp() override {
+        data_ = std::make_unique<float[]>(dim_ * element_size_);
+        std::default_random_engine rng;
+        std::uniform_real_distribution<float> distrib_real;
+        for (size_t i = 0; i < dim_ * element_size_; ++i) {
+            data_[i] = distrib_real(rng);
+        }
+        labels_ = std::make_unique<LabelT[]>(element_size_);
+        std::iota(labels_.get(), labels_.get() + element_size_, 0);
+        queries_ = std::make_unique<float[]>(dim_ * query_n_);
+        for (size_t i = 0; i < dim_ * query_n_; ++i) {
+            queries_[i] = distrib_real(rng);
+        }
+    }
+
+    static float L2(const float *v1, const float *v2) {
+        float res = 0;
+        for (size_t i = 0; i < dim_; ++i) {
+            res += (v1[i] - v2[i]) * (v1[i] - v2[i]);
+        }
+        return res;
+    }
+
+    // the bound of the change of the l2 distance of `v1` and `v2` if their difference changes by at most `max_error` in every
+    // coordinate: |(d + e)^2 - d^2| <= 2de + e^2, where e is the norm of the change
+    static float L2Bound(const float *v1, const float *v2, float max_error) {
+        float e = max_error * std::sqrt(float(dim_));
+        return 2 * std::sqrt(L2(v1, v2)) * e + e * e + 1e-4;
+    }
+
+    // the ratio of the 10 nearest neighbors of `query_n_` queries found by `hnsw_index`. `Dist(i, j)` is the exact distance of
+    // the i-th query and the j-th vector. a found vector is a nearest neighbor if it is not farther than the 10th nearest one, so
+    // that the ties of the integer distances are counted.
+    template <typename Hnsw, typename QueryType, typename DistFunc>
+    double Recall(const Hnsw &hnsw_index, const QueryType *queries, size_t query_dim, DistFunc Dist) {
+        const size_t k = 10;
+        size_t hit = 0;
+        std::vector<float> dists(element_size_);
+        for (size_t i = 0; i < query_n_; ++i) {
+            for (size_t j = 0; j < element_size_; ++j) {
+                dists[j] = Dist(i, j);
+            }
+            std::nth_element(dists.begin(), dists.begin() + k - 1, dists.end());
+            auto result = hnsw_index.KnnSearch(queries + i * query_dim, k, HnswSearchParams{.ef_ = 100});
+            for (; !result.empty(); result.pop()) {
+                hit += Dist(i, result.top().second) <= dists[k - 1];
+            }
+        }
+        return double(hit) / (query_n_ * k);
+    }
+
+    // search every inserted vector and count how many find themselves as the nearest one
+    template <typename Hnsw>
+    size_t SelfHit(const Hnsw &hnsw_index) {
+        size_t correct = 0;
+        for (size_t i = 0; i < element_size_; ++i) {
+            const float *query = data_.get() + i * dim_;
+            auto result = hnsw_index.KnnSearch(query, 1);
+            if (!result.empty() && result.top().second == (LabelT)i) {
+                ++correct;
+            }
+        }
+        return correct;
+    }
+};
+
+TEST_F(HnswAlgTest, parallel_insert) {
+    using Hnsw = KnnHnsw<float, LabelT, PlainStore<float>, PlainL2Dist<float>>;
+
+    for (size_t thread_n : {1, 4}) {
+        auto hnsw_index = Hnsw::Make(element_size_, dim_, M_, ef_construction_, {});
+        hnsw_index->Insert(data_.get(), labels_.get(), element_size_, thread_n);
+        hnsw_index->Check();
+
+        size_t correct = SelfHit(*hnsw_index);
+        EXPECT_GE(correct, element_size_ * 0.95);
+    }
+}
+
+TEST_F(HnswAlgTest, parallel_insert_lvq) {
+    using Hnsw = KnnHnsw<float, LabelT, LVQStore<float, int8_t, LVQL2Cache<float, int8_t>>, LVQL2Dist<float, int8_t>>;
+
+    auto hnsw_index = Hnsw::Make(element_size_, dim_, M_, ef_construction_, 0);
+    hnsw_index->Insert(data_.get(), labels_.get(), element_size_, 4);
+    hnsw_index->Check();
+
+    size_t correct = SelfHit(*hnsw_index);
+    EXPECT_GE(correct, element_size_ * 0.9);
+}
+
+TEST_F(HnswAlgTest, lvq4_store) {
+    using Dist4 = LVQL2Dist<float, U4>;
+    using Dist4x8 = LVQL2Dist<float, U4x8>;
+    using Hnsw4 = KnnHnsw<float, LabelT, Dist4::DataStore, Dist4>;
+    using Hnsw4x8 = KnnHnsw<float, LabelT, Dist4x8::DataStore, Dist4x8>;
+
+    // the distance of two codes is the l2 distance of the decompressed vectors, which differ from the vectors by at most half of
+    // their buckets in every coordinate
+    auto store4 = Dist4::DataStore::Make(element_size_, dim_, 0);
+    store4.AddVec(data_.get(), element_size_);
+    Dist4 dist4(dim_);
+    std::vector<float> vec1(dim_);
+    std::vector<float> vec2(dim_);
+    for (size_t i = 0; i + 1 < element_size_; i += 2) {
+        store4.Decompress(i, vec1.data());
+        store4.Decompress(i + 1, vec2.data());
+        float dist = dist4(store4.GetVec(i), store4.GetVec(i + 1), store4);
+        EXPECT_NEAR(dist, L2(vec1.data(), vec2.data()), 1e-3);
+        float max_error = (store4.GetVec(i).GetScalar().first + store4.GetVec(i + 1).GetScalar().first) / 2 + 1e-5;
+        EXPECT_LE(std::abs(dist - L2(data_.get() + i * dim_, data_.get() + (i + 1) * dim_)),
+                  L2Bound(data_.get() + i * dim_, data_.get() + (i + 1) * dim_, max_error));
+    }
+
+    // the candidates are re-ranked by the f32 distance to the vectors decompressed with their residuals
+    auto store4x8 = Dist4x8::DataStore::Make(element_size_, dim_, 0);
+    store4x8.AddVec(data_.get(), element_size_);
+    Dist4x8 dist4x8(dim_);
+    for (size_t i = 0; i < query_n_; ++i) {
+        const float *query = queries_.get() + i * dim_;
+        for (size_t j = 0; j < element_size_; j += 97) {
+            float max_error = store4x8.GetVec(j).GetResidualScalar().first / 2 + 1e-5;
+            EXPECT_LE(std::abs(dist4x8.Rerank(query, j, store4x8, vec1.data()) - L2(query, data_.get() + j * dim_)),
+                      L2Bound(query, data_.get() + j * dim_, max_error));
+        }
+    }
+
+    auto hnsw4 = Hnsw4::Make(element_size_, dim_, M_, ef_construction_, 0);
+    hnsw4->Insert(data_.get(), labels_.get(), element_size_, 4);
+    hnsw4->Check();
+    auto hnsw4x8 = Hnsw4x8::Make(element_size_, dim_, M_, ef_construction_, 0);
+    hnsw4x8->Insert(data_.get(), labels_.get(), element_size_, 4);
+    hnsw4x8->Check();
+    auto Dist = [&](size_t i, size_t j) { return L2(queries_.get() + i * dim_, data_.get() + j * dim_); };
+    double recall4 = Recall(*hnsw4, queries_.get(), dim_, Dist);
+    double recall4x8 = Recall(*hnsw4x8, queries_.get(), dim_, Dist);
+    EXPECT_GE(recall4, 0.7);
+    EXPECT_GE(recall4x8, 0.9);
+    EXPECT_GE(recall4x8, recall4);
+}
+
+TEST_F(HnswAlgTest, pq_store) {
+    using PQDist = PQL2Dist<float>;
+    using Hnsw = KnnHnsw<float, LabelT, PQDist::DataStore, PQDist>;
+
+    // 2 dimensions in a subspace
+    const size_t subspace_n = dim_ / 2;
+    auto store = PQDist::DataStore::Make(element_size_, dim_, subspace_n);
+    store.AddVec(data_.get(), element_size_);
+    PQDist pq_dist(dim_);
+
+    // the decoded vectors are much nearer to the vectors than the vectors to their mean
+    std::vector<float> mean(dim_);
+    for (size_t i = 0; i < element_size_ * dim_; ++i) {
+        mean[i % dim_] += data_[i] / element_size_;
+    }
+    std::vector<float> decoded(element_size_ * dim_);
+    double error = 0;
+    double variance = 0;
+    for (size_t i = 0; i < element_size_; ++i) {
+        store.pq().Decode(store.GetVec(i).codes_, decoded.data() + i * dim_);
+        error += L2(data_.get() + i * dim_, decoded.data() + i * dim_);
+        variance += L2(data_.get() + i * dim_, mean.data());
+    }
+    EXPECT_LE(error, variance * 0.05);
+
+    // the codebooks are trained again as the vectors added in batches double, so they aren't fixed on the first batch
+    auto batch_store = PQDist::DataStore::Make(element_size_, dim_, subspace_n);
+    for (size_t begin = 0, batch_n = ProductQuantizer::CENTROID_NUM; begin < element_size_; begin += batch_n) {
+        batch_n = std::min(batch_n, element_size_ - begin);
+        batch_store.AddVec(data_.get() + begin * dim_, batch_n);
+    }
+    double batch_error = 0;
+    for (size_t i = 0; i < element_size_; ++i) {
+        batch_store.pq().Decode(batch_store.GetVec(i).codes_, decoded.data() + i * dim_);
+        batch_error += L2(data_.get() + i * dim_, decoded.data() + i * dim_);
+    }
+    EXPECT_LE(batch_error, variance * 0.05);
+
+    for (size_t i = 0; i < element_size_; ++i) {
+        store.pq().Decode(store.GetVec(i).codes_, decoded.data() + i * dim_);
+    }
+
+    // a query looks up its l2 distances to the decoded vectors, two codes are compared by their decoded vectors
+    for (size_t i = 0; i < query_n_; ++i) {
+        auto query = store.MakeQuery(queries_.get() + i * dim_);
+        for (size_t j = 0; j < element_size_; j += 97) {
+            EXPECT_NEAR(pq_dist(query, store.GetVec(j), store), L2(queries_.get() + i * dim_, decoded.data() + j * dim_), 1e-4);
+            EXPECT_NEAR(pq_dist(store.GetVec(i), store.GetVec(j), store), L2(decoded.data() + i * dim_, decoded.data() + j * dim_), 1e-4);
+        }
+    }
+
+    auto hnsw_index = Hnsw::Make(element_size_, dim_, M_, ef_construction_, subspace_n);
+    hnsw_index->Insert(data_.get(), labels_.get(), element_size_, 4);
+    hnsw_index->Check();
+    auto Dist = [&](size_t i, size_t j) { return L2(queries_.get() + i * dim_, data_.get() + j * dim_); };
+    EXPECT_GE(Recall(*hnsw_index, queries_.get(), dim_, Dist), 0.7);
+}
+
+TEST_F(HnswAlgTest, fp16_store) {
+    using HalfDist = HalfL2Dist<float, float16_t>;
+    using Hnsw = KnnHnsw<float, LabelT, HalfDist::DataStore, HalfDist>;
+
+    // the values in [0, 1) keep 10 bits of their mantissas
+    auto store = HalfDist::DataStore::Make(element_size_, dim_);
+    store.AddVec(data_.get(), element_size_);
+    HalfDist half_dist(dim_);
+    const float max_error = std::ldexp(1.0f, -10);
+    for (size_t i = 0; i < element_size_; ++i) {
+        for (size_t j = 0; j < dim_; ++j) {
+            EXPECT_LE(std::abs(float(store.GetVec(i).vec_[j]) - data_[i * dim_ + j]), max_error);
+        }
+    }
+
+    // a query is compared in f32 with the widened values
+    for (size_t i = 0; i < query_n_; ++i) {
+        const float *query = queries_.get() + i * dim_;
+        for (size_t j = 0; j < element_size_; j += 97) {
+            EXPECT_LE(std::abs(half_dist(store.MakeQuery(query), store.GetVec(j), store) - L2(query, data_.get() + j * dim_)),
+                      L2Bound(query, data_.get() + j * dim_, max_error));
+        }
+    }
+
+    auto hnsw_index = Hnsw::Make(element_size_, dim_, M_, ef_construction_, {});
+    hnsw_index->Insert(data_.get(), labels_.get(), element_size_, 4);
+    hnsw_index->Check();
+    auto Dist = [&](size_t i, size_t j) { return L2(queries_.get() + i * dim_, data_.get() + j * dim_); };
+    EXPECT_GE(Recall(*hnsw_index, queries_.get(), dim_, Dist), 0.95);
+}
+
+TEST_F(HnswAlgTest, i8_store) {
+    using Hnsw = KnnHnsw<int8_t, LabelT, PlainStore<int8_t>, I8L2Dist>;
+
+    // the float vectors in [0, 1) are scaled to int8
+    auto Scale = [](const float *vecs, size_t n) {
+        std::vector<int8_t> res(n * dim_);
+        for (size_t i = 0; i < n * dim_; ++i) {
+            res[i] = int8_t(vecs[i] * 127);
+        }
+        return res;
+    };
+    std::vector<int8_t> data = Scale(data_.get(), element_size_);
+    std::vector<int8_t> queries = Scale(queries_.get(), query_n_);
+    // the distance is accumulated in integers, so it is the f32 distance of the widened vectors exactly
+    auto Dist = [&](size_t i, size_t j) {
+        float res = 0;
+        for (size_t d = 0; d < dim_; ++d) {
+            float diff = float(queries[i * dim_ + d]) - float(data[j * dim_ + d]);
+            res += diff * diff;
+        }
+        return res;
+    };
+    auto store = PlainStore<int8_t>::Make(element_size_, dim_);
+    store.AddVec(data.data(), element_size_);
+    I8L2Dist i8_dist(dim_);
+    for (size_t i = 0; i < query_n_; ++i) {
+        for (size_t j = 0; j < element_size_; j += 97) {
+            EXPECT_EQ(i8_dist(store.MakeQuery(queries.data() + i * dim_), store.GetVec(j), store), Dist(i, j));
+        }
+    }
+
+    auto hnsw_index = Hnsw::Make(element_size_, dim_, M_, ef_construction_, {});
+    hnsw_index->Insert(data.data(), labels_.get(), element_size_, 4);
+    hnsw_index->Check();
+    EXPECT_GE(Recall(*hnsw_index, queries.data(), dim_, Dist), 0.9);
+}
+
+TEST_F(HnswAlgTest, bit_store) {
+    using Hnsw = KnnHnsw<uint8_t, LabelT, PlainStore<uint8_t>, PlainHammingDist>;
+
+    // a coordinate is encoded in a byte whose t-th bit is set if the value is above (t + 1) / 9, so that the hamming distance
+    // is the l1 distance of the vectors quantized to 9 levels
+    const size_t byte_n = dim_;
+    auto Encode = [&](const float *vecs, size_t n) {
+        std::vector<uint8_t> res(n * byte_n);
+        for (size_t i = 0; i < n * dim_; ++i) {
+            for (int t = 0; t < 8; ++t) {
+                if (vecs[i] > (t + 1) / 9.0f) {
+                    res[i] |= 1 << t;
+                }
+            }
+        }
+        return res;
+    };
+    std::vector<uint8_t> bits = Encode(data_.get(), element_size_);
+    std::vector<uint8_t> queries = Encode(queries_.get(), query_n_);
+    auto Dist = [&](size_t i, size_t j) {
+        float res = 0;
+        for (size_t b = 0; b < byte_n; ++b) {
+            res += std::popcount(uint8_t(queries[i * byte_n + b] ^ bits[j * byte_n + b]));
+        }
+        return res;
+    };
+    auto store = PlainStore<uint8_t>::Make(element_size_, byte_n);
+    store.AddVec(bits.data(), element_size_);
+    PlainHammingDist hamming_dist(byte_n);
+    for (size_t i = 0; i < query_n_; ++i) {
+        for (size_t j = 0; j < element_size_; j += 97) {
+            EXPECT_EQ(hamming_dist(store.MakeQuery(queries.data() + i * byte_n), store.GetVec(j), store), Dist(i, j));
+        }
+    }
+
+    auto hnsw_index = Hnsw::Make(element_size_, byte_n, M_, ef_construction_, {});
+    hnsw_index->Insert(bits.data(), labels_.get(), element_size_, 4);
+    hnsw_index->Check();
+    EXPECT_GE(Recall(*hnsw_index, queries.data(), byte_n, Dist), 0.9);
+}
+
+TEST_F(HnswAlgTest, concurrent_search_params) {
+    using Hnsw = KnnHnsw<float, LabelT, PlainStore<float>, PlainL2Dist<float>>;
+
+    auto hnsw_index = Hnsw::Make(element_size_, dim_, M_, ef_construction_, {});
+    hnsw_index->Insert(data_.get(), labels_.get(), element_size_);
+
+    const size_t top_k = 10;
+    const std::vector<size_t> efs = {10, 50, 200};
+    auto Search = [&](size_t ef) {
+        std::vector<LabelT> res;
+        for (size_t i = 0; i < element_size_; ++i) {
+            auto result = hnsw_index->KnnSearch(data_.get() + i * dim_, top_k, HnswSearchParams{.ef_ = ef});
+            while (!result.empty()) {
+                res.push_back(result.top().second);
+                result.pop();
+            }
+        }
+        return res;
+    };
+    // sequential results of every ef are the expected results of the concurrent search
+    std::vector<std::vector<LabelT>> expected;
+    for (size_t ef : efs) {
+        expected.push_back(Search(ef));
+    }
+    std::vector<std::vector<LabelT>> results(efs.size());
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < efs.size(); ++i) {
+        threads.emplace_back([&, i] { results[i] = Search(efs[i]); });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (size_t i = 0; i < efs.size(); ++i) {
+        EXPECT_EQ(results[i], expected[i]);
+    }
+}
+
+TEST_F(HnswAlgTest, knn_search_batch) {
+    using Hnsw = KnnHnsw<float, LabelT, LVQStore<float, int8_t, LVQL2Cache<float, int8_t>>, LVQL2Dist<float, int8_t>>;
+
+    auto hnsw_index = Hnsw::Make(element_size_, dim_, M_, ef_construction_, 0);
+    hnsw_index->Insert(data_.get(), labels_.get(), element_size_);
+
+    const size_t top_k = 10;
+    Bitmask bitmask;
+    // more searching threads than the workers of the pool, the extra chunks wait in its queue
+    ThreadPool pool(2);
+    for (size_t thread_n : {1, 4}) {
+        std::vector<float> distances(element_size_ * top_k);
+        std::vector<LabelT> labels(element_size_ * top_k);
+        std::vector<size_t> result_ns(element_size_);
+        hnsw_index
+            ->KnnSearchBatch(data_.get(), element_size_, top_k, bitmask, distances.data(), labels.data(), result_ns.data(), {}, &pool, thread_n);
+        // the batch search gives the same results as the searches one by one
+        for (size_t i = 0; i < element_size_; ++i) {
+            auto result = hnsw_index->KnnSearch(data_.get() + i * dim_, top_k);
+            ASSERT_EQ(result_ns[i], result.size());
+            for (size_t j = result.size(); j > 0; --j) {
+                EXPECT_EQ(labels[i * top_k + j - 1], result.top().second);
+                EXPECT_EQ(distances[i * top_k + j - 1], result.top().first);
+                result.pop();
+            }
+        }
+    }
+}
+
+TEST_F(HnswAlgTest, knn_search_return_pair) {
+    // the distances of the 4-bit codes are refined by the residual codes, which changes the order of the candidates
+    using Hnsw = KnnHnsw<float, LabelT, LVQStore<float, U4x8, LVQL2Cache<float, int8_t>>, LVQL2Dist<float, U4x8>>;
+
+    auto hnsw_index = Hnsw::Make(element_size_, dim_, M_, ef_construction_, 0);
+    hnsw_index->Insert(data_.get(), labels_.get(), element_size_);
+
+    const size_t top_k = 10;
+    Bitmask bitmask;
+    for (size_t i = 0; i < element_size_; i += 10) {
+        const float *query = data_.get() + i * dim_;
+        auto [result_n, result] = hnsw_index->KnnSearchReturnPair(query, top_k, bitmask, HnswSearchParams{.ef_ = 50});
+        auto &[d_ptr, l_ptr] = result;
+        // the nearest k in ascending order of the refined distances, as the top k search
+        ASSERT_EQ(result_n, top_k);
+        EXPECT_TRUE(std::is_sorted(d_ptr.get(), d_ptr.get() + result_n));
+        auto expected = hnsw_index->KnnSearch(query, top_k, HnswSearchParams{.ef_ = 50});
+        for (size_t j = result_n; j > 0; --j) {
+            EXPECT_EQ(l_ptr[j - 1], expected.top().second);
+            EXPECT_EQ(d_ptr[j - 1], expected.top().first);
+            expected.pop();
+        }
+    }
+}
+
+TEST_F(HnswAlgTest, visited_table) {
+    VisitedTable visited(4);
+    // run over the epoch wrap around, every search must start with no vertex visited
+    for (size_t search_i = 0; search_i < 70000; ++search_i) {
+        visited.Reset(search_i < 100 ? 4 : 8);
+        for (size_t i = 0; i < 8 && (search_i >= 100 || i < 4); ++i) {
+            EXPECT_FALSE(visited.IsVisited(i));
+        }
+        visited.SetVisited(search_i % 4);
+        EXPECT_TRUE(visited.IsVisited(search_i % 4));
+    }
+}
+
+TEST_F(HnswAlgTest, linear_pool) {
+    // the capacity is not a multiple of the lanes, so the position search reads the padding beyond the candidates
+    constexpr size_t capacity = 37;
+    LinearPool<float, int32_t> pool;
+    std::default_random_engine rng;
+    std::uniform_int_distribution<int> distrib(0, 99);
+    for (size_t round = 0; round < 3; ++round) {
+        pool.Reset(capacity);
+        std::vector<std::pair<float, int32_t>> inserted;
+        for (int32_t id = 0; id < 200; ++id) {
+            auto dist = static_cast<float>(distrib(rng));
+            inserted.emplace_back(dist, id);
+            pool.Insert(dist, id);
+            // expand now and then, the expanded candidates are kept in order
+            if (id % 7 == 0 && pool.HasUnexpanded()) {
+                auto [expand_dist, expand_id] = pool.ExpandNext();
+                EXPECT_LE(expand_dist, pool.WorstDist());
+            }
+        }
+        // equal distances keep the order of the insertion
+        std::stable_sort(inserted.begin(), inserted.end(), [](const auto &a, const auto &b) { return a.first < b.first; });
+        ASSERT_EQ(pool.size(), capacity);
+        for (size_t i = 0; i < capacity; ++i) {
+            EXPECT_EQ(pool.Dist(i), inserted[i].first);
+            EXPECT_EQ(pool.Id(i), inserted[i].second);
+        }
+        // the rest are expanded in ascending order of distance
+        float last_dist = -1;
+        while (pool.HasUnexpanded()) {
+            float dist = pool.ExpandNext().first;
+            EXPECT_GE(dist, last_dist);
+            last_dist = dist;
+        }
+        EXPECT_FALSE(pool.Insert(inserted[capacity - 1].first, -1));
+
+        // the refined distances are sorted again, equal ones keep their order
+        std::vector<std::pair<float, int32_t>> refined;
+        for (size_t i = 0; i < capacity; ++i) {
+            auto dist = static_cast<float>(distrib(rng) % 10);
+            pool.SetDist(i, dist);
+            refined.emplace_back(dist, pool.Id(i));
+        }
+        pool.Sort();
+        std::stable_sort(refined.begin(), refined.end(), [](const auto &a, const auto &b) { return a.first < b.first; });
+        for (size_t i = 0; i < capacity; ++i) {
+            EXPECT_EQ(pool.Dist(i), refined[i].first);
+            EXPECT_EQ(pool.Id(i), refined[i].second);
+        }
+    }
+}
+
+TEST_F(HnswAlgTest, grow) {
+    using Hnsw = KnnHnsw<float, LabelT, LVQStore<float, int8_t, LVQL2Cache<float, int8_t>>, LVQL2Dist<float, int8_t>>;
+
+    const size_t half = element_size_ / 2;
+    auto hnsw_index = Hnsw::Make(half, dim_, M_, ef_construction_, 0);
+    hnsw_index->Insert(data_.get(), labels_.get(), half, 4);
+    EXPECT_EQ(hnsw_index->GetMaxVertexNum(), half);
+
+    hnsw_index->Grow(element_size_);
+    EXPECT_EQ(hnsw_index->GetVertexNum(), half);
+    EXPECT_EQ(hnsw_index->GetMaxVertexNum(), element_size_);
+    hnsw_index->Insert(data_.get() + half * dim_, labels_.get() + half, element_size_ - half, 4);
+    hnsw_index->Check();
+
+    size_t correct = SelfHit(*hnsw_index);
+    EXPECT_GE(correct, element_size_ * 0.9);
+}
+
+TEST_F(HnswAlgTest, repair_deleted) {
+    using Hnsw = KnnHnsw<float, LabelT, PlainStore<float>, PlainL2Dist<float>>;
+
+    auto hnsw_index = Hnsw::Make(element_size_, dim_, M_, ef_construction_, {});
+    hnsw_index->Insert(data_.get(), labels_.get(), element_size_);
+
+    Bitmask bitmask;
+    bitmask.Initialize(std::bit_ceil(element_size_));
+    for (size_t i = 0; i < element_size_; i += 3) {
+        bitmask.SetFalse(i);
+    }
+    EXPECT_GT(hnsw_index->RepairDeleted(bitmask), 0u);
+    hnsw_index->Check();
+    // no deleted vertex is reachable from an alive one
+    EXPECT_EQ(hnsw_index->RepairDeleted(bitmask), 0u);
+
+    size_t correct = 0;
+    size_t alive_n = 0;
+    for (size_t i = 0; i < element_size_; ++i) {
+        if (!bitmask.IsTrue(i)) {
+            continue;
+        }
+        ++alive_n;
+        auto result = hnsw_index->KnnSearch(data_.get() + i * dim_, 1, bitmask);
+        if (!result.empty() && result.top().second == (LabelT)i) {
+            ++correct;
+        }
+    }
+    EXPECT_GE(correct, alive_n * 0.95);
+}
+
+TEST_F(HnswAlgTest, mmap_load) {
+    using Hnsw = KnnHnsw<float, LabelT, LVQStore<float, int8_t, LVQL2Cache<float, int8_t>>, LVQL2Dist<float, int8_t>>;
+
+    LocalFileSystem fs;
+    std::string file_dir = tmp_data_path();
+    if (!fs.Exists(file_dir)) {
+        fs.CreateDirectory(file_dir);
+    }
+    std::string file_path = file_dir + "/hnsw_mmap.bin";
+    const size_t half = element_size_ / 2;
+    {
+        auto hnsw_index = Hnsw::Make(half, dim_, M_, ef_construction_, 0);
+        hnsw_index->Insert(data_.get(), labels_.get(), half);
+        uint8_t file_flags = FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG;
+        std::unique_ptr<FileHandler> file_handler = fs.OpenFile(file_path, file_flags, FileLockType::kWriteLock);
+        hnsw_index->Save(*file_handler);
+    }
+    {
+        std::unique_ptr<FileHandler> file_handler = fs.OpenFile(file_path, FileFlags::READ_FLAG, FileLockType::kReadLock);
+        auto hnsw_index = Hnsw::Load(std::make_unique<MmapFile>(*file_handler), 0);
+        file_handler->Close();
+        EXPECT_EQ(hnsw_index->GetVertexNum(), half);
+        hnsw_index->Check();
+
+        // the mapped index is copied out when it grows
+        hnsw_index->Grow(element_size_);
+        hnsw_index->Insert(data_.get() + half * dim_, labels_.get() + half, element_size_ - half);
+        hnsw_index->Unmap();
+        hnsw_index->Check();
+
+        size_t correct = SelfHit(*hnsw_index);
+        EXPECT_GE(correct, element_size_ * 0.9);
+
+        // the unmapped index can overwrite its file
+        uint8_t file_flags = FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG;
+        file_handler = fs.OpenFile(file_path, file_flags, FileLockType::kWriteLock);
+        hnsw_index->Save(*file_handler);
+    }
+    {
+        std::unique_ptr<FileHandler> file_handler = fs.OpenFile(file_path, FileFlags::READ_FLAG, FileLockType::kReadLock);
+        auto hnsw_index = Hnsw::Load(*file_handler, 0);
+        EXPECT_EQ(hnsw_index->GetVertexNum(), element_size_);
+        hnsw_index->Check();
+    }
+    fs.DeleteFile(file_path);
+}
+
+TEST_F(HnswAlgTest, save_while_search) {
+    using Hnsw = KnnHnsw<float, LabelT, LVQStore<float, int8_t, LVQL2Cache<float, int8_t>>, LVQL2Dist<float, int8_t>>;
+
+    LocalFileSystem fs;
+    std::string file_dir = tmp_data_path();
+    if (!fs.Exists(file_dir)) {
+        fs.CreateDirectory(file_dir);
+    }
+    std::string file_path = file_dir + "/hnsw_save_search.bin";
+    {
+        auto hnsw_index = Hnsw::Make(element_size_, dim_, M_, ef_construction_, 0);
+        hnsw_index->Insert(data_.get(), labels_.get(), element_size_);
+        uint8_t file_flags = FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG;
+        std::unique_ptr<FileHandler> file_handler = fs.OpenFile(file_path, file_flags, FileLockType::kWriteLock);
+        hnsw_index->Save(*file_handler);
+    }
+    std::unique_ptr<FileHandler> file_handler = fs.OpenFile(file_path, FileFlags::READ_FLAG, FileLockType::kReadLock);
+    auto hnsw_index = Hnsw::Load(std::make_unique<MmapFile>(*file_handler), 0);
+    file_handler->Close();
+    EXPECT_TRUE(hnsw_index->IsMapped());
+    // the writer copies the index out of the file under the exclusive lock, as `SegmentColumnIndexEntry::UpdateIndex` does
+    hnsw_index->Unmap();
+    EXPECT_FALSE(hnsw_index->IsMapped());
+
+    const size_t top_k = 10;
+    auto Search = [&](const Hnsw &index) {
+        std::vector<LabelT> res;
+        for (size_t i = 0; i < query_n_; ++i) {
+            auto result = index.KnnSearch(queries_.get() + i * dim_, top_k, HnswSearchParams{.ef_ = 100});
+            while (!result.empty()) {
+                res.push_back(result.top().second);
+                result.pop();
+            }
+        }
+        return res;
+    };
+    const std::vector<LabelT> expected = Search(*hnsw_index);
+
+    // the checkpoint overwrites the file with the shared lock only, while the searches go on
+    const size_t thread_n = 4;
+    std::atomic_bool saving = true;
+    std::vector<size_t> mismatch_n(thread_n, 0);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < thread_n; ++i) {
+        threads.emplace_back([&, i] {
+            do {
+                mismatch_n[i] += Search(*hnsw_index) != expected;
+            } while (saving);
+        });
+    }
+    for (int i = 0; i < 5; ++i) {
+        uint8_t file_flags = FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG;
+        std::unique_ptr<FileHandler> write_handler = fs.OpenFile(file_path, file_flags, FileLockType::kWriteLock);
+        hnsw_index->Save(*write_handler);
+        write_handler->Close();
+    }
+    saving = false;
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (size_t i = 0; i < thread_n; ++i) {
+        EXPECT_EQ(mismatch_n[i], 0u);
+    }
+
+    // the file saved during the searches is the same index
+    {
+        std::unique_ptr<FileHandler> read_handler = fs.OpenFile(file_path, FileFlags::READ_FLAG, FileLockType::kReadLock);
+        auto loaded_index = Hnsw::Load(std::make_unique<MmapFile>(*read_handler), 0);
+        read_handler->Close();
+        loaded_index->Check();
+        EXPECT_EQ(loaded_index->GetVertexNum(), element_size_);
+        EXPECT_EQ(Search(*loaded_index), expected);
+    }
+    fs.DeleteFile(file_path);
+}
+
+TEST_F(HnswAlgTest, reorder) {
+    using Hnsw = KnnHnsw<float, LabelT, PlainStore<float>, PlainL2Dist<float>>;
+
+    LocalFileSystem fs;
+    std::string file_dir = tmp_data_path();
+    if (!fs.Exists(file_dir)) {
+        fs.CreateDirectory(file_dir);
+    }
+    std::string file_path = file_dir + "/hnsw_reorder.bin";
+    const size_t half = element_size_ / 2;
+
+    Bitmask bitmask;
+    bitmask.Initialize(std::bit_ceil(element_size_));
+    for (size_t i = 0; i < element_size_; i += 3) {
+        bitmask.SetFalse(i);
+    }
+    // the bitmask refers to the insertion order after the reordering
+    auto FilteredHit = [&](const Hnsw &hnsw_index, size_t vertex_n) {
+        size_t correct = 0;
+        for (size_t i = 0; i < vertex_n; ++i) {
+            auto result = hnsw_index.KnnSearch(data_.get() + i * dim_, 1, bitmask);
+            EXPECT_FALSE(!result.empty() && !bitmask.IsTrue(result.top().second));
+            if (bitmask.IsTrue(i) && !result.empty() && result.top().second == (LabelT)i) {
+                ++correct;
+            }
+        }
+        return correct;
+    };
+    {
+        auto hnsw_index = Hnsw::Make(half, dim_, M_, ef_construction_, {});
+        hnsw_index->Insert(data_.get(), labels_.get(), half);
+        size_t correct = SelfHit(*hnsw_index);
+        size_t filtered_correct = FilteredHit(*hnsw_index, half);
+
+        hnsw_index->Reorder();
+        EXPECT_TRUE(hnsw_index->IsReordered());
+        hnsw_index->Check();
+        // the graph is the same, only the vertices are renumbered
+        EXPECT_EQ(SelfHit(*hnsw_index), correct);
+        EXPECT_EQ(FilteredHit(*hnsw_index, half), filtered_correct);
+
+        uint8_t file_flags = FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG;
+        std::unique_ptr<FileHandler> file_handler = fs.OpenFile(file_path, file_flags, FileLockType::kWriteLock);
+        hnsw_index->Save(*file_handler);
+    }
+    {
+        std::unique_ptr<FileHandler> file_handler = fs.OpenFile(file_path, FileFlags::READ_FLAG, FileLockType::kReadLock);
+        auto hnsw_index = Hnsw::Load(std::make_unique<MmapFile>(*file_handler), {});
+        file_handler->Close();
+        EXPECT_TRUE(hnsw_index->IsReordered());
+        hnsw_index->Check();
+
+        // the appended vertices keep the insertion order
+        hnsw_index->Grow(element_size_);
+        hnsw_index->Insert(data_.get() + half * dim_, labels_.get() + half, element_size_ - half);
+        hnsw_index->Check();
+        EXPECT_GE(SelfHit(*hnsw_index), element_size_ * 0.95);
+        EXPECT_GE(FilteredHit(*hnsw_index, element_size_), element_size_ * 2 / 3 * 0.95);
+
+        // reordered again with the appended vertices
+        hnsw_index->Reorder();
+        hnsw_index->Check();
+        EXPECT_GE(FilteredHit(*hnsw_index, element_size_), element_size_ * 2 / 3 * 0.95);
+    }
+    {
+        std::unique_ptr<FileHandler> file_handler = fs.OpenFile(file_path, FileFlags::READ_FLAG, FileLockType::kReadLock);
+        auto hnsw_index = Hnsw::Load(*file_handler, {});
+        EXPECT_TRUE(hnsw_index->IsReordered());
+        hnsw_index->Check();
+        EXPECT_GE(FilteredHit(*hnsw_index, half), half * 2 / 3 * 0.95);
+    }
+    fs.DeleteFile(file_path);
+}
+
+TEST_F(HnswAlgTest, expand_filtered) {
+    using Hnsw = KnnHnsw<float, LabelT, PlainStore<float>, PlainL2Dist<float>>;
+
+    auto hnsw_index = Hnsw::Make(element_size_, dim_, M_, ef_construction_, {});
+    hnsw_index->Insert(data_.get(), labels_.get(), element_size_);
+
+    // one in ten vertices pass the filter
+    Bitmask bitmask;
+    bitmask.Initialize(std::bit_ceil(element_size_));
+    for (size_t i = 0; i < element_size_; ++i) {
+        if (i % 10 != 0) {
+            bitmask.SetFalse(i);
+        }
+    }
+    auto FilteredHit = [&](const HnswSearchParams &params) {
+        size_t correct = 0;
+        for (size_t i = 0; i < element_size_; i += 10) {
+            auto result = hnsw_index->KnnSearch(data_.get() + i * dim_, 1, bitmask, params);
+            EXPECT_FALSE(!result.empty() && !bitmask.IsTrue(result.top().second));
+            if (!result.empty() && result.top().second == (LabelT)i) {
+                ++correct;
+            }
+        }
+        return correct;
+    };
+    const size_t passed_n = element_size_ / 10;
+    EXPECT_GE(FilteredHit(HnswSearchParams{.ef_ = 10}), passed_n * 0.9);
+    EXPECT_GE(FilteredHit(HnswSearchParams{.ef_ = 10, .expand_filtered_ = true}), passed_n * 0.9);
+}
+
+TEST_F(HnswAlgTest, range_search) {
+    using Hnsw = KnnHnsw<float, LabelT, PlainStore<float>, PlainL2Dist<float>>;
+
+    auto hnsw_index = Hnsw::Make(element_size_, dim_, M_, ef_construction_, {});
+    hnsw_index->Insert(data_.get(), labels_.get(), element_size_);
+
+    Bitmask bitmask;
+    bitmask.Initialize(std::bit_ceil(element_size_));
+    for (size_t i = 0; i < element_size_; i += 2) {
+        bitmask.SetFalse(i);
+    }
+    const size_t query_n = 100;
+    size_t expected_n = 0;
+    size_t found_n = 0;
+    for (size_t i = 0; i < query_n; ++i) {
+        const float *query = data_.get() + i * dim_;
+        std::vector<float> dists(element_size_);
+        for (size_t j = 0; j < element_size_; ++j) {
+            float dist = 0;
+            for (size_t d = 0; d < dim_; ++d) {
+                float diff = query[d] - data_[j * dim_ + d];
+                dist += diff * diff;
+            }
+            dists[j] = dist;
+        }
+        // about 50 vectors are within the radius, half of them pass the bitmask
+        std::vector<float> sorted_dists = dists;
+        std::nth_element(sorted_dists.begin(), sorted_dists.begin() + 50, sorted_dists.end());
+        float radius = sorted_dists[50];
+        for (size_t j = 0; j < element_size_; ++j) {
+            if (dists[j] <= radius && bitmask.IsTrue(j)) {
+                ++expected_n;
+            }
+        }
+
+        auto result = hnsw_index->KnnRangeSearch(query, radius, bitmask);
+        for (size_t j = 0; j < result.size(); ++j) {
+            const auto &[dist, label] = result[j];
+            EXPECT_LE(dist, radius);
+            EXPECT_TRUE(bitmask.IsTrue(label));
+            if (j > 0) {
+                EXPECT_LE(result[j - 1].first, dist);
+            }
+        }
+        found_n += result.size();
+    }
+    EXPECT_LE(found_n, expected_n);
+    EXPECT_GE(found_n, expected_n * 0.9);
+}
@@ -188,4 +188,38 @@ TEST_F(HnswLVQTest, test1) {
             CheckStore(lvq_store, data.get());
         }
     }
-}
\ No newline at end of file
+}
+
+TEST_F(HnswLVQTest, decompress_4bit) {
+    using LVQ4Store = LVQStore<float, U4, LVQL2Cache<float, int8_t>>;
+    using LVQ4x8Store = LVQStore<float, U4x8, LVQL2Cache<float, int8_t>>;
+
+    auto data = std::make_unique<float[]>(dim_ * vec_n_);
+    std::default_random_engine rng;
+    std::uniform_real_distribution<float> distrib_real(100, 200);
+    for (size_t i = 0; i < dim_ * vec_n_; ++i) {
+        data[i] = distrib_real(rng);
+    }
+
+    // the error of a code is at most half of the bucket, the residual codes shrink it by the 8-bit buckets
+    auto CheckDecompress = [&](auto &store, float max_error) {
+        store.Compress();
+        auto res = std::make_unique<float[]>(dim_);
+        for (size_t i = 0; i < store.cur_vec_num(); ++i) {
+            store.Decompress(i, res.get());
+            for (size_t j = 0; j < dim_; ++j) {
+                EXPECT_LE(std::abs(res[j] - data[i * dim_ + j]), max_error);
+            }
+        }
+    };
+    {
+        LVQ4Store lvq_store = LVQ4Store::Make(vec_n_, dim_, buffer_size_);
+        EXPECT_NE(lvq_store.AddVec(data.get(), vec_n_), LVQ4Store::ERR_IDX);
+        CheckDecompress(lvq_store, 100.0f / 15 / 2 + 1e-2);
+    }
+    {
+        LVQ4x8Store lvq_store = LVQ4x8Store::Make(vec_n_, dim_, buffer_size_);
+        EXPECT_NE(lvq_store.AddVec(data.get(), vec_n_), LVQ4x8Store::ERR_IDX);
+        CheckDecompress(lvq_store, 100.0f / 15 / 255 + 1e-2);
+    }
+}
@@ -31,6 +31,7 @@ import txn_manager;
 import txn;
 import base_entry;
 import status;
+import table_collection_entry;
 
 class DBTxnTest : public BaseTest {
     void SetUp() override {
@@ -503,3 +504,27 @@ TEST_F(DBTxnTest, test7) {
     // Txn3: Commit, OK
     txn_mgr->CommitTxn(new_txn3);
 }
+
+TEST_F(DBTxnTest, min_active_begin_ts) {
+    using namespace infinity;
+    TxnManager *txn_mgr = infinity::InfinityContext::instance().storage()->txn_manager();
+
+    // Txn1: the reader begins before the delete
+    Txn *reader_txn = txn_mgr->CreateTxn();
+    reader_txn->Begin();
+    EXPECT_LE(txn_mgr->GetMinActiveBeginTS(), reader_txn->BeginTS());
+
+    // Txn2: the delete commits after the reader began
+    Txn *delete_txn = txn_mgr->CreateTxn();
+    delete_txn->Begin();
+    TxnTimeStamp delete_ts = txn_mgr->CommitTxn(delete_txn);
+    EXPECT_GT(delete_ts, reader_txn->BeginTS());
+
+    // the rows deleted by txn2 are still visible to txn1, so the index isn't repaired by them
+    EXPECT_LT(txn_mgr->GetMinActiveBeginTS(), delete_ts);
+    EXPECT_FALSE(TableCollectionEntry::RepairIndex(nullptr, 0, delete_ts, nullptr, nullptr));
+
+    // no txn sees them after txn1 is done
+    txn_mgr->CommitTxn(reader_txn);
+    EXPECT_GT(txn_mgr->GetMinActiveBeginTS(), delete_ts);
+}
@@ -19,6 +19,7 @@
 #include <random>
 
 import hnsw_alg;
+import hnsw_common;
 import file_system;
 import file_system_type;
 import local_file_system;
@@ -72,11 +73,11 @@ int main() {
         // hnsw_index->Dump(std::cout);
         hnsw_index->Check();
 
-        hnsw_index->SetEf(10);
+        HnswSearchParams search_params{.ef_ = 10};
         int correct = 0;
         for (int i = 0; i < element_size; ++i) {
             const float *query = data.get() + i * dim;
-            RetHeap result = hnsw_index->KnnSearch(query, 1);
+            RetHeap result = hnsw_index->KnnSearch(query, 1, search_params);
             if (result.top().second == (LabelT)i) {
                 ++correct;
             }
@@ -94,14 +95,14 @@ int main() {
         std::unique_ptr<FileHandler> file_handler = fs.OpenFile(save_dir + "/test_hnsw.bin", file_flags, FileLockType::kReadLock);
 
         auto hnsw_index = Hnsw::Load(*file_handler, {});
-        hnsw_index->SetEf(10);
+        HnswSearchParams search_params{.ef_ = 10};
 
         // hnsw_index->Dump(std::cout);
         // hnsw_index->Check();
         int correct = 0;
         for (int i = 0; i < element_size; ++i) {
             const float *query = data.get() + i * dim;
-            std::priority_queue<std::pair<float, LabelT>> result = hnsw_index->KnnSearch(query, 1);
+            std::priority_queue<std::pair<float, LabelT>> result = hnsw_index->KnnSearch(query, 1, search_params);
             if (result.top().second == (LabelT)i) {
                 ++correct;
             }